@@ -52,6 +52,85 @@
 
 F_DRIVER * mdrv = NULL;  /* driver structure */
 
+#if F_SECTOR_CACHE_SIZE
+static char           gl_cache[F_SECTOR_CACHE_SIZE][F_SECTOR_SIZE]; /* cached FAT and directory sectors */
+static unsigned long  gl_cachesector[F_SECTOR_CACHE_SIZE];          /* sector number + 1, 0 if the line is empty */
+static unsigned long  gl_cacheage[F_SECTOR_CACHE_SIZE];             /* last access time of the line */
+static unsigned long  gl_cacheclock;
+
+
+/****************************************************************************
+ *
+ * _f_cachefind
+ *
+ * find a sector in the sector cache
+ *
+ * INPUTS
+ * sector - which physical sector
+ *
+ * RETURNS
+ * index of the cache line or -1 if the sector is not cached
+ *
+ ***************************************************************************/
+static int _f_cachefind ( unsigned long sector )
+{
+  int  a;
+
+  for ( a = 0 ; a < F_SECTOR_CACHE_SIZE ; a++ )
+  {
+    if ( gl_cachesector[a] == sector + 1 )
+    {
+      gl_cacheage[a] = ++gl_cacheclock;
+      return a;
+    }
+  }
+
+  return -1;
+} /* _f_cachefind */
+
+
+/****************************************************************************
+ *
+ * _f_cacheput
+ *
+ * store the sector in gl_sector into the least recently used cache line
+ *
+ * INPUTS
+ * sector - which physical sector
+ *
+ ***************************************************************************/
+static void _f_cacheput ( unsigned long sector )
+{
+  int  a;
+  int  lru = 0;
+
+  for ( a = 1 ; a < F_SECTOR_CACHE_SIZE ; a++ )
+  {
+    if ( gl_cacheage[a] < gl_cacheage[lru] )
+    {
+      lru = a;
+    }
+  }
+
+  psp_memcpy( gl_cache[lru], gl_sector, F_SECTOR_SIZE );
+  gl_cachesector[lru] = sector + 1;
+  gl_cacheage[lru] = ++gl_cacheclock;
+} /* _f_cacheput */
+
+
+/****************************************************************************
+ *
+ * _f_cacheinvalidate
+ *
+ * drop the cached sectors, it is called when a volume is mounted
+ *
+ ***************************************************************************/
+void _f_cacheinvalidate ( void )
+{
+  psp_memset( gl_cachesector, 0, sizeof( gl_cachesector ) );
+} /* _f_cacheinvalidate */
+#endif /* if F_SECTOR_CACHE_SIZE */
+
 
 /****************************************************************************
  *
@@ -145,6 +224,13 @@ unsigned char _f_writeglsector ( unsigned long sector )
       mdrv_ret = mdrv->writesector( mdrv, (unsigned char *)gl_sector, sector );
       if ( !mdrv_ret )
       {
+#if F_SECTOR_CACHE_SIZE
+        int  a = _f_cachefind( sector );
+        if ( a >= 0 )
+        {
+          psp_memcpy( gl_cache[a], gl_sector, F_SECTOR_SIZE ); /*write through*/
+        }
+#endif
         return F_NO_ERROR;
       }
 
@@ -170,12 +256,13 @@ unsigned char _f_writeglsector ( unsigned long sector )
  *
  * INPUTS
  * sector - which physical sector is read
+ * cache - the sector may be kept in the sector cache (FAT and directory)
  *
  * RETURNS
  * error code or zero if successful
  *
  ***************************************************************************/
-unsigned char _f_readglsector ( unsigned long sector )
+static unsigned char _f_readsector ( unsigned long sector, unsigned char cache )
 {
   unsigned char  retry;
   unsigned char  ret;
@@ -194,6 +281,20 @@ unsigned char _f_readglsector ( unsigned long sector )
     }
   }
 
+#if F_SECTOR_CACHE_SIZE
+  if ( cache )
+  {
+    int  a = _f_cachefind( sector );
+    if ( a >= 0 )
+    {
+      psp_memcpy( gl_sector, gl_cache[a], F_SECTOR_SIZE );
+      gl_volume.actsector = sector;
+      return F_NO_ERROR;
+    }
+  }
+#else
+  (void)cache;
+#endif
 
   for ( retry = 3 ; retry ; retry-- )
   {
@@ -202,6 +303,12 @@ unsigned char _f_readglsector ( unsigned long sector )
     if ( !mdrv_ret )
     {
       gl_volume.actsector = sector;
+#if F_SECTOR_CACHE_SIZE
+      if ( cache )
+      {
+        _f_cacheput( sector );
+      }
+#endif
       return F_NO_ERROR;
     }
 
@@ -214,5 +321,219 @@ unsigned char _f_readglsector ( unsigned long sector )
 
   gl_volume.actsector = (unsigned long)-1;
   return F_ERR_ONDRIVE;
+} /* _f_readsector */
+
+
+/****************************************************************************
+ *
+ * _f_readglsector
+ *
+ * read a FAT or directory sector into gl_sector through the sector cache
+ *
+ * INPUTS
+ * sector - which physical sector is read
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+unsigned char _f_readglsector ( unsigned long sector )
+{
+  return _f_readsector( sector, 1 );
 } /* _f_readglsector */
 
+
+/****************************************************************************
+ *
+ * _f_readgldatasector
+ *
+ * read a file data sector into gl_sector, it bypasses the sector cache
+ *
+ * INPUTS
+ * sector - which physical sector is read
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+unsigned char _f_readgldatasector ( unsigned long sector )
+{
+  return _f_readsector( sector, 0 );
+} /* _f_readgldatasector */
+
+
+/****************************************************************************
+ *
+ * _f_transfer
+ *
+ * transfer consecutive sectors between the media and a buffer, it uses
+ * the burst functions of the driver if there are
+ *
+ * INPUTS
+ * data - buffer of cnt sectors
+ * sector - first physical sector
+ * cnt - number of sectors
+ * write - 1 to write the buffer, 0 to read into it
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+static unsigned char _f_transfer ( char * data, unsigned long sector, int cnt, unsigned char write )
+{
+  unsigned char  retry;
+
+  while ( cnt )
+  {
+    int  n = cnt;
+    int  mdrv_ret = 0;
+
+    for ( retry = 3 ; retry ; retry-- )
+    {
+      if ( write )
+      {
+        if ( mdrv->writemultiplesector != NULL )
+        {
+          mdrv_ret = mdrv->writemultiplesector( mdrv, data, sector, n );
+        }
+        else
+        {
+          n = 1;
+          mdrv_ret = mdrv->writesector( mdrv, data, sector );
+        }
+      }
+      else
+      {
+        if ( mdrv->readmultiplesector != NULL )
+        {
+          mdrv_ret = mdrv->readmultiplesector( mdrv, data, sector, n );
+        }
+        else
+        {
+          n = 1;
+          mdrv_ret = mdrv->readsector( mdrv, data, sector );
+        }
+      }
+
+      if ( !mdrv_ret )
+      {
+        break;
+      }
+
+      if ( mdrv_ret == -1 )
+      {
+        gl_volume.state = F_STATE_NEEDMOUNT; /*card has been removed;*/
+        return F_ERR_CARDREMOVED;
+      }
+    }
+
+    if ( !retry )
+    {
+      return F_ERR_ONDRIVE;
+    }
+
+    data += n * F_SECTOR_SIZE;
+    sector += n;
+    cnt -= n;
+  }
+
+  return F_NO_ERROR;
+} /* _f_transfer */
+
+
+/****************************************************************************
+ *
+ * _f_readmultiplesector
+ *
+ * read consecutive file data sectors directly into the user buffer
+ *
+ * INPUTS
+ * data - where to store cnt sectors
+ * sector - first physical sector
+ * cnt - number of sectors
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+unsigned char _f_readmultiplesector ( void * data, unsigned long sector, int cnt )
+{
+  unsigned char  ret;
+
+  if ( ( gl_volume.actsector - sector < (unsigned long)cnt ) && ( gl_volume.modified || gl_file.modified ) )
+  {
+    ret = _f_writeglsector( (unsigned long)-1 ); /*gl_sector holds newer data of the range*/
+    if ( ret )
+    {
+      return ret;
+    }
+  }
+
+  return _f_transfer( (char *)data, sector, cnt, 0 );
+} /* _f_readmultiplesector */
+
+
+/****************************************************************************
+ *
+ * _f_writemultiplesector
+ *
+ * write consecutive file data sectors directly from the user buffer, the
+ * copies of these sectors in gl_sector and the sector cache are dropped
+ *
+ * INPUTS
+ * data - cnt sectors to be written
+ * sector - first physical sector
+ * cnt - number of sectors
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+unsigned char _f_writemultiplesector ( const void * data, unsigned long sector, int cnt )
+{
+  if ( mdrv->writesector == NULL )
+  {
+    gl_volume.state = F_STATE_NEEDMOUNT; /*no write function*/
+    return F_ERR_ACCESSDENIED;
+  }
+
+  if ( mdrv->getstatus != NULL )
+  {
+    unsigned int  status;
+
+    status = mdrv->getstatus( mdrv );
+
+    if ( status & ( F_ST_MISSING | F_ST_CHANGED ) )
+    {
+      gl_volume.state = F_STATE_NEEDMOUNT; /*card has been removed;*/
+      return F_ERR_CARDREMOVED;
+    }
+
+    if ( status & ( F_ST_WRPROTECT ) )
+    {
+      gl_volume.state = F_STATE_NEEDMOUNT;  /*card has been removed;*/
+      return F_ERR_WRITEPROTECT;
+    }
+  }
+
+  if ( gl_volume.actsector - sector < (unsigned long)cnt )
+  {
+    gl_volume.actsector = (unsigned long)-1;
+  }
+
+#if F_SECTOR_CACHE_SIZE
+  {
+    int  a;
+    for ( a = 0 ; a < F_SECTOR_CACHE_SIZE ; a++ )
+    {
+      if ( gl_cachesector[a] - 1 - sector < (unsigned long)cnt )
+      {
+        gl_cachesector[a] = 0;
+      }
+    }
+  }
+#endif
+
+  return _f_transfer( (char *)data, sector, cnt, 1 );
+} /* _f_writemultiplesector */
+
@@ -50,11 +50,21 @@
 extern "C" {
 #endif
 
+#ifndef F_SECTOR_CACHE_SIZE
+ #define F_SECTOR_CACHE_SIZE 0 /* config_fat_sl.h without the sector cache setting */
+#endif
+
 extern F_DRIVER * mdrv;  /* driver structure */
 
 unsigned char _f_checkstatus ( void );
 unsigned char _f_readglsector ( unsigned long );
+unsigned char _f_readgldatasector ( unsigned long );
 unsigned char _f_writeglsector ( unsigned long );
+unsigned char _f_readmultiplesector ( void *, unsigned long, int );
+unsigned char _f_writemultiplesector ( const void *, unsigned long, int );
+#if F_SECTOR_CACHE_SIZE
+void _f_cacheinvalidate ( void );
+#endif
 
 #ifdef __cplusplus
 }
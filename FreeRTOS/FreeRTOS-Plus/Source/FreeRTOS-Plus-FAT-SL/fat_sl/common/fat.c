@@ -457,18 +457,16 @@ void _f_clustertopos ( unsigned long cluster, F_POS * pos )
 
 /****************************************************************************
  *
- * _f_getcurrsector
- *
- * read current sector according in file structure
+ * _f_stepcluster
  *
- * INPUTS
- * f - internal file pointer
+ * move the file position into the next cluster of the chain if the current
+ * cluster is finished
  *
  * RETURNS
- * error code or zero if successful
+ * error code or zero if successful, F_ERR_EOF at the end of the chain
  *
  ***************************************************************************/
-unsigned char _f_getcurrsector ( void )
+unsigned char _f_stepcluster ( void )
 {
   unsigned char  ret;
   unsigned long  cluster;
@@ -491,7 +489,35 @@ unsigned char _f_getcurrsector ( void )
     _f_clustertopos( cluster, &gl_file.pos );
   }
 
-  return _f_readglsector( gl_file.pos.sector );
+  return F_NO_ERROR;
+} /* _f_stepcluster */
+
+
+
+/****************************************************************************
+ *
+ * _f_getcurrsector
+ *
+ * read current sector according in file structure
+ *
+ * INPUTS
+ * f - internal file pointer
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+unsigned char _f_getcurrsector ( void )
+{
+  unsigned char  ret;
+
+  ret = _f_stepcluster();
+  if ( ret )
+  {
+    return ret;
+  }
+
+  return _f_readgldatasector( gl_file.pos.sector );
 } /* _f_getcurrsector */
 
 
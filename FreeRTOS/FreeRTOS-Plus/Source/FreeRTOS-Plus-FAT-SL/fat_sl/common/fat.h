@@ -53,6 +53,7 @@ extern "C" {
 unsigned char _f_getfatsector ( unsigned long );
 unsigned char _f_getclustervalue ( unsigned long, unsigned long * );
 void _f_clustertopos ( unsigned long, F_POS * );
+unsigned char _f_stepcluster ( void );
 unsigned char _f_getcurrsector ( void );
 
 unsigned char _f_writefatsector ( void );
@@ -54,6 +54,7 @@
 #endif
 
 static unsigned char _f_emptywritebuffer ( void );
+static unsigned char _f_stepwritecluster ( void );
 
 
 /****************************************************************************
@@ -141,6 +142,26 @@ static unsigned char _f_emptywritebuffer ( void )
 
   gl_file.pos.sector++;
 
+  return _f_stepwritecluster();
+} /* _f_emptywritebuffer */
+
+
+
+/****************************************************************************
+ *
+ * _f_stepwritecluster
+ *
+ * move the file position into the next cluster if the current cluster is
+ * finished, the next cluster is allocated at the end of the chain
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+static unsigned char _f_stepwritecluster ( void )
+{
+  unsigned char  ret;
+
   if ( gl_file.pos.sector >= gl_file.pos.sectorend )
   {
     unsigned long  value;
@@ -189,7 +210,121 @@ static unsigned char _f_emptywritebuffer ( void )
 
 
   return F_NO_ERROR;
-} /* _f_emptywritebuffer */
+} /* _f_stepwritecluster */
+
+
+
+/****************************************************************************
+ *
+ * _f_burstread
+ *
+ * read the whole sectors of the request directly into the user buffer, up
+ * to a cluster at a time. gl_file.pos has to be at the start of a sector.
+ *
+ * INPUTS
+ * pbuffer - user buffer pointer, advanced by the read bytes
+ * psize - remaining size, decreased by the read bytes
+ * pretsize - transferred size, increased by the read bytes
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+static unsigned char _f_burstread ( char * * pbuffer, long * psize, long * pretsize )
+{
+  unsigned char  ret;
+  unsigned long  cnt;
+
+  while ( *psize >= (long) F_SECTOR_SIZE )
+  {
+    ret = _f_stepcluster();
+    if ( ret )
+    {
+      return ret;
+    }
+
+    cnt = gl_file.pos.sectorend - gl_file.pos.sector;
+    if ( cnt > (unsigned long)*psize / F_SECTOR_SIZE )
+    {
+      cnt = (unsigned long)*psize / F_SECTOR_SIZE;
+    }
+
+    ret = _f_readmultiplesector( *pbuffer, gl_file.pos.sector, (int)cnt );
+    if ( ret )
+    {
+      return ret;
+    }
+
+    gl_file.pos.sector += cnt;
+    cnt *= F_SECTOR_SIZE;
+    gl_file.abspos += cnt;
+    *pbuffer += cnt;
+    *psize -= (long)cnt;
+    *pretsize += (long)cnt;
+  }
+
+  return F_NO_ERROR;
+} /* _f_burstread */
+
+
+
+/****************************************************************************
+ *
+ * _f_burstwrite
+ *
+ * write the whole sectors of the request directly from the user buffer, up
+ * to a cluster at a time. gl_file.pos has to be at the start of a sector
+ * and gl_sector must not hold modified file data.
+ *
+ * INPUTS
+ * pbuffer - user buffer pointer, advanced by the written bytes
+ * psize - remaining size, decreased by the written bytes
+ * pretsize - transferred size, increased by the written bytes
+ *
+ * RETURNS
+ * error code or zero if successful
+ *
+ ***************************************************************************/
+static unsigned char _f_burstwrite ( char * * pbuffer, long * psize, long * pretsize )
+{
+  unsigned char  ret;
+  unsigned long  cnt;
+
+  while ( *psize >= (long) F_SECTOR_SIZE )
+  {
+    ret = _f_stepwritecluster();
+    if ( ret )
+    {
+      return ret;
+    }
+
+    cnt = gl_file.pos.sectorend - gl_file.pos.sector;
+    if ( cnt > (unsigned long)*psize / F_SECTOR_SIZE )
+    {
+      cnt = (unsigned long)*psize / F_SECTOR_SIZE;
+    }
+
+    ret = _f_writemultiplesector( *pbuffer, gl_file.pos.sector, (int)cnt );
+    if ( ret )
+    {
+      return ret;
+    }
+
+    gl_file.pos.sector += cnt;
+    cnt *= F_SECTOR_SIZE;
+    gl_file.abspos += cnt;
+    *pbuffer += cnt;
+    *psize -= (long)cnt;
+    *pretsize += (long)cnt;
+
+    if ( gl_file.filesize < gl_file.abspos )
+    {
+      gl_file.filesize = gl_file.abspos;
+    }
+  }
+
+  return _f_stepwritecluster(); /*keep the position inside a cluster as _f_emptywritebuffer*/
+} /* _f_burstwrite */
 
 
 
@@ -892,6 +1027,18 @@ long fn_read ( void * buf, long size, long _size_st, F_FILE * f )
 
       gl_file.pos.sector++;         /*goto next*/
 
+      if ( size >= (long) F_SECTOR_SIZE )
+      {
+        ret = _f_burstread( &buffer, &size, &retsize );
+        if ( ret )
+        {
+          gl_file.mode = F_FILE_CLOSE;       /*no more read allowed*/
+          return retsize;
+        }
+
+        rdsize = (unsigned long)size;
+      }
+
       ret = _f_getcurrsector();
       if ( ( ret == F_ERR_EOF ) && ( !size ) )
       {
@@ -1016,6 +1163,24 @@ long fn_write ( const void * buf, long size, long _size_st, F_FILE * f )
       gl_file.abspos += gl_file.relpos;
       gl_file.relpos = 0;
 
+      if ( wrsize >= F_SECTOR_SIZE )
+      {
+        if ( _f_burstwrite( &buffer, &size, &retsize ) )
+        {
+          gl_file.mode = F_FILE_CLOSE;
+          if ( _f_updatefileentry( 0 ) == 0 )
+          {
+            return retsize;
+          }
+          else
+          {
+            return 0;
+          }
+        }
+
+        wrsize = (unsigned long)size;
+      }
+
       if ( wrsize && ( wrsize < F_SECTOR_SIZE ) )
       {
         ret = _f_getcurrsector();
@@ -739,6 +739,9 @@ unsigned char _f_getvolume ( void )
       gl_volume.lastalloccluster = 0;
       gl_volume.actsector = (unsigned long)( -1 );
       gl_volume.fatsector = (unsigned long)( -1 );
+#if F_SECTOR_CACHE_SIZE
+      _f_cacheinvalidate();
+#endif
 
       gl_file.mode = F_FILE_CLOSE;
 
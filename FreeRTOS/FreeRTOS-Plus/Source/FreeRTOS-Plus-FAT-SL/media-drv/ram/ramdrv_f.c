@@ -67,23 +67,23 @@ static t_RamDrv  RamDrv[1] =
 
 
 /****************************************************************************
- * Read one sector
+ * Read consecutive sectors
  ***************************************************************************/
-static int ram_readsector ( F_DRIVER * driver, void * data, unsigned long sector )
+static int ram_readmultiplesector ( F_DRIVER * driver, void * data, unsigned long sector, int cnt )
 {
   long       len;
   char     * d = (char *)data;
   char     * s;
   t_RamDrv * p = (t_RamDrv *)( driver->user_ptr );
 
-  if ( sector >= p->maxsector )
+  if ( ( cnt <= 0 ) || ( sector >= p->maxsector ) || ( (unsigned long)cnt > p->maxsector - sector ) )
   {
     return MDRIVER_RAM_ERR_SECTOR;
   }
 
   s = p->ramdrv;
   s += sector * MDRIVER_RAM_SECTOR_SIZE;
-  len = MDRIVER_RAM_SECTOR_SIZE;
+  len = (long)cnt * MDRIVER_RAM_SECTOR_SIZE;
 
 #if MDRIVER_MEM_LONG_ACCESS
   if ( ( !( len & 3 ) ) && ( !( ( (long)d ) & 3 ) ) && ( !( ( (long)s ) & 3 ) ) )
@@ -110,23 +110,31 @@ static int ram_readsector ( F_DRIVER * driver, void * data, unsigned long sector
 }
 
 /****************************************************************************
- * Write one sector
+ * Read one sector
  ***************************************************************************/
-static int ram_writesector ( F_DRIVER * driver, void * data, unsigned long sector )
+static int ram_readsector ( F_DRIVER * driver, void * data, unsigned long sector )
+{
+  return ram_readmultiplesector( driver, data, sector, 1 );
+}
+
+/****************************************************************************
+ * Write consecutive sectors
+ ***************************************************************************/
+static int ram_writemultiplesector ( F_DRIVER * driver, void * data, unsigned long sector, int cnt )
 {
   long       len;
   char     * s = (char *)data;
   char     * d;
   t_RamDrv * p = (t_RamDrv *)( driver->user_ptr );
 
-  if ( sector >= p->maxsector )
+  if ( ( cnt <= 0 ) || ( sector >= p->maxsector ) || ( (unsigned long)cnt > p->maxsector - sector ) )
   {
     return MDRIVER_RAM_ERR_SECTOR;
   }
 
   d = p->ramdrv;
   d += sector * MDRIVER_RAM_SECTOR_SIZE;
-  len = MDRIVER_RAM_SECTOR_SIZE;
+  len = (long)cnt * MDRIVER_RAM_SECTOR_SIZE;
 
 #if MDRIVER_MEM_LONG_ACCESS
   if ( ( !( len & 3 ) ) && ( !( ( (long)d ) & 3 ) ) && ( !( ( (long)s ) & 3 ) ) )
@@ -152,6 +160,14 @@ static int ram_writesector ( F_DRIVER * driver, void * data, unsigned long secto
   return MDRIVER_RAM_NO_ERROR;
 }
 
+/****************************************************************************
+ * Write one sector
+ ***************************************************************************/
+static int ram_writesector ( F_DRIVER * driver, void * data, unsigned long sector )
+{
+  return ram_writemultiplesector( driver, data, sector, 1 );
+}
+
 
 /****************************************************************************
  *
@@ -238,6 +254,8 @@ F_DRIVER * ram_initfunc ( unsigned long driver_param )
 
   p->driver->readsector = ram_readsector;
   p->driver->writesector = ram_writesector;
+  p->driver->readmultiplesector = ram_readmultiplesector;
+  p->driver->writemultiplesector = ram_writemultiplesector;
   p->driver->getphy = ram_getphy;
   p->driver->release = ram_release;
   p->driver->user_ptr = p;
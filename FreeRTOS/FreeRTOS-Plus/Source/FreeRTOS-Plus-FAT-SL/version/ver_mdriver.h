@@ -42,7 +42,7 @@
 #define _VER_MDRIVER_H
 
 #define VER_MDRIVER_MAJOR 1
-#define VER_MDRIVER_MINOR 0
+#define VER_MDRIVER_MINOR 1
 
 #endif
 
@@ -0,0 +1,1260 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_benchmark_example.c
+*
+* Description:   Cycle and throughput benchmark of the filtering, transform,
+*                matrix and statistics functions.
+*
+* Target Processor: Cortex-M4/Cortex-M3, x86-64 host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup BenchmarkExample Benchmark Example
+ *
+ * \par Description:
+ * \par
+ * Measures the cycles taken by the filtering, transform, matrix and statistics
+ * functions over a sweep of block sizes and data types, so that variants such as
+ * arm_fir_q15() and arm_fir_fast_q15(), or arm_cfft_radix4_f32() and arm_cfft_f32(),
+ * can be compared on the same data.
+ *
+ * \par Method:
+ * \par
+ * Each case is run once to warm up the caches, then timed BENCH_RUNS times and the
+ * fastest run is reported, less the overhead of reading the counter. Transforms that
+ * work in place get their input restored before each run, outside the timed region.
+ * On Cortex-M the cycles come from the DWT cycle counter (DWT->CYCCNT) and the clock
+ * is SystemCoreClock. On the host build (ARM_MATH_HOST) they come from the time stamp
+ * counter, whose rate is measured against clock_gettime().
+ *
+ * \par Output:
+ * \par
+ * One CSV line per case on stdout (retarget printf() to ITM or semihosting on the target):
+ * <pre>
+ *   group,function,type,size,cycles,cycles_per_sample,msamples_per_s
+ * </pre>
+ * \c size is the block size, the transform length or the matrix dimension. A sample is
+ * an input sample of a filter or statistics function, a complex (or real for RFFTs)
+ * point of a transform and an output element of a matrix function.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_f32(), arm_fir_q31(), arm_fir_fast_q31(), arm_fir_q15(), arm_fir_fast_q15(), arm_fir_q7()
+ * - arm_biquad_cascade_df1_f32(), arm_biquad_cascade_df1_q31(), arm_biquad_cascade_df1_fast_q31(),
+ *   arm_biquad_cascade_df1_q15(), arm_biquad_cascade_df1_fast_q15(), arm_biquad_cascade_df2T_f32()
+ * - arm_biquad_cascade_df2T_q31/q15() against the Direct Form I filters for 1 to MAX_STAGES stages
+ * - arm_fir_ols_f32() against arm_fir_f32() for filters of 128 to 1024 taps
+ * - arm_fir_mc_f32/q15() and arm_biquad_cascade_df1_mc_f32/q31/q15() against one call per channel
+ * - arm_fir_resample_f32/q31/q15() from 44.1 kHz to 48 kHz, exact and with a clock drift
+ * - arm_cfft_f32(), arm_cfft_radix2_f32/q31/q15(), arm_cfft_radix4_f32/q31/q15(),
+ *   arm_rfft_fast_f32(), arm_rfft_q31(), arm_rfft_q15()
+ * - arm_goertzel_f32/q31() and arm_sdft_f32/q31() for 8 to MAX_BINS bins
+ * - arm_stft_f32/q15() in dB, of the bins and of mel bands, against one call per stage
+ * - arm_mat_mult_f32(), arm_mat_mult_q31(), arm_mat_mult_fast_q31(), arm_mat_mult_q15(),
+ *   arm_mat_mult_fast_q15(), arm_mat_trans_f32(), arm_mat_inverse_f32(), arm_mat_mult_f64()
+ * - arm_mat_cholesky_f32/f64(), arm_mat_ldlt_f32() and arm_mat_lu_f32() with their solves, against
+ *   arm_mat_inverse_f32() and a multiplication, for a symmetric positive definite system
+ * - arm_vexp_f32(), arm_vlog_f32(), arm_vlog10_f32(), arm_vatan2_f32(), arm_vtanh_f32(), arm_vsqrt_f32(),
+ *   arm_vlog_q31() and arm_vlog_q15(), against a loop of the C library function
+ * - arm_mean, arm_power, arm_rms, arm_std, arm_var, arm_min and arm_max functions
+ * - arm_stats_f32/q31/q15/q7() against the calls of the mean, var, std, rms, min and max functions
+ *
+ * <b> Refer  </b>
+ * \link arm_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_benchmark_example.c
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#if defined (ARM_MATH_HOST)
+#include <time.h>
+#include <x86intrin.h>
+#endif
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#ifndef BENCH_RUNS
+#if defined (ARM_MATH_HOST)
+#define BENCH_RUNS        100       /* Timed runs of each case, the fastest is reported */
+#else
+#define BENCH_RUNS        10
+#endif
+#endif
+#define MAX_LEN           4096      /* Longest transform, in complex points */
+#define MAX_BLOCKSIZE     1024      /* Largest block of the filters and statistics */
+#define MAX_MATRIX        32        /* Largest matrix dimension */
+#define NUM_TAPS          32        /* FIR filter length */
+#define NUM_STAGES        4         /* Biquad cascade length */
+#define MAX_STAGES        8         /* Longest biquad cascade */
+#define LONG_BLOCKSIZE    256       /* Block size of the long FIR filters */
+#define MAX_LONG_TAPS     1024      /* Longest FIR filter, with the state in the output buffer */
+#define MC_CHANNELS       4         /* Channels of the multichannel filters, with the state in the work buffer */
+#define RS_L              160       /* Upsample factor of the resampler, 44.1 kHz to 48 kHz */
+#define RS_M              147       /* Downsample factor of the resampler */
+#define RS_TAPS           (8 * RS_L) /* Resampler length, with the coefficients in the work buffer */
+#define MAX_BINS          32        /* Most bins of the Goertzel filter bank and the sliding DFT */
+#define STFT_LEN          512       /* Frame length of the STFT */
+#define STFT_HOP          128       /* Hop size of the STFT */
+#define STFT_BANDS        40        /* Mel bands of the STFT */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (ARM_MATH_HOST)
+
+typedef uint64_t bench_cycles_t;
+
+static bench_cycles_t bench_now(void)
+{
+  _mm_lfence();
+  return __rdtsc();
+}
+
+/* Rate of the time stamp counter over 50 ms */
+static uint32_t bench_clock(void)
+{
+  struct timespec t0, t1;
+  bench_cycles_t c0;
+  double dt;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  c0 = bench_now();
+  do
+  {
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    dt = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+  } while(dt < 0.05);
+
+  return (uint32_t) ((bench_now() - c0) / dt);
+}
+
+#else
+
+typedef uint32_t bench_cycles_t;
+
+extern uint32_t SystemCoreClock;
+
+static bench_cycles_t bench_now(void)
+{
+  return DWT->CYCCNT;
+}
+
+/* Start the DWT cycle counter */
+static uint32_t bench_clock(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  return SystemCoreClock;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Declare Global variables
+* ------------------------------------------------------------------- */
+/* Input, work and output buffers, used as arrays of the type of each case */
+static float32_t bufSrc[2 * MAX_LEN];
+static float32_t bufWork[2 * MAX_LEN];
+static float32_t bufDst[2 * MAX_LEN];
+static float32_t bufState[MAX_BLOCKSIZE + NUM_TAPS];
+
+/* FIR and biquad coefficients of each type */
+static float32_t firCoeffsF32[NUM_TAPS];
+static q31_t firCoeffsQ31[NUM_TAPS];
+static q15_t firCoeffsQ15[NUM_TAPS];
+static q7_t firCoeffsQ7[NUM_TAPS];
+static float32_t iirCoeffsF32[5 * MAX_STAGES];
+static q31_t iirCoeffsQ31[5 * MAX_STAGES];
+static q15_t iirCoeffsQ15[6 * MAX_STAGES];
+
+static uint32_t clockHz;            /* Cycle counter rate */
+static bench_cycles_t overhead;     /* Cycles of an empty timed region */
+static uint32_t N;                  /* Block size or length of the current case */
+
+#define SRC(t)    ((t *) bufSrc)
+#define WORK(t)   ((t *) bufWork)
+#define DST(t)    ((t *) bufDst)
+#define STATE(t)  ((t *) bufState)
+
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+static arm_fir_ols_instance_f32 firOlsF32;
+static arm_fir_instance_f32 firChF32[MC_CHANNELS];
+static arm_fir_instance_q15 firChQ15[MC_CHANNELS];
+static arm_fir_mc_instance_f32 firMcF32;
+static arm_fir_mc_instance_q15 firMcQ15;
+static arm_fir_resample_instance_f32 rsF32;
+static arm_fir_resample_instance_q31 rsQ31;
+static arm_fir_resample_instance_q15 rsQ15;
+static arm_biquad_casd_df1_inst_f32 iirChF32[MC_CHANNELS];
+static arm_biquad_casd_df1_inst_q31 iirChQ31[MC_CHANNELS];
+static arm_biquad_casd_df1_inst_q15 iirChQ15[MC_CHANNELS];
+static arm_biquad_casd_df1_mc_inst_f32 iirMcF32;
+static arm_biquad_casd_df1_mc_inst_q31 iirMcQ31;
+static arm_biquad_casd_df1_mc_inst_q15 iirMcQ15;
+static arm_biquad_casd_df1_inst_f32 iirF32;
+static arm_biquad_casd_df1_inst_q31 iirQ31;
+static arm_biquad_casd_df1_inst_q15 iirQ15;
+static arm_biquad_cascade_df2T_instance_f32 iirDf2TF32;
+static arm_biquad_cascade_df2T_instance_q31 iirDf2TQ31;
+static arm_biquad_cascade_df2T_instance_q15 iirDf2TQ15;
+static const arm_cfft_instance_f32 *cfftF32;
+static arm_cfft_radix2_instance_f32 cfftR2F32;
+static arm_cfft_radix2_instance_q31 cfftR2Q31;
+static arm_cfft_radix2_instance_q15 cfftR2Q15;
+static arm_cfft_radix4_instance_f32 cfftR4F32;
+static arm_cfft_radix4_instance_q31 cfftR4Q31;
+static arm_cfft_radix4_instance_q15 cfftR4Q15;
+static arm_rfft_fast_instance_f32 rfftFastF32;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_q15 rfftQ15;
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_sdft_instance_f32 sdftF32;
+static arm_sdft_instance_q31 sdftQ31;
+static arm_stft_instance_f32 stftF32;
+static arm_stft_instance_q15 stftQ15;
+static arm_matrix_instance_f32 matAF32, matBF32, matCF32;
+static arm_matrix_instance_q31 matAQ31, matBQ31, matCQ31;
+static arm_matrix_instance_q15 matAQ15, matBQ15, matCQ15;
+static arm_matrix_instance_f32 matLF32, matDF32, matXF32, matYF32;
+static arm_matrix_instance_f64 matAF64, matBF64, matCF64, matLF64, matYF64;
+static float64_t bufF64[4 * MAX_MATRIX * MAX_MATRIX];
+static uint16_t matPerm[MAX_MATRIX];
+
+/* Results of the statistics functions */
+static float32_t resF32;
+static q63_t resQ63;
+static q31_t resQ31;
+static q15_t resQ15;
+static q7_t resQ7;
+static uint32_t resIndex;
+static arm_stats_result_f32 statsF32;
+static arm_stats_result_q31 statsQ31;
+static arm_stats_result_q15 statsQ15;
+static arm_stats_result_q7 statsQ7;
+
+
+/* ----------------------------------------------------------------------
+* Test data
+* ------------------------------------------------------------------- */
+static uint32_t seed = 1u;
+
+/* Uniform random numbers in [-0.5, 0.5) */
+static void fill_f32(float32_t * pDst, uint32_t blockSize)
+{
+  while(blockSize > 0u)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    *pDst++ = (float32_t) (int32_t) seed * (0.5f / 2147483648.0f);
+    blockSize--;
+  }
+}
+
+/* Source buffer of random data of each type */
+static void fill_src_q31(uint32_t blockSize)
+{
+  fill_f32(bufWork, blockSize);
+  arm_float_to_q31(bufWork, SRC(q31_t), blockSize);
+}
+
+static void fill_src_q15(uint32_t blockSize)
+{
+  fill_f32(bufWork, blockSize);
+  arm_float_to_q15(bufWork, SRC(q15_t), blockSize);
+}
+
+static void fill_src_q7(uint32_t blockSize)
+{
+  fill_f32(bufWork, blockSize);
+  arm_float_to_q7(bufWork, SRC(q7_t), blockSize);
+}
+
+
+/* ----------------------------------------------------------------------
+* Timing of one case
+* ------------------------------------------------------------------- */
+static void bench(
+  const char *group,
+  const char *name,
+  const char *type,
+  uint32_t size,
+  uint32_t samples,
+  void (*run) (void),
+  void (*reset) (void))
+{
+  bench_cycles_t t, best = 0;
+  uint64_t cps, msps;
+  uint32_t i;
+
+  for (i = 0u; i <= BENCH_RUNS; i++)
+  {
+    if(reset != NULL)
+    {
+      reset();
+    }
+    t = bench_now();
+    run();
+    t = bench_now() - t;
+
+    /* The first run warms up the caches */
+    if(i == 1u || (i > 1u && t < best))
+    {
+      best = t;
+    }
+  }
+  best = (best > overhead) ? best - overhead : 1u;
+
+  /* Hundredths of cycles per sample and of million samples per second */
+  cps = ((uint64_t) best * 100u) / samples;
+  msps = ((uint64_t) clockHz * samples) / ((uint64_t) best * 10000u);
+
+  printf("%s,%s,%s,%lu,%lu,%lu.%02lu,%lu.%02lu\n", group, name, type,
+         (unsigned long) size, (unsigned long) best,
+         (unsigned long) (cps / 100u), (unsigned long) (cps % 100u),
+         (unsigned long) (msps / 100u), (unsigned long) (msps % 100u));
+}
+
+static void run_none(void)
+{
+}
+
+
+/* ----------------------------------------------------------------------
+* Filtering functions
+* ------------------------------------------------------------------- */
+static void run_fir_f32(void)            { arm_fir_f32(&firF32, SRC(float32_t), DST(float32_t), N); }
+static void run_fir_q31(void)            { arm_fir_q31(&firQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_fir_fast_q31(void)       { arm_fir_fast_q31(&firQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_fir_q15(void)            { arm_fir_q15(&firQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_fir_fast_q15(void)       { arm_fir_fast_q15(&firQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_fir_q7(void)             { arm_fir_q7(&firQ7, SRC(q7_t), DST(q7_t), N); }
+static void run_biquad_f32(void)         { arm_biquad_cascade_df1_f32(&iirF32, SRC(float32_t), DST(float32_t), N); }
+static void run_biquad_q31(void)         { arm_biquad_cascade_df1_q31(&iirQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_biquad_fast_q31(void)    { arm_biquad_cascade_df1_fast_q31(&iirQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_biquad_q15(void)         { arm_biquad_cascade_df1_q15(&iirQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_biquad_fast_q15(void)    { arm_biquad_cascade_df1_fast_q15(&iirQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_biquad_df2T_f32(void)    { arm_biquad_cascade_df2T_f32(&iirDf2TF32, SRC(float32_t), DST(float32_t), N); }
+static void run_biquad_df2T_q31(void)    { arm_biquad_cascade_df2T_q31(&iirDf2TQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_biquad_df2T_q15(void)    { arm_biquad_cascade_df2T_q15(&iirDf2TQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_fir_ols_f32(void)        { arm_fir_ols_f32(&firOlsF32, SRC(float32_t), DST(float32_t), N); }
+static void run_fir_mc_f32(void)         { arm_fir_mc_f32(&firMcF32, SRC(float32_t), DST(float32_t), N); }
+static void run_fir_mc_q15(void)         { arm_fir_mc_q15(&firMcQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_biquad_mc_f32(void)      { arm_biquad_cascade_df1_mc_f32(&iirMcF32, SRC(float32_t), DST(float32_t), N); }
+static void run_biquad_mc_q31(void)      { arm_biquad_cascade_df1_mc_q31(&iirMcQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_biquad_mc_q15(void)      { arm_biquad_cascade_df1_mc_q15(&iirMcQ15, SRC(q15_t), DST(q15_t), N); }
+static void run_resample_f32(void)       { arm_fir_resample_f32(&rsF32, SRC(float32_t), DST(float32_t), N); }
+static void run_resample_q31(void)       { arm_fir_resample_q31(&rsQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_resample_q15(void)       { arm_fir_resample_q15(&rsQ15, SRC(q15_t), DST(q15_t), N); }
+
+/* One call per channel, on channels stored one after the other */
+static void run_fir_ch_f32(void)
+{
+  uint32_t c;
+
+  for (c = 0u; c < MC_CHANNELS; c++)
+  {
+    arm_fir_f32(&firChF32[c], SRC(float32_t) + c * N, DST(float32_t) + c * N, N);
+  }
+}
+
+static void run_fir_ch_q15(void)
+{
+  uint32_t c;
+
+  for (c = 0u; c < MC_CHANNELS; c++)
+  {
+    arm_fir_q15(&firChQ15[c], SRC(q15_t) + c * N, DST(q15_t) + c * N, N);
+  }
+}
+
+static void run_biquad_ch_f32(void)
+{
+  uint32_t c;
+
+  for (c = 0u; c < MC_CHANNELS; c++)
+  {
+    arm_biquad_cascade_df1_f32(&iirChF32[c], SRC(float32_t) + c * N, DST(float32_t) + c * N, N);
+  }
+}
+
+static void run_biquad_ch_q31(void)
+{
+  uint32_t c;
+
+  for (c = 0u; c < MC_CHANNELS; c++)
+  {
+    arm_biquad_cascade_df1_q31(&iirChQ31[c], SRC(q31_t) + c * N, DST(q31_t) + c * N, N);
+  }
+}
+
+static void run_biquad_ch_q15(void)
+{
+  uint32_t c;
+
+  for (c = 0u; c < MC_CHANNELS; c++)
+  {
+    arm_biquad_cascade_df1_q15(&iirChQ15[c], SRC(q15_t) + c * N, DST(q15_t) + c * N, N);
+  }
+}
+
+/* Low pass FIR with a sum of 1, and biquad sections {b0, b1, b2, a1, a2} in Q30 and    
+ * {b0, 0, b1, b2, a1, a2} in Q14 for the fixed-point filters (postShift 1) */
+static void init_coeffs(void)
+{
+  const float32_t section[5] = {0.25f, 0.5f, 0.25f, 0.5f, -0.25f};      /* Stable low pass */
+  uint32_t i, k;
+
+  for (i = 0u; i < NUM_TAPS; i++)
+  {
+    firCoeffsF32[i] = 1.0f / NUM_TAPS;
+  }
+  arm_float_to_q31(firCoeffsF32, firCoeffsQ31, NUM_TAPS);
+  arm_float_to_q15(firCoeffsF32, firCoeffsQ15, NUM_TAPS);
+  arm_float_to_q7(firCoeffsF32, firCoeffsQ7, NUM_TAPS);
+
+  for (i = 0u; i < MAX_STAGES; i++)
+  {
+    for (k = 0u; k < 5u; k++)
+    {
+      iirCoeffsF32[5u * i + k] = section[k];
+      iirCoeffsQ31[5u * i + k] = (q31_t) (section[k] * 1073741824.0f);
+      iirCoeffsQ15[6u * i + k + (k > 0u)] = (q15_t) (section[k] * 16384.0f);
+    }
+    iirCoeffsQ15[6u * i + 1u] = 0;
+  }
+}
+
+static void bench_filtering(void)
+{
+  const char *g = "filtering";
+
+  init_coeffs();
+
+  for (N = 32u; N <= MAX_BLOCKSIZE; N <<= 1)
+  {
+    fill_f32(SRC(float32_t), N);
+    arm_fir_init_f32(&firF32, NUM_TAPS, firCoeffsF32, STATE(float32_t), N);
+    bench(g, "arm_fir_f32", "f32", N, N, run_fir_f32, NULL);
+    arm_biquad_cascade_df1_init_f32(&iirF32, NUM_STAGES, iirCoeffsF32, STATE(float32_t));
+    bench(g, "arm_biquad_cascade_df1_f32", "f32", N, N, run_biquad_f32, NULL);
+    arm_biquad_cascade_df2T_init_f32(&iirDf2TF32, NUM_STAGES, iirCoeffsF32, STATE(float32_t));
+    bench(g, "arm_biquad_cascade_df2T_f32", "f32", N, N, run_biquad_df2T_f32, NULL);
+
+    fill_src_q31(N);
+    arm_fir_init_q31(&firQ31, NUM_TAPS, firCoeffsQ31, STATE(q31_t), N);
+    bench(g, "arm_fir_q31", "q31", N, N, run_fir_q31, NULL);
+    bench(g, "arm_fir_fast_q31", "q31", N, N, run_fir_fast_q31, NULL);
+    arm_biquad_cascade_df1_init_q31(&iirQ31, NUM_STAGES, iirCoeffsQ31, STATE(q31_t), 1);
+    bench(g, "arm_biquad_cascade_df1_q31", "q31", N, N, run_biquad_q31, NULL);
+    bench(g, "arm_biquad_cascade_df1_fast_q31", "q31", N, N, run_biquad_fast_q31, NULL);
+
+    fill_src_q15(N);
+    arm_fir_init_q15(&firQ15, NUM_TAPS, firCoeffsQ15, STATE(q15_t), N);
+    bench(g, "arm_fir_q15", "q15", N, N, run_fir_q15, NULL);
+    bench(g, "arm_fir_fast_q15", "q15", N, N, run_fir_fast_q15, NULL);
+    arm_biquad_cascade_df1_init_q15(&iirQ15, NUM_STAGES, iirCoeffsQ15, STATE(q15_t), 1);
+    bench(g, "arm_biquad_cascade_df1_q15", "q15", N, N, run_biquad_q15, NULL);
+    bench(g, "arm_biquad_cascade_df1_fast_q15", "q15", N, N, run_biquad_fast_q15, NULL);
+
+    fill_src_q7(N);
+    arm_fir_init_q7(&firQ7, NUM_TAPS, firCoeffsQ7, STATE(q7_t), N);
+    bench(g, "arm_fir_q7", "q7", N, N, run_fir_q7, NULL);
+  }
+}
+
+/* Fixed-point biquad cascades in Direct Form I and transposed Direct Form II, of 1 to    
+ * MAX_STAGES stages. The coefficient arrays are the same for both structures. */
+static void bench_biquad_df2T(void)
+{
+  const char *g = "filtering";
+  char name[48];
+  uint32_t numStages;
+
+  init_coeffs();
+
+  N = 256u;
+  for (numStages = 1u; numStages <= MAX_STAGES; numStages <<= 1)
+  {
+    fill_src_q31(N);
+    arm_biquad_cascade_df1_init_q31(&iirQ31, numStages, iirCoeffsQ31, STATE(q31_t), 1);
+    sprintf(name, "arm_biquad_cascade_df1_q31 %lu stages", (unsigned long) numStages);
+    bench(g, name, "q31", N, N, run_biquad_q31, NULL);
+    arm_biquad_cascade_df2T_init_q31(&iirDf2TQ31, numStages, iirCoeffsQ31, STATE(q63_t), 1);
+    sprintf(name, "arm_biquad_cascade_df2T_q31 %lu stages", (unsigned long) numStages);
+    bench(g, name, "q31", N, N, run_biquad_df2T_q31, NULL);
+
+    fill_src_q15(N);
+    arm_biquad_cascade_df1_init_q15(&iirQ15, numStages, iirCoeffsQ15, STATE(q15_t), 1);
+    sprintf(name, "arm_biquad_cascade_df1_q15 %lu stages", (unsigned long) numStages);
+    bench(g, name, "q15", N, N, run_biquad_q15, NULL);
+    sprintf(name, "arm_biquad_cascade_df1_fast_q15 %lu stages", (unsigned long) numStages);
+    bench(g, name, "q15", N, N, run_biquad_fast_q15, NULL);
+    arm_biquad_cascade_df2T_init_q15(&iirDf2TQ15, numStages, iirCoeffsQ15, STATE(q31_t), 1);
+    sprintf(name, "arm_biquad_cascade_df2T_q15 %lu stages", (unsigned long) numStages);
+    bench(g, name, "q15", N, N, run_biquad_df2T_q15, NULL);
+  }
+}
+
+/* Interleaved multichannel filters against one call per channel, with the states in the work buffer */
+static void bench_multichannel(void)
+{
+  const char *g = "filtering";
+  uint32_t c, stateLen;
+
+  init_coeffs();
+
+  /* N is the number of frames, and a sample is one sample of one channel */
+  for (N = 32u; N <= MAX_BLOCKSIZE; N <<= 1)
+  {
+    stateLen = N + NUM_TAPS;
+
+    fill_f32(SRC(float32_t), MC_CHANNELS * N);
+    for (c = 0u; c < MC_CHANNELS; c++)
+    {
+      arm_fir_init_f32(&firChF32[c], NUM_TAPS, firCoeffsF32, WORK(float32_t) + c * stateLen, N);
+    }
+    bench(g, "arm_fir_f32 per channel", "f32", N, MC_CHANNELS * N, run_fir_ch_f32, NULL);
+    arm_fir_mc_init_f32(&firMcF32, NUM_TAPS, MC_CHANNELS, firCoeffsF32, WORK(float32_t), N);
+    bench(g, "arm_fir_mc_f32", "f32", N, MC_CHANNELS * N, run_fir_mc_f32, NULL);
+    for (c = 0u; c < MC_CHANNELS; c++)
+    {
+      arm_biquad_cascade_df1_init_f32(&iirChF32[c], NUM_STAGES, iirCoeffsF32, WORK(float32_t) + 4u * NUM_STAGES * c);
+    }
+    bench(g, "arm_biquad_cascade_df1_f32 per channel", "f32", N, MC_CHANNELS * N, run_biquad_ch_f32, NULL);
+    arm_biquad_cascade_df1_mc_init_f32(&iirMcF32, NUM_STAGES, MC_CHANNELS, iirCoeffsF32, WORK(float32_t));
+    bench(g, "arm_biquad_cascade_df1_mc_f32", "f32", N, MC_CHANNELS * N, run_biquad_mc_f32, NULL);
+
+    fill_src_q31(MC_CHANNELS * N);
+    for (c = 0u; c < MC_CHANNELS; c++)
+    {
+      arm_biquad_cascade_df1_init_q31(&iirChQ31[c], NUM_STAGES, iirCoeffsQ31, WORK(q31_t) + 4u * NUM_STAGES * c, 1);
+    }
+    bench(g, "arm_biquad_cascade_df1_q31 per channel", "q31", N, MC_CHANNELS * N, run_biquad_ch_q31, NULL);
+    arm_biquad_cascade_df1_mc_init_q31(&iirMcQ31, NUM_STAGES, MC_CHANNELS, iirCoeffsQ31, WORK(q31_t), 1);
+    bench(g, "arm_biquad_cascade_df1_mc_q31", "q31", N, MC_CHANNELS * N, run_biquad_mc_q31, NULL);
+
+    fill_src_q15(MC_CHANNELS * N);
+    for (c = 0u; c < MC_CHANNELS; c++)
+    {
+      arm_fir_init_q15(&firChQ15[c], NUM_TAPS, firCoeffsQ15, WORK(q15_t) + c * stateLen, N);
+    }
+    bench(g, "arm_fir_q15 per channel", "q15", N, MC_CHANNELS * N, run_fir_ch_q15, NULL);
+    arm_fir_mc_init_q15(&firMcQ15, NUM_TAPS, MC_CHANNELS, firCoeffsQ15, WORK(q15_t), N);
+    bench(g, "arm_fir_mc_q15", "q15", N, MC_CHANNELS * N, run_fir_mc_q15, NULL);
+    for (c = 0u; c < MC_CHANNELS; c++)
+    {
+      arm_biquad_cascade_df1_init_q15(&iirChQ15[c], NUM_STAGES, iirCoeffsQ15, WORK(q15_t) + 4u * NUM_STAGES * c, 1);
+    }
+    bench(g, "arm_biquad_cascade_df1_q15 per channel", "q15", N, MC_CHANNELS * N, run_biquad_ch_q15, NULL);
+    arm_biquad_cascade_df1_mc_init_q15(&iirMcQ15, NUM_STAGES, MC_CHANNELS, iirCoeffsQ15, WORK(q15_t), 1);
+    bench(g, "arm_biquad_cascade_df1_mc_q15", "q15", N, MC_CHANNELS * N, run_biquad_mc_q15, NULL);
+  }
+}
+
+/* Rational resampler, with the coefficients of each type one after the other in the work buffer,    
+ * after the first MAX_BLOCKSIZE words used by fill_src_q31() and fill_src_q15().    
+ * A sample is an input sample. */
+static void bench_resample(void)
+{
+  const char *g = "filtering";
+  float32_t *pCoeffsF32 = WORK(float32_t) + MAX_BLOCKSIZE;
+  q31_t *pCoeffsQ31 = (q31_t *) (pCoeffsF32 + RS_TAPS);
+  q15_t *pCoeffsQ15 = (q15_t *) (pCoeffsQ31 + RS_TAPS);
+
+  fill_f32(pCoeffsF32, RS_TAPS);
+  arm_float_to_q31(pCoeffsF32, pCoeffsQ31, RS_TAPS);
+  arm_float_to_q15(pCoeffsF32, pCoeffsQ15, RS_TAPS);
+
+  for (N = 32u; N <= MAX_BLOCKSIZE; N <<= 1)
+  {
+    fill_f32(SRC(float32_t), N);
+    arm_fir_resample_init_f32(&rsF32, RS_L, RS_M, RS_TAPS, pCoeffsF32, STATE(float32_t), N);
+    bench(g, "arm_fir_resample_f32", "f32", N, N, run_resample_f32, NULL);
+
+    /* 100 ppm faster output clock, interpolating between the polyphase branches */
+    rsF32.stepFrac = -(int32_t) (RS_M * 429497u);
+    bench(g, "arm_fir_resample_f32 drift", "f32", N, N, run_resample_f32, NULL);
+
+    fill_src_q31(N);
+    arm_fir_resample_init_q31(&rsQ31, RS_L, RS_M, RS_TAPS, pCoeffsQ31, STATE(q31_t), N);
+    bench(g, "arm_fir_resample_q31", "q31", N, N, run_resample_q31, NULL);
+
+    fill_src_q15(N);
+    arm_fir_resample_init_q15(&rsQ15, RS_L, RS_M, RS_TAPS, pCoeffsQ15, STATE(q15_t), N);
+    bench(g, "arm_fir_resample_q15", "q15", N, N, run_resample_q15, NULL);
+  }
+}
+
+/* Long FIR filters in the direct form and by overlap-save, with the coefficients    
+ * in the work buffer and the state after the output block */
+static void bench_long_fir(void)
+{
+  const char *g = "filtering";
+  char name[40];
+  uint32_t numTaps;
+
+  N = LONG_BLOCKSIZE;
+  fill_f32(SRC(float32_t), N);
+
+  for (numTaps = 128u; numTaps <= MAX_LONG_TAPS; numTaps <<= 1)
+  {
+    fill_f32(WORK(float32_t), numTaps);
+
+    arm_fir_init_f32(&firF32, numTaps, WORK(float32_t), DST(float32_t) + N, N);
+    sprintf(name, "arm_fir_f32 %lu taps", (unsigned long) numTaps);
+    bench(g, name, "f32", N, N, run_fir_f32, NULL);
+
+    arm_fir_ols_init_f32(&firOlsF32, numTaps, WORK(float32_t), DST(float32_t) + N, N);
+    sprintf(name, "arm_fir_ols_f32 %lu taps", (unsigned long) numTaps);
+    bench(g, name, "f32", N, N, run_fir_ols_f32, NULL);
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+* Transform functions, in place on the work buffer
+* ------------------------------------------------------------------- */
+static void reset_f32(void)              { memcpy(bufWork, bufSrc, 2u * N * sizeof(float32_t)); }
+static void reset_q31(void)              { memcpy(bufWork, bufSrc, 2u * N * sizeof(q31_t)); }
+static void reset_q15(void)              { memcpy(bufWork, bufSrc, 2u * N * sizeof(q15_t)); }
+
+static void run_cfft_f32(void)           { arm_cfft_f32(cfftF32, WORK(float32_t), 0u, 1u); }
+static void run_cfft_radix2_f32(void)    { arm_cfft_radix2_f32(&cfftR2F32, WORK(float32_t)); }
+static void run_cfft_radix2_q31(void)    { arm_cfft_radix2_q31(&cfftR2Q31, WORK(q31_t)); }
+static void run_cfft_radix2_q15(void)    { arm_cfft_radix2_q15(&cfftR2Q15, WORK(q15_t)); }
+static void run_cfft_radix4_f32(void)    { arm_cfft_radix4_f32(&cfftR4F32, WORK(float32_t)); }
+static void run_cfft_radix4_q31(void)    { arm_cfft_radix4_q31(&cfftR4Q31, WORK(q31_t)); }
+static void run_cfft_radix4_q15(void)    { arm_cfft_radix4_q15(&cfftR4Q15, WORK(q15_t)); }
+static void run_rfft_fast_f32(void)      { arm_rfft_fast_f32(&rfftFastF32, WORK(float32_t), DST(float32_t), 0u); }
+static void run_rfft_q31(void)           { arm_rfft_q31(&rfftQ31, WORK(q31_t), DST(q31_t)); }
+static void run_rfft_q15(void)           { arm_rfft_q15(&rfftQ15, WORK(q15_t), DST(q15_t)); }
+static void run_goertzel_f32(void)       { arm_goertzel_f32(&goertzelF32, SRC(float32_t), DST(float32_t), N); }
+static void run_goertzel_q31(void)       { arm_goertzel_q31(&goertzelQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_sdft_f32(void)           { arm_sdft_f32(&sdftF32, SRC(float32_t), DST(float32_t), N); }
+static void run_sdft_q31(void)           { arm_sdft_q31(&sdftQ31, SRC(q31_t), DST(q31_t), N); }
+static void run_stft_f32(void)           { arm_stft_f32(&stftF32, SRC(float32_t), DST(float32_t), N); }
+static void run_stft_q15(void)           { arm_stft_q15(&stftQ15, SRC(q15_t), DST(q15_t), N); }
+
+/* The log power spectra of arm_stft_f32() computed by one call per stage */
+static void run_stft_chain_f32(void)
+{
+  float32_t *pFrame = WORK(float32_t) + MAX_BLOCKSIZE;
+  float32_t *pSpec = pFrame + STFT_LEN;
+  float32_t *pDst = DST(float32_t);
+  uint32_t f, k;
+
+  for (f = 0u; f < N / STFT_HOP; f++)
+  {
+    arm_mult_f32(SRC(float32_t) + f * STFT_HOP, (float32_t *) stftF32.pWindow, pFrame, STFT_LEN);
+    arm_rfft_fast_f32(&rfftFastF32, pFrame, pSpec, 0u);
+    arm_cmplx_mag_squared_f32(pSpec, pDst, STFT_LEN / 2u);
+    for (k = 0u; k < STFT_LEN / 2u; k++)
+    {
+      pDst[k] = 10.0f * log10f(pDst[k]);
+    }
+    pDst += STFT_LEN / 2u + 1u;
+  }
+}
+
+static void bench_transform(void)
+{
+  const char *g = "transform";
+  const arm_cfft_instance_f32 *cfft[] = {
+    &arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+    &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+    &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+  };
+  uint32_t i;
+
+  for (N = 16u, i = 0u; N <= MAX_LEN; N <<= 1, i++)
+  {
+    fill_f32(SRC(float32_t), 2u * N);
+    cfftF32 = cfft[i];
+    bench(g, "arm_cfft_f32", "f32", N, N, run_cfft_f32, reset_f32);
+    if(arm_cfft_radix2_init_f32(&cfftR2F32, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix2_f32", "f32", N, N, run_cfft_radix2_f32, reset_f32);
+    if(arm_cfft_radix4_init_f32(&cfftR4F32, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix4_f32", "f32", N, N, run_cfft_radix4_f32, reset_f32);
+    if(arm_rfft_fast_init_f32(&rfftFastF32, N) == ARM_MATH_SUCCESS)
+      bench(g, "arm_rfft_fast_f32", "f32", N, N, run_rfft_fast_f32, reset_f32);
+
+    fill_src_q31(2u * N);
+    if(arm_cfft_radix2_init_q31(&cfftR2Q31, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix2_q31", "q31", N, N, run_cfft_radix2_q31, reset_q31);
+    if(arm_cfft_radix4_init_q31(&cfftR4Q31, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix4_q31", "q31", N, N, run_cfft_radix4_q31, reset_q31);
+    if(arm_rfft_init_q31(&rfftQ31, &cfftR4Q31, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_rfft_q31", "q31", N, N, run_rfft_q31, reset_q31);
+
+    fill_src_q15(2u * N);
+    if(arm_cfft_radix2_init_q15(&cfftR2Q15, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix2_q15", "q15", N, N, run_cfft_radix2_q15, reset_q15);
+    if(arm_cfft_radix4_init_q15(&cfftR4Q15, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_cfft_radix4_q15", "q15", N, N, run_cfft_radix4_q15, reset_q15);
+    if(arm_rfft_init_q15(&rfftQ15, &cfftR4Q15, N, 0u, 1u) == ARM_MATH_SUCCESS)
+      bench(g, "arm_rfft_q15", "q15", N, N, run_rfft_q15, reset_q15);
+  }
+}
+
+/* Goertzel filter bank over one analysis of N samples and sliding DFT of length N,    
+ * against arm_rfft_fast_f32() above. The coefficients and states are in the work buffer,    
+ * after the first MAX_BLOCKSIZE words used by fill_src_q31(). A sample is an input sample. */
+static void bench_bins(void)
+{
+  const char *g = "transform";
+  float32_t freqF32[MAX_BINS];
+  q31_t freqQ31[MAX_BINS];
+  uint16_t index[MAX_BINS];
+  float32_t *pCoeffsF32 = WORK(float32_t) + MAX_BLOCKSIZE;
+  float32_t *pStateF32 = pCoeffsF32 + 2u * MAX_BINS;
+  q31_t *pCoeffsQ31 = (q31_t *) (pStateF32 + 2u * MAX_BINS + MAX_BLOCKSIZE);
+  q31_t *pStateQ31 = pCoeffsQ31 + 2u * MAX_BINS;
+  char name[40];
+  uint32_t numBins, k;
+
+  for (N = 256u; N <= MAX_BLOCKSIZE; N <<= 2)
+  {
+    for (numBins = 8u; numBins <= MAX_BINS; numBins <<= 1)
+    {
+      for (k = 0u; k < numBins; k++)
+      {
+        index[k] = (uint16_t) (((2u * k + 1u) * N) / (4u * numBins));
+        freqF32[k] = (float32_t) index[k] / N;
+        freqQ31[k] = (q31_t) (((uint64_t) index[k] << 31) / N);
+      }
+
+      fill_f32(SRC(float32_t), N);
+      arm_goertzel_init_f32(&goertzelF32, numBins, N, freqF32, pCoeffsF32, pStateF32);
+      sprintf(name, "arm_goertzel_f32 %lu bins", (unsigned long) numBins);
+      bench(g, name, "f32", N, N, run_goertzel_f32, NULL);
+      arm_sdft_init_f32(&sdftF32, numBins, N, index, pCoeffsF32, pStateF32);
+      sprintf(name, "arm_sdft_f32 %lu bins", (unsigned long) numBins);
+      bench(g, name, "f32", N, N, run_sdft_f32, NULL);
+
+      fill_src_q31(N);
+      arm_goertzel_init_q31(&goertzelQ31, numBins, N, freqQ31, pCoeffsQ31, (q63_t *) pStateQ31);
+      sprintf(name, "arm_goertzel_q31 %lu bins", (unsigned long) numBins);
+      bench(g, name, "q31", N, N, run_goertzel_q31, NULL);
+      arm_sdft_init_q31(&sdftQ31, numBins, N, index, pCoeffsQ31, pStateQ31);
+      sprintf(name, "arm_sdft_q31 %lu bins", (unsigned long) numBins);
+      bench(g, name, "q31", N, N, run_sdft_q31, NULL);
+    }
+  }
+}
+
+/* STFT of 4 hops in dB, of the bins and of mel bands up to half the sample rate, and the    
+ * same bins by one call per stage. The window, the bands and the buffers are in the work    
+ * buffer, after the first MAX_BLOCKSIZE words used by fill_src_q15(). A sample is an input sample. */
+static void bench_stft(void)
+{
+  const char *g = "transform";
+  uint16_t edges[STFT_BANDS + 2];
+  float32_t *pWindowF32 = WORK(float32_t) + MAX_BLOCKSIZE + 3u * STFT_LEN;
+  float32_t *pWeightsF32 = pWindowF32 + STFT_LEN;
+  float32_t *pStateF32 = pWeightsF32 + STFT_LEN;
+  float32_t *pBufferF32 = pStateF32 + STFT_LEN;
+  q15_t *pWindowQ15 = (q15_t *) (pBufferF32 + 2u * STFT_LEN);
+  q15_t *pWeightsQ15 = pWindowQ15 + STFT_LEN;
+  q15_t *pStateQ15 = pWeightsQ15 + STFT_LEN;
+  q15_t *pBufferQ15 = pStateQ15 + STFT_LEN;
+  float64_t melMax = 2595.0 * log10(1.0 + 24000.0 / 700.0);
+  uint32_t k;
+
+  /* Hann window, mel band edges of a 48 kHz signal, one bin apart at least */
+  for (k = 0u; k < STFT_LEN; k++)
+  {
+    pWindowF32[k] = 0.5f - 0.5f * cosf(6.2831853f * k / STFT_LEN);
+  }
+  arm_float_to_q15(pWindowF32, pWindowQ15, STFT_LEN);
+  for (k = 0u; k < STFT_BANDS + 2u; k++)
+  {
+    edges[k] = (uint16_t) (700.0 * (pow(10.0, melMax * k / (STFT_BANDS + 1u) / 2595.0) - 1.0) *
+                           STFT_LEN / 48000.0 + 0.5);
+    if(k > 0u && edges[k] <= edges[k - 1u])
+    {
+      edges[k] = edges[k - 1u] + 1u;
+    }
+  }
+
+  N = 4u * STFT_HOP;
+  fill_f32(SRC(float32_t), N + STFT_LEN);
+  arm_stft_init_f32(&stftF32, STFT_LEN, STFT_HOP, pWindowF32, 0u, NULL, NULL, 1u, pStateF32, pBufferF32);
+  bench(g, "arm_stft_f32 dB", "f32", STFT_LEN, N, run_stft_f32, NULL);
+  arm_rfft_fast_init_f32(&rfftFastF32, STFT_LEN);
+  bench(g, "arm_stft_f32 dB by stages", "f32", STFT_LEN, N, run_stft_chain_f32, NULL);
+  arm_stft_init_f32(&stftF32, STFT_LEN, STFT_HOP, pWindowF32, STFT_BANDS, edges, pWeightsF32, 1u, pStateF32, pBufferF32);
+  bench(g, "arm_stft_f32 mel dB", "f32", STFT_LEN, N, run_stft_f32, NULL);
+
+  fill_src_q15(N);
+  arm_stft_init_q15(&stftQ15, STFT_LEN, STFT_HOP, pWindowQ15, 0u, NULL, NULL, 1u, pStateQ15, pBufferQ15);
+  bench(g, "arm_stft_q15 dB", "q15", STFT_LEN, N, run_stft_q15, NULL);
+  arm_stft_init_q15(&stftQ15, STFT_LEN, STFT_HOP, pWindowQ15, STFT_BANDS, edges, pWeightsQ15, 1u, pStateQ15, pBufferQ15);
+  bench(g, "arm_stft_q15 mel dB", "q15", STFT_LEN, N, run_stft_q15, NULL);
+}
+
+
+/* ----------------------------------------------------------------------
+* Matrix functions on N x N matrices, A and B in the source buffer
+* ------------------------------------------------------------------- */
+static void reset_inverse(void)          { memcpy(bufWork, bufSrc, N * N * sizeof(float32_t)); }
+
+static void run_mat_mult_f32(void)       { arm_mat_mult_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_trans_f32(void)      { arm_mat_trans_f32(&matAF32, &matCF32); }
+static void run_mat_inverse_f32(void)    { arm_mat_inverse_f32(&matBF32, &matCF32); }
+static void run_mat_mult_q31(void)       { arm_mat_mult_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_mult_fast_q31(void)  { arm_mat_mult_fast_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_mult_q15(void)       { arm_mat_mult_q15(&matAQ15, &matBQ15, &matCQ15, WORK(q15_t)); }
+static void run_mat_mult_fast_q15(void)  { arm_mat_mult_fast_q15(&matAQ15, &matBQ15, &matCQ15, WORK(q15_t)); }
+static void run_mat_mult_f64(void)       { arm_mat_mult_f64(&matAF64, &matBF64, &matCF64); }
+
+static void bench_matrix(void)
+{
+  const char *g = "matrix";
+  uint32_t i;
+
+  for (N = 4u; N <= MAX_MATRIX; N <<= 1)
+  {
+    /* A and B, then A made diagonally dominant and inverted from the work buffer, as the inverse overwrites its source */
+    fill_f32(SRC(float32_t), 2u * N * N);
+    arm_mat_init_f32(&matAF32, N, N, SRC(float32_t));
+    arm_mat_init_f32(&matBF32, N, N, SRC(float32_t) + N * N);
+    arm_mat_init_f32(&matCF32, N, N, DST(float32_t));
+    bench(g, "arm_mat_mult_f32", "f32", N, N * N, run_mat_mult_f32, NULL);
+    bench(g, "arm_mat_trans_f32", "f32", N, N * N, run_mat_trans_f32, NULL);
+    for (i = 0u; i < N; i++)
+    {
+      bufSrc[i * (N + 1u)] += (float32_t) N;
+    }
+    arm_mat_init_f32(&matBF32, N, N, WORK(float32_t));
+    bench(g, "arm_mat_inverse_f32", "f32", N, N * N, run_mat_inverse_f32, reset_inverse);
+
+    for (i = 0u; i < 2u * N * N; i++)
+    {
+      bufF64[i] = bufSrc[i];
+    }
+    arm_mat_init_f64(&matAF64, N, N, bufF64);
+    arm_mat_init_f64(&matBF64, N, N, bufF64 + N * N);
+    arm_mat_init_f64(&matCF64, N, N, bufF64 + 2u * N * N);
+    bench(g, "arm_mat_mult_f64", "f64", N, N * N, run_mat_mult_f64, NULL);
+
+    fill_src_q31(2u * N * N);
+    arm_mat_init_q31(&matAQ31, N, N, SRC(q31_t));
+    arm_mat_init_q31(&matBQ31, N, N, SRC(q31_t) + N * N);
+    arm_mat_init_q31(&matCQ31, N, N, DST(q31_t));
+    bench(g, "arm_mat_mult_q31", "q31", N, N * N, run_mat_mult_q31, NULL);
+    bench(g, "arm_mat_mult_fast_q31", "q31", N, N * N, run_mat_mult_fast_q31, NULL);
+
+    fill_src_q15(2u * N * N);
+    arm_mat_init_q15(&matAQ15, N, N, SRC(q15_t));
+    arm_mat_init_q15(&matBQ15, N, N, SRC(q15_t) + N * N);
+    arm_mat_init_q15(&matCQ15, N, N, DST(q15_t));
+    bench(g, "arm_mat_mult_q15", "q15", N, N * N, run_mat_mult_q15, NULL);
+    bench(g, "arm_mat_mult_fast_q15", "q15", N, N * N, run_mat_mult_fast_q15, NULL);
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+* Solve of an N x N symmetric positive definite system with one right-hand
+* side, A in the source buffer and b after it, the factors in the work buffer
+* ------------------------------------------------------------------- */
+static void run_solve_inverse_f32(void)
+{
+  arm_mat_inverse_f32(&matBF32, &matCF32);
+  arm_mat_mult_f32(&matCF32, &matYF32, &matXF32);
+}
+
+static void run_solve_cholesky_f32(void)
+{
+  arm_mat_cholesky_f32(&matAF32, &matLF32);
+  arm_mat_cholesky_solve_f32(&matLF32, &matYF32, &matXF32);
+}
+
+static void run_solve_ldlt_f32(void)
+{
+  arm_mat_ldlt_f32(&matAF32, &matLF32, &matDF32, matPerm);
+}
+
+static void run_solve_lu_f32(void)
+{
+  arm_mat_lu_f32(&matAF32, &matLF32, matPerm);
+  arm_mat_lu_solve_f32(&matLF32, matPerm, &matYF32, &matXF32);
+}
+
+static void run_solve_cholesky_f64(void)
+{
+  arm_mat_cholesky_f64(&matAF64, &matLF64);
+  arm_mat_cholesky_solve_f64(&matLF64, &matYF64, &matCF64);
+}
+
+static void bench_solve(void)
+{
+  const char *g = "solve";
+  float32_t *pA = SRC(float32_t);
+  float32_t *pG = DST(float32_t);
+  float32_t sum;
+  uint32_t i, j;
+
+  for (N = 4u; N <= MAX_MATRIX; N <<= 1)
+  {
+    /* A = G * G' + N * I */
+    fill_f32(pG, N * N);
+    for (i = 0u; i < N; i++)
+    {
+      for (j = 0u; j < N; j++)
+      {
+        arm_dot_prod_f32(pG + i * N, pG + j * N, N, &sum);
+        pA[i * N + j] = (i == j) ? sum + (float32_t) N : sum;
+      }
+    }
+    fill_f32(pA + N * N, N);
+
+    arm_mat_init_f32(&matAF32, N, N, pA);
+    arm_mat_init_f32(&matYF32, N, 1, pA + N * N);
+    arm_mat_init_f32(&matXF32, N, 1, DST(float32_t) + N * N);
+    arm_mat_init_f32(&matBF32, N, N, WORK(float32_t));
+    arm_mat_init_f32(&matCF32, N, N, DST(float32_t));
+    arm_mat_init_f32(&matLF32, N, N, WORK(float32_t) + N * N);
+    arm_mat_init_f32(&matDF32, N, N, WORK(float32_t) + 2u * N * N);
+    bench(g, "arm_mat_inverse_f32 + mult", "f32", N, N * N, run_solve_inverse_f32, reset_inverse);
+    bench(g, "arm_mat_cholesky_f32 + solve", "f32", N, N * N, run_solve_cholesky_f32, NULL);
+    bench(g, "arm_mat_ldlt_f32", "f32", N, N * N, run_solve_ldlt_f32, NULL);
+    bench(g, "arm_mat_lu_f32 + solve", "f32", N, N * N, run_solve_lu_f32, NULL);
+
+    for (i = 0u; i < N * N + N; i++)
+    {
+      bufF64[i] = pA[i];
+    }
+    arm_mat_init_f64(&matAF64, N, N, bufF64);
+    arm_mat_init_f64(&matYF64, N, 1, bufF64 + N * N);
+    arm_mat_init_f64(&matCF64, N, 1, bufF64 + N * N + N);
+    arm_mat_init_f64(&matLF64, N, N, bufF64 + 2u * N * N);
+    bench(g, "arm_mat_cholesky_f64 + solve", "f64", N, N * N, run_solve_cholesky_f64, NULL);
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+* Vector fast math functions, against a loop of the C library function
+* ------------------------------------------------------------------- */
+static void run_vexp_f32(void)    { arm_vexp_f32(SRC(float32_t), DST(float32_t), N); }
+static void run_vlog_f32(void)    { arm_vlog_f32(WORK(float32_t), DST(float32_t), N); }
+static void run_vlog10_f32(void)  { arm_vlog10_f32(WORK(float32_t), DST(float32_t), N); }
+static void run_vatan2_f32(void)  { arm_vatan2_f32(SRC(float32_t), SRC(float32_t) + N, DST(float32_t), N); }
+static void run_vtanh_f32(void)   { arm_vtanh_f32(SRC(float32_t), DST(float32_t), N); }
+static void run_vsqrt_f32(void)   { arm_vsqrt_f32(WORK(float32_t), DST(float32_t), N); }
+static void run_vlog_q31(void)    { arm_vlog_q31(SRC(q31_t), DST(q31_t), N); }
+static void run_vlog_q15(void)    { arm_vlog_q15(SRC(q15_t), DST(q15_t), N); }
+
+static void run_expf(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = expf(SRC(float32_t)[i]);
+  }
+}
+
+static void run_logf(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = logf(WORK(float32_t)[i]);
+  }
+}
+
+static void run_log10f(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = log10f(WORK(float32_t)[i]);
+  }
+}
+
+static void run_atan2f(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = atan2f(SRC(float32_t)[i], SRC(float32_t)[N + i]);
+  }
+}
+
+static void run_tanhf(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = tanhf(SRC(float32_t)[i]);
+  }
+}
+
+static void run_sqrtf(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < N; i++)
+  {
+    DST(float32_t)[i] = sqrtf(WORK(float32_t)[i]);
+  }
+}
+
+static void bench_fast_math(void)
+{
+  const char *g = "fast math";
+  uint32_t i;
+
+  for (N = 32u; N <= MAX_BLOCKSIZE; N <<= 1)
+  {
+    /* Inputs in [-8, 8), and positive inputs of the logarithms and square roots */
+    fill_f32(SRC(float32_t), 2u * N);
+    arm_scale_f32(SRC(float32_t), 16.0f, SRC(float32_t), 2u * N);
+    for (i = 0u; i < N; i++)
+    {
+      WORK(float32_t)[i] = SRC(float32_t)[i] * SRC(float32_t)[i] + 0.01f;
+    }
+    bench(g, "arm_vexp_f32", "f32", N, N, run_vexp_f32, NULL);
+    bench(g, "expf", "f32", N, N, run_expf, NULL);
+    bench(g, "arm_vlog_f32", "f32", N, N, run_vlog_f32, NULL);
+    bench(g, "logf", "f32", N, N, run_logf, NULL);
+    bench(g, "arm_vlog10_f32", "f32", N, N, run_vlog10_f32, NULL);
+    bench(g, "log10f", "f32", N, N, run_log10f, NULL);
+    bench(g, "arm_vatan2_f32", "f32", N, N, run_vatan2_f32, NULL);
+    bench(g, "atan2f", "f32", N, N, run_atan2f, NULL);
+    bench(g, "arm_vtanh_f32", "f32", N, N, run_vtanh_f32, NULL);
+    bench(g, "tanhf", "f32", N, N, run_tanhf, NULL);
+    bench(g, "arm_vsqrt_f32", "f32", N, N, run_vsqrt_f32, NULL);
+    bench(g, "sqrtf", "f32", N, N, run_sqrtf, NULL);
+
+    /* Positive fixed-point inputs */
+    fill_src_q31(N);
+    arm_abs_q31(SRC(q31_t), SRC(q31_t), N);
+    bench(g, "arm_vlog_q31", "q31", N, N, run_vlog_q31, NULL);
+
+    fill_src_q15(N);
+    arm_abs_q15(SRC(q15_t), SRC(q15_t), N);
+    bench(g, "arm_vlog_q15", "q15", N, N, run_vlog_q15, NULL);
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+* Statistics functions
+* ------------------------------------------------------------------- */
+static void run_mean_f32(void)   { arm_mean_f32(SRC(float32_t), N, &resF32); }
+static void run_power_f32(void)  { arm_power_f32(SRC(float32_t), N, &resF32); }
+static void run_rms_f32(void)    { arm_rms_f32(SRC(float32_t), N, &resF32); }
+static void run_std_f32(void)    { arm_std_f32(SRC(float32_t), N, &resF32); }
+static void run_var_f32(void)    { arm_var_f32(SRC(float32_t), N, &resF32); }
+static void run_min_f32(void)    { arm_min_f32(SRC(float32_t), N, &resF32, &resIndex); }
+static void run_max_f32(void)    { arm_max_f32(SRC(float32_t), N, &resF32, &resIndex); }
+static void run_mean_q31(void)   { arm_mean_q31(SRC(q31_t), N, &resQ31); }
+static void run_power_q31(void)  { arm_power_q31(SRC(q31_t), N, &resQ63); }
+static void run_rms_q31(void)    { arm_rms_q31(SRC(q31_t), N, &resQ31); }
+static void run_std_q31(void)    { arm_std_q31(SRC(q31_t), N, &resQ31); }
+static void run_var_q31(void)    { arm_var_q31(SRC(q31_t), N, &resQ63); }
+static void run_min_q31(void)    { arm_min_q31(SRC(q31_t), N, &resQ31, &resIndex); }
+static void run_max_q31(void)    { arm_max_q31(SRC(q31_t), N, &resQ31, &resIndex); }
+static void run_mean_q15(void)   { arm_mean_q15(SRC(q15_t), N, &resQ15); }
+static void run_power_q15(void)  { arm_power_q15(SRC(q15_t), N, &resQ63); }
+static void run_rms_q15(void)    { arm_rms_q15(SRC(q15_t), N, &resQ15); }
+static void run_std_q15(void)    { arm_std_q15(SRC(q15_t), N, &resQ15); }
+static void run_var_q15(void)    { arm_var_q15(SRC(q15_t), N, &resQ31); }
+static void run_min_q15(void)    { arm_min_q15(SRC(q15_t), N, &resQ15, &resIndex); }
+static void run_max_q15(void)    { arm_max_q15(SRC(q15_t), N, &resQ15, &resIndex); }
+static void run_mean_q7(void)    { arm_mean_q7(SRC(q7_t), N, &resQ7); }
+static void run_power_q7(void)   { arm_power_q7(SRC(q7_t), N, &resQ31); }
+static void run_min_q7(void)     { arm_min_q7(SRC(q7_t), N, &resQ7, &resIndex); }
+static void run_max_q7(void)     { arm_max_q7(SRC(q7_t), N, &resQ7, &resIndex); }
+static void run_stats_f32(void)  { arm_stats_f32(SRC(float32_t), N, &statsF32); }
+static void run_stats_q31(void)  { arm_stats_q31(SRC(q31_t), N, &statsQ31); }
+static void run_stats_q15(void)  { arm_stats_q15(SRC(q15_t), N, &statsQ15); }
+static void run_stats_q7(void)   { arm_stats_q7(SRC(q7_t), N, &statsQ7); }
+
+/* The separate functions that arm_stats_xxx() replaces */
+static void run_stats_sep_f32(void)
+{
+  arm_mean_f32(SRC(float32_t), N, &statsF32.mean);
+  arm_var_f32(SRC(float32_t), N, &statsF32.var);
+  arm_std_f32(SRC(float32_t), N, &statsF32.std);
+  arm_rms_f32(SRC(float32_t), N, &statsF32.rms);
+  arm_min_f32(SRC(float32_t), N, &statsF32.min, &statsF32.minIndex);
+  arm_max_f32(SRC(float32_t), N, &statsF32.max, &statsF32.maxIndex);
+}
+
+static void run_stats_sep_q31(void)
+{
+  arm_mean_q31(SRC(q31_t), N, &statsQ31.mean);
+  arm_var_q31(SRC(q31_t), N, &resQ63);
+  arm_std_q31(SRC(q31_t), N, &statsQ31.std);
+  arm_rms_q31(SRC(q31_t), N, &statsQ31.rms);
+  arm_min_q31(SRC(q31_t), N, &statsQ31.min, &statsQ31.minIndex);
+  arm_max_q31(SRC(q31_t), N, &statsQ31.max, &statsQ31.maxIndex);
+}
+
+static void run_stats_sep_q15(void)
+{
+  arm_mean_q15(SRC(q15_t), N, &statsQ15.mean);
+  arm_var_q15(SRC(q15_t), N, &resQ31);
+  arm_std_q15(SRC(q15_t), N, &statsQ15.std);
+  arm_rms_q15(SRC(q15_t), N, &statsQ15.rms);
+  arm_min_q15(SRC(q15_t), N, &statsQ15.min, &statsQ15.minIndex);
+  arm_max_q15(SRC(q15_t), N, &statsQ15.max, &statsQ15.maxIndex);
+}
+
+/* There are no variance, standard deviation and RMS functions of Q7 */
+static void run_stats_sep_q7(void)
+{
+  arm_mean_q7(SRC(q7_t), N, &statsQ7.mean);
+  arm_power_q7(SRC(q7_t), N, &resQ31);
+  arm_min_q7(SRC(q7_t), N, &statsQ7.min, &statsQ7.minIndex);
+  arm_max_q7(SRC(q7_t), N, &statsQ7.max, &statsQ7.maxIndex);
+}
+
+static void bench_statistics(void)
+{
+  const char *g = "statistics";
+
+  for (N = 32u; N <= MAX_BLOCKSIZE; N <<= 1)
+  {
+    fill_f32(SRC(float32_t), N);
+    bench(g, "arm_mean_f32", "f32", N, N, run_mean_f32, NULL);
+    bench(g, "arm_power_f32", "f32", N, N, run_power_f32, NULL);
+    bench(g, "arm_rms_f32", "f32", N, N, run_rms_f32, NULL);
+    bench(g, "arm_std_f32", "f32", N, N, run_std_f32, NULL);
+    bench(g, "arm_var_f32", "f32", N, N, run_var_f32, NULL);
+    bench(g, "arm_min_f32", "f32", N, N, run_min_f32, NULL);
+    bench(g, "arm_max_f32", "f32", N, N, run_max_f32, NULL);
+    bench(g, "arm_stats_f32", "f32", N, N, run_stats_f32, NULL);
+    bench(g, "arm_mean/var/std/rms/min/max_f32", "f32", N, N, run_stats_sep_f32, NULL);
+
+    fill_src_q31(N);
+    bench(g, "arm_mean_q31", "q31", N, N, run_mean_q31, NULL);
+    bench(g, "arm_power_q31", "q31", N, N, run_power_q31, NULL);
+    bench(g, "arm_rms_q31", "q31", N, N, run_rms_q31, NULL);
+    bench(g, "arm_std_q31", "q31", N, N, run_std_q31, NULL);
+    bench(g, "arm_var_q31", "q31", N, N, run_var_q31, NULL);
+    bench(g, "arm_min_q31", "q31", N, N, run_min_q31, NULL);
+    bench(g, "arm_max_q31", "q31", N, N, run_max_q31, NULL);
+    bench(g, "arm_stats_q31", "q31", N, N, run_stats_q31, NULL);
+    bench(g, "arm_mean/var/std/rms/min/max_q31", "q31", N, N, run_stats_sep_q31, NULL);
+
+    fill_src_q15(N);
+    bench(g, "arm_mean_q15", "q15", N, N, run_mean_q15, NULL);
+    bench(g, "arm_power_q15", "q15", N, N, run_power_q15, NULL);
+    bench(g, "arm_rms_q15", "q15", N, N, run_rms_q15, NULL);
+    bench(g, "arm_std_q15", "q15", N, N, run_std_q15, NULL);
+    bench(g, "arm_var_q15", "q15", N, N, run_var_q15, NULL);
+    bench(g, "arm_min_q15", "q15", N, N, run_min_q15, NULL);
+    bench(g, "arm_max_q15", "q15", N, N, run_max_q15, NULL);
+    bench(g, "arm_stats_q15", "q15", N, N, run_stats_q15, NULL);
+    bench(g, "arm_mean/var/std/rms/min/max_q15", "q15", N, N, run_stats_sep_q15, NULL);
+
+    fill_src_q7(N);
+    bench(g, "arm_mean_q7", "q7", N, N, run_mean_q7, NULL);
+    bench(g, "arm_power_q7", "q7", N, N, run_power_q7, NULL);
+    bench(g, "arm_min_q7", "q7", N, N, run_min_q7, NULL);
+    bench(g, "arm_max_q7", "q7", N, N, run_max_q7, NULL);
+    bench(g, "arm_stats_q7", "q7", N, N, run_stats_q7, NULL);
+    bench(g, "arm_mean/power/min/max_q7", "q7", N, N, run_stats_sep_q7, NULL);
+  }
+}
+
+
+int32_t main(void)
+{
+  bench_cycles_t t;
+  uint32_t i;
+
+  clockHz = bench_clock();
+
+  /* Cycles of an empty timed region */
+  overhead = (bench_cycles_t) -1;
+  for (i = 0u; i < 100u; i++)
+  {
+    t = bench_now();
+    run_none();
+    t = bench_now() - t;
+    if(t < overhead)
+    {
+      overhead = t;
+    }
+  }
+
+  printf("group,function,type,size,cycles,cycles_per_sample,msamples_per_s\n");
+  bench_filtering();
+  bench_biquad_df2T();
+  bench_multichannel();
+  bench_resample();
+  bench_long_fir();
+  bench_transform();
+  bench_bins();
+  bench_stft();
+  bench_matrix();
+  bench_solve();
+  bench_fast_math();
+  bench_statistics();
+
+#if defined (ARM_MATH_HOST)
+  return 0;
+#else
+  while(1);                             /* main function does not return */
+#endif
+}
+
+ /** \endlink */
@@ -82,7 +82,45 @@ void arm_dot_prod_f32(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2/AVX2 */
+  __HVF acc0 = __HVF_ZERO(), acc1 = __HVF_ZERO();    /* Partial sums, four accumulators hide the add latency */
+  __HVF acc2 = __HVF_ZERO(), acc3 = __HVF_ZERO();
+
+  blkCnt = blockSize / (4u * __HVF_LANES);
+
+  while(blkCnt > 0u)
+  {
+    acc0 = __HVF_MAC(acc0, __HVF_LOAD(pSrcA), __HVF_LOAD(pSrcB));
+    acc1 = __HVF_MAC(acc1, __HVF_LOAD(pSrcA + __HVF_LANES), __HVF_LOAD(pSrcB + __HVF_LANES));
+    acc2 = __HVF_MAC(acc2, __HVF_LOAD(pSrcA + 2 * __HVF_LANES), __HVF_LOAD(pSrcB + 2 * __HVF_LANES));
+    acc3 = __HVF_MAC(acc3, __HVF_LOAD(pSrcA + 3 * __HVF_LANES), __HVF_LOAD(pSrcB + 3 * __HVF_LANES));
+    pSrcA += 4 * __HVF_LANES;
+    pSrcB += 4 * __HVF_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = (blockSize % (4u * __HVF_LANES)) / __HVF_LANES;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = __HVF_MAC(acc0, __HVF_LOAD(pSrcA), __HVF_LOAD(pSrcB));
+    pSrcA += __HVF_LANES;
+    pSrcB += __HVF_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = __HVF_HSUM(__HVF_ADD(__HVF_ADD(acc0, acc1), __HVF_ADD(acc2, acc3)));
+
+  /* The remaining samples are added by the scalar loop */
+  blkCnt = blockSize % __HVF_LANES;
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   /*loop Unrolling */
@@ -114,7 +152,7 @@ void arm_dot_prod_f32(
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
-#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+#endif /* #if defined (ARM_MATH_SSE2) */
 
 
   while(blkCnt > 0u)
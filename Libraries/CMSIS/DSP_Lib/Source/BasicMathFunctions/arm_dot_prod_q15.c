@@ -77,6 +77,37 @@ void arm_dot_prod_q15(
 
 #ifndef ARM_MATH_CM0_FAMILY
 
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2.    
+   ** The pairs of products are summed to 64 bits as by __SMLALD, so the result is bit-exact. */
+  __m128i acc = _mm_setzero_si128();
+
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    acc = __HVI_ACC_MADD(acc, _mm_madd_epi16(_mm_loadu_si128((__m128i *) pSrcA),
+                                             _mm_loadu_si128((__m128i *) pSrcB)));
+    pSrcA += 8u;
+    pSrcB += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((blockSize & 4u) != 0u)
+  {
+    acc = __HVI_ACC_MADD(acc, _mm_madd_epi16(_mm_loadl_epi64((__m128i *) pSrcA),
+                                             _mm_loadl_epi64((__m128i *) pSrcB)));
+    pSrcA += 4u;
+    pSrcB += 4u;
+  }
+
+  sum = __HVI_HSUM64(acc);
+
+#else
+
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
 
@@ -96,6 +127,8 @@ void arm_dot_prod_q15(
     blkCnt--;
   }
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
   /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
    ** No loop unrolling is used. */
   blkCnt = blockSize % 0x4u;
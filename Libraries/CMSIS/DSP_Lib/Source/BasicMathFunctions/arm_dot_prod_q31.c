@@ -77,7 +77,38 @@ void arm_dot_prod_q31(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE41)
+
+  /* Run the below code for the host build with SSE4.1.    
+   ** Each 64-bit product is shifted before the addition as in the C code, so the result is bit-exact.    
+   ** The shift is biased by 2^49 per product, which is taken off the sum at the end. */
+  __m128i acc = _mm_setzero_si128();
+  __m128i inA, inB;
+
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* Products of the even and then the odd lanes */
+    acc = _mm_add_epi64(acc, __HVI_SRAI_EPI64_BIASED(_mm_mul_epi32(inA, inB), 14));
+    acc = _mm_add_epi64(acc, __HVI_SRAI_EPI64_BIASED(_mm_mul_epi32(_mm_srli_epi64(inA, 32),
+                                                                   _mm_srli_epi64(inB, 32)), 14));
+    pSrcA += 4u;
+    pSrcB += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = (q63_t) ((uint64_t) __HVI_HSUM64(acc) - ((uint64_t) (blockSize >> 2u) << 51u));
+
+  /* The remaining samples are added by the scalar loop */
+  blkCnt = blockSize % 0x4u;
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inA3, inA4;
@@ -121,7 +152,7 @@ void arm_dot_prod_q31(
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
-#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+#endif /* #if defined (ARM_MATH_SSE41) */
 
 
   while(blkCnt > 0u)
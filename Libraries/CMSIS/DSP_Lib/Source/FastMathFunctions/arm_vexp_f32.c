@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vexp_f32.c    
+*    
+* Description:	Floating-point vector exponential.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vexp Vector Exponential    
+ *    
+ * Computes the natural exponential of each element of a floating-point vector.    
+ *    
+ * \par Algorithm    
+ * The input is reduced to <code>x = n * ln2 + r</code> with <code>|r| <= ln2 / 2</code>,    
+ * using ln2 in two parts so that <code>r</code> is exact. <code>exp(r)</code> is a    
+ * polynomial of degree 7, and the result is scaled by <code>2<sup>n</sup></code>    
+ * through the exponent bits. The code is straight-line single-precision    
+ * arithmetic, with no table, no division and no branch, which the Cortex-M4 FPU pipelines.    
+ * The host build computes 4 values at a time with SSE2, bit-exact with the C code.    
+ *    
+ * \par Accuracy    
+ * The maximum error is 1 ULP, measured over all the single-precision inputs    
+ * with a normal result.    
+ * Inputs above 88.72 give +Inf, and results below 2<sup>-126</sup> are subnormal    
+ * or zero. NaN gives NaN.    
+ */
+
+/**    
+ * @addtogroup vexp    
+ * @{    
+ */
+
+/* Limits of the input. exp(89) overflows, and exp(-104) is below the smallest subnormal */
+#define VEXP_MAX          89.0f
+#define VEXP_MIN          -104.0f
+
+/* Rounding to an integer by the addition of 1.5 * 2^23 */
+#define VEXP_LOG2E        1.44269504088896341f
+#define VEXP_ROUND        12582912.0f
+#define VEXP_ROUND_BITS   0x4B400000
+
+/* ln2 in two parts, the first with 9 significant bits */
+#define VEXP_LN2_HI       0.693359375f
+#define VEXP_LN2_LO       -2.12194440e-4f
+
+/* Polynomial of exp(r) - 1 - r - r^2 / 2 on |r| <= ln2 / 2 */
+#define VEXP_C0           1.9875691500e-4f
+#define VEXP_C1           1.3981999507e-3f
+#define VEXP_C2           8.3334519073e-3f
+#define VEXP_C3           4.1665795894e-2f
+#define VEXP_C4           1.6666665459e-1f
+#define VEXP_C5           5.0000001201e-1f
+
+/**    
+ * @brief  Exponential of one value.    
+ * @param[in]  x  input value.    
+ * @return exp(x).    
+ */
+
+static __INLINE float32_t arm_vexp_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } t, s1, s2;                                   /* Bits of the rounding and of the scales */
+  float32_t n, r, p;
+  int32_t e, e1;                                 /* Exponent of the result */
+
+  x = (x > VEXP_MAX) ? VEXP_MAX : x;
+  x = (x < VEXP_MIN) ? VEXP_MIN : x;
+
+  /* n = round(x / ln2) */
+  t.f = x * VEXP_LOG2E + VEXP_ROUND;
+  e = (int32_t) (t.u - VEXP_ROUND_BITS);
+  n = t.f - VEXP_ROUND;
+
+  /* r = x - n * ln2 */
+  r = x - n * VEXP_LN2_HI;
+  r = r - n * VEXP_LN2_LO;
+
+  /* exp(r) */
+  p = VEXP_C0;
+  p = p * r + VEXP_C1;
+  p = p * r + VEXP_C2;
+  p = p * r + VEXP_C3;
+  p = p * r + VEXP_C4;
+  p = p * r + VEXP_C5;
+  p = p * (r * r) + r;
+  p = p + 1.0f;
+
+  /* exp(r) * 2^n, with 2^n in two factors so that n = 128 overflows and n < -126 gives subnormals */
+  e1 = e >> 1;
+  s1.u = (uint32_t) (e1 + 127) << 23;
+  s2.u = (uint32_t) (e - e1 + 127) << 23;
+
+  return (p * s1.f * s2.f);
+}
+
+#if defined (ARM_MATH_SSE2)
+
+/**    
+ * @brief  Exponential of 4 values, bit-exact with arm_vexp_core_f32().    
+ */
+
+static __INLINE __m128 arm_vexp_sse_f32(
+  __m128 x)
+{
+  __m128 t, n, r, p;
+  __m128i e, e1;
+
+  x = _mm_min_ps(_mm_set1_ps(VEXP_MAX), x);
+  x = _mm_max_ps(_mm_set1_ps(VEXP_MIN), x);
+
+  t = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(VEXP_LOG2E)), _mm_set1_ps(VEXP_ROUND));
+  e = _mm_sub_epi32(_mm_castps_si128(t), _mm_set1_epi32(VEXP_ROUND_BITS));
+  n = _mm_sub_ps(t, _mm_set1_ps(VEXP_ROUND));
+
+  r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(VEXP_LN2_HI)));
+  r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(VEXP_LN2_LO)));
+
+  p = _mm_set1_ps(VEXP_C0);
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C1));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C2));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C3));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C4));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C5));
+  p = _mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r);
+  p = _mm_add_ps(p, _mm_set1_ps(1.0f));
+
+  e1 = _mm_srai_epi32(e, 1);
+  e = _mm_sub_epi32(e, e1);
+  p = _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e1, _mm_set1_epi32(127)), 23)));
+
+  return (_mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e, _mm_set1_epi32(127)), 23))));
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @brief  Floating-point vector exponential.    
+ * @param[in]   *pSrc      points to the input vector    
+ * @param[out]  *pDst      points to the output vector, exp(pSrc[n])    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, arm_vexp_sse_f32(_mm_loadu_ps(pSrc)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vexp_core_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vexp group    
+ */
@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vlog_f32.c    
+*    
+* Description:	Floating-point vector natural logarithm.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vlog Vector Logarithm    
+ *    
+ * Computes the natural or base 10 logarithm of each element of a vector.    
+ *    
+ * \par Floating-point algorithm    
+ * The input is split into <code>2<sup>e</sup> * (1 + f)</code>, with <code>1 + f</code>    
+ * in [sqrt(0.5), sqrt(2)) and subnormal inputs scaled first.    
+ * <code>log(1 + f) = f - f<sup>2</sup>/2 + f<sup>3</sup> * P(f)</code>, with <code>P</code> of degree 8,    
+ * and <code>e * ln2</code> is added with ln2 in two parts. The base 10 logarithm multiplies each    
+ * term by log10(e) or log10(2), also in two parts, rather than the natural logarithm as a whole.    
+ * The code is straight-line single-precision arithmetic that the Cortex-M4 FPU pipelines.    
+ * The host build computes 4 values at a time with SSE2, bit-exact with the C code.    
+ *    
+ * \par    
+ * The maximum error is 1 ULP for arm_vlog_f32() and 2 ULP for arm_vlog10_f32(),    
+ * measured over all the positive single-precision inputs.    
+ * +Inf gives +Inf, zero gives -Inf, and negative values and NaN give NaN.    
+ *    
+ * \par Fixed-point algorithm    
+ * The input is normalized with a count of the leading zeros. The upper 6 bits of the mantissa    
+ * select a reciprocal <code>c</code> of <code>armRecipTableQ31</code> and    
+ * <code>-log(c)</code> in <code>armLogTableQ31</code>. <code>log(1 + d)</code>, <code>d = m * c - 1</code>    
+ * with <code>|d| <= 2<sup>-7</sup></code>, is a short series. The Q15 function rounds <code>c</code>    
+ * to 1.17 format, so that <code>m * c</code> fits in 32 bits.    
+ * The Q31 function returns log(x) in 5.26 format with an error below 0.6 LSB, and the Q15    
+ * function returns it in 4.11 format with an error below 0.52 LSB, over all the positive inputs.    
+ * Zero and negative inputs give the most negative value.    
+ * These use integer arithmetic only and are not vectorized on the host.    
+ */
+
+/**    
+ * @addtogroup vlog    
+ * @{    
+ */
+
+/* Smallest normal value, and the scale of the subnormals, 2^23 */
+#define VLOG_FLT_MIN      1.17549435e-38f
+#define VLOG_FLT_MAX      3.40282347e+38f
+#define VLOG_SUB_SCALE    8388608.0f
+
+/* Mantissa of sqrt(2) with the exponent of 1.0 */
+#define VLOG_SQRT2_BITS   0x3FB504F3
+
+/* Polynomial of (log(1 + f) - f + f^2 / 2) / f^3 on sqrt(0.5) - 1 <= f < sqrt(2) - 1 */
+#define VLOG_C0           7.0376836292e-2f
+#define VLOG_C1           -1.1514610310e-1f
+#define VLOG_C2           1.1676998740e-1f
+#define VLOG_C3           -1.2420140846e-1f
+#define VLOG_C4           1.4249322787e-1f
+#define VLOG_C5           -1.6668057665e-1f
+#define VLOG_C6           2.0000714765e-1f
+#define VLOG_C7           -2.4999993993e-1f
+#define VLOG_C8           3.3333331174e-1f
+
+/* ln2 in two parts, the first with 9 significant bits */
+#define VLOG_LN2_HI       0.693359375f
+#define VLOG_LN2_LO       -2.12194440e-4f
+
+/**    
+ * @brief  Natural logarithm of one value.    
+ * @param[in]  x  input value.    
+ * @return log(x).    
+ */
+
+static __INLINE float32_t arm_vlog_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } v, r;                                        /* Bits of the input and of the result */
+  float32_t f, z, y, ef;
+  int32_t e;                                     /* Exponent of the input */
+  uint32_t sub = (x < VLOG_FLT_MIN);             /* Subnormal (or negative) input */
+
+  /* x = 2^e * (1 + f), 1 + f in [sqrt(0.5), sqrt(2)) */
+  v.f = sub ? x * VLOG_SUB_SCALE : x;
+  e = (int32_t) (v.u >> 23) - (sub ? 150 : 127);
+  v.u = (v.u & 0x007FFFFFu) | 0x3F800000u;
+  if(v.u > VLOG_SQRT2_BITS)
+  {
+    v.u -= 0x00800000u;
+    e++;
+  }
+  f = v.f - 1.0f;
+  ef = (float32_t) e;
+
+  /* log(1 + f) - f */
+  z = f * f;
+  y = VLOG_C0;
+  y = y * f + VLOG_C1;
+  y = y * f + VLOG_C2;
+  y = y * f + VLOG_C3;
+  y = y * f + VLOG_C4;
+  y = y * f + VLOG_C5;
+  y = y * f + VLOG_C6;
+  y = y * f + VLOG_C7;
+  y = y * f + VLOG_C8;
+  y = y * f * z;
+
+  /* log(x) = f + (log(1 + f) - f) + e * ln2 */
+  y = y + ef * VLOG_LN2_LO;
+  y = y - 0.5f * z;
+  f = f + y;
+  r.f = f + ef * VLOG_LN2_HI;
+
+  /* +Inf, then zero (-Inf), negative values and NaN (NaN) */
+  if(x > VLOG_FLT_MAX)
+  {
+    r.f = x;
+  }
+  if(!(x > 0.0f))
+  {
+    r.u = (x == 0.0f) ? 0xFF800000u : 0x7FC00000u;
+  }
+
+  return (r.f);
+}
+
+#if defined (ARM_MATH_SSE2)
+
+/**    
+ * @brief  Natural logarithm of 4 values, bit-exact with arm_vlog_core_f32().    
+ */
+
+static __INLINE __m128 arm_vlog_sse_f32(
+  __m128 x)
+{
+  __m128 sub, v, f, z, y, ef, mask;
+  __m128i u, e;
+
+  sub = _mm_cmplt_ps(x, _mm_set1_ps(VLOG_FLT_MIN));
+  v = _mm_or_ps(_mm_and_ps(sub, _mm_mul_ps(x, _mm_set1_ps(VLOG_SUB_SCALE))), _mm_andnot_ps(sub, x));
+  u = _mm_castps_si128(v);
+  e = _mm_sub_epi32(_mm_srli_epi32(u, 23),
+                    _mm_or_si128(_mm_and_si128(_mm_castps_si128(sub), _mm_set1_epi32(150)),
+                                 _mm_andnot_si128(_mm_castps_si128(sub), _mm_set1_epi32(127))));
+  u = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000));
+  mask = _mm_castsi128_ps(_mm_cmpgt_epi32(u, _mm_set1_epi32(VLOG_SQRT2_BITS)));
+  u = _mm_sub_epi32(u, _mm_and_si128(_mm_castps_si128(mask), _mm_set1_epi32(0x00800000)));
+  e = _mm_sub_epi32(e, _mm_castps_si128(mask));
+  f = _mm_sub_ps(_mm_castsi128_ps(u), _mm_set1_ps(1.0f));
+  ef = _mm_cvtepi32_ps(e);
+
+  z = _mm_mul_ps(f, f);
+  y = _mm_set1_ps(VLOG_C0);
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C1));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C2));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C3));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C4));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C5));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C6));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C7));
+  y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(VLOG_C8));
+  y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+
+  y = _mm_add_ps(y, _mm_mul_ps(ef, _mm_set1_ps(VLOG_LN2_LO)));
+  y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+  f = _mm_add_ps(f, y);
+  f = _mm_add_ps(f, _mm_mul_ps(ef, _mm_set1_ps(VLOG_LN2_HI)));
+
+  mask = _mm_cmpgt_ps(x, _mm_set1_ps(VLOG_FLT_MAX));
+  f = _mm_or_ps(_mm_and_ps(mask, x), _mm_andnot_ps(mask, f));
+  mask = _mm_cmpeq_ps(x, _mm_setzero_ps());
+  y = _mm_or_ps(_mm_and_ps(mask, _mm_castsi128_ps(_mm_set1_epi32((int32_t) 0xFF800000))),
+                _mm_andnot_ps(mask, _mm_castsi128_ps(_mm_set1_epi32(0x7FC00000))));
+  mask = _mm_cmpgt_ps(x, _mm_setzero_ps());
+
+  return (_mm_or_ps(_mm_and_ps(mask, f), _mm_andnot_ps(mask, y)));
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @brief  Floating-point vector natural logarithm.    
+ * @param[in]   *pSrc      points to the input vector    
+ * @param[out]  *pDst      points to the output vector, log(pSrc[n])    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, arm_vlog_sse_f32(_mm_loadu_ps(pSrc)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vlog_core_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vlog group    
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vlog_q15.c    
+*    
+* Description:	Q15 vector natural logarithm.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup vlog    
+ * @{    
+ */
+
+/* ln2 in 8.24 format */
+#define VLOG_LN2_Q24      11629080u
+
+/**    
+ * @brief  Q15 vector natural logarithm.    
+ * @param[in]   *pSrc      points to the input vector    
+ * @param[out]  *pDst      points to the output vector, log(pSrc[n]) in 4.11 format    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ *    
+ * \par    
+ * The logarithm of the smallest positive input, 2<sup>-15</sup>, is -10.4.    
+ * Zero and negative inputs give 0x8000. The arithmetic is 32-bit.    
+ */
+
+void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* input value */
+  q31_t d, acc;                                  /* residual and logarithm in 12.20 format */
+  uint32_t m, c, idx, n;                         /* mantissa, reciprocal, table index and shift */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in > 0)
+    {
+      /* in = m * 2^-(n + 1), m in [1, 2) in 2.14 format */
+      n = __CLZ((uint32_t) in) - 17u;
+      m = (uint32_t) in << n;
+
+      /* c in 1.17 format, rounded from the reciprocal of which armLogTableQ31 holds the logarithm */
+      idx = (m >> 8) & 0x3Fu;
+      c = ((uint32_t) armRecipTableQ31[idx] + (1u << 13)) >> 14;
+
+      /* d = m * c - 1, |d| <= 2^-7, in 12.20 format */
+      d = ((q31_t) (m * c - 0x80000000u) + (1 << 10)) >> 11;
+
+      /* log(in) = -log(c) + d - d^2 / 2 - (n + 1) * ln2, each term rounded */
+      acc = ((armLogTableQ31[idx] + (1 << 10)) >> 11) + d - ((d * d + (1 << 20)) >> 21)
+        - (q31_t) (((n + 1u) * VLOG_LN2_Q24 + 8u) >> 4);
+
+      /* Round to 4.11 format */
+      *pDst++ = (q15_t) ((acc + (1 << 8)) >> 9);
+    }
+    else
+    {
+      *pDst++ = (q15_t) 0x8000;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vlog group    
+ */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vlog_q31.c    
+*    
+* Description:	Q31 vector natural logarithm.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup vlog    
+ * @{    
+ */
+
+/* ln2 in 8.56 format */
+#define VLOG_LN2_Q56      ((q63_t) 49946518145322872LL)
+
+/**    
+ * @brief  Q31 vector natural logarithm.    
+ * @param[in]   *pSrc      points to the input vector    
+ * @param[out]  *pDst      points to the output vector, log(pSrc[n]) in 5.26 format    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ *    
+ * \par    
+ * The logarithm of the smallest positive input, 2<sup>-31</sup>, is -21.49.    
+ * Zero and negative inputs give 0x80000000.    
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* input value */
+  q31_t d, d2, d3, d4;                           /* powers of the residual */
+  q63_t acc;                                     /* logarithm in 8.56 format */
+  uint32_t m, idx, n;                            /* mantissa, table index and shift */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in > 0)
+    {
+      /* in = m * 2^-(n + 1), m in [1, 2) in 2.30 format */
+      n = __CLZ((uint32_t) in) - 1u;
+      m = (uint32_t) in << n;
+
+      /* d = m * c - 1, |d| <= 2^-7, in 1.31 format */
+      idx = (m >> 24) & 0x3Fu;
+      d = (q31_t) ((((q63_t) m * armRecipTableQ31[idx]) - ((q63_t) 1 << 61)) >> 30);
+
+      /* log(1 + d) = d - d^2 / 2 + d^3 / 3 - d^4 / 4 */
+      d2 = (q31_t) (((q63_t) d * d) >> 31);
+      d3 = (q31_t) (((q63_t) d2 * d) >> 31);
+      d4 = (q31_t) (((q63_t) d2 * d2) >> 31);
+      d = d - (d2 >> 1) + (q31_t) (((q63_t) d3 * 0x2AAAAAAB) >> 31) - (d4 >> 2);
+
+      /* log(in) = -log(c) + log(1 + d) - (n + 1) * ln2 */
+      acc = ((q63_t) (armLogTableQ31[idx] + d) << 25) - (q63_t) (n + 1u) * VLOG_LN2_Q56;
+
+      /* Round to 5.26 format */
+      *pDst++ = (q31_t) ((acc + ((q63_t) 1 << 29)) >> 30);
+    }
+    else
+    {
+      *pDst++ = (q31_t) 0x80000000;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vlog group    
+ */
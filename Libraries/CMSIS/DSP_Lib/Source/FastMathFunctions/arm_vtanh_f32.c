@@ -0,0 +1,307 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vtanh_f32.c    
+*    
+* Description:	Floating-point vector hyperbolic tangent.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vtanh Vector Hyperbolic Tangent    
+ *    
+ * Computes the hyperbolic tangent of each element of a floating-point vector,    
+ * for example as a soft limiter.    
+ *    
+ * \par Algorithm    
+ * Below 0.625 in magnitude, <code>tanh(x) = x + x<sup>3</sup> * P(x<sup>2</sup>)</code>    
+ * with <code>P</code> of degree 4. Above, <code>tanh(|x|) = 1 - 2 / (exp(2|x|) + 1)</code>,    
+ * with the exponential of \ref vexp and the magnitude limited to 9, where the result rounds to 1.    
+ * Both are computed and one is selected, so the code has no branch.    
+ * The host build computes 4 values at a time with SSE2, bit-exact with the C code.    
+ *    
+ * \par Accuracy    
+ * The maximum error is 2 ULP, measured over all the single-precision inputs.    
+ * +-Inf gives +-1 and NaN gives NaN.    
+ */
+
+/**    
+ * @addtogroup vtanh    
+ * @{    
+ */
+
+/* Magnitude below which the polynomial is used, and above which the result is 1 */
+#define VTANH_SMALL       0.625f
+#define VTANH_LARGE       9.0f
+
+/* Polynomial of (tanh(x) - x) / x^3 in x^2 */
+#define VTANH_C0          -5.70498872745e-3f
+#define VTANH_C1          2.06390887954e-2f
+#define VTANH_C2          -5.37397155531e-2f
+#define VTANH_C3          1.33314422036e-1f
+#define VTANH_C4          -3.33332819422e-1f
+
+/* Limits of the input. exp(89) overflows, and exp(-104) is below the smallest subnormal */
+#define VEXP_MAX          89.0f
+#define VEXP_MIN          -104.0f
+
+/* Rounding to an integer by the addition of 1.5 * 2^23 */
+#define VEXP_LOG2E        1.44269504088896341f
+#define VEXP_ROUND        12582912.0f
+#define VEXP_ROUND_BITS   0x4B400000
+
+/* ln2 in two parts, the first with 9 significant bits */
+#define VEXP_LN2_HI       0.693359375f
+#define VEXP_LN2_LO       -2.12194440e-4f
+
+/* Polynomial of exp(r) - 1 - r - r^2 / 2 on |r| <= ln2 / 2 */
+#define VEXP_C0           1.9875691500e-4f
+#define VEXP_C1           1.3981999507e-3f
+#define VEXP_C2           8.3334519073e-3f
+#define VEXP_C3           4.1665795894e-2f
+#define VEXP_C4           1.6666665459e-1f
+#define VEXP_C5           5.0000001201e-1f
+
+/**    
+ * @brief  Exponential of one value.    
+ * @param[in]  x  input value.    
+ * @return exp(x).    
+ */
+
+static __INLINE float32_t arm_vexp_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } t, s1, s2;                                   /* Bits of the rounding and of the scales */
+  float32_t n, r, p;
+  int32_t e, e1;                                 /* Exponent of the result */
+
+  x = (x > VEXP_MAX) ? VEXP_MAX : x;
+  x = (x < VEXP_MIN) ? VEXP_MIN : x;
+
+  /* n = round(x / ln2) */
+  t.f = x * VEXP_LOG2E + VEXP_ROUND;
+  e = (int32_t) (t.u - VEXP_ROUND_BITS);
+  n = t.f - VEXP_ROUND;
+
+  /* r = x - n * ln2 */
+  r = x - n * VEXP_LN2_HI;
+  r = r - n * VEXP_LN2_LO;
+
+  /* exp(r) */
+  p = VEXP_C0;
+  p = p * r + VEXP_C1;
+  p = p * r + VEXP_C2;
+  p = p * r + VEXP_C3;
+  p = p * r + VEXP_C4;
+  p = p * r + VEXP_C5;
+  p = p * (r * r) + r;
+  p = p + 1.0f;
+
+  /* exp(r) * 2^n, with 2^n in two factors so that n = 128 overflows and n < -126 gives subnormals */
+  e1 = e >> 1;
+  s1.u = (uint32_t) (e1 + 127) << 23;
+  s2.u = (uint32_t) (e - e1 + 127) << 23;
+
+  return (p * s1.f * s2.f);
+}
+
+/**    
+ * @brief  Hyperbolic tangent of one value.    
+ * @param[in]  x  input value.    
+ * @return tanh(x).    
+ */
+
+static __INLINE float32_t arm_vtanh_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } a, s, l;                                     /* Bits of |x|, of the small and of the large result */
+  float32_t z;
+  uint32_t sign;
+
+  a.f = x;
+  sign = a.u & 0x80000000u;
+  a.u = a.u & 0x7FFFFFFFu;
+
+  /* tanh(|x|) = |x| + |x|^3 * P(x^2) */
+  z = a.f * a.f;
+  s.f = VTANH_C0;
+  s.f = s.f * z + VTANH_C1;
+  s.f = s.f * z + VTANH_C2;
+  s.f = s.f * z + VTANH_C3;
+  s.f = s.f * z + VTANH_C4;
+  s.f = s.f * z * a.f + a.f;
+
+  /* tanh(|x|) = 1 - 2 / (exp(2|x|) + 1) */
+  z = arm_vexp_core_f32(2.0f * ((a.f > VTANH_LARGE) ? VTANH_LARGE : a.f));
+  l.f = 1.0f - 2.0f / (z + 1.0f);
+
+  s.u = ((a.f < VTANH_SMALL) ? s.u : l.u) | sign;
+
+  return (s.f);
+}
+
+#if defined (ARM_MATH_SSE2)
+
+/**    
+ * @brief  Exponential of 4 values, bit-exact with arm_vexp_core_f32().    
+ */
+
+static __INLINE __m128 arm_vexp_sse_f32(
+  __m128 x)
+{
+  __m128 t, n, r, p;
+  __m128i e, e1;
+
+  x = _mm_min_ps(_mm_set1_ps(VEXP_MAX), x);
+  x = _mm_max_ps(_mm_set1_ps(VEXP_MIN), x);
+
+  t = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(VEXP_LOG2E)), _mm_set1_ps(VEXP_ROUND));
+  e = _mm_sub_epi32(_mm_castps_si128(t), _mm_set1_epi32(VEXP_ROUND_BITS));
+  n = _mm_sub_ps(t, _mm_set1_ps(VEXP_ROUND));
+
+  r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(VEXP_LN2_HI)));
+  r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(VEXP_LN2_LO)));
+
+  p = _mm_set1_ps(VEXP_C0);
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C1));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C2));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C3));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C4));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(VEXP_C5));
+  p = _mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r);
+  p = _mm_add_ps(p, _mm_set1_ps(1.0f));
+
+  e1 = _mm_srai_epi32(e, 1);
+  e = _mm_sub_epi32(e, e1);
+  p = _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e1, _mm_set1_epi32(127)), 23)));
+
+  return (_mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e, _mm_set1_epi32(127)), 23))));
+}
+
+/**    
+ * @brief  Hyperbolic tangent of 4 values, bit-exact with arm_vtanh_core_f32().    
+ */
+
+static __INLINE __m128 arm_vtanh_sse_f32(
+  __m128 x)
+{
+  __m128 sign, a, z, s, l, mask;
+
+  sign = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t) 0x80000000)));
+  a = _mm_andnot_ps(sign, x);
+
+  z = _mm_mul_ps(a, a);
+  s = _mm_set1_ps(VTANH_C0);
+  s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(VTANH_C1));
+  s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(VTANH_C2));
+  s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(VTANH_C3));
+  s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(VTANH_C4));
+  s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), a), a);
+
+  z = arm_vexp_sse_f32(_mm_mul_ps(_mm_set1_ps(2.0f), _mm_min_ps(_mm_set1_ps(VTANH_LARGE), a)));
+  l = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(z, _mm_set1_ps(1.0f))));
+
+  mask = _mm_cmplt_ps(a, _mm_set1_ps(VTANH_SMALL));
+
+  return (_mm_or_ps(_mm_or_ps(_mm_and_ps(mask, s), _mm_andnot_ps(mask, l)), sign));
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @brief  Floating-point vector hyperbolic tangent.    
+ * @param[in]   *pSrc      points to the input vector    
+ * @param[out]  *pDst      points to the output vector, tanh(pSrc[n])    
+ * @param[in]   blockSize  number of samples in the vectors    
+ * @return none.    
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, arm_vtanh_sse_f32(_mm_loadu_ps(pSrc)));
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vtanh_core_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vtanh group    
+ */
@@ -192,7 +192,143 @@ void arm_biquad_cascade_df1_f32(
   uint32_t sample, stage = S->numStages;         /*  loop counters             */
 
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  __m128 vb0, vb1, vb2, va1, va2;                /*  Coefficients of 4 stages  */
+  __m128 vXn, vXn1, vXn2, vYn1, vYn2, vacc, vm;  /*  State of 4 stages         */
+  __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+  float32_t st[5][4];
+  uint32_t t, j;
+
+  /*    
+   * Groups of 4 stages run as a pipeline, stage j of the group on lane j.    
+   * At step t, lane j computes sample t - j from the output of lane j - 1    
+   * at the previous step, so a group takes blockSize + 3 steps. The lanes    
+   * outside the block in the first and last 3 steps keep their state. Each    
+   * lane computes the same expression as the C code, so the result is    
+   * bit-exact.    
+   */
+  while(stage >= 4u)
+  {
+    for (j = 0u; j < 4u; j++)
+    {
+      st[0][j] = pCoeffs[5u * j];
+      st[1][j] = pCoeffs[5u * j + 1u];
+      st[2][j] = pCoeffs[5u * j + 2u];
+      st[3][j] = pCoeffs[5u * j + 3u];
+      st[4][j] = pCoeffs[5u * j + 4u];
+    }
+    vb0 = _mm_loadu_ps(st[0]);
+    vb1 = _mm_loadu_ps(st[1]);
+    vb2 = _mm_loadu_ps(st[2]);
+    va1 = _mm_loadu_ps(st[3]);
+    va2 = _mm_loadu_ps(st[4]);
+
+    for (j = 0u; j < 4u; j++)
+    {
+      st[0][j] = pState[4u * j];
+      st[1][j] = pState[4u * j + 1u];
+      st[2][j] = pState[4u * j + 2u];
+      st[3][j] = pState[4u * j + 3u];
+    }
+    vXn1 = _mm_loadu_ps(st[0]);
+    vXn2 = _mm_loadu_ps(st[1]);
+    vYn1 = _mm_loadu_ps(st[2]);
+    vYn2 = _mm_loadu_ps(st[3]);
+    vacc = _mm_setzero_ps();
+
+    for (t = 0u; t < blockSize + 3u; t++)
+    {
+      /* Input of lane 0 is the next sample, lanes 1 to 3 take the previous outputs */
+      Xn = (t < blockSize) ? pIn[t] : 0.0f;
+      vXn = _mm_move_ss(_mm_shuffle_ps(vacc, vacc, _MM_SHUFFLE(2, 1, 0, 0)), _mm_set_ss(Xn));
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      vacc = _mm_mul_ps(vb0, vXn);
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(vb1, vXn1));
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(vb2, vXn2));
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(va1, vYn1));
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(va2, vYn2));
+
+      if(t < 3u || t >= blockSize)
+      {
+        /* Lanes with 0 <= t - j < blockSize update their state */
+        vm = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t) t + 1), lane),
+                                            _mm_cmpgt_epi32(lane, _mm_set1_epi32((int32_t) t - (int32_t) blockSize))));
+        vXn2 = _mm_or_ps(_mm_and_ps(vm, vXn1), _mm_andnot_ps(vm, vXn2));
+        vXn1 = _mm_or_ps(_mm_and_ps(vm, vXn), _mm_andnot_ps(vm, vXn1));
+        vYn2 = _mm_or_ps(_mm_and_ps(vm, vYn1), _mm_andnot_ps(vm, vYn2));
+        vYn1 = _mm_or_ps(_mm_and_ps(vm, vacc), _mm_andnot_ps(vm, vYn1));
+      }
+      else
+      {
+        vXn2 = vXn1;
+        vXn1 = vXn;
+        vYn2 = vYn1;
+        vYn1 = vacc;
+      }
+
+      /* Lane 3 completes sample t - 3, behind the samples still to be read when in-place */
+      if(t >= 3u)
+      {
+        pOut[t - 3u] = _mm_cvtss_f32(_mm_shuffle_ps(vacc, vacc, _MM_SHUFFLE(3, 3, 3, 3)));
+      }
+    }
+
+    /*  Store the updated state variables back into the pState array */
+    _mm_storeu_ps(st[0], vXn1);
+    _mm_storeu_ps(st[1], vXn2);
+    _mm_storeu_ps(st[2], vYn1);
+    _mm_storeu_ps(st[3], vYn2);
+    for (j = 0u; j < 4u; j++)
+    {
+      *pState++ = st[0][j];
+      *pState++ = st[1][j];
+      *pState++ = st[2][j];
+      *pState++ = st[3][j];
+    }
+
+    pCoeffs += 20u;
+    pIn = pDst;
+    stage -= 4u;
+  }
+
+  /* The remaining 1 to 3 stages */
+  while(stage > 0u)
+  {
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    for (sample = 0u; sample < blockSize; sample++)
+    {
+      Xn = pIn[sample];
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+      pOut[sample] = acc;
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = acc;
+    }
+
+    *pState++ = Xn1;
+    *pState++ = Xn2;
+    *pState++ = Yn1;
+    *pState++ = Yn2;
+
+    pIn = pDst;
+    stage--;
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -415,7 +551,7 @@ void arm_biquad_cascade_df1_f32(
 
   } while(stage > 0u);
 
-#endif /*   #ifndef ARM_MATH_CM0_FAMILY         */
+#endif /*   #if defined (ARM_MATH_SSE2)         */
 
 }
 
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_df1_mc_f32.c    
+*    
+* Description:	Processing function for the floating-point multichannel    
+*               Biquad cascade DirectFormI(DF1) filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * \par Multichannel filters    
+ * The <code>_mc</code> variants filter <code>numChannels</code> interleaved channels with the same    
+ * coefficients in one pass. A frame holds one sample of each channel, and <code>blockSize</code> counts frames.    
+ * Each stage runs over the whole block for a group of channels with their state held in registers,    
+ * and the output of each channel is the same as filtering that channel alone.    
+ */
+
+/**    
+ * @param[in]  *S         points to an instance of the floating-point multichannel Biquad cascade structure.    
+ * @param[in]  *pSrc      points to the block of interleaved input frames.    
+ * @param[out] *pDst      points to the block of interleaved output frames.    
+ * @param[in]  blockSize  number of frames to process.    
+ * @return     none.    
+ *    
+ * The output of each channel is the same as filtering that channel alone with    
+ * <code>arm_biquad_cascade_df1_f32()</code>. In-place processing is supported.    
+ */
+
+void arm_biquad_cascade_df1_mc_f32(
+  const arm_biquad_casd_df1_mc_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut;                               /*  destination pointer       */
+  float32_t *px;                                 /*  frame pointer             */
+  float32_t *pState = S->pState;                 /*  pState pointer            */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t acc;                                 /*  Simulates the accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn1, Xn2, Yn1, Yn2;                  /*  Filter state variables    */
+  float32_t Xn;                                  /*  temporary input           */
+  uint32_t numChannels = S->numChannels;         /*  number of channels        */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    ch = 0u;
+
+#if defined (ARM_MATH_SSE2)
+
+    /* Run the below code for the host build.    
+     ** Four channels are held in one vector. The state of the stage is stored    
+     ** as {x[n-1], x[n-2], y[n-1], y[n-2]}, each followed by all the channels.    
+     ** The sums are computed in the order of the C code, so the result is bit-exact. */
+    {
+      __m128 vb0 = _mm_set1_ps(b0), vb1 = _mm_set1_ps(b1), vb2 = _mm_set1_ps(b2);
+      __m128 va1 = _mm_set1_ps(a1), va2 = _mm_set1_ps(a2);
+      __m128 vXn, vXn1, vXn2, vYn1, vYn2, vacc;
+      float32_t *py;                             /*  output frame pointer      */
+
+      for (; (ch + 4u) <= numChannels; ch += 4u)
+      {
+        /* Reading the state values */
+        vXn1 = _mm_loadu_ps(pState + ch);
+        vXn2 = _mm_loadu_ps(pState + numChannels + ch);
+        vYn1 = _mm_loadu_ps(pState + (2u * numChannels) + ch);
+        vYn2 = _mm_loadu_ps(pState + (3u * numChannels) + ch);
+
+        px = pIn + ch;
+        py = pDst + ch;
+
+        sample = blockSize;
+
+        while(sample > 0u)
+        {
+          /* Read the input */
+          vXn = _mm_loadu_ps(px);
+
+          /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+          vacc = _mm_mul_ps(vb0, vXn);
+          vacc = _mm_add_ps(vacc, _mm_mul_ps(vb1, vXn1));
+          vacc = _mm_add_ps(vacc, _mm_mul_ps(vb2, vXn2));
+          vacc = _mm_add_ps(vacc, _mm_mul_ps(va1, vYn1));
+          vacc = _mm_add_ps(vacc, _mm_mul_ps(va2, vYn2));
+
+          /* Store the result in the accumulator in the destination buffer. */
+          _mm_storeu_ps(py, vacc);
+
+          /* Every time after the output is computed state should be updated. */
+          vXn2 = vXn1;
+          vXn1 = vXn;
+          vYn2 = vYn1;
+          vYn1 = vacc;
+
+          px += numChannels;
+          py += numChannels;
+
+          sample--;
+        }
+
+        /*  Store the updated state variables back into the pState array */
+        _mm_storeu_ps(pState + ch, vXn1);
+        _mm_storeu_ps(pState + numChannels + ch, vXn2);
+        _mm_storeu_ps(pState + (2u * numChannels) + ch, vYn1);
+        _mm_storeu_ps(pState + (3u * numChannels) + ch, vYn2);
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* The remaining channels, or all of them on the Cortex-M processors, are filtered one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      /* Reading the state values */
+      Xn1 = pState[ch];
+      Xn2 = pState[numChannels + ch];
+      Yn1 = pState[(2u * numChannels) + ch];
+      Yn2 = pState[(3u * numChannels) + ch];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+        /* Store the result in the accumulator in the destination buffer. */
+        *pOut = acc;
+
+        /* Every time after the output is computed state should be updated. */
+        /* The states should be updated as:    */
+        /* Xn2 = Xn1    */
+        /* Xn1 = Xn     */
+        /* Yn2 = Yn1    */
+        /* Yn1 = acc   */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = acc;
+
+        px += numChannels;
+        pOut += numChannels;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numChannels + ch] = Xn2;
+      pState[(2u * numChannels) + ch] = Yn1;
+      pState[(3u * numChannels) + ch] = Yn2;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent numStages  occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Move to the state of the next stage */
+    pState += 4u * numChannels;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
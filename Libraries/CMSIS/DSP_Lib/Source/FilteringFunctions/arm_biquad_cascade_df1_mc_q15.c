@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_df1_mc_q15.c    
+*    
+* Description:	Processing function for the Q15 multichannel Biquad cascade    
+*               DirectFormI(DF1) filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * @param[in]  *S         points to an instance of the Q15 multichannel Biquad cascade structure.    
+ * @param[in]  *pSrc      points to the block of interleaved input frames.    
+ * @param[out] *pDst      points to the block of interleaved output frames.    
+ * @param[in]  blockSize  number of frames to process.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Each channel is computed as in <code>arm_biquad_cascade_df1_q15()</code>, with a 64-bit    
+ * accumulator that is shifted by <code>15-postShift</code> bits and saturated to 1.15 format.    
+ * The output of each channel is the same as filtering that channel alone. In-place processing is supported.    
+ */
+
+void arm_biquad_cascade_df1_mc_q15(
+  const arm_biquad_casd_df1_mc_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut;                                   /*  Destination pointer                          */
+  q15_t *px;                                     /*  Frame pointer                                */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  q63_t acc;                                     /*  Accumulator                                  */
+  int32_t lShift = (15 - (int32_t) S->postShift);       /*  Post shift                                   */
+  uint32_t numChannels = S->numChannels;         /*  Number of channels                           */
+  uint32_t sample, ch, stage = (uint32_t) S->numStages; /*  Loop counters                        */
+
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in;                                      /*  Temporary variable to hold input value       */
+  q31_t out;                                     /*  Temporary variable to hold output value      */
+  q31_t b0;                                      /*  Temporary variable to hold bo value          */
+  q31_t b1, a1;                                  /*  Filter coefficients                          */
+  q31_t state_in, state_out;                     /*  Filter state variables                       */
+
+  do
+  {
+    /* Read the b0 and 0 coefficients using SIMD  */
+    b0 = *__SIMD32(pCoeffs)++;
+
+    /* Read the b1 and b2 coefficients using SIMD */
+    b1 = *__SIMD32(pCoeffs)++;
+
+    /* Read the a1 and a2 coefficients using SIMD */
+    a1 = *__SIMD32(pCoeffs)++;
+
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* Read the input state values of the channel:  x[n-1], x[n-2] */
+      state_in = *__SIMD32(pState)++;
+
+      /* Read the output state values of the channel:  y[n-1], y[n-2] */
+      state_out = *__SIMD32(pState)--;
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        in = *px;
+
+        /* out =  b0 * x[n] + 0 * 0 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        out = __SMUAD(b0, in);
+
+#else
+
+        out = __SMUADX(b0, in);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* acc =  b1 * x[n-1] + b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+
+        /* The result is converted from 3.29 to 1.31 if postShift = 1, and then saturation is applied */
+        out = __SSAT((q31_t) (acc >> lShift), 16);
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q15_t) out;
+
+        /* x[n-N], x[n-N-1] are packed together to make state_in of type q31 */
+        /* y[n-N], y[n-N-1] are packed together to make state_out of type q31 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+
+#endif /*   #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        px += numChannels;
+        pOut += numChannels;
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the state array */
+      *__SIMD32(pState)++ = state_in;
+      *__SIMD32(pState)++ = state_out;
+    }
+
+    /*  The first stage goes from the input wire to the output wire.  */
+    /*  Subsequent numStages occur in-place in the output wire  */
+    pIn = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q15_t Xn;                                      /*  temporary input               */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    pCoeffs++;  // skip the 0 coefficient
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* Reading the state values */
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 *Xn;
+        acc += (q31_t) b1 *Xn1;
+        acc += (q31_t) b2 *Xn2;
+        acc += (q31_t) a1 *Yn1;
+        acc += (q31_t) a2 *Yn2;
+
+        /* The result is converted to 1.15 with saturation */
+        acc = __SSAT((q31_t) (acc >> lShift), 16);
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q15_t) acc;
+
+        px += numChannels;
+        pOut += numChannels;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      *pState++ = Xn1;
+      *pState++ = Xn2;
+      *pState++ = Yn1;
+      *pState++ = Yn2;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+  } while(--stage);
+
+#endif /*     #ifndef ARM_MATH_CM0_FAMILY */
+
+}
+
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
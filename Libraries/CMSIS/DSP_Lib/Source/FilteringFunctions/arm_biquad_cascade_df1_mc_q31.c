@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_df1_mc_q31.c    
+*    
+* Description:	Processing function for the Q31 multichannel Biquad cascade    
+*               DirectFormI(DF1) filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.    
+ * @param[in]  *pSrc      points to the block of interleaved input frames.    
+ * @param[out] *pDst      points to the block of interleaved output frames.    
+ * @param[in]  blockSize  number of frames to process.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Each channel is computed as in <code>arm_biquad_cascade_df1_q31()</code>, with a 64-bit    
+ * accumulator that is shifted by <code>31-postShift</code> bits and truncated to 1.31 format.    
+ * The output of each channel is the same as filtering that channel alone. In-place processing is supported.    
+ */
+
+void arm_biquad_cascade_df1_mc_q31(
+  const arm_biquad_casd_df1_mc_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t lShift = 31u - (uint32_t) S->postShift;      /*  Shift to be applied to the output */
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pOut;                                   /*  output pointer                */
+  q31_t *px;                                     /*  frame pointer                 */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  uint32_t numChannels = S->numChannels;         /*  number of channels            */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    ch = 0u;
+
+#if defined (ARM_MATH_SSE41)
+
+    /* Run the below code for the host build with SSE4.1.    
+     ** Four channels are held in one vector. _mm_mul_epi32 multiplies the even channels,    
+     ** and the odd channels after a shift of the 64-bit lanes. The low 32 bits of the    
+     ** shifted accumulators are the same for logical and arithmetic shifts, so the    
+     ** result is bit-exact. */
+    {
+      __m128i vb0 = _mm_set1_epi32(b0), vb1 = _mm_set1_epi32(b1), vb2 = _mm_set1_epi32(b2);
+      __m128i va1 = _mm_set1_epi32(a1), va2 = _mm_set1_epi32(a2);
+      __m128i vXn, vXn1, vXn2, vYn1, vYn2, vaccE, vaccO, vYn;
+      __m128i vmask = _mm_set_epi32(0, -1, 0, -1);
+      __m128i vshift = _mm_cvtsi32_si128((int32_t) lShift);
+
+      for (; (ch + 4u) <= numChannels; ch += 4u)
+      {
+        /* Reading the state values */
+        vXn1 = _mm_loadu_si128((__m128i *) (pState + ch));
+        vXn2 = _mm_loadu_si128((__m128i *) (pState + numChannels + ch));
+        vYn1 = _mm_loadu_si128((__m128i *) (pState + (2u * numChannels) + ch));
+        vYn2 = _mm_loadu_si128((__m128i *) (pState + (3u * numChannels) + ch));
+
+        px = pIn + ch;
+        pOut = pDst + ch;
+
+        sample = blockSize;
+
+        while(sample > 0u)
+        {
+          /* Read the input */
+          vXn = _mm_loadu_si128((__m128i *) px);
+
+          /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+          vaccE = _mm_mul_epi32(vb0, vXn);
+          vaccE = _mm_add_epi64(vaccE, _mm_mul_epi32(vb1, vXn1));
+          vaccE = _mm_add_epi64(vaccE, _mm_mul_epi32(vb2, vXn2));
+          vaccE = _mm_add_epi64(vaccE, _mm_mul_epi32(va1, vYn1));
+          vaccE = _mm_add_epi64(vaccE, _mm_mul_epi32(va2, vYn2));
+
+          vaccO = _mm_mul_epi32(vb0, _mm_srli_epi64(vXn, 32));
+          vaccO = _mm_add_epi64(vaccO, _mm_mul_epi32(vb1, _mm_srli_epi64(vXn1, 32)));
+          vaccO = _mm_add_epi64(vaccO, _mm_mul_epi32(vb2, _mm_srli_epi64(vXn2, 32)));
+          vaccO = _mm_add_epi64(vaccO, _mm_mul_epi32(va1, _mm_srli_epi64(vYn1, 32)));
+          vaccO = _mm_add_epi64(vaccO, _mm_mul_epi32(va2, _mm_srli_epi64(vYn2, 32)));
+
+          /* The result is converted to 1.31 and the channels are put back in order */
+          vYn = _mm_or_si128(_mm_and_si128(_mm_srl_epi64(vaccE, vshift), vmask),
+                             _mm_slli_epi64(_mm_srl_epi64(vaccO, vshift), 32));
+
+          /* Store the output in the destination buffer. */
+          _mm_storeu_si128((__m128i *) pOut, vYn);
+
+          /* Every time after the output is computed state should be updated. */
+          vXn2 = vXn1;
+          vXn1 = vXn;
+          vYn2 = vYn1;
+          vYn1 = vYn;
+
+          px += numChannels;
+          pOut += numChannels;
+
+          sample--;
+        }
+
+        /*  Store the updated state variables back into the pState array */
+        _mm_storeu_si128((__m128i *) (pState + ch), vXn1);
+        _mm_storeu_si128((__m128i *) (pState + numChannels + ch), vXn2);
+        _mm_storeu_si128((__m128i *) (pState + (2u * numChannels) + ch), vYn1);
+        _mm_storeu_si128((__m128i *) (pState + (3u * numChannels) + ch), vYn2);
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_SSE41) */
+
+    /* The remaining channels, or all of them on the Cortex-M processors, are filtered one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      /* Reading the state values */
+      Xn1 = pState[ch];
+      Xn2 = pState[numChannels + ch];
+      Yn1 = pState[(2u * numChannels) + ch];
+      Yn2 = pState[(3u * numChannels) + ch];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* The result is converted to 1.31  */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *pOut = Yn1;
+
+        px += numChannels;
+        pOut += numChannels;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numChannels + ch] = Xn2;
+      pState[(2u * numChannels) + ch] = Yn1;
+      pState[(3u * numChannels) + ch] = Yn2;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent numStages  occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Move to the state of the next stage */
+    pState += 4u * numChannels;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
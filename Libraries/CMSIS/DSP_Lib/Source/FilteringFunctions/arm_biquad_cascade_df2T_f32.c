@@ -50,7 +50,7 @@
 * This set of functions implements arbitrary order recursive (IIR) filters using a transposed direct form II structure.       
 * The filters are implemented as a cascade of second order Biquad sections.       
 * These functions provide a slight memory savings as compared to the direct form I Biquad filter functions.      
-* Only floating-point data is supported.       
+* Floating-point, Q15 and Q31 data types are supported.       
 *       
 * This function operate on blocks of input and output data and each call to the function       
 * processes <code>blockSize</code> samples through the filter.       
@@ -105,7 +105,9 @@
 * The advantage of the Direct Form I structure is that it is numerically more robust for fixed-point data types.    
 * That is why the Direct Form I structure supports Q15 and Q31 data types.    
 * The transposed Direct Form II structure, on the other hand, requires a wide dynamic range for the state variables <code>d1</code> and <code>d2</code>.    
-* Because of this, the CMSIS library only has a floating-point version of the Direct Form II Biquad.    
+* Because of this, the Q15 and Q31 versions keep the state variables at the width of the Direct Form I accumulator,    
+* 32 bits for Q15 and 64 bits for Q31. They are partial sums of that accumulator,    
+* so the Q15 and Q31 outputs are bit-exact with <code>arm_biquad_cascade_df1_fast_q15()</code> and <code>arm_biquad_cascade_df1_q31()</code>.    
 * The advantage of the Direct Form II Biquad is that it requires half the number of state variables, 2 rather than 4, per Biquad stage.    
 *       
 * \par Instance Structure       
@@ -119,7 +121,7 @@
 * - Sets the values of the internal structure fields.       
 * - Zeros out the values in the state buffer.       
 * To do this manually without calling the init function, assign the follow subfields of the instance structure:
-* numStages, pCoeffs, pState. Also set all of the values in pState to zero. 
+* numStages, pCoeffs, pState, and postShift for the Q15 and Q31 versions. Also set all of the values in pState to zero. 
 *       
 * \par       
 * Use of the initialization function is optional.       
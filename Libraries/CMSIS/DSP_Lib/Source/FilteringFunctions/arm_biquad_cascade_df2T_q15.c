@@ -0,0 +1,393 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_df2T_q15.c    
+*    
+* Description:	Processing function for the Q15 transposed direct form II Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF2T    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the Q15 transposed direct form II Biquad cascade structure.    
+ * @param[in]  *pSrc     points to the block of input data.    
+ * @param[out] *pDst     points to the block of output data.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using a 32-bit accumulator with 2.30 format,    
+ * and the state variables <code>d1</code> and <code>d2</code> are partial sums of the same accumulator.    
+ * The accumulator maintains full precision of the intermediate multiplication results but provides only a single guard bit.    
+ * Thus, if the accumulator result overflows it wraps around and distorts the result.    
+ * In order to avoid overflows completely the input signal must be scaled down by two bits and lie in the range [-0.25 +0.25).    
+ * The 2.30 accumulator is then shifted by <code>postShift</code> bits and the result truncated to 1.15 format by discarding the low 16 bits.    
+ * The output is saturated, and the saturated output is fed back to the state.    
+ *    
+ * \par    
+ * The sums are the same as those of <code>arm_biquad_cascade_df1_fast_q15()</code> in a different order,    
+ * so for the same coefficients and <code>postShift</code> the output is bit-exact with it.    
+ * The coefficient array has the same layout, and the state takes 2 32-bit words per stage.    
+ * Use <code>arm_biquad_cascade_df1_q15()</code> when the 64-bit accumulation is needed to avoid wrap around distortion.    
+ */
+
+void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  q31_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  q31_t acc;                                     /*  Accumulator                                  */
+  q31_t d1, d2;                                  /*  Filter state variables                       */
+  q31_t Xn, Yn;                                  /*  Input and output                             */
+  int32_t shift = (int32_t) (15 - S->postShift); /*  Post shift                                   */
+  uint32_t sample, stage = S->numStages;         /*  Stage loop counter                           */
+
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+  __m128i vb0, vc1, vc2;                         /*  Coefficients of 4 stages                     */
+  __m128i vd1, vd2, vx, vy, vxy, vacc, vm;       /*  State of 4 stages                            */
+  __m128i vshift = _mm_cvtsi32_si128(shift);
+  __m128i vlow = _mm_set1_epi32(0xFFFF);
+  __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                          */
+  q31_t st[3][4];
+  uint32_t t, j;
+
+  /*    
+   * Groups of 4 stages run as a pipeline as in arm_biquad_cascade_df1_f32(),    
+   * stage j of the group on lane j. The lanes keep x[n] and y[n] sign extended,    
+   * and the pair {x[n], y[n]} packed in the halves of the lane multiplies    
+   * {b1, a1} and {b2, a2} with _mm_madd_epi16(), which wraps as the C code does.    
+   */
+  while(stage >= 4u)
+  {
+    for (j = 0u; j < 4u; j++)
+    {
+      st[0][j] = (uint16_t) pCoeffs[6u * j];
+      st[1][j] = (q31_t) (((uint32_t) pCoeffs[6u * j + 4u] << 16) | (uint16_t) pCoeffs[6u * j + 2u]);
+      st[2][j] = (q31_t) (((uint32_t) pCoeffs[6u * j + 5u] << 16) | (uint16_t) pCoeffs[6u * j + 3u]);
+    }
+    vb0 = _mm_loadu_si128((__m128i *) st[0]);
+    vc1 = _mm_loadu_si128((__m128i *) st[1]);
+    vc2 = _mm_loadu_si128((__m128i *) st[2]);
+
+    for (j = 0u; j < 4u; j++)
+    {
+      st[0][j] = pState[2u * j];
+      st[1][j] = pState[2u * j + 1u];
+    }
+    vd1 = _mm_loadu_si128((__m128i *) st[0]);
+    vd2 = _mm_loadu_si128((__m128i *) st[1]);
+    vy = _mm_setzero_si128();
+
+    for (t = 0u; t < blockSize + 3u; t++)
+    {
+      /* Input of lane 0 is the next sample, lanes 1 to 3 take the previous outputs */
+      Xn = (t < blockSize) ? pIn[t] : 0;
+      vx = _mm_or_si128(_mm_slli_si128(vy, 4), _mm_and_si128(_mm_cvtsi32_si128(Xn), vlow));
+      vx = _mm_srai_epi32(_mm_slli_epi32(vx, 16), 16);
+
+      /* y[n] = b0 * x[n] + d1, shifted and saturated to 16 bits */
+      vacc = _mm_add_epi32(_mm_madd_epi16(vx, vb0), vd1);
+      vy = _mm_packs_epi32(_mm_sra_epi32(vacc, vshift), vacc);
+      vy = _mm_srai_epi32(_mm_unpacklo_epi16(vy, vy), 16);
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      vxy = _mm_or_si128(_mm_and_si128(vx, vlow), _mm_slli_epi32(vy, 16));
+      vacc = _mm_add_epi32(_mm_madd_epi16(vxy, vc1), vd2);
+      vxy = _mm_madd_epi16(vxy, vc2);
+
+      if(t < 3u || t >= blockSize)
+      {
+        /* Lanes with 0 <= t - j < blockSize update their state */
+        vm = _mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t) t + 1), lane),
+                           _mm_cmpgt_epi32(lane, _mm_set1_epi32((int32_t) t - (int32_t) blockSize)));
+        vd1 = _mm_or_si128(_mm_and_si128(vm, vacc), _mm_andnot_si128(vm, vd1));
+        vd2 = _mm_or_si128(_mm_and_si128(vm, vxy), _mm_andnot_si128(vm, vd2));
+      }
+      else
+      {
+        vd1 = vacc;
+        vd2 = vxy;
+      }
+
+      /* Lane 3 completes sample t - 3, behind the samples still to be read when in-place */
+      if(t >= 3u)
+      {
+        pOut[t - 3u] = (q15_t) _mm_cvtsi128_si32(_mm_srli_si128(vy, 12));
+      }
+    }
+
+    /*  Store the updated state variables back into the pState array */
+    _mm_storeu_si128((__m128i *) st[0], vd1);
+    _mm_storeu_si128((__m128i *) st[1], vd2);
+    for (j = 0u; j < 4u; j++)
+    {
+      *pState++ = st[0][j];
+      *pState++ = st[1][j];
+    }
+
+    pCoeffs += 24u;
+    pIn = pDst;
+    stage -= 4u;
+  }
+
+  /* The remaining 1 to 3 stages */
+  while(stage > 0u)
+  {
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6u;
+
+    d1 = pState[0];
+    d2 = pState[1];
+
+    for (sample = 0u; sample < blockSize; sample++)
+    {
+      Xn = pIn[sample];
+      acc = (b0 * Xn) + d1;
+      Yn = __SSAT((acc >> shift), 16);
+      pOut[sample] = (q15_t) Yn;
+      d1 = (q31_t) ((uint32_t) (b1 * Xn) + (uint32_t) (a1 * Yn) + (uint32_t) d2);
+      d2 = (q31_t) ((uint32_t) (b2 * Xn) + (uint32_t) (a2 * Yn));
+    }
+
+    *pState++ = d1;
+    *pState++ = d2;
+
+    pIn = pDst;
+    stage--;
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t b0;                                      /*  b0 coefficient                               */
+  q31_t c1, c2;                                  /*  {b1, a1} and {b2, a2} packed                 */
+  q31_t in, out;                                 /*  Two inputs and the first output              */
+
+  do
+  {
+    /* Read the coefficients and pack the feedforward and feedback coefficients of d1 and d2 together */
+    b0 = pCoeffs[0];
+    c1 = __PKHBT(pCoeffs[2], pCoeffs[4], 16);
+    c2 = __PKHBT(pCoeffs[3], pCoeffs[5], 16);
+    pCoeffs += 6u;
+
+    /* Read the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    /* Apply loop unrolling and compute 2 output values simultaneously. */
+    sample = blockSize >> 1u;
+
+    /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.    
+     ** the remaining sample is computed below. */
+    while(sample > 0u)
+    {
+      /* Read two inputs */
+      in = *__SIMD32(pIn)++;
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      Xn = (q15_t) in;
+
+#else
+
+      Xn = in >> 16;
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      /* y[n] = b0 * x[n] + d1, converted from 2.30 to 1.15 with saturation */
+      acc = (b0 * Xn) + d1;
+      out = __SSAT((acc >> shift), 16);
+
+      /* {x[n], y[n]} are packed together to update both state variables with dual multiplies */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      Xn = __PKHBT(Xn, out, 16);
+      d1 = __SMLAD(Xn, c1, d2);
+      d2 = __SMUAD(Xn, c2);
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      Xn = in >> 16;
+
+#else
+
+      Xn = (q15_t) in;
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      acc = (b0 * Xn) + d1;
+      Yn = __SSAT((acc >> shift), 16);
+
+      Xn = __PKHBT(Xn, Yn, 16);
+      d1 = __SMLAD(Xn, c1, d2);
+      d2 = __SMUAD(Xn, c2);
+
+      /* Store the two outputs in the destination buffer. */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      *__SIMD32(pOut)++ = __PKHBT(out, Yn, 16);
+
+#else
+
+      *__SIMD32(pOut)++ = __PKHBT(Yn, out, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is odd, compute the last output sample here. */
+    if((blockSize & 0x1u) != 0u)
+    {
+      Xn = *pIn++;
+
+      acc = (b0 * Xn) + d1;
+      Yn = __SSAT((acc >> shift), 16);
+
+      *pOut++ = (q15_t) Yn;
+
+      Xn = __PKHBT(Xn, Yn, 16);
+      d1 = __SMLAD(Xn, c1, d2);
+      d2 = __SMUAD(Xn, c2);
+    }
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                          */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6u;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1, converted from 2.30 to 1.15 with saturation */
+      acc = (b0 * Xn) + d1;
+      Yn = __SSAT((acc >> shift), 16);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = (q15_t) Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2, wrapping as the 32-bit accumulator */
+      d1 = (q31_t) ((uint32_t) (b1 * Xn) + (uint32_t) (a1 * Yn) + (uint32_t) d2);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (q31_t) ((uint32_t) (b2 * Xn) + (uint32_t) (a2 * Yn));
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#endif /*   #if defined (ARM_MATH_SSE2)         */
+
+}
+
+/**    
+ * @} end of BiquadCascadeDF2T group    
+ */
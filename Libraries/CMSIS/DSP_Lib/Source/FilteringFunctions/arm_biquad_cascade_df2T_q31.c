@@ -0,0 +1,377 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_df2T_q31.c    
+*    
+* Description:	Processing function for the Q31 transposed direct form II Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF2T    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the Q31 transposed direct form II Biquad cascade structure.    
+ * @param[in]  *pSrc     points to the block of input data.    
+ * @param[out] *pDst     points to the block of output data.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator.    
+ * The state variables <code>d1</code> and <code>d2</code> are partial sums of the same accumulator and are kept in 64 bits.    
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.    
+ * Thus, if the accumulator result overflows it wraps around rather than clip.    
+ * In order to avoid overflows completely the input signal must be scaled down by 2 bits and lie in the range [-0.25 +0.25).    
+ * After all 5 multiply-accumulates are performed, the 2.62 accumulator is shifted by <code>postShift</code> bits and the result truncated to    
+ * 1.31 format by discarding the low 32 bits.    
+ *    
+ * \par    
+ * The sums are the same as those of <code>arm_biquad_cascade_df1_q31()</code> in a different order,    
+ * so for the same coefficients and <code>postShift</code> the output is bit-exact with it.    
+ * Each sample updates 2 state variables rather than 4.    
+ */
+
+void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t shift = 31u - (uint32_t) S->postShift; /*  Shift to be applied to the output */
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pOut = pDst;                            /*  output pointer initialization */
+  q63_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  q63_t d1, d2;                                  /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn, Yn;                                  /*  input and output              */
+  uint32_t sample, stage = S->numStages;         /*  loop counters                 */
+
+
+#if defined (ARM_MATH_SSE41)
+
+  /* Run the below code for the host build with SSE4.1 */
+  __m128i vb0[2], vb1[2], vb2[2], va1[2], va2[2]; /*  Coefficients of 4 stages, 2 per vector */
+  __m128i vd1[2], vd2[2], vx[2], vy[2], vacc, vm; /*  State of 4 stages, 2 per vector */
+  __m128i vshift = _mm_cvtsi32_si128((int32_t) shift);
+  q63_t st[2][4];
+  uint32_t t, j, k;
+
+  /*    
+   * Groups of 4 stages run as a pipeline as in arm_biquad_cascade_df1_f32(),    
+   * stage j of the group on 64-bit lane j % 2 of vectors j / 2.    
+   * At step t, stage j computes sample t - j from the output of stage j - 1    
+   * at the previous step. The inputs and outputs are in the low 32 bits of the lanes,    
+   * where _mm_mul_epi32() reads them, and the logical shift of the accumulator    
+   * gives the same low 32 bits as the arithmetic one.    
+   */
+  while(stage >= 4u)
+  {
+    for (k = 0u; k < 2u; k++)
+    {
+      vb0[k] = _mm_set_epi64x(pCoeffs[5u * (2u * k + 1u)], pCoeffs[5u * (2u * k)]);
+      vb1[k] = _mm_set_epi64x(pCoeffs[5u * (2u * k + 1u) + 1u], pCoeffs[5u * (2u * k) + 1u]);
+      vb2[k] = _mm_set_epi64x(pCoeffs[5u * (2u * k + 1u) + 2u], pCoeffs[5u * (2u * k) + 2u]);
+      va1[k] = _mm_set_epi64x(pCoeffs[5u * (2u * k + 1u) + 3u], pCoeffs[5u * (2u * k) + 3u]);
+      va2[k] = _mm_set_epi64x(pCoeffs[5u * (2u * k + 1u) + 4u], pCoeffs[5u * (2u * k) + 4u]);
+      vd1[k] = _mm_set_epi64x(pState[2u * (2u * k + 1u)], pState[2u * (2u * k)]);
+      vd2[k] = _mm_set_epi64x(pState[2u * (2u * k + 1u) + 1u], pState[2u * (2u * k) + 1u]);
+      vy[k] = _mm_setzero_si128();
+    }
+
+    for (t = 0u; t < blockSize + 3u; t++)
+    {
+      /* Input of stage 0 is the next sample, stages 1 to 3 take the previous outputs */
+      Xn = (t < blockSize) ? pIn[t] : 0;
+      vx[1] = _mm_alignr_epi8(vy[1], vy[0], 8);
+      vx[0] = _mm_unpacklo_epi64(_mm_cvtsi32_si128(Xn), vy[0]);
+
+      for (k = 0u; k < 2u; k++)
+      {
+        /* acc =  b0 * x[n] + d1 */
+        vacc = _mm_add_epi64(_mm_mul_epi32(vb0[k], vx[k]), vd1[k]);
+        vy[k] = _mm_srl_epi64(vacc, vshift);
+
+        if(t < 3u || t >= blockSize)
+        {
+          /* Stages with 0 <= t - j < blockSize update their state */
+          j = 2u * k;
+          vm = _mm_set_epi64x(-(int64_t) ((t >= j + 1u) && (t - (j + 1u) < blockSize)),
+                              -(int64_t) ((t >= j) && (t - j < blockSize)));
+        }
+        else
+        {
+          vm = _mm_set1_epi32(-1);
+        }
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        vacc = _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(vb1[k], vx[k]), _mm_mul_epi32(va1[k], vy[k])), vd2[k]);
+        vd2[k] = _mm_blendv_epi8(vd2[k], _mm_add_epi64(_mm_mul_epi32(vb2[k], vx[k]), _mm_mul_epi32(va2[k], vy[k])), vm);
+        vd1[k] = _mm_blendv_epi8(vd1[k], vacc, vm);
+      }
+
+      /* Stage 3 completes sample t - 3, behind the samples still to be read when in-place */
+      if(t >= 3u)
+      {
+        pOut[t - 3u] = _mm_extract_epi32(vy[1], 2);
+      }
+    }
+
+    /*  Store the updated state variables back into the pState array */
+    for (k = 0u; k < 2u; k++)
+    {
+      _mm_storeu_si128((__m128i *) st[0], vd1[k]);
+      _mm_storeu_si128((__m128i *) st[1], vd2[k]);
+      *pState++ = st[0][0];
+      *pState++ = st[1][0];
+      *pState++ = st[0][1];
+      *pState++ = st[1][1];
+    }
+
+    pCoeffs += 20u;
+    pIn = pDst;
+    stage -= 4u;
+  }
+
+  /* The remaining 1 to 3 stages */
+  while(stage > 0u)
+  {
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    d1 = pState[0];
+    d2 = pState[1];
+
+    for (sample = 0u; sample < blockSize; sample++)
+    {
+      Xn = pIn[sample];
+      acc = ((q63_t) b0 * Xn) + d1;
+      Yn = (q31_t) (acc >> shift);
+      pOut[sample] = Yn;
+      d1 = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + d2;
+      d2 = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+    }
+
+    *pState++ = d1;
+    *pState++ = d2;
+
+    pIn = pDst;
+    stage--;
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t uShift = 32u - shift;                 /*  Shift of the upper part of acc */
+  q31_t acc_l, acc_h;                            /*  temporary output variables    */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    /* Apply loop unrolling and compute 2 output values per iteration. */
+    sample = blockSize >> 1u;
+
+    /* First part of the processing with loop unrolling.    
+     ** the remaining sample is computed below. */
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q63_t) b0 * Xn) + d1;
+
+      /* The output is the accumulator shifted by 31 - postShift bits, from its lower and upper parts */
+      acc_l = acc & 0xffffffff;
+      acc_h = (acc >> 32) & 0xffffffff;
+      Yn = (uint32_t) acc_l >> shift | acc_h << uShift;
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((q63_t) b1 * Xn) + d2;
+      d1 += (q63_t) a1 * Yn;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (q63_t) b2 * Xn;
+      d2 += (q63_t) a2 * Yn;
+
+      /* Read the second input */
+      Xn = *pIn++;
+
+      acc = ((q63_t) b0 * Xn) + d1;
+
+      acc_l = acc & 0xffffffff;
+      acc_h = (acc >> 32) & 0xffffffff;
+      Yn = (uint32_t) acc_l >> shift | acc_h << uShift;
+
+      *pOut++ = Yn;
+
+      d1 = ((q63_t) b1 * Xn) + d2;
+      d1 += (q63_t) a1 * Yn;
+
+      d2 = (q63_t) b2 * Xn;
+      d2 += (q63_t) a2 * Yn;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is odd, compute the last output sample here. */
+    if((blockSize & 0x1u) != 0u)
+    {
+      Xn = *pIn++;
+
+      acc = ((q63_t) b0 * Xn) + d1;
+
+      acc_l = acc & 0xffffffff;
+      acc_h = (acc >> 32) & 0xffffffff;
+      Yn = (uint32_t) acc_l >> shift | acc_h << uShift;
+
+      *pOut++ = Yn;
+
+      d1 = ((q63_t) b1 * Xn) + d2;
+      d1 += (q63_t) a1 * Yn;
+
+      d2 = (q63_t) b2 * Xn;
+      d2 += (q63_t) a2 * Yn;
+    }
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = ((q63_t) b0 * Xn) + d1;
+
+      /* The output is truncated to 1.31 format after the shift by 31 - postShift bits */
+      Yn = (q31_t) (acc >> shift);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((q63_t) b1 * Xn) + ((q63_t) a1 * Yn) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = ((q63_t) b2 * Xn) + ((q63_t) a2 * Yn);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#endif /*   #if defined (ARM_MATH_SSE41)         */
+
+}
+
+/**    
+ * @} end of BiquadCascadeDF2T group    
+ */
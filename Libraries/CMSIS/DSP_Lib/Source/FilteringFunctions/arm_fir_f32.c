@@ -131,7 +131,114 @@
 *  
 */
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE2)
+
+/* Run the below code for the host build with SSE2/AVX2 */
+
+void arm_fir_f32(
+const arm_fir_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+   float32_t *pState = S->pState;                 /* State pointer */
+   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+   float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+   uint32_t i, blkCnt;                            /* Loop counters */
+   __HVF acc0, acc1, acc2, acc3, c0;              /* Accumulators of consecutive outputs and a broadcast coefficient */
+   float32_t acc;
+
+   /* Append the whole block to the previous frame (numTaps - 1) samples in the state buffer.  
+   ** Each output is computed from the state buffer only, so pSrc may be the same as pDst. */
+   memcpy(&pState[numTaps - 1u], pSrc, blockSize * sizeof(float32_t));
+
+   /* Compute 4 vectors of outputs at a time. Each coefficient is multiplied by  
+   ** the consecutive state samples of all the outputs, in the order of the C code. */
+   blkCnt = blockSize / (4u * __HVF_LANES);
+
+   while(blkCnt > 0u)
+   {
+      acc0 = acc1 = acc2 = acc3 = __HVF_ZERO();
+      px = pState;
+      pb = pCoeffs;
+      i = numTaps;
+
+      do
+      {
+         c0 = __HVF_SET1(*pb++);
+         acc0 = __HVF_MAC(acc0, c0, __HVF_LOAD(px));
+         acc1 = __HVF_MAC(acc1, c0, __HVF_LOAD(px + __HVF_LANES));
+         acc2 = __HVF_MAC(acc2, c0, __HVF_LOAD(px + 2 * __HVF_LANES));
+         acc3 = __HVF_MAC(acc3, c0, __HVF_LOAD(px + 3 * __HVF_LANES));
+         px++;
+         i--;
+
+      } while(i > 0u);
+
+      __HVF_STORE(pDst, acc0);
+      __HVF_STORE(pDst + __HVF_LANES, acc1);
+      __HVF_STORE(pDst + 2 * __HVF_LANES, acc2);
+      __HVF_STORE(pDst + 3 * __HVF_LANES, acc3);
+      pDst += 4 * __HVF_LANES;
+      pState += 4 * __HVF_LANES;
+
+      blkCnt--;
+   }
+
+   /* One vector of outputs at a time */
+   blkCnt = (blockSize % (4u * __HVF_LANES)) / __HVF_LANES;
+
+   while(blkCnt > 0u)
+   {
+      acc0 = __HVF_ZERO();
+      px = pState;
+      pb = pCoeffs;
+      i = numTaps;
+
+      do
+      {
+         acc0 = __HVF_MAC(acc0, __HVF_SET1(*pb++), __HVF_LOAD(px));
+         px++;
+         i--;
+
+      } while(i > 0u);
+
+      __HVF_STORE(pDst, acc0);
+      pDst += __HVF_LANES;
+      pState += __HVF_LANES;
+
+      blkCnt--;
+   }
+
+   /* The remaining outputs */
+   blkCnt = blockSize % __HVF_LANES;
+
+   while(blkCnt > 0u)
+   {
+      acc = 0.0f;
+      px = pState;
+      pb = pCoeffs;
+      i = numTaps;
+
+      do
+      {
+         acc += *px++ * *pb++;
+         i--;
+
+      } while(i > 0u);
+
+      *pDst++ = acc;
+      pState = pState + 1;
+
+      blkCnt--;
+   }
+
+   /* Copy the last numTaps - 1 samples to the start of the state buffer */
+   memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -644,7 +751,7 @@ uint32_t blockSize)
 
 }
 
-#endif /*   #ifndef ARM_MATH_CM0_FAMILY */
+#endif /*   #if defined (ARM_MATH_SSE2) */
 
 /**  
 * @} end of FIR group  
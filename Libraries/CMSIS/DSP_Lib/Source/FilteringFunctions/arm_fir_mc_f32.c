@@ -0,0 +1,275 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_mc_f32.c    
+*    
+* Description:	Floating-point multichannel FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR    
+ * @{    
+ */
+
+/**    
+ * \par Multichannel filters    
+ * The <code>_mc</code> variants filter <code>numChannels</code> interleaved channels,    
+ * such as the frames of a multichannel audio stream, with the same coefficients in one pass.    
+ * A frame holds one sample of each channel, and <code>blockSize</code> counts frames.    
+ * The state buffer keeps the last <code>numTaps-1</code> frames followed by the new block, so    
+ * the samples of neighbouring channels and taps are read sequentially, and each coefficient load    
+ * is shared by several channels.    
+ * The output of each channel is the same as filtering that channel alone with <code>arm_fir_f32()</code>.    
+ */
+
+/**    
+ * @param[in]  *S points to an instance of the floating-point multichannel FIR structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return     none.    
+ */
+
+void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t *pOut;                               /* Output pointer */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of interleaved channels */
+  uint32_t ch, blkCnt, tapCnt;                   /* Loop counters */
+
+  /* The new frames are placed after the numTaps-1 frames of the previous call */
+  pStateCurnt = pState + ((numTaps - 1u) * numChannels);
+  memcpy(pStateCurnt, pSrc, (blockSize * numChannels) * sizeof(float32_t));
+
+  ch = 0u;
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build.    
+   ** Four channels are held in one vector and four frames are computed at a time.    
+   ** The samples of frame n+1 at tap k are the samples of frame n at tap k+1, so    
+   ** each tap loads one new vector for the four frames.    
+   ** The sums are accumulated in the order of the C code, so the result is bit-exact. */
+  {
+    __m128 vacc0, vacc1, vacc2, vacc3, vx0, vx1, vx2, vx3, vb;
+    float32_t *py;                               /* Points to the samples of the next tap */
+    uint32_t i;                                  /* Loop counter */
+
+    for (; (ch + 4u) <= numChannels; ch += 4u)
+    {
+      pOut = pDst + ch;
+      px = pState + ch;
+
+      blkCnt = blockSize >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        vacc0 = _mm_setzero_ps();
+        vacc1 = _mm_setzero_ps();
+        vacc2 = _mm_setzero_ps();
+        vacc3 = _mm_setzero_ps();
+        vx0 = _mm_loadu_ps(px);
+        vx1 = _mm_loadu_ps(px + numChannels);
+        vx2 = _mm_loadu_ps(px + (2u * numChannels));
+        py = px + (3u * numChannels);
+        pb = pCoeffs;
+
+        tapCnt = numTaps;
+
+        while(tapCnt > 0u)
+        {
+          vb = _mm_set1_ps(*pb++);
+          vx3 = _mm_loadu_ps(py);
+          py += numChannels;
+          vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vb));
+          vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vb));
+          vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vb));
+          vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vb));
+          vx0 = vx1;
+          vx1 = vx2;
+          vx2 = vx3;
+
+          tapCnt--;
+        }
+
+        _mm_storeu_ps(pOut, vacc0);
+        _mm_storeu_ps(pOut + numChannels, vacc1);
+        _mm_storeu_ps(pOut + (2u * numChannels), vacc2);
+        _mm_storeu_ps(pOut + (3u * numChannels), vacc3);
+
+        px += 4u * numChannels;
+        pOut += 4u * numChannels;
+
+        blkCnt--;
+      }
+
+      /* The remaining 1 to 3 frames */
+      blkCnt = blockSize & 0x3u;
+
+      while(blkCnt > 0u)
+      {
+        vacc0 = _mm_setzero_ps();
+        pb = pCoeffs;
+
+        for (i = 0u; i < numTaps; i++)
+        {
+          vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(_mm_loadu_ps(px + i * numChannels), _mm_set1_ps(pb[i])));
+        }
+
+        _mm_storeu_ps(pOut, vacc0);
+
+        px += numChannels;
+        pOut += numChannels;
+
+        blkCnt--;
+      }
+    }
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  {
+    float32_t acc1, acc2, acc3;                  /* Accumulators */
+    float32_t c0;                                /* Coefficient */
+
+    /* Four channels share each coefficient load */
+    for (; (ch + 4u) <= numChannels; ch += 4u)
+    {
+      pOut = pDst + ch;
+
+      for (blkCnt = 0u; blkCnt < blockSize; blkCnt++)
+      {
+        px = pState + (blkCnt * numChannels) + ch;
+        pb = pCoeffs;
+
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+
+        tapCnt = numTaps;
+
+        while(tapCnt > 0u)
+        {
+          /* Read the coefficient */
+          c0 = *pb++;
+
+          /* acc +=  b[numTaps-1-k] * x[n-numTaps+1+k] for each channel */
+          acc0 += px[0] * c0;
+          acc1 += px[1] * c0;
+          acc2 += px[2] * c0;
+          acc3 += px[3] * c0;
+
+          /* Move to the next frame */
+          px += numChannels;
+
+          tapCnt--;
+        }
+
+        /* Store the outputs of the four channels */
+        pOut[0] = acc0;
+        pOut[1] = acc1;
+        pOut[2] = acc2;
+        pOut[3] = acc3;
+
+        pOut += numChannels;
+      }
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  /* The remaining channels, or all of them on Cortex-M0, are computed one at a time */
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (blkCnt = 0u; blkCnt < blockSize; blkCnt++)
+    {
+      px = pState + (blkCnt * numChannels) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0.0f;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += *px * *pb++;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      *pOut = acc0;
+      pOut += numChannels;
+    }
+  }
+
+  /* Processing is complete.    
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + (blockSize * numChannels);
+  pStateCurnt = pState;
+
+  tapCnt = (numTaps - 1u) * numChannels;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    tapCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR group    
+ */
@@ -0,0 +1,322 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_mc_q15.c    
+*    
+* Description:	Q15 multichannel FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR    
+ * @{    
+ */
+
+#if defined (ARM_MATH_SSE2)
+
+/* Sign extends the four int32 sums of _mm_madd_epi16 and adds them to the 64-bit    
+ * accumulators of channels 0, 1 (acc0) and 2, 3 (acc1). The sum -32768 * -32768 * 2    
+ * wraps to 0x80000000, which is taken as +2^31. */
+static __INLINE void arm_fir_mc_acc_q15(
+  __m128i * acc0,
+  __m128i * acc1,
+  __m128i v)
+{
+  __m128i hi = _mm_andnot_si128(_mm_cmpeq_epi32(v, _mm_set1_epi32((int32_t) 0x80000000)),
+                                _mm_srai_epi32(v, 31));
+
+  *acc0 = _mm_add_epi64(*acc0, _mm_unpacklo_epi32(v, hi));
+  *acc1 = _mm_add_epi64(*acc1, _mm_unpackhi_epi32(v, hi));
+}
+
+/* Truncates the accumulators of four channels to 34.15, saturates them to 1.15 and stores them */
+static __INLINE void arm_fir_mc_store_q15(
+  q15_t * pOut,
+  __m128i acc0,
+  __m128i acc1)
+{
+  q63_t accBuf[4];
+  uint32_t i;
+
+  _mm_storeu_si128((__m128i *) & accBuf[0], acc0);
+  _mm_storeu_si128((__m128i *) & accBuf[2], acc1);
+
+  for (i = 0u; i < 4u; i++)
+  {
+    pOut[i] = (q15_t) (__SSAT((q31_t) (accBuf[i] >> 15), 16));
+  }
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @param[in]  *S points to an instance of the Q15 multichannel FIR structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Each channel is accumulated as in <code>arm_fir_q15()</code>: the 2.30 products are added    
+ * in a 64-bit accumulator, which is truncated to 34.15 format and saturated to 1.15 format.    
+ * The output of each channel is the same as filtering that channel alone with <code>arm_fir_q15()</code>.    
+ */
+
+void arm_fir_mc_q15(
+  const arm_fir_mc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q15_t *pOut;                                   /* Output pointer */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of interleaved channels */
+  uint32_t ch, blkCnt, tapCnt;                   /* Loop counters */
+
+  /* The new frames are placed after the numTaps-1 frames of the previous call */
+  pStateCurnt = pState + ((numTaps - 1u) * numChannels);
+  memcpy(pStateCurnt, pSrc, (blockSize * numChannels) * sizeof(q15_t));
+
+  ch = 0u;
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build.    
+   ** Four channels and two frames are computed at a time. The samples of two taps are    
+   ** interleaved, so that _mm_madd_epi16 gives x[k] * b[k] + x[k+1] * b[k+1] for each    
+   ** channel, and the samples of frame n+1 at tap k are the samples of frame n at tap k+1.    
+   ** The sums are added to 64-bit accumulators, two channels per vector. */
+  {
+    __m128i vacc00, vacc01, vacc10, vacc11, vx0, vx1, vx2, vb;
+    q15_t *py;                                   /* Points to the samples of the next tap */
+
+    for (; (ch + 4u) <= numChannels; ch += 4u)
+    {
+      pOut = pDst + ch;
+      px = pState + ch;
+
+      blkCnt = blockSize >> 1u;
+
+      while(blkCnt > 0u)
+      {
+        vacc00 = _mm_setzero_si128();
+        vacc01 = _mm_setzero_si128();
+        vacc10 = _mm_setzero_si128();
+        vacc11 = _mm_setzero_si128();
+        vx0 = _mm_loadl_epi64((__m128i *) px);
+        py = px + numChannels;
+        pb = pCoeffs;
+
+        tapCnt = numTaps >> 1u;
+
+        while(tapCnt > 0u)
+        {
+          vb = _mm_set1_epi32((int32_t) (((uint32_t) (uint16_t) pb[1] << 16) | (uint16_t) pb[0]));
+          vx1 = _mm_loadl_epi64((__m128i *) py);
+          vx2 = _mm_loadl_epi64((__m128i *) (py + numChannels));
+          arm_fir_mc_acc_q15(&vacc00, &vacc01, _mm_madd_epi16(_mm_unpacklo_epi16(vx0, vx1), vb));
+          arm_fir_mc_acc_q15(&vacc10, &vacc11, _mm_madd_epi16(_mm_unpacklo_epi16(vx1, vx2), vb));
+          vx0 = vx2;
+
+          pb += 2u;
+          py += 2u * numChannels;
+          tapCnt--;
+        }
+
+        /* The last tap for an odd numTaps, paired with zero */
+        if((numTaps & 0x1u) != 0u)
+        {
+          vb = _mm_set1_epi32((int32_t) (uint16_t) pb[0]);
+          vx1 = _mm_loadl_epi64((__m128i *) py);
+          arm_fir_mc_acc_q15(&vacc00, &vacc01, _mm_madd_epi16(_mm_unpacklo_epi16(vx0, _mm_setzero_si128()), vb));
+          arm_fir_mc_acc_q15(&vacc10, &vacc11, _mm_madd_epi16(_mm_unpacklo_epi16(vx1, _mm_setzero_si128()), vb));
+        }
+
+        arm_fir_mc_store_q15(pOut, vacc00, vacc01);
+        arm_fir_mc_store_q15(pOut + numChannels, vacc10, vacc11);
+
+        px += 2u * numChannels;
+        pOut += 2u * numChannels;
+
+        blkCnt--;
+      }
+
+      /* The last frame for an odd blockSize */
+      if((blockSize & 0x1u) != 0u)
+      {
+        vacc00 = _mm_setzero_si128();
+        vacc01 = _mm_setzero_si128();
+        pb = pCoeffs;
+
+        tapCnt = numTaps >> 1u;
+
+        while(tapCnt > 0u)
+        {
+          vb = _mm_set1_epi32((int32_t) (((uint32_t) (uint16_t) pb[1] << 16) | (uint16_t) pb[0]));
+          vx0 = _mm_loadl_epi64((__m128i *) px);
+          vx1 = _mm_loadl_epi64((__m128i *) (px + numChannels));
+          arm_fir_mc_acc_q15(&vacc00, &vacc01, _mm_madd_epi16(_mm_unpacklo_epi16(vx0, vx1), vb));
+
+          pb += 2u;
+          px += 2u * numChannels;
+          tapCnt--;
+        }
+
+        if((numTaps & 0x1u) != 0u)
+        {
+          vb = _mm_set1_epi32((int32_t) (uint16_t) pb[0]);
+          vx0 = _mm_loadl_epi64((__m128i *) px);
+          arm_fir_mc_acc_q15(&vacc00, &vacc01, _mm_madd_epi16(_mm_unpacklo_epi16(vx0, _mm_setzero_si128()), vb));
+        }
+
+        arm_fir_mc_store_q15(pOut, vacc00, vacc01);
+      }
+    }
+  }
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  {
+    q63_t acc1;                                  /* Accumulator */
+    q31_t c0;                                    /* Packed coefficients of two taps */
+
+    /* Two channels share each coefficient load. The samples of two taps are packed so    
+     ** that the dual multiply-accumulate computes x[k] * b[k] + x[k+1] * b[k+1]. */
+    for (; (ch + 2u) <= numChannels; ch += 2u)
+    {
+      pOut = pDst + ch;
+
+      for (blkCnt = 0u; blkCnt < blockSize; blkCnt++)
+      {
+        px = pState + (blkCnt * numChannels) + ch;
+        pb = pCoeffs;
+
+        acc0 = 0;
+        acc1 = 0;
+
+        tapCnt = numTaps >> 1u;
+
+        while(tapCnt > 0u)
+        {
+          /* Read the coefficients of two taps */
+          c0 = __PKHBT(pb[0], pb[1], 16);
+          pb += 2u;
+
+          /* acc +=  b[k] * x[k] + b[k+1] * x[k+1] for each channel */
+          acc0 = __SMLALD(__PKHBT(px[0], px[numChannels], 16), c0, acc0);
+          acc1 = __SMLALD(__PKHBT(px[1], px[numChannels + 1u], 16), c0, acc1);
+
+          /* Move by two frames */
+          px += 2u * numChannels;
+
+          tapCnt--;
+        }
+
+        /* The last tap for an odd numTaps */
+        if((numTaps & 0x1u) != 0u)
+        {
+          acc0 += (q31_t) px[0] * *pb;
+          acc1 += (q31_t) px[1] * *pb;
+        }
+
+        /* Results are truncated to 34.15 and saturated to 1.15 */
+        pOut[0] = (q15_t) (__SSAT((q31_t) (acc0 >> 15), 16));
+        pOut[1] = (q15_t) (__SSAT((q31_t) (acc1 >> 15), 16));
+
+        pOut += numChannels;
+      }
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  /* The remaining channels, or all of them on Cortex-M0, are computed one at a time */
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (blkCnt = 0u; blkCnt < blockSize; blkCnt++)
+    {
+      px = pState + (blkCnt * numChannels) + ch;
+      pb = pCoeffs;
+
+      acc0 = 0;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += (q31_t) * px * *pb++;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      *pOut = (q15_t) (__SSAT((q31_t) (acc0 >> 15), 16));
+      pOut += numChannels;
+    }
+  }
+
+  /* Processing is complete.    
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + (blockSize * numChannels);
+  pStateCurnt = pState;
+
+  tapCnt = (numTaps - 1u) * numChannels;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    tapCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR group    
+ */
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_ols_f32.c    
+*    
+* Description:	Floating-point overlap-save FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_OLS Overlap-Save FIR Filter    
+ *    
+ * These functions compute the same output as the FIR filter functions, by fast convolution    
+ * in the frequency domain. For long filters the cost per sample grows with the logarithm of the    
+ * block size and the number of partitions, instead of with the number of taps.    
+ *    
+ * \par Algorithm:    
+ * The filter is split into <code>numPart</code> partitions of <code>partLen</code> taps (uniform partitioned overlap-save).    
+ * For each block of <code>partLen</code> input samples, a frame of the last <code>2*partLen</code> input samples    
+ * is transformed by arm_rfft_fast_f32() and stored in a frequency domain delay line.    
+ * The spectra of the delay line are multiplied by the spectra of the partitions and summed,    
+ * and the second half of the inverse FFT of the sum gives <code>partLen</code> output samples:    
+ * <pre>    
+ *    Y = X[t] * H[0] + X[t-1] * H[1] + ... + X[t-numPart+1] * H[numPart-1]    
+ * </pre>    
+ * The latency is the partition length, which divides the block size, so the output of each    
+ * call is complete as with arm_fir_f32().    
+ * \par    
+ * When the direct form is cheaper, for short filters or block sizes that are not a multiple of 16,    
+ * the initialization function selects it and the processing function calls arm_fir_f32().    
+ *    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>.    
+ * Coefficients are stored in time reversed order, as for arm_fir_f32():    
+ * \par    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>4*numTaps + 9*blockSize</code>.    
+ * It holds the input samples, the frequency domain delay line and the spectra of the partitions.    
+ *    
+ * \par Instance Structure    
+ * The partition spectra and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter, and the state array cannot be shared.    
+ *    
+ * \par Initialization Functions    
+ * The initialization function must be used. It performs the following operations:    
+ * - Selects the direct form or the partition length.    
+ * - Computes the spectra of the partitions.    
+ * - Zeros out the values in the state buffer.    
+ */
+
+/**    
+ * @addtogroup FIR_OLS    
+ * @{    
+ */
+
+/* Adds the product of the packed real FFT spectra pX and pH to pAcc.    
+ * Element 0 and 1 are the real values of bin 0 and bin partLen. */
+static void arm_fir_ols_cmac_f32(
+  float32_t * pAcc,
+  const float32_t * pX,
+  const float32_t * pH,
+  uint32_t numBins)
+{
+  float32_t xr, xi, hr, hi;                      /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  pAcc[0] += pX[0] * pH[0];
+  pAcc[1] += pX[1] * pH[1];
+  pAcc += 2u;
+  pX += 2u;
+  pH += 2u;
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2.    
+   ** Same operations as the C code, so the result is bit-exact. */
+  __m128 x, h, acc;
+  const __m128 sign = _mm_castsi128_ps(_mm_set_epi32(0, (int32_t) 0x80000000, 0, (int32_t) 0x80000000));
+
+  /* Two bins at a time */
+  blkCnt = (numBins - 1u) >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    x = _mm_loadu_ps(pX);
+    h = _mm_loadu_ps(pH);
+    acc = _mm_loadu_ps(pAcc);
+
+    /* (xr * hr - xi * hi, xi * hr + xr * hi) */
+    x = _mm_add_ps(_mm_mul_ps(x, _mm_shuffle_ps(h, h, _MM_SHUFFLE(2, 2, 0, 0))),
+                   _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_shuffle_ps(h, h, _MM_SHUFFLE(3, 3, 1, 1))), sign));
+    _mm_storeu_ps(pAcc, _mm_add_ps(acc, x));
+
+    pAcc += 4u;
+    pX += 4u;
+    pH += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = (numBins - 1u) & 1u;
+
+#else
+
+  blkCnt = numBins - 1u;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  while(blkCnt > 0u)
+  {
+    xr = pX[0];
+    xi = pX[1];
+    hr = pH[0];
+    hi = pH[1];
+
+    pAcc[0] += (xr * hr) - (xi * hi);
+    pAcc[1] += (xi * hr) + (xr * hi);
+
+    pAcc += 2u;
+    pX += 2u;
+    pH += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @param[in,out] *S points to an instance of the floating-point overlap-save FIR filter structure.    
+ * @param[in] *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in] blockSize number of samples to process per call. It must be a multiple of <code>partLen</code>.    
+ * @return none.    
+ */
+
+void arm_fir_ols_f32(
+  arm_fir_ols_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen;                 /* Partition length */
+  uint32_t numPart = S->numPart;                 /* Number of partitions */
+  uint32_t fftLen = 2u * partLen;                /* FFT length */
+  float32_t *pIn = S->pState;                    /* Last partLen input samples */
+  float32_t *pFrame = pIn + partLen;             /* Input frame, then sum of the spectra */
+  float32_t *pOut = pFrame + fftLen;             /* Output frame */
+  float32_t *pFdl = pOut + fftLen;               /* Frequency domain delay line */
+  float32_t *pH;                                 /* Spectrum of a partition */
+  uint32_t blkCnt, k, j;                         /* Loop counters */
+
+  if(numPart == 0u)
+  {
+    /* Direct form */
+    arm_fir_f32(&S->Sfir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  blkCnt = blockSize / partLen;
+
+  while(blkCnt > 0u)
+  {
+    /* Frame of the last 2*partLen input samples */
+    memcpy(pFrame, pIn, partLen * sizeof(float32_t));
+    memcpy(pFrame + partLen, pSrc, partLen * sizeof(float32_t));
+    memcpy(pIn, pSrc, partLen * sizeof(float32_t));
+
+    /* The latest spectrum goes one slot down, so the spectrum of k blocks ago is in slot partIndex + k */
+    S->partIndex = (S->partIndex == 0u) ? (uint16_t) (numPart - 1u) : (uint16_t) (S->partIndex - 1u);
+    arm_rfft_fast_f32(&S->Srfft, pFrame, pFdl + (fftLen * S->partIndex), 0u);
+
+    /* Sum of the products with the spectra of the partitions */
+    memset(pFrame, 0, fftLen * sizeof(float32_t));
+    pH = S->pCoeffsFreq;
+    j = S->partIndex;
+
+    for (k = 0u; k < numPart; k++)
+    {
+      arm_fir_ols_cmac_f32(pFrame, pFdl + (fftLen * j), pH, partLen);
+      pH += fftLen;
+      j = (j == numPart - 1u) ? 0u : j + 1u;
+    }
+
+    /* The second half of the inverse FFT is the output, the first half is aliased */
+    arm_rfft_fast_f32(&S->Srfft, pFrame, pOut, 1u);
+    memcpy(pDst, pOut + partLen, partLen * sizeof(float32_t));
+
+    pSrc += partLen;
+    pDst += partLen;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR_OLS group    
+ */
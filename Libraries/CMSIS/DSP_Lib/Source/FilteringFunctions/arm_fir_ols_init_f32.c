@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_ols_init_f32.c    
+*    
+* Description:	Floating-point overlap-save FIR filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*    
+ * Cost of the FFT form per output sample, in taps of the direct form:    
+ * COST_FFT * log2(2*partLen) for the forward and inverse real FFTs,    
+ * COST_MAC for each partition in the frequency domain multiply-accumulate,    
+ * and COST_BLOCK / partLen for the copies and calls of each block.    
+ */
+#if defined (ARM_MATH_HOST)
+/* Measured on x86-64, where the direct form computes several taps per instruction.    
+   The reference C build uses the same values, so that it selects the same form. */
+#define ARM_FIR_OLS_COST_FFT      24u
+#define ARM_FIR_OLS_COST_MAC      8u
+#define ARM_FIR_OLS_COST_BLOCK    2048u
+#else
+#define ARM_FIR_OLS_COST_FFT      6u
+#define ARM_FIR_OLS_COST_MAC      10u
+#define ARM_FIR_OLS_COST_BLOCK    512u
+#endif
+
+/* Partition lengths supported by arm_rfft_fast_f32 */
+#define ARM_FIR_OLS_MIN_PART      16u
+#define ARM_FIR_OLS_MAX_PART      2048u
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_OLS    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point overlap-save FIR filter.    
+ * @param[in,out] *S points to an instance of the floating-point overlap-save FIR filter structure.    
+ * @param[in] numTaps  number of filter coefficients in the filter.    
+ * @param[in] *pCoeffs points to the filter coefficients.    
+ * @param[in] *pState points to the state buffer.    
+ * @param[in] blockSize number of samples that are processed per call.    
+ * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>numTaps</code> or <code>blockSize</code> is 0.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * <code>pState</code> points to the array of state variables.    
+ * <code>pState</code> is of length <code>4*numTaps+9*blockSize</code> words where <code>blockSize</code> is the number of input samples processed by each call to <code>arm_fir_ols_f32()</code>.    
+ * \par    
+ * The function estimates the cost per sample of the direct form and of the FFT form for each    
+ * power of two partition length from 16 to 2048 that divides <code>blockSize</code>, and selects the cheapest.    
+ * For the FFT form, the spectra of the partitions are computed into <code>pState</code>,    
+ * so <code>pCoeffs</code> is not used after the call.    
+ */
+
+arm_status arm_fir_ols_init_f32(
+  arm_fir_ols_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  float32_t *pFrame;                             /* Frame of the FFT of a partition */
+  uint32_t partLen, numPart, log2Len;            /* Partition length, count and log2 of the FFT length */
+  uint32_t cost, bestCost, bestLen;              /* Cost per sample in taps of the direct form */
+  uint32_t k, i, n;                              /* Loop counters */
+
+  if((numTaps == 0u) || (blockSize == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Cheapest partition length, 0 for the direct form */
+  bestCost = numTaps;
+  bestLen = 0u;
+  log2Len = 5u;
+
+  for (partLen = ARM_FIR_OLS_MIN_PART;
+       (partLen <= ARM_FIR_OLS_MAX_PART) && ((blockSize % partLen) == 0u); partLen *= 2u)
+  {
+    numPart = (numTaps + partLen - 1u) / partLen;
+    cost = (ARM_FIR_OLS_COST_FFT * log2Len) + (ARM_FIR_OLS_COST_MAC * numPart) +
+      (ARM_FIR_OLS_COST_BLOCK / partLen);
+
+    if(cost < bestCost)
+    {
+      bestCost = cost;
+      bestLen = partLen;
+    }
+
+    log2Len++;
+  }
+
+  S->numTaps = numTaps;
+  S->pState = pState;
+
+  if(bestLen == 0u)
+  {
+    /* Direct form */
+    S->numPart = 0u;
+    S->partLen = 0u;
+    S->partIndex = 0u;
+    S->pCoeffsFreq = NULL;
+    arm_fir_init_f32(&S->Sfir, numTaps, pCoeffs, pState, blockSize);
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  partLen = bestLen;
+  numPart = (numTaps + partLen - 1u) / partLen;
+
+  S->numPart = (uint16_t) numPart;
+  S->partLen = (uint16_t) partLen;
+  S->partIndex = 0u;
+
+  /* The state holds the last partLen input samples, two frames of 2*partLen    
+   ** samples, the delay line of numPart input spectra and the numPart filter spectra */
+  S->pCoeffsFreq = pState + (5u * partLen) + (2u * partLen * numPart);
+  arm_rfft_fast_init_f32(&S->Srfft, (uint16_t) (2u * partLen));
+
+  /* Clear the input samples and the delay line */
+  memset(pState, 0, ((5u * partLen) + (2u * partLen * numPart)) * sizeof(float32_t));
+
+  /* Spectrum of each partition, zero padded to the FFT length */
+  pFrame = pState + partLen;
+  n = 0u;
+
+  for (k = 0u; k < numPart; k++)
+  {
+    /* b[k*partLen] to b[k*partLen+partLen-1] in time order */
+    for (i = 0u; i < partLen; i++)
+    {
+      pFrame[i] = (n < numTaps) ? pCoeffs[numTaps - 1u - n] : 0.0f;
+      n++;
+    }
+
+    memset(pFrame + partLen, 0, partLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->Srfft, pFrame, S->pCoeffsFreq + (2u * partLen * k), 0u);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of FIR_OLS group    
+ */
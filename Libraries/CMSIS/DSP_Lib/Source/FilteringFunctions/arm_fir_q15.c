@@ -75,7 +75,73 @@
  * Refer to the function <code>arm_fir_fast_q15()</code> for a faster but less precise implementation of this function.       
  */
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE2)
+
+/* Run the below code for the host build with SSE2 */
+
+void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  __m128i acc0;                                  /* Two 64-bit partial sums */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Append the whole block to the previous frame (numTaps - 1) samples in the state buffer.       
+   ** Each output is computed from the state buffer only, so pSrc may be the same as pDst. */
+  memcpy(&pState[numTaps - 1u], pSrc, blockSize * sizeof(q15_t));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = _mm_setzero_si128();
+    px = pState;
+    pb = pCoeffs;
+
+    /* 8 taps at a time, the pairs of 2.30 products are summed to 64 bits as by __SMLALD */
+    tapCnt = numTaps >> 3u;
+
+    while(tapCnt > 0u)
+    {
+      acc0 = __HVI_ACC_MADD(acc0, _mm_madd_epi16(_mm_loadu_si128((__m128i *) px),
+                                                 _mm_loadu_si128((__m128i *) pb)));
+      px += 8u;
+      pb += 8u;
+      tapCnt--;
+    }
+
+    acc = __HVI_HSUM64(acc0);
+
+    tapCnt = numTaps & 7u;
+
+    while(tapCnt > 0u)
+    {
+      acc += (q31_t) * px++ * *pb++;
+      tapCnt--;
+    }
+
+    /* The result is in 34.30 format. Convert to 1.15 as the C code, so the result is bit-exact */
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q15_t));
+}
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -681,7 +747,7 @@ void arm_fir_q15(
 
 }
 
-#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+#endif /* #if defined (ARM_MATH_SSE2) */
 
 
 
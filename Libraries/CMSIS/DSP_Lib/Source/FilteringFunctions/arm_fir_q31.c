@@ -80,7 +80,86 @@ void arm_fir_q31(
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
 
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined (ARM_MATH_SSE41)
+
+  /* Run the below code for the host build with SSE4.1 */
+
+  q31_t *px;                                     /* Temporary pointer for state */
+  q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  __m128i acc0, acc1, acc2, acc3;                /* Accumulators of 8 outputs, even and odd ones */
+  __m128i x0, x1, c0;                            /* State and broadcast coefficient */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Length of the filter */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* Append the whole block to the previous frame (numTaps - 1) samples in the state buffer.    
+   ** Each output is computed from the state buffer only, so pSrc may be the same as pDst. */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(q31_t));
+
+  /* Compute 8 outputs at a time. The 2.62 products are summed in 64 bits as    
+   ** by the C code, so the result is bit-exact. */
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = acc1 = acc2 = acc3 = _mm_setzero_si128();
+    px = pState;
+    pb = pCoeffs;
+    i = numTaps;
+
+    do
+    {
+      c0 = _mm_set1_epi32(*pb++);
+      x0 = _mm_loadu_si128((__m128i *) px);
+      x1 = _mm_loadu_si128((__m128i *) (px + 4));
+      acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(x0, c0));
+      acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(_mm_srli_epi64(x0, 32), c0));
+      acc2 = _mm_add_epi64(acc2, _mm_mul_epi32(x1, c0));
+      acc3 = _mm_add_epi64(acc3, _mm_mul_epi32(_mm_srli_epi64(x1, 32), c0));
+      px++;
+      i--;
+    } while(i > 0u);
+
+    /* The low words of acc >> 31 in the output order */
+    acc0 = _mm_shuffle_epi32(_mm_srli_epi64(acc0, 31), _MM_SHUFFLE(3, 1, 2, 0));
+    acc1 = _mm_shuffle_epi32(_mm_srli_epi64(acc1, 31), _MM_SHUFFLE(3, 1, 2, 0));
+    acc2 = _mm_shuffle_epi32(_mm_srli_epi64(acc2, 31), _MM_SHUFFLE(3, 1, 2, 0));
+    acc3 = _mm_shuffle_epi32(_mm_srli_epi64(acc3, 31), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128((__m128i *) pDst, _mm_unpacklo_epi32(acc0, acc1));
+    _mm_storeu_si128((__m128i *) (pDst + 4), _mm_unpacklo_epi32(acc2, acc3));
+    pDst += 8u;
+    pState += 8u;
+
+    blkCnt--;
+  }
+
+  /* The remaining 1 to 7 outputs */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    acc = 0;
+    px = pState;
+    pb = pCoeffs;
+    i = numTaps;
+
+    do
+    {
+      acc += (q63_t) * px++ * *pb++;
+      i--;
+    } while(i > 0u);
+
+    *pDst++ = (q31_t) (acc >> 31u);
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q31_t));
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -356,7 +435,7 @@ void arm_fir_q31(
   }
 
 
-#endif /*  #ifndef ARM_MATH_CM0_FAMILY */
+#endif /*  #if defined (ARM_MATH_SSE41) */
 
 }
 
@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_resample_f32.c    
+*    
+* Description:	floating-point FIR rational resampler.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler    
+ *    
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>,    
+ * such as 160/147 from 44.1 kHz to 48 kHz.    
+ * Conceptually, they upsample by <code>L</code> (inserting <code>L-1</code> zeros between the samples),    
+ * apply a lowpass FIR filter at the upsampled rate, and keep every <code>M</code>-th sample.    
+ * The filter should have a normalized cutoff frequency of <code>1/max(L, M)</code> and a passband gain of <code>L</code>.    
+ * The user of the function is responsible for providing the filter coefficients.    
+ *    
+ * Cascading the FIR interpolator and the FIR decimator computes all the <code>L</code> upsampled    
+ * samples and throws most of them away. These functions compute only the output samples,    
+ * each with one of the <code>L</code> polyphase components of the filter, so the cost per output sample is    
+ * <code>phaseLength=numTaps/L</code> multiply-accumulates whatever the factors.    
+ *    
+ * \par Algorithm:    
+ * Output sample <code>m</code> is at the upsampled position <code>u=m*M</code>, which is input sample    
+ * <code>n=floor(u/L)</code> and polyphase branch <code>p=u%L</code>:    
+ * <pre>    
+ *    y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]    
+ * </pre>    
+ * The functions process blocks of <code>blockSize</code> input samples and return the number of output    
+ * samples, which varies from block to block. The position of the next output is kept in the instance,    
+ * so the conversion continues seamlessly over the blocks.    
+ * <code>pDst</code> must hold at least <code>(blockSize*L)/M+2</code> samples, and <code>blockSize*L</code> must be less than 2^31.    
+ *    
+ * \par Fractional delay:    
+ * The step between the outputs is <code>M + stepFrac/2^32</code> upsampled samples, and the position has a    
+ * 32-bit fractional part <code>frac</code> below the resolution of the polyphase branches.    
+ * <code>stepFrac</code> is zero after initialization, which gives the exact <code>L/M</code> conversion.    
+ * It may be changed between blocks to follow the drift of another clock, such as the sample rate of    
+ * an asynchronous USB audio stream measured from its feedback endpoint: an output clock running    
+ * <code>d</code> parts per million faster than nominal needs <code>stepFrac = -d*1e-6*M*2^32</code>. While <code>frac</code> is not zero, each output is    
+ * interpolated linearly between the outputs of two neighbouring polyphase branches,    
+ * which doubles the cost of that sample.    
+ * <code>frac</code> itself may also be set to delay the output by a fraction of an upsampled sample.    
+ *    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>.    
+ * <code>numTaps</code> must be a multiple of the upsample factor <code>L</code> and this is checked by the    
+ * initialization functions.    
+ * Coefficients are stored in time reversed order.    
+ * \par    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength</code>.    
+ * Samples in the state buffer are stored in the order:    
+ * \par    
+ * <pre>    
+ *    {x[n-phaseLength], x[n-phaseLength+1], ..., x[n-1], x[n], x[n+1], ..., x[n+blockSize-1]}    
+ * </pre>    
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.    
+ * There are separate instance structure declarations for each of the 3 supported data types.    
+ *    
+ * \par Initialization Functions    
+ * There is also an associated initialization function for each data type.    
+ * The initialization function performs the following operations:    
+ * - Sets the values of the internal structure fields, with the position and <code>stepFrac</code> set to zero.    
+ * - Zeros out the values in the state buffer.    
+ * - Checks to make sure that the length of the filter is a multiple of the upsample factor.    
+ *    
+ * \par Fixed-Point Behavior    
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.    
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.    
+ * Refer to the function specific documentation below for usage guidelines.    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/* Dot product of the phaseLength samples from px with the coefficients from pb at a stride of L */
+static float32_t arm_fir_resample_dot_f32(
+  float32_t * px,
+  float32_t * pb,
+  uint32_t L,
+  uint32_t phaseLength)
+{
+  float32_t sum0 = 0.0f;                         /* Accumulator */
+  uint32_t tapCnt;                               /* Loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t sum1 = 0.0f;                         /* Accumulator of the odd taps */
+
+  /* Loop unrolling.  Two accumulators hide the latency of the multiply-accumulate */
+  tapCnt = phaseLength >> 2u;
+
+  while(tapCnt > 0u)
+  {
+    sum0 += px[0] * pb[0];
+    sum1 += px[1] * pb[L];
+    sum0 += px[2] * pb[2u * L];
+    sum1 += px[3] * pb[3u * L];
+
+    px += 4u;
+    pb += 4u * L;
+
+    tapCnt--;
+  }
+
+  sum0 += sum1;
+
+  /* The remaining 1 to 3 taps */
+  tapCnt = phaseLength % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  tapCnt = phaseLength;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(tapCnt > 0u)
+  {
+    sum0 += *px++ * *pb;
+    pb += L;
+
+    tapCnt--;
+  }
+
+  return (sum0);
+}
+
+/**    
+ * @brief Processing function for the floating-point FIR rational resampler.    
+ * @param[in,out] *S        points to an instance of the floating-point FIR rational resampler structure.    
+ * @param[in]     *pSrc     points to the block of input data.    
+ * @param[out]    *pDst     points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process per call.    
+ * @return        number of output samples written to <code>pDst</code>.    
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                    /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;                  /* Coefficient pointer */
+  float32_t *pOut = pDst;                         /* Output pointer */
+  float32_t *px, *pb, *px1, *pb1;                 /* Samples and coefficients of the two branches */
+  float32_t *pStateCurnt;                         /* Points to the current sample of the state */
+  float32_t y0, y1;                               /* Outputs of the two branches */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLength = S->phaseLength;         /* Length of each polyphase filter */
+  int32_t end = (int32_t) (blockSize * L);       /* Position of the first sample of the next block */
+  int32_t pos = S->pos;                          /* Position of the output, in units of 1/L input samples */
+  uint32_t frac = S->frac;                       /* Fractional part of the position */
+  uint64_t step;                                 /* Step between the outputs, in units of 2^-32/L input samples */
+  uint64_t next;                                 /* Fractional part of the position plus the step */
+  uint32_t p, tapCnt;                            /* Polyphase branch, loop counter */
+
+  /* Step of M upsampled samples, adjusted by the fractional step */
+  step = (uint64_t) (((int64_t) S->M << 32) + S->stepFrac);
+
+  /* Copy the new input samples after the phaseLength samples of the previous call */
+  memcpy(pState + phaseLength, pSrc, blockSize * sizeof(float32_t));
+
+  /* Compute the outputs that fall into this block.    
+   ** An output at branch L-1 with a fractional part also needs the next input sample. */
+  while((pos < end) && ((frac == 0u) || (pos != (end - 1))))
+  {
+    /* The newest sample of the output is x[pos/L], at pState[phaseLength + pos/L].    
+     ** pos is -1 when an output is left between the last sample of the previous block and the first one of this block. */
+    if(pos < 0)
+    {
+      px = pState;
+      p = L - 1u;
+    }
+    else
+    {
+      px = pState + ((uint32_t) pos / L) + 1u;
+      p = (uint32_t) pos % L;
+    }
+
+    /* The coefficients of branch p are b[p], b[p+L], ..., in time reversed order from pCoeffs[L-1-p] */
+    pb = pCoeffs + (L - 1u - p);
+
+    y0 = arm_fir_resample_dot_f32(px, pb, L, phaseLength);
+
+    if(frac != 0u)
+    {
+      /* The neighbouring branch is p+1, or branch 0 of the next input sample */
+      if(p == (L - 1u))
+      {
+        px1 = px + 1u;
+        pb1 = pCoeffs + (L - 1u);
+      }
+      else
+      {
+        px1 = px;
+        pb1 = pb - 1u;
+      }
+
+      y1 = arm_fir_resample_dot_f32(px1, pb1, L, phaseLength);
+
+      /* y = y0 + (y1 - y0) * frac */
+      y0 += (y1 - y0) * ((float32_t) frac * 2.3283064365386963e-10f);
+    }
+
+    *pOut++ = y0;
+
+    /* Move to the next output */
+    next = (uint64_t) frac + step;
+    pos += (int32_t) (next >> 32);
+    frac = (uint32_t) next;
+  }
+
+  /* Store the position relative to the next block */
+  S->pos = pos - end;
+  S->frac = frac;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLength samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  pStateCurnt = pState;
+
+  tapCnt = phaseLength;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    tapCnt--;
+  }
+
+  return ((uint32_t) (pOut - pDst));
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
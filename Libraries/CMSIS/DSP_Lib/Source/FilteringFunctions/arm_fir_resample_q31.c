@@ -0,0 +1,224 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_resample_q31.c    
+*    
+* Description:	Q31 FIR rational resampler.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/* Dot product of the phaseLength samples from px with the coefficients from pb at a stride of L,    
+ * truncated to 1.31 format */
+static q31_t arm_fir_resample_dot_q31(
+  q31_t * px,
+  q31_t * pb,
+  uint32_t L,
+  uint32_t phaseLength)
+{
+  q63_t sum0 = 0;                                /* Accumulator */
+  uint32_t tapCnt;                               /* Loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  tapCnt = phaseLength >> 2u;
+
+  while(tapCnt > 0u)
+  {
+    sum0 += (q63_t) px[0] * pb[0];
+    sum0 += (q63_t) px[1] * pb[L];
+    sum0 += (q63_t) px[2] * pb[2u * L];
+    sum0 += (q63_t) px[3] * pb[3u * L];
+
+    px += 4u;
+    pb += 4u * L;
+
+    tapCnt--;
+  }
+
+  /* The remaining 1 to 3 taps */
+  tapCnt = phaseLength % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  tapCnt = phaseLength;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(tapCnt > 0u)
+  {
+    sum0 += (q63_t) * px++ * *pb;
+    pb += L;
+
+    tapCnt--;
+  }
+
+  return ((q31_t) (sum0 >> 31));
+}
+
+/**    
+ * @brief Processing function for the Q31 FIR rational resampler.    
+ * @param[in,out] *S        points to an instance of the Q31 FIR rational resampler structure.    
+ * @param[in]     *pSrc     points to the block of input data.    
+ * @param[out]    *pDst     points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process per call.    
+ * @return        number of output samples written to <code>pDst</code>.
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator.    
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.    
+ * Thus, if the accumulator result overflows it wraps around rather than clip.    
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>.    
+ * since <code>numTaps/L</code> additions occur per output sample.    
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.    
+ */
+
+uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                        /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                      /* Coefficient pointer */
+  q31_t *pOut = pDst;                             /* Output pointer */
+  q31_t *px, *pb, *px1, *pb1;                     /* Samples and coefficients of the two branches */
+  q31_t *pStateCurnt;                             /* Points to the current sample of the state */
+  q31_t y0, y1;                                   /* Outputs of the two branches */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLength = S->phaseLength;         /* Length of each polyphase filter */
+  int32_t end = (int32_t) (blockSize * L);       /* Position of the first sample of the next block */
+  int32_t pos = S->pos;                          /* Position of the output, in units of 1/L input samples */
+  uint32_t frac = S->frac;                       /* Fractional part of the position */
+  uint64_t step;                                 /* Step between the outputs, in units of 2^-32/L input samples */
+  uint64_t next;                                 /* Fractional part of the position plus the step */
+  uint32_t p, tapCnt;                            /* Polyphase branch, loop counter */
+
+  /* Step of M upsampled samples, adjusted by the fractional step */
+  step = (uint64_t) (((int64_t) S->M << 32) + S->stepFrac);
+
+  /* Copy the new input samples after the phaseLength samples of the previous call */
+  memcpy(pState + phaseLength, pSrc, blockSize * sizeof(q31_t));
+
+  /* Compute the outputs that fall into this block.    
+   ** An output at branch L-1 with a fractional part also needs the next input sample. */
+  while((pos < end) && ((frac == 0u) || (pos != (end - 1))))
+  {
+    /* The newest sample of the output is x[pos/L], at pState[phaseLength + pos/L].    
+     ** pos is -1 when an output is left between the last sample of the previous block and the first one of this block. */
+    if(pos < 0)
+    {
+      px = pState;
+      p = L - 1u;
+    }
+    else
+    {
+      px = pState + ((uint32_t) pos / L) + 1u;
+      p = (uint32_t) pos % L;
+    }
+
+    /* The coefficients of branch p are b[p], b[p+L], ..., in time reversed order from pCoeffs[L-1-p] */
+    pb = pCoeffs + (L - 1u - p);
+
+    y0 = arm_fir_resample_dot_q31(px, pb, L, phaseLength);
+
+    if(frac != 0u)
+    {
+      /* The neighbouring branch is p+1, or branch 0 of the next input sample */
+      if(p == (L - 1u))
+      {
+        px1 = px + 1u;
+        pb1 = pCoeffs + (L - 1u);
+      }
+      else
+      {
+        px1 = px;
+        pb1 = pb - 1u;
+      }
+
+      y1 = arm_fir_resample_dot_q31(px1, pb1, L, phaseLength);
+
+      /* y = y0 + (y1 - y0) * frac, with frac in 0.31 format */
+      y0 = (q31_t) (y0 + (((q63_t) y1 - y0) * (q31_t) (frac >> 1) >> 31));
+    }
+
+    *pOut++ = y0;
+
+    /* Move to the next output */
+    next = (uint64_t) frac + step;
+    pos += (int32_t) (next >> 32);
+    frac = (uint32_t) next;
+  }
+
+  /* Store the position relative to the next block */
+  S->pos = pos - end;
+  S->frac = frac;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLength samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  pStateCurnt = pState;
+
+  tapCnt = phaseLength;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *px++;
+
+    tapCnt--;
+  }
+
+  return ((uint32_t) (pOut - pDst));
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -0,0 +1,2168 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_host_test.c    
+*    
+* Description:	Checks the SIMD kernels of the host build against the    
+*               reference C code of the same sources (arm_ref_math.o, the    
+*               library built with ARM_MATH_HOST_NOSIMD and its symbols    
+*               renamed to ref_*). Fixed-point results and most floating-point    
+*               results must be bit-exact. arm_dot_prod_f32 sums in another    
+*               order, and arm_fir_f32 uses FMA with AVX2, so these two    
+*               (and arm_fir_ols_f32 in the direct form) are checked against    
+*               an error bound. The functions without SIMD kernels are    
+*               checked against direct references in double precision or    
+*               64-bit integers instead. The fast math functions are also    
+*               checked against libm, within their documented errors.    
+*    
+*               Usage: arm_host_test [-s seed] [-n cases]    
+*    
+* Target Processor: x86-64 host (ARM_MATH_HOST)
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* Reference C code */
+extern __typeof__(arm_dot_prod_f32) ref_arm_dot_prod_f32;
+extern __typeof__(arm_dot_prod_q15) ref_arm_dot_prod_q15;
+extern __typeof__(arm_dot_prod_q31) ref_arm_dot_prod_q31;
+extern __typeof__(arm_cmplx_mag_f32) ref_arm_cmplx_mag_f32;
+extern __typeof__(arm_fir_f32) ref_arm_fir_f32;
+extern __typeof__(arm_fir_q15) ref_arm_fir_q15;
+extern __typeof__(arm_fir_q31) ref_arm_fir_q31;
+extern __typeof__(arm_fir_ols_init_f32) ref_arm_fir_ols_init_f32;
+extern __typeof__(arm_fir_ols_f32) ref_arm_fir_ols_f32;
+extern __typeof__(arm_fir_mc_f32) ref_arm_fir_mc_f32;
+extern __typeof__(arm_fir_mc_q15) ref_arm_fir_mc_q15;
+extern __typeof__(arm_biquad_cascade_df1_f32) ref_arm_biquad_cascade_df1_f32;
+extern __typeof__(arm_biquad_cascade_df1_mc_f32) ref_arm_biquad_cascade_df1_mc_f32;
+extern __typeof__(arm_biquad_cascade_df1_mc_q31) ref_arm_biquad_cascade_df1_mc_q31;
+extern __typeof__(arm_biquad_cascade_df2T_q15) ref_arm_biquad_cascade_df2T_q15;
+extern __typeof__(arm_biquad_cascade_df2T_q31) ref_arm_biquad_cascade_df2T_q31;
+extern __typeof__(arm_cfft_f32) ref_arm_cfft_f32;
+extern __typeof__(arm_goertzel_f32) ref_arm_goertzel_f32;
+extern __typeof__(arm_sdft_f32) ref_arm_sdft_f32;
+extern __typeof__(arm_mat_mult_f32) ref_arm_mat_mult_f32;
+extern __typeof__(arm_mat_mult_f64) ref_arm_mat_mult_f64;
+extern __typeof__(arm_vexp_f32) ref_arm_vexp_f32;
+extern __typeof__(arm_vlog_f32) ref_arm_vlog_f32;
+extern __typeof__(arm_vlog10_f32) ref_arm_vlog10_f32;
+extern __typeof__(arm_vatan2_f32) ref_arm_vatan2_f32;
+extern __typeof__(arm_vtanh_f32) ref_arm_vtanh_f32;
+extern __typeof__(arm_vsqrt_f32) ref_arm_vsqrt_f32;
+extern __typeof__(arm_stats_f32) ref_arm_stats_f32;
+extern __typeof__(arm_stats_q31) ref_arm_stats_q31;
+extern __typeof__(arm_stats_q15) ref_arm_stats_q15;
+extern __typeof__(arm_stats_q7) ref_arm_stats_q7;
+
+#define MAX_BLOCK   256       /* Maximum block size of the filters */
+#define MAX_TAPS    128       /* Maximum number of FIR taps */
+#define MAX_OLS_TAPS 1024     /* Maximum number of overlap-save FIR taps */
+#define MAX_STAGES  12        /* Maximum number of biquad stages */
+#define MAX_CHANNELS 8        /* Maximum number of interleaved channels */
+#define MAX_BINS    64        /* Maximum number of Goertzel and sliding DFT bins */
+#define MAX_MAT_DIM 64        /* Maximum number of rows of A and columns of B */
+#define MAX_MAT_K   600       /* Maximum number of columns of A, over 2 panels */
+#define MAX_SOLVE   32        /* Maximum size of the factorized matrices */
+#define MAX_STFT    512       /* Maximum STFT frame length */
+#define MAX_LEN     8192      /* Buffer size, 4096 complex samples */
+
+static uint32_t Seed = 1u;
+static uint32_t NumCases = 500u;
+static int Failed;
+
+static float32_t SrcF[MAX_LEN], DstF[MAX_LEN], RefF[MAX_LEN], CoefF[MAX_LEN];
+static float32_t StateF[2][MAX_TAPS + MAX_BLOCK];
+static q31_t SrcQ31[MAX_LEN], DstQ31[MAX_LEN], RefQ31[MAX_LEN], CoefQ31[MAX_LEN];
+static q31_t StateQ31[2][MAX_TAPS + MAX_BLOCK];
+static q15_t SrcQ15[MAX_LEN], DstQ15[MAX_LEN], RefQ15[MAX_LEN], CoefQ15[MAX_LEN];
+static q15_t StateQ15[2][MAX_TAPS + MAX_BLOCK];
+static q7_t SrcQ7[MAX_LEN];
+
+
+/* xorshift32 */
+static uint32_t rnd(void)
+{
+  Seed ^= Seed << 13;
+  Seed ^= Seed >> 17;
+  Seed ^= Seed << 5;
+  return Seed;
+}
+
+/* Random data of a test case, mode 1 gives the full scale values only and mode 2 small ones */
+static q31_t rnd_q31(uint32_t mode)
+{
+  switch (mode)
+  {
+  case 1:
+    return (rnd() & 1u) ? (q31_t) 0x80000000 : 0x7FFFFFFF;
+  case 2:
+    return (q31_t) rnd() >> 20;
+  default:
+    return (q31_t) rnd();
+  }
+}
+
+static q15_t rnd_q15(uint32_t mode)
+{
+  return (q15_t) (rnd_q31(mode) >> 16);
+}
+
+static float32_t rnd_f32(void)
+{
+  return (float32_t) ((q31_t) rnd()) / 2147483648.0f;
+}
+
+static void report(const char *name, uint32_t cases, uint32_t bad, const char *check)
+{
+  printf("%-30s %6u cases  %s\n", name, (unsigned) cases, bad ? "FAILED" : check);
+  if(bad)
+    Failed = 1;
+}
+
+
+static void test_dot_prod(void)
+{
+  uint32_t c, i, n, mode, bad[3] = { 0u, 0u, 0u };
+  q63_t r0, r1;
+  float32_t f0, f1, bound;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    n = rnd() % 300u;
+    mode = c % 3u;
+    bound = 0.0f;
+    for (i = 0u; i < n; i++)
+    {
+      SrcQ15[i] = rnd_q15(mode);
+      CoefQ15[i] = rnd_q15(mode);
+      SrcQ31[i] = rnd_q31(mode);
+      CoefQ31[i] = rnd_q31(mode);
+      SrcF[i] = rnd_f32();
+      CoefF[i] = rnd_f32();
+      bound += fabsf(SrcF[i] * CoefF[i]);
+    }
+
+    arm_dot_prod_q15(SrcQ15, CoefQ15, n, &r0);
+    ref_arm_dot_prod_q15(SrcQ15, CoefQ15, n, &r1);
+    bad[0] += (r0 != r1);
+
+    arm_dot_prod_q31(SrcQ31, CoefQ31, n, &r0);
+    ref_arm_dot_prod_q31(SrcQ31, CoefQ31, n, &r1);
+    bad[1] += (r0 != r1);
+
+    /* Summed in another order, each partial sum may round differently */
+    arm_dot_prod_f32(SrcF, CoefF, n, &f0);
+    ref_arm_dot_prod_f32(SrcF, CoefF, n, &f1);
+    bad[2] += (fabsf(f0 - f1) > 2.0f * FLT_EPSILON * n * bound);
+  }
+
+  report("arm_dot_prod_q15", NumCases, bad[0], "bit-exact");
+  report("arm_dot_prod_q31", NumCases, bad[1], "bit-exact");
+  report("arm_dot_prod_f32", NumCases, bad[2], "within bound");
+}
+
+
+static void test_cmplx_mag(void)
+{
+  uint32_t c, i, n, bad = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    n = rnd() % 300u;
+    for (i = 0u; i < 2u * n; i++)
+    {
+      SrcF[i] = (rnd() % 8u) ? rnd_f32() * 100.0f : 0.0f;
+    }
+    arm_cmplx_mag_f32(SrcF, DstF, n);
+    ref_arm_cmplx_mag_f32(SrcF, RefF, n);
+    bad += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+  }
+
+  report("arm_cmplx_mag_f32", NumCases, bad, "bit-exact");
+}
+
+
+static void test_fir_q15(void)
+{
+  arm_fir_instance_q15 S[2];
+  uint32_t c, b, i, k, numTaps, blk, inplace, mode, bad = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numTaps = 4u + 2u * (rnd() % (MAX_TAPS / 2u - 1u));
+    mode = c % 3u;
+    inplace = rnd() & 1u;
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefQ15[i] = rnd_q15(mode);
+    }
+    arm_fir_init_q15(&S[0], numTaps, CoefQ15, StateQ15[0], MAX_BLOCK);
+    arm_fir_init_q15(&S[1], numTaps, CoefQ15, StateQ15[1], MAX_BLOCK);
+
+    /* Blocks of different sizes carry the state over */
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcQ15[i] = rnd_q15(mode);
+      }
+      if(inplace)
+      {
+        memcpy(DstQ15, SrcQ15, blk * sizeof(q15_t));
+        memcpy(RefQ15, SrcQ15, blk * sizeof(q15_t));
+        arm_fir_q15(&S[0], DstQ15, DstQ15, blk);
+        ref_arm_fir_q15(&S[1], RefQ15, RefQ15, blk);
+      }
+      else
+      {
+        arm_fir_q15(&S[0], SrcQ15, DstQ15, blk);
+        ref_arm_fir_q15(&S[1], SrcQ15, RefQ15, blk);
+      }
+      k = memcmp(DstQ15, RefQ15, blk * sizeof(q15_t)) != 0;
+      k |= memcmp(StateQ15[0], StateQ15[1], (numTaps - 1u) * sizeof(q15_t)) != 0;
+      bad += k;
+    }
+  }
+
+  report("arm_fir_q15", 3u * NumCases, bad, "bit-exact");
+}
+
+
+static void test_fir_q31(void)
+{
+  arm_fir_instance_q31 S[2];
+  uint32_t c, b, i, k, numTaps, blk, inplace, mode, bad = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numTaps = 1u + rnd() % MAX_TAPS;
+    mode = c % 3u;
+    inplace = rnd() & 1u;
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefQ31[i] = rnd_q31(mode);
+    }
+    arm_fir_init_q31(&S[0], numTaps, CoefQ31, StateQ31[0], MAX_BLOCK);
+    arm_fir_init_q31(&S[1], numTaps, CoefQ31, StateQ31[1], MAX_BLOCK);
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcQ31[i] = rnd_q31(mode);
+      }
+      if(inplace)
+      {
+        memcpy(DstQ31, SrcQ31, blk * sizeof(q31_t));
+        memcpy(RefQ31, SrcQ31, blk * sizeof(q31_t));
+        arm_fir_q31(&S[0], DstQ31, DstQ31, blk);
+        ref_arm_fir_q31(&S[1], RefQ31, RefQ31, blk);
+      }
+      else
+      {
+        arm_fir_q31(&S[0], SrcQ31, DstQ31, blk);
+        ref_arm_fir_q31(&S[1], SrcQ31, RefQ31, blk);
+      }
+      k = memcmp(DstQ31, RefQ31, blk * sizeof(q31_t)) != 0;
+      k |= memcmp(StateQ31[0], StateQ31[1], (numTaps - 1u) * sizeof(q31_t)) != 0;
+      bad += k;
+    }
+  }
+
+  report("arm_fir_q31", 3u * NumCases, bad, "bit-exact");
+}
+
+
+static void test_fir_f32(void)
+{
+  arm_fir_instance_f32 S[2];
+  uint32_t c, b, i, k, numTaps, blk, bad = 0u;
+  float32_t bound;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numTaps = 1u + rnd() % MAX_TAPS;
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefF[i] = rnd_f32();
+    }
+    arm_fir_init_f32(&S[0], numTaps, CoefF, StateF[0], MAX_BLOCK);
+    arm_fir_init_f32(&S[1], numTaps, CoefF, StateF[1], MAX_BLOCK);
+
+#if defined (ARM_MATH_AVX2)
+    /* Each fused multiply-add rounds once instead of twice */
+    bound = FLT_EPSILON * numTaps * numTaps;
+#else
+    bound = 0.0f;
+#endif
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+      }
+      arm_fir_f32(&S[0], SrcF, DstF, blk);
+      ref_arm_fir_f32(&S[1], SrcF, RefF, blk);
+      k = memcmp(StateF[0], StateF[1], (numTaps - 1u) * sizeof(float32_t)) != 0;
+      for (i = 0u; i < blk; i++)
+      {
+        k |= !(fabsf(DstF[i] - RefF[i]) <= bound);
+      }
+      bad += k;
+    }
+  }
+
+#if defined (ARM_MATH_AVX2)
+  report("arm_fir_f32", 3u * NumCases, bad, "within bound");
+#else
+  report("arm_fir_f32", 3u * NumCases, bad, "bit-exact");
+#endif
+}
+
+
+/* Checks the overlap-save FIR against the C code, and against a direct convolution in double precision
+ * over the 3 blocks of a case, with an error relative to the sum of the magnitudes of the taps */
+static void test_fir_ols_f32(void)
+{
+  static float32_t state[2][4u * MAX_OLS_TAPS + 9u * MAX_BLOCK];
+  arm_fir_ols_instance_f32 S[2];
+  uint32_t c, b, i, k, numTaps, blk, bad = 0u, badConv = 0u;
+  float32_t bound;
+  float64_t acc, norm, e, err = 0.0;
+
+  for (c = 0u; c < NumCases / 10u; c++)
+  {
+    numTaps = 1u + rnd() % MAX_OLS_TAPS;
+    blk = 16u << (rnd() % 5u);
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefF[i] = rnd_f32();
+    }
+    arm_fir_ols_init_f32(&S[0], numTaps, CoefF, state[0], blk);
+    ref_arm_fir_ols_init_f32(&S[1], numTaps, CoefF, state[1], blk);
+
+#if defined (ARM_MATH_AVX2)
+    /* The direct form uses fused multiply-adds */
+    bound = (S[0].numPart == 0u) ? FLT_EPSILON * numTaps * numTaps : 0.0f;
+#else
+    bound = 0.0f;
+#endif
+
+    for (b = 0u; b < 3u; b++)
+    {
+      for (i = b * blk; i < (b + 1u) * blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+      }
+      arm_fir_ols_f32(&S[0], SrcF + b * blk, DstF + b * blk, blk);
+      ref_arm_fir_ols_f32(&S[1], SrcF + b * blk, RefF + b * blk, blk);
+      k = (S[0].numPart != S[1].numPart) || (S[0].partLen != S[1].partLen);
+      for (i = b * blk; i < (b + 1u) * blk; i++)
+      {
+        k |= !(fabsf(DstF[i] - RefF[i]) <= bound);
+      }
+      bad += k;
+    }
+
+    /* The partitions, the FFTs and the delay line must give the convolution, with the taps in time reversed order */
+    for (i = 0u, norm = 0.0; i < numTaps; i++)
+    {
+      norm += fabs(CoefF[i]);
+    }
+    for (i = 0u, k = 0u; i < 3u * blk; i++)
+    {
+      for (b = 0u, acc = 0.0; b < numTaps && b <= i; b++)
+      {
+        acc += (float64_t) CoefF[numTaps - 1u - b] * SrcF[i - b];
+      }
+      e = fabs(DstF[i] - acc) / norm;
+      err = (e > err) ? e : err;
+      k |= (e > 1.0e-6);
+    }
+    badConv += k;
+  }
+
+#if defined (ARM_MATH_AVX2)
+  report("arm_fir_ols_f32", 3u * (NumCases / 10u), bad, "within bound");
+#else
+  report("arm_fir_ols_f32", 3u * (NumCases / 10u), bad, "bit-exact");
+#endif
+  printf("%-30s max error %.3g of the tap sum\n", "arm_fir_ols_f32", err);
+  report("arm_fir_ols_f32", NumCases / 10u, badConv, "within bound");
+}
+
+
+static void test_biquad_f32(void)
+{
+  arm_biquad_casd_df1_inst_f32 S[2];
+  float32_t state[2][4u * MAX_STAGES];
+  float32_t r, w;
+  uint32_t c, b, i, k, numStages, blk, inplace, bad = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numStages = 1u + rnd() % MAX_STAGES;
+    inplace = rnd() & 1u;
+
+    /* Stable sections, poles at radius r */
+    for (i = 0u; i < numStages; i++)
+    {
+      r = 0.5f + 0.45f * fabsf(rnd_f32());
+      w = PI * rnd_f32();
+      CoefF[5u * i] = rnd_f32();
+      CoefF[5u * i + 1u] = rnd_f32();
+      CoefF[5u * i + 2u] = rnd_f32();
+      CoefF[5u * i + 3u] = 2.0f * r * cosf(w);
+      CoefF[5u * i + 4u] = -r * r;
+    }
+    arm_biquad_cascade_df1_init_f32(&S[0], numStages, CoefF, state[0]);
+    arm_biquad_cascade_df1_init_f32(&S[1], numStages, CoefF, state[1]);
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+      }
+      if(inplace)
+      {
+        memcpy(DstF, SrcF, blk * sizeof(float32_t));
+        memcpy(RefF, SrcF, blk * sizeof(float32_t));
+        arm_biquad_cascade_df1_f32(&S[0], DstF, DstF, blk);
+        ref_arm_biquad_cascade_df1_f32(&S[1], RefF, RefF, blk);
+      }
+      else
+      {
+        arm_biquad_cascade_df1_f32(&S[0], SrcF, DstF, blk);
+        ref_arm_biquad_cascade_df1_f32(&S[1], SrcF, RefF, blk);
+      }
+      k = memcmp(DstF, RefF, blk * sizeof(float32_t)) != 0;
+      k |= memcmp(state[0], state[1], 4u * numStages * sizeof(float32_t)) != 0;
+      bad += k;
+    }
+  }
+
+  report("arm_biquad_cascade_df1_f32", 3u * NumCases, bad, "bit-exact");
+}
+
+
+/* Checks the multichannel FIRs against the C code, and each channel against the C code of
+ * arm_fir_f32() and arm_fir_q15() run on that channel alone */
+static void test_fir_mc(void)
+{
+  static float32_t stateF[2][MAX_CHANNELS * (MAX_TAPS + MAX_BLOCK)];
+  static q15_t stateQ15[2][MAX_CHANNELS * (MAX_TAPS + MAX_BLOCK)];
+  static float32_t chStateF[MAX_CHANNELS][MAX_TAPS + MAX_BLOCK], chF[2][MAX_BLOCK];
+  static q15_t chStateQ15[MAX_CHANNELS][MAX_TAPS + 1u + MAX_BLOCK], chQ15[2][MAX_BLOCK], padQ15[MAX_TAPS + 1u];
+  arm_fir_mc_instance_f32 SF[2];
+  arm_fir_mc_instance_q15 SQ[2];
+  arm_fir_instance_f32 CF[MAX_CHANNELS];
+  arm_fir_instance_q15 CQ[MAX_CHANNELS];
+  uint32_t c, b, i, k, ch, numTaps, numCh, blk, mode, badF = 0u, badQ = 0u, badChF = 0u, badChQ = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numTaps = 1u + rnd() % MAX_TAPS;
+    numCh = 1u + rnd() % MAX_CHANNELS;
+    mode = c % 3u;
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefF[i] = rnd_f32();
+      CoefQ15[i] = rnd_q15(mode);
+    }
+    arm_fir_mc_init_f32(&SF[0], numTaps, numCh, CoefF, stateF[0], MAX_BLOCK);
+    arm_fir_mc_init_f32(&SF[1], numTaps, numCh, CoefF, stateF[1], MAX_BLOCK);
+    arm_fir_mc_init_q15(&SQ[0], numTaps, numCh, CoefQ15, stateQ15[0], MAX_BLOCK);
+    arm_fir_mc_init_q15(&SQ[1], numTaps, numCh, CoefQ15, stateQ15[1], MAX_BLOCK);
+
+    /* arm_fir_q15() takes an even number of taps, at least 4, so leading zero taps are added */
+    k = (numTaps < 4u) ? 4u - numTaps : (numTaps & 1u);
+    memset(padQ15, 0, k * sizeof(q15_t));
+    memcpy(padQ15 + k, CoefQ15, numTaps * sizeof(q15_t));
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      arm_fir_init_f32(&CF[ch], numTaps, CoefF, chStateF[ch], MAX_BLOCK);
+      arm_fir_init_q15(&CQ[ch], numTaps + k, padQ15, chStateQ15[ch], MAX_BLOCK);
+    }
+
+    /* Blocks of different sizes carry the state over */
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk * numCh; i++)
+      {
+        SrcF[i] = rnd_f32();
+        SrcQ15[i] = rnd_q15(mode);
+      }
+      arm_fir_mc_f32(&SF[0], SrcF, DstF, blk);
+      ref_arm_fir_mc_f32(&SF[1], SrcF, RefF, blk);
+      k = memcmp(DstF, RefF, blk * numCh * sizeof(float32_t)) != 0;
+      k |= memcmp(stateF[0], stateF[1], (numTaps - 1u) * numCh * sizeof(float32_t)) != 0;
+      badF += k;
+
+      arm_fir_mc_q15(&SQ[0], SrcQ15, DstQ15, blk);
+      ref_arm_fir_mc_q15(&SQ[1], SrcQ15, RefQ15, blk);
+      k = memcmp(DstQ15, RefQ15, blk * numCh * sizeof(q15_t)) != 0;
+      k |= memcmp(stateQ15[0], stateQ15[1], (numTaps - 1u) * numCh * sizeof(q15_t)) != 0;
+      badQ += k;
+
+      /* De-interleave each channel and filter it alone */
+      for (ch = 0u, k = 0u; ch < numCh; ch++)
+      {
+        for (i = 0u; i < blk; i++)
+        {
+          chF[0][i] = SrcF[i * numCh + ch];
+          chQ15[0][i] = SrcQ15[i * numCh + ch];
+        }
+        ref_arm_fir_f32(&CF[ch], chF[0], chF[1], blk);
+        ref_arm_fir_q15(&CQ[ch], chQ15[0], chQ15[1], blk);
+        for (i = 0u; i < blk; i++)
+        {
+          k |= (memcmp(&DstF[i * numCh + ch], &chF[1][i], sizeof(float32_t)) != 0);
+          k |= (DstQ15[i * numCh + ch] != chQ15[1][i]) << 1;
+        }
+      }
+      badChF += k & 1u;
+      badChQ += k >> 1;
+    }
+  }
+
+  report("arm_fir_mc_f32", 3u * NumCases, badF, "bit-exact");
+  report("arm_fir_mc_q15", 3u * NumCases, badQ, "bit-exact");
+  report("arm_fir_mc_f32 vs arm_fir_f32", 3u * NumCases, badChF, "bit-exact");
+  report("arm_fir_mc_q15 vs arm_fir_q15", 3u * NumCases, badChQ, "bit-exact");
+}
+
+
+/* Checks the multichannel biquad cascades against the C code, and each channel against
+ * arm_biquad_cascade_df1_f32(), _q31() and _q15() run on that channel alone.
+ * The Q15 one has no SIMD code and is only checked against the single-channel function. */
+static void test_biquad_mc(void)
+{
+  static float32_t stateF[2][4u * MAX_STAGES * MAX_CHANNELS];
+  static q31_t stateQ31[2][4u * MAX_STAGES * MAX_CHANNELS];
+  static q15_t stateQ15[4u * MAX_STAGES * MAX_CHANNELS];
+  static float32_t chStateF[MAX_CHANNELS][4u * MAX_STAGES], chF[2][MAX_BLOCK];
+  static q31_t chStateQ31[MAX_CHANNELS][4u * MAX_STAGES], chQ31[2][MAX_BLOCK];
+  static q15_t chStateQ15[MAX_CHANNELS][4u * MAX_STAGES], chQ15[2][MAX_BLOCK];
+  arm_biquad_casd_df1_mc_inst_f32 SF[2];
+  arm_biquad_casd_df1_mc_inst_q31 SQ[2];
+  arm_biquad_casd_df1_mc_inst_q15 SS;
+  arm_biquad_casd_df1_inst_f32 CF[MAX_CHANNELS];
+  arm_biquad_casd_df1_inst_q31 CQ[MAX_CHANNELS];
+  arm_biquad_casd_df1_inst_q15 CS[MAX_CHANNELS];
+  float32_t r, w;
+  uint32_t c, b, i, k, ch, numStages, numCh, blk, inplace, postShift, badF = 0u, badQ = 0u;
+  uint32_t badChF = 0u, badChQ = 0u, badChS = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numStages = 1u + rnd() % MAX_STAGES;
+    numCh = 1u + rnd() % MAX_CHANNELS;
+    inplace = rnd() & 1u;
+    postShift = rnd() % 3u;
+
+    /* Stable sections, poles at radius r. The Q31 coefficients keep the accumulator in range. */
+    for (i = 0u; i < numStages; i++)
+    {
+      r = 0.5f + 0.45f * fabsf(rnd_f32());
+      w = PI * rnd_f32();
+      CoefF[5u * i] = rnd_f32();
+      CoefF[5u * i + 1u] = rnd_f32();
+      CoefF[5u * i + 2u] = rnd_f32();
+      CoefF[5u * i + 3u] = 2.0f * r * cosf(w);
+      CoefF[5u * i + 4u] = -r * r;
+    }
+    for (i = 0u; i < 5u * numStages; i++)
+    {
+      CoefQ31[i] = rnd_q31(c % 3u) >> 2;
+    }
+
+    /* Q15 coefficients {b0, 0, b1, b2, a1, a2}, saturating at times */
+    for (i = 0u; i < 6u * numStages; i++)
+    {
+      CoefQ15[i] = (i % 6u == 1u) ? 0 : rnd_q15(c % 3u) >> 2;
+    }
+    arm_biquad_cascade_df1_mc_init_f32(&SF[0], numStages, numCh, CoefF, stateF[0]);
+    arm_biquad_cascade_df1_mc_init_f32(&SF[1], numStages, numCh, CoefF, stateF[1]);
+    arm_biquad_cascade_df1_mc_init_q31(&SQ[0], numStages, numCh, CoefQ31, stateQ31[0], postShift);
+    arm_biquad_cascade_df1_mc_init_q31(&SQ[1], numStages, numCh, CoefQ31, stateQ31[1], postShift);
+    arm_biquad_cascade_df1_mc_init_q15(&SS, numStages, numCh, CoefQ15, stateQ15, postShift);
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      arm_biquad_cascade_df1_init_f32(&CF[ch], numStages, CoefF, chStateF[ch]);
+      arm_biquad_cascade_df1_init_q31(&CQ[ch], numStages, CoefQ31, chStateQ31[ch], postShift);
+      arm_biquad_cascade_df1_init_q15(&CS[ch], numStages, CoefQ15, chStateQ15[ch], postShift);
+    }
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk * numCh; i++)
+      {
+        SrcF[i] = rnd_f32();
+        SrcQ31[i] = rnd_q31(c % 3u);
+        SrcQ15[i] = rnd_q15(c % 3u);
+      }
+      if(inplace)
+      {
+        memcpy(DstF, SrcF, blk * numCh * sizeof(float32_t));
+        memcpy(RefF, SrcF, blk * numCh * sizeof(float32_t));
+        memcpy(DstQ31, SrcQ31, blk * numCh * sizeof(q31_t));
+        memcpy(RefQ31, SrcQ31, blk * numCh * sizeof(q31_t));
+        memcpy(DstQ15, SrcQ15, blk * numCh * sizeof(q15_t));
+        arm_biquad_cascade_df1_mc_f32(&SF[0], DstF, DstF, blk);
+        ref_arm_biquad_cascade_df1_mc_f32(&SF[1], RefF, RefF, blk);
+        arm_biquad_cascade_df1_mc_q31(&SQ[0], DstQ31, DstQ31, blk);
+        ref_arm_biquad_cascade_df1_mc_q31(&SQ[1], RefQ31, RefQ31, blk);
+        arm_biquad_cascade_df1_mc_q15(&SS, DstQ15, DstQ15, blk);
+      }
+      else
+      {
+        arm_biquad_cascade_df1_mc_f32(&SF[0], SrcF, DstF, blk);
+        ref_arm_biquad_cascade_df1_mc_f32(&SF[1], SrcF, RefF, blk);
+        arm_biquad_cascade_df1_mc_q31(&SQ[0], SrcQ31, DstQ31, blk);
+        ref_arm_biquad_cascade_df1_mc_q31(&SQ[1], SrcQ31, RefQ31, blk);
+        arm_biquad_cascade_df1_mc_q15(&SS, SrcQ15, DstQ15, blk);
+      }
+      k = memcmp(DstF, RefF, blk * numCh * sizeof(float32_t)) != 0;
+      k |= memcmp(stateF[0], stateF[1], 4u * numStages * numCh * sizeof(float32_t)) != 0;
+      badF += k;
+      k = memcmp(DstQ31, RefQ31, blk * numCh * sizeof(q31_t)) != 0;
+      k |= memcmp(stateQ31[0], stateQ31[1], 4u * numStages * numCh * sizeof(q31_t)) != 0;
+      badQ += k;
+
+      /* De-interleave each channel and filter it alone */
+      for (ch = 0u, k = 0u; ch < numCh; ch++)
+      {
+        for (i = 0u; i < blk; i++)
+        {
+          chF[0][i] = SrcF[i * numCh + ch];
+          chQ31[0][i] = SrcQ31[i * numCh + ch];
+          chQ15[0][i] = SrcQ15[i * numCh + ch];
+        }
+        ref_arm_biquad_cascade_df1_f32(&CF[ch], chF[0], chF[1], blk);
+        arm_biquad_cascade_df1_q31(&CQ[ch], chQ31[0], chQ31[1], blk);
+        arm_biquad_cascade_df1_q15(&CS[ch], chQ15[0], chQ15[1], blk);
+        for (i = 0u; i < blk; i++)
+        {
+          k |= (memcmp(&DstF[i * numCh + ch], &chF[1][i], sizeof(float32_t)) != 0);
+          k |= (DstQ31[i * numCh + ch] != chQ31[1][i]) << 1;
+          k |= (DstQ15[i * numCh + ch] != chQ15[1][i]) << 2;
+        }
+      }
+      badChF += k & 1u;
+      badChQ += (k >> 1) & 1u;
+      badChS += k >> 2;
+    }
+  }
+
+  report("arm_biquad_cascade_df1_mc_f32", 3u * NumCases, badF, "bit-exact");
+  report("arm_biquad_cascade_df1_mc_q31", 3u * NumCases, badQ, "bit-exact");
+  report("biquad_df1_mc_f32 vs df1_f32", 3u * NumCases, badChF, "bit-exact");
+  report("biquad_df1_mc_q31 vs df1_q31", 3u * NumCases, badChQ, "bit-exact");
+  report("biquad_df1_mc_q15 vs df1_q15", 3u * NumCases, badChS, "bit-exact");
+}
+
+
+/* Checks the rational resamplers against the direct polyphase sum y[m] = sum b[p+j*L] * x[n-j],
+ * with n = m*M/L and p = m*M%L, over the blocks of random sizes of a stream */
+static void test_fir_resample(void)
+{
+  static const uint16_t ratio[3][2] = { { 160u, 147u }, { 2u, 3u }, { 5u, 1u } };
+  static float32_t outF[4u * MAX_LEN];
+  static q31_t outQ31[4u * MAX_LEN];
+  static q15_t outQ15[4u * MAX_LEN];
+  arm_fir_resample_instance_f32 SF;
+  arm_fir_resample_instance_q31 SQ31;
+  arm_fir_resample_instance_q15 SQ15;
+  float64_t acc, mag;
+  q63_t acc31, acc15;
+  uint32_t c, b, i, j, m, n, p, t, L, M, phaseLength, numTaps, blk, len, numOut;
+  uint32_t nF, nQ31, nQ15, badF = 0u, badQ31 = 0u, badQ15 = 0u, kF, kQ31, kQ15;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    L = ratio[c % 3u][0];
+    M = ratio[c % 3u][1];
+    phaseLength = 1u + rnd() % 16u;
+    numTaps = L * phaseLength;
+    for (i = 0u; i < numTaps; i++)
+    {
+      CoefF[i] = rnd_f32();
+      CoefQ31[i] = rnd_q31(0u) / (q31_t) (phaseLength + 1u);      /* No overflow of the 2.62 accumulator */
+      CoefQ15[i] = rnd_q15(c % 3u);
+    }
+    arm_fir_resample_init_f32(&SF, (uint16_t) L, (uint16_t) M, (uint16_t) numTaps, CoefF, StateF[0], MAX_BLOCK);
+    arm_fir_resample_init_q31(&SQ31, (uint16_t) L, (uint16_t) M, (uint16_t) numTaps, CoefQ31, StateQ31[0], MAX_BLOCK);
+    arm_fir_resample_init_q15(&SQ15, (uint16_t) L, (uint16_t) M, (uint16_t) numTaps, CoefQ15, StateQ15[0], MAX_BLOCK);
+
+    /* Blocks of random sizes */
+    len = nF = nQ31 = nQ15 = 0u;
+    for (b = 0u; b < 6u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = len; i < len + blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+        SrcQ31[i] = rnd_q31(c % 3u);
+        SrcQ15[i] = rnd_q15(c % 3u);
+      }
+      nF += arm_fir_resample_f32(&SF, SrcF + len, outF + nF, blk);
+      nQ31 += arm_fir_resample_q31(&SQ31, SrcQ31 + len, outQ31 + nQ31, blk);
+      nQ15 += arm_fir_resample_q15(&SQ15, SrcQ15 + len, outQ15 + nQ15, blk);
+      len += blk;
+    }
+
+    /* The outputs at the upsampled positions m*M below len*L */
+    numOut = (len * L + M - 1u) / M;
+    kF = (nF != numOut);
+    kQ31 = (nQ31 != numOut);
+    kQ15 = (nQ15 != numOut);
+    for (m = 0u; (m < numOut) && !(kF && kQ31 && kQ15); m++)
+    {
+      n = m * M / L;
+      p = m * M % L;
+      acc = mag = 0.0;
+      acc31 = acc15 = 0;
+      for (j = 0u; (j < phaseLength) && (j <= n); j++)
+      {
+        /* b[t] is stored at pCoeffs[numTaps-1-t] */
+        t = numTaps - 1u - (p + j * L);
+        acc += (float64_t) CoefF[t] * SrcF[n - j];
+        mag += fabs((float64_t) CoefF[t] * SrcF[n - j]);
+        acc31 += (q63_t) CoefQ31[t] * SrcQ31[n - j];
+        acc15 += (q31_t) CoefQ15[t] * SrcQ15[n - j];
+      }
+      kF |= (fabs(outF[m] - acc) > 1.0e-6 * mag + FLT_MIN);
+      kQ31 |= (outQ31[m] != (q31_t) (acc31 >> 31));
+      kQ15 |= (outQ15[m] != (q15_t) __SSAT((q31_t) (acc15 >> 15), 16));
+    }
+    badF += kF;
+    badQ31 += kQ31;
+    badQ15 += kQ15;
+  }
+
+  report("arm_fir_resample_f32", NumCases, badF, "within bound");
+  report("arm_fir_resample_q31", NumCases, badQ31, "bit-exact");
+  report("arm_fir_resample_q15", NumCases, badQ15, "bit-exact");
+}
+
+
+/* Checks the DF2T cascades against the C code, and against arm_biquad_cascade_df1_fast_q15()
+ * and arm_biquad_cascade_df1_q31() on the same coefficients and postShift, which they match bit for bit. */
+static void test_biquad_df2T(void)
+{
+  q31_t state15[2][2u * MAX_STAGES];
+  q63_t state31[2][2u * MAX_STAGES];
+  q15_t stateDF1q15[4u * MAX_STAGES];
+  q31_t stateDF1q31[4u * MAX_STAGES];
+  arm_biquad_cascade_df2T_instance_q15 S15[2];
+  arm_biquad_cascade_df2T_instance_q31 S31[2];
+  arm_biquad_casd_df1_inst_q15 D15;
+  arm_biquad_casd_df1_inst_q31 D31;
+  uint32_t c, b, i, k, numStages, blk, inplace, postShift, mode, bad15 = 0u, bad31 = 0u;
+  uint32_t badDF1q15 = 0u, badDF1q31 = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numStages = 1u + rnd() % MAX_STAGES;
+    inplace = rnd() & 1u;
+    postShift = rnd() % 3u;
+    mode = c % 3u;
+
+    /* Random coefficients, which also exercise the wrap around and the saturation */
+    for (i = 0u; i < 5u * numStages; i++)
+    {
+      CoefQ31[i] = rnd_q31(mode) >> 2;
+    }
+    for (i = 0u; i < 6u * numStages; i++)
+    {
+      CoefQ15[i] = (i % 6u == 1u) ? 0 : rnd_q15(mode);
+    }
+    arm_biquad_cascade_df2T_init_q15(&S15[0], numStages, CoefQ15, state15[0], postShift);
+    arm_biquad_cascade_df2T_init_q15(&S15[1], numStages, CoefQ15, state15[1], postShift);
+    arm_biquad_cascade_df2T_init_q31(&S31[0], numStages, CoefQ31, state31[0], postShift);
+    arm_biquad_cascade_df2T_init_q31(&S31[1], numStages, CoefQ31, state31[1], postShift);
+    arm_biquad_cascade_df1_init_q15(&D15, numStages, CoefQ15, stateDF1q15, postShift);
+    arm_biquad_cascade_df1_init_q31(&D31, numStages, CoefQ31, stateDF1q31, postShift);
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcQ15[i] = rnd_q15(mode);
+        SrcQ31[i] = rnd_q31(mode);
+      }
+
+      /* The DF1 outputs go to the tails of the Ref buffers */
+      arm_biquad_cascade_df1_fast_q15(&D15, SrcQ15, RefQ15 + MAX_BLOCK, blk);
+      arm_biquad_cascade_df1_q31(&D31, SrcQ31, RefQ31 + MAX_BLOCK, blk);
+      if(inplace)
+      {
+        memcpy(DstQ15, SrcQ15, blk * sizeof(q15_t));
+        memcpy(RefQ15, SrcQ15, blk * sizeof(q15_t));
+        memcpy(DstQ31, SrcQ31, blk * sizeof(q31_t));
+        memcpy(RefQ31, SrcQ31, blk * sizeof(q31_t));
+        arm_biquad_cascade_df2T_q15(&S15[0], DstQ15, DstQ15, blk);
+        ref_arm_biquad_cascade_df2T_q15(&S15[1], RefQ15, RefQ15, blk);
+        arm_biquad_cascade_df2T_q31(&S31[0], DstQ31, DstQ31, blk);
+        ref_arm_biquad_cascade_df2T_q31(&S31[1], RefQ31, RefQ31, blk);
+      }
+      else
+      {
+        arm_biquad_cascade_df2T_q15(&S15[0], SrcQ15, DstQ15, blk);
+        ref_arm_biquad_cascade_df2T_q15(&S15[1], SrcQ15, RefQ15, blk);
+        arm_biquad_cascade_df2T_q31(&S31[0], SrcQ31, DstQ31, blk);
+        ref_arm_biquad_cascade_df2T_q31(&S31[1], SrcQ31, RefQ31, blk);
+      }
+      k = memcmp(DstQ15, RefQ15, blk * sizeof(q15_t)) != 0;
+      k |= memcmp(state15[0], state15[1], 2u * numStages * sizeof(q31_t)) != 0;
+      bad15 += k;
+      k = memcmp(DstQ31, RefQ31, blk * sizeof(q31_t)) != 0;
+      k |= memcmp(state31[0], state31[1], 2u * numStages * sizeof(q63_t)) != 0;
+      bad31 += k;
+      badDF1q15 += memcmp(DstQ15, RefQ15 + MAX_BLOCK, blk * sizeof(q15_t)) != 0;
+      badDF1q31 += memcmp(DstQ31, RefQ31 + MAX_BLOCK, blk * sizeof(q31_t)) != 0;
+    }
+  }
+
+  report("arm_biquad_cascade_df2T_q15", 3u * NumCases, bad15, "bit-exact");
+  report("arm_biquad_cascade_df2T_q31", 3u * NumCases, bad31, "bit-exact");
+  report("df2T_q15 vs df1_fast_q15", 3u * NumCases, badDF1q15, "bit-exact");
+  report("df2T_q31 vs df1_q31", 3u * NumCases, badDF1q31, "bit-exact");
+}
+
+
+/* Direct DFT of L complex values in double precision, scaled by 1/L for the inverse one or when scale is set */
+static void dft_f64(const float64_t * x, float64_t * y, uint32_t L, uint32_t ifft, uint32_t scale)
+{
+  static float64_t cosTab[MAX_LEN / 2], sinTab[MAX_LEN / 2];
+  float64_t sr, si, s, g;
+  uint32_t k, n, i;
+
+  for (i = 0u; i < L; i++)
+  {
+    cosTab[i] = cos(6.283185307179586 * i / L);
+    sinTab[i] = sin(6.283185307179586 * i / L);
+  }
+  g = (scale || ifft) ? 1.0 / L : 1.0;
+  for (k = 0u; k < L; k++)
+  {
+    sr = si = 0.0;
+    for (n = 0u, i = 0u; n < L; n++, i = (i + k) % L)
+    {
+      /* x[n] * exp(-+2*pi*j*k*n/L) */
+      s = ifft ? sinTab[i] : -sinTab[i];
+      sr += x[2u * n] * cosTab[i] - x[2u * n + 1u] * s;
+      si += x[2u * n] * s + x[2u * n + 1u] * cosTab[i];
+    }
+    y[2u * k] = sr * g;
+    y[2u * k + 1u] = si * g;
+  }
+}
+
+
+/* Checks arm_cfft_f32() against the C code, and up to the longest codelet (256) against a double DFT,
+ * which covers the codelets whatever the lengths they were generated for */
+static void test_cfft_f32(void)
+{
+  static const arm_cfft_instance_f32 *const inst[] = {
+    &arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+    &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+    &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+  };
+  static float64_t x[MAX_LEN], y[MAX_LEN];
+  float64_t e, norm, err = 0.0;
+  uint32_t c, i, n, ifft, bitrev, cases = 0u, bad = 0u, casesDft = 0u, badDft = 0u;
+
+  for (c = 0u; c < sizeof inst / sizeof inst[0]; c++)
+  {
+    n = 2u * inst[c]->fftLen;
+    for (ifft = 0u; ifft < 2u; ifft++)
+    {
+      for (bitrev = 0u; bitrev < 2u; bitrev++)
+      {
+        for (i = 0u; i < n; i++)
+        {
+          DstF[i] = RefF[i] = rnd_f32();
+        }
+        for (i = 0u; i < n; i++)
+        {
+          x[i] = DstF[i];
+        }
+        arm_cfft_f32(inst[c], DstF, ifft, bitrev);
+        ref_arm_cfft_f32(inst[c], RefF, ifft, bitrev);
+        bad += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+        cases++;
+
+        /* Error relative to the norm of the output, in natural order only */
+        if(!bitrev || inst[c]->fftLen > 256u)
+        {
+          continue;
+        }
+        dft_f64(x, y, inst[c]->fftLen, ifft, 0u);
+        norm = 0.0;
+        for (i = 0u; i < n; i++)
+        {
+          norm += y[i] * y[i];
+        }
+        norm = sqrt(norm / inst[c]->fftLen);
+        for (i = 0u; i < n; i++)
+        {
+          e = fabs(DstF[i] - y[i]) / norm;
+          err = (e > err) ? e : err;
+          badDft += (e > 1.0e-6);
+        }
+        casesDft++;
+      }
+    }
+  }
+
+  report("arm_cfft_f32", cases, bad, "bit-exact");
+  printf("%-30s max error %.3g of the output rms\n", "arm_cfft_f32 vs DFT", err);
+  report("arm_cfft_f32 vs DFT", casesDft, badDft, "within bound");
+}
+
+
+static void test_cfft_mixed(void)
+{
+  /* Radix 2, 3, 4 and 5 stages alone and mixed */
+  static const uint16_t lens[] = {
+    2u, 3u, 4u, 5u, 6u, 10u, 12u, 15u, 24u, 25u, 27u, 30u, 45u, 60u, 80u, 90u, 125u,
+    120u, 144u, 160u, 240u, 243u, 320u, 360u, 480u, 625u, 720u, 960u, 1000u, 1200u,
+    1536u, 1920u, 2160u, 2400u, 3000u, 3840u, 4000u
+  };
+  static float64_t x[MAX_LEN], y[MAX_LEN];
+  static float32_t twF[MAX_LEN], bufF[MAX_LEN];
+  static q31_t twQ31[MAX_LEN], bufQ31[MAX_LEN];
+  arm_cfft_mixed_instance_f32 SF;
+  arm_cfft_mixed_instance_q31 SQ;
+  float64_t e, norm, bound, errF = 0.0, errQ31 = 0.0;
+  uint32_t c, i, L, ifft, cases = 0u, badF = 0u, badQ31 = 0u;
+
+  for (c = 0u; c < sizeof lens / sizeof lens[0]; c++)
+  {
+    L = lens[c];
+    if((arm_cfft_mixed_init_f32(&SF, (uint16_t) L, twF, bufF) != ARM_MATH_SUCCESS) ||
+       (arm_cfft_mixed_init_q31(&SQ, (uint16_t) L, twQ31, bufQ31) != ARM_MATH_SUCCESS))
+    {
+      badF++;
+      continue;
+    }
+
+    /* A radix-r butterfly adds r truncated inputs, and the twiddle rotation truncates twice */
+    for (i = 0u, bound = 0.0; i < SQ.numStages; i++)
+    {
+      bound += SQ.radix[i] + 2.0;
+    }
+    for (ifft = 0u; ifft < 2u; ifft++)
+    {
+      /* Floating-point: error relative to the norm of the output */
+      for (i = 0u; i < 2u * L; i++)
+      {
+        DstF[i] = rnd_f32();
+        x[i] = DstF[i];
+      }
+      dft_f64(x, y, L, ifft, 0u);
+      arm_cfft_mixed_f32(&SF, DstF, (uint8_t) ifft);
+      norm = 0.0;
+      for (i = 0u; i < 2u * L; i++)
+      {
+        norm += y[i] * y[i];
+      }
+      norm = sqrt(norm / L);
+      for (i = 0u; i < 2u * L; i++)
+      {
+        e = fabs(DstF[i] - y[i]) / norm;
+        errF = (e > errF) ? e : errF;
+        badF += (e > 2.0e-6);
+      }
+
+      /* Q31: inputs of magnitude below 1, output of the DFT divided by L both ways, error in LSB */
+      for (i = 0u; i < 2u * L; i++)
+      {
+        DstQ31[i] = rnd_q31(c % 3u) >> 1;
+        x[i] = DstQ31[i] / 2147483648.0;
+      }
+      dft_f64(x, y, L, ifft, 1u);
+      arm_cfft_mixed_q31(&SQ, DstQ31, (uint8_t) ifft);
+      for (i = 0u; i < 2u * L; i++)
+      {
+        e = fabs(DstQ31[i] - y[i] * 2147483648.0);
+        errQ31 = (e > errQ31) ? e : errQ31;
+        badQ31 += (e > bound);
+      }
+      cases++;
+    }
+  }
+
+  printf("%-30s max error %.3g of the output rms\n", "arm_cfft_mixed_f32", errF);
+  report("arm_cfft_mixed_f32", cases, badF, "within bound");
+  printf("%-30s max error %.3g LSB\n", "arm_cfft_mixed_q31", errQ31);
+  report("arm_cfft_mixed_q31", cases, badQ31, "within bound");
+}
+
+
+static void test_goertzel_sdft_f32(void)
+{
+  static float32_t state[2][2u * MAX_BINS + MAX_BLOCK];
+  static float32_t coef[2u * MAX_BINS];
+  static uint16_t index[MAX_BINS];
+  arm_goertzel_instance_f32 G[2];
+  arm_sdft_instance_f32 D[2];
+  uint32_t c, b, i, k, n, numBins, len, blk, badG = 0u, badD = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numBins = 1u + rnd() % MAX_BINS;
+    len = 16u + rnd() % (MAX_BLOCK - 15u);         /* At most 17 analyses per block */
+    for (i = 0u; i < numBins; i++)
+    {
+      CoefF[i] = 0.5f * fabsf(rnd_f32());
+      index[i] = (uint16_t) (rnd() % len);
+    }
+    arm_goertzel_init_f32(&G[0], numBins, len, CoefF, coef, state[0]);
+    arm_goertzel_init_f32(&G[1], numBins, len, CoefF, coef, state[1]);
+
+    /* Blocks across the end of the analyses */
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+      }
+      n = arm_goertzel_f32(&G[0], SrcF, DstF, blk);
+      k = (ref_arm_goertzel_f32(&G[1], SrcF, RefF, blk) != n) || (G[0].count != G[1].count);
+      k |= (memcmp(DstF, RefF, n * numBins * sizeof(float32_t)) != 0);
+      k |= (memcmp(state[0], state[1], 2u * numBins * sizeof(float32_t)) != 0);
+      badG += k;
+    }
+
+    arm_sdft_init_f32(&D[0], numBins, len, index, coef, state[0]);
+    arm_sdft_init_f32(&D[1], numBins, len, index, coef, state[1]);
+
+    for (b = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcF[i] = rnd_f32();
+      }
+      arm_sdft_f32(&D[0], SrcF, DstF, blk);
+      ref_arm_sdft_f32(&D[1], SrcF, RefF, blk);
+      k = (D[0].delayIndex != D[1].delayIndex);
+      k |= (memcmp(DstF, RefF, 2u * numBins * sizeof(float32_t)) != 0);
+      badD += k;
+    }
+  }
+
+  report("arm_goertzel_f32", 3u * NumCases, badG, "bit-exact");
+  report("arm_sdft_f32", 3u * NumCases, badD, "bit-exact");
+}
+
+
+/* Bins of the Q31 sliding DFT after pos samples: sum of (r*exp(j*w))^(m+1) * x[pos-1-m] over the window, scaled down as the comb stage */
+static void sdft_ref_q31(const q31_t * pHist, uint32_t pos, uint32_t N, uint32_t bin, float64_t * re, float64_t * im)
+{
+  float64_t r = 1.0 - 1.0 / 1048576.0, w = 6.283185307179586 * bin / N;
+  float64_t cr = r * cos(w), ci = r * sin(w), zr = cr, zi = ci, t, x;
+  uint32_t m;
+
+  *re = *im = 0.0;
+  for (m = 0u; m < N && m < pos; m++)
+  {
+    x = pHist[(pos - 1u - m) % N];
+    *re += zr * x;
+    *im += zi * x;
+    t = zr * cr - zi * ci;
+    zi = zr * ci + zi * cr;
+    zr = t;
+  }
+  *re = ldexp(*re, -(int) (32u - __CLZ(N - 1u) + 1u));
+  *im = ldexp(*im, -(int) (32u - __CLZ(N - 1u) + 1u));
+}
+
+
+static void test_goertzel_sdft_q31(void)
+{
+  static q63_t stateG[2u * MAX_BINS];
+  static q31_t stateD[2u * MAX_BINS + MAX_BLOCK], coef[2u * MAX_BINS], hist[MAX_BLOCK];
+  static uint16_t index[MAX_BINS];
+  arm_goertzel_instance_q31 G;
+  arm_sdft_instance_q31 D;
+  float64_t sr, si, w, re, im, e, errG = 0.0, errD = 0.0, errL = 0.0;
+  uint32_t c, b, i, k, a, n, numBins, len, blk, pos, shift, badG = 0u, badD = 0u, badL = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    numBins = 1u + rnd() % MAX_BINS;
+    len = 16u + rnd() % (MAX_BLOCK - 15u);
+    shift = 32u - __CLZ(len - 1u);
+    for (i = 0u; i < numBins; i++)
+    {
+      CoefQ31[i] = (q31_t) (rnd() % 0x40000001u);
+      index[i] = (uint16_t) (rnd() % len);
+    }
+
+    /* Goertzel: 1 to 4 analyses and a partial one in random blocks, inputs below one half so that nothing saturates */
+    arm_goertzel_init_q31(&G, numBins, len, CoefQ31, coef, stateG);
+    n = len * (1u + rnd() % 4u) + rnd() % len;
+    for (i = 0u; i < n; i++)
+    {
+      SrcQ31[i] = rnd_q31(c % 3u) >> 1;
+    }
+    for (i = 0u, a = 0u; i < n; i += blk)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      blk = (blk < n - i) ? blk : n - i;
+      a += arm_goertzel_q31(&G, SrcQ31 + i, DstQ31 + a * numBins, blk);
+    }
+    badG += (a != n / len) || (G.count != n % len);
+
+    /* Power of the DFT at the frequency of the rounded coefficient, in 3.29 format */
+    for (a = 0u; a < n / len; a++)
+    {
+      for (k = 0u; k < numBins; k++)
+      {
+        w = acos(coef[2u * k] / 2147483648.0);
+        sr = si = 0.0;
+        for (i = 0u; i < len; i++)
+        {
+          sr += SrcQ31[a * len + i] * cos(w * i);
+          si -= SrcQ31[a * len + i] * sin(w * i);
+        }
+        sr = ldexp(sr, -(int) shift);
+        si = ldexp(si, -(int) shift);
+        e = fabs(DstQ31[a * numBins + k] - (sr * sr + si * si) / 8589934592.0);
+        errG = (e > errG) ? e : errG;
+        badG += (e > 32.0);
+      }
+    }
+
+    /* Sliding DFT: three blocks, bins checked after each one */
+    arm_sdft_init_q31(&D, numBins, len, index, coef, stateD);
+    for (b = 0u, pos = 0u; b < 3u; b++)
+    {
+      blk = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk; i++)
+      {
+        SrcQ31[i] = rnd_q31(c % 3u);
+        hist[(pos + i) % len] = SrcQ31[i];
+      }
+      arm_sdft_q31(&D, SrcQ31, DstQ31, blk);
+      pos += blk;
+      for (k = 0u; k < numBins; k++)
+      {
+        sdft_ref_q31(hist, pos, len, index[k], &re, &im);
+        e = fabs(DstQ31[2u * k] - re) + fabs(DstQ31[2u * k + 1u] - im);
+        errD = (e > errD) ? e : errD;
+        badD += (e > 256.0);
+      }
+    }
+  }
+
+  /* Sliding DFT over 2^20 samples, where the rounding errors of the resonators accumulate */
+  len = 256u;
+  for (k = 0u; k < MAX_BINS; k++)
+  {
+    index[k] = (uint16_t) (k * 4u + rnd() % 4u);
+  }
+  arm_sdft_init_q31(&D, MAX_BINS, len, index, coef, stateD);
+  for (pos = 0u; pos < (1u << 20); pos += MAX_BLOCK)
+  {
+    for (i = 0u; i < MAX_BLOCK; i++)
+    {
+      SrcQ31[i] = rnd_q31(0u);
+      hist[(pos + i) % len] = SrcQ31[i];
+    }
+    arm_sdft_q31(&D, SrcQ31, DstQ31, MAX_BLOCK);
+  }
+  for (k = 0u; k < MAX_BINS; k++)
+  {
+    sdft_ref_q31(hist, pos, len, index[k], &re, &im);
+    e = fabs(DstQ31[2u * k] - re) + fabs(DstQ31[2u * k + 1u] - im);
+    errL = (e > errL) ? e : errL;
+    badL += (e > 2048.0);
+  }
+
+  printf("%-30s max error %.3g LSB\n", "arm_goertzel_q31", errG);
+  report("arm_goertzel_q31", NumCases, badG, "within bound");
+  printf("%-30s max error %.3g LSB, %.3g LSB after 2^20 samples\n", "arm_sdft_q31", errD, errL);
+  report("arm_sdft_q31", 3u * NumCases + 1u, badD + badL, "within bound");
+}
+
+
+/* Power of the bins 0 to N/2 of a windowed frame in double precision, or its energy in the triangular bands */
+static void stft_ref(const float64_t * pFrame, uint32_t N, uint32_t numBands, const uint16_t * pEdges, float64_t * pOut)
+{
+  static float64_t power[MAX_STFT / 2u + 1u];
+  float64_t re, im, acc;
+  uint32_t k, n, i, m;
+
+  for (k = 0u; k <= N / 2u; k++)
+  {
+    re = im = 0.0;
+    for (n = 0u, i = 0u; n < N; n++, i = (i + k) % N)
+    {
+      re += pFrame[n] * cos(6.283185307179586 * i / N);
+      im -= pFrame[n] * sin(6.283185307179586 * i / N);
+    }
+    power[k] = re * re + im * im;
+  }
+  if(numBands == 0u)
+  {
+    memcpy(pOut, power, (N / 2u + 1u) * sizeof(float64_t));
+    return;
+  }
+  for (m = 0u; m < numBands; m++)
+  {
+    acc = 0.0;
+    for (k = pEdges[m]; k < pEdges[m + 2u]; k++)
+    {
+      if(k < pEdges[m + 1u])
+        acc += power[k] * (k - pEdges[m]) / (pEdges[m + 1u] - pEdges[m]);
+      else
+        acc += power[k] * (1.0 - (float64_t) (k - pEdges[m + 1u]) / (pEdges[m + 2u] - pEdges[m + 1u]));
+    }
+    pOut[m] = acc;
+  }
+}
+
+
+/* Checks the STFTs against the power of a double precision DFT of each frame, over blocks of random sizes.
+ * The dB of a second instance are checked against 10 * log10() of the power of the first one. */
+static void test_stft(void)
+{
+  static float32_t winF[MAX_STFT], stateF[2][MAX_STFT], bufF[2][2u * MAX_STFT], wtF[MAX_STFT / 2u + 1u];
+  static float32_t outF[2][3u * MAX_BLOCK * (MAX_STFT / 4u + 1u)];
+  static q15_t winQ15[MAX_STFT], stateQ15[2][MAX_STFT], bufQ15[2][3u * MAX_STFT], wtQ15[MAX_STFT / 2u + 1u];
+  static q15_t outQ15[2][3u * MAX_BLOCK * (MAX_STFT / 2u + 1u)];
+  static float64_t frame[MAX_STFT], ref[MAX_STFT / 2u + 1u];
+  static uint16_t edges[MAX_STFT / 2u + 2u];
+  arm_stft_instance_f32 SF[2];
+  arm_stft_instance_q15 SQ[2];
+  float64_t e, d, energy, errF = 0.0, errQ15 = 0.0, errDbF = 0.0, errDbQ15 = -1.0;
+  uint32_t c, b, i, k, f, n, N, half, hop, numBands, frameSize, pos, blk[3];
+  uint32_t badF = 0u, badQ15 = 0u;
+  int32_t idx, v;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    /* Frame length, hop and bands of the case, the q15 STFT supports 128 and 512 of the lengths below */
+    N = 32u << (rnd() % 5u);
+    N = ((c & 1u) != 0u) ? ((N <= 128u) ? 128u : 512u) : ((N <= 256u) ? N : 256u);
+    half = N / 2u;
+    hop = 1u + rnd() % N;
+    numBands = ((rnd() & 1u) != 0u) ? 1u + rnd() % (half / 4u) : 0u;
+    frameSize = (numBands != 0u) ? numBands : half + 1u;
+    edges[0] = 0u;
+    for (k = 1u; k < numBands + 2u; k++)
+    {
+      edges[k] = (uint16_t) (edges[k - 1u] + 1u + rnd() % (half / (numBands + 2u)));
+    }
+    for (n = 0u; n < N; n++)
+    {
+      winF[n] = (float32_t) (0.5 - 0.5 * cos(6.283185307179586 * n / N));
+      winQ15[n] = (q15_t) __SSAT((q31_t) floor(winF[n] * 32768.0 + 0.5), 16);
+    }
+
+    /* A stream of three blocks */
+    for (b = 0u, n = 0u; b < 3u; b++)
+    {
+      blk[b] = 1u + rnd() % MAX_BLOCK;
+      for (i = 0u; i < blk[b]; i++, n++)
+      {
+        SrcQ15[n] = rnd_q15(c % 3u);
+        SrcF[n] = SrcQ15[n] / 32768.0f;
+      }
+    }
+
+    if((c & 1u) == 0u)
+    {
+      /* Floating-point: error relative to the energy of the frame, the sum of the powers of all the N bins */
+      if((arm_stft_init_f32(&SF[0], (uint16_t) N, (uint16_t) hop, winF, (uint16_t) numBands, edges, wtF, 0u, stateF[0], bufF[0]) != ARM_MATH_SUCCESS) ||
+         (arm_stft_init_f32(&SF[1], (uint16_t) N, (uint16_t) hop, winF, (uint16_t) numBands, edges, wtF, 1u, stateF[1], bufF[1]) != ARM_MATH_SUCCESS))
+      {
+        badF++;
+        continue;
+      }
+      for (b = 0u, pos = 0u, f = 0u; b < 3u; b++)
+      {
+        n = arm_stft_f32(&SF[0], SrcF + pos, outF[0] + f * frameSize, blk[b]);
+        badF += (arm_stft_f32(&SF[1], SrcF + pos, outF[1] + f * frameSize, blk[b]) != n);
+        badF += (n != (pos + blk[b]) / hop - pos / hop) || (SF[0].count != (pos + blk[b]) % hop);
+        pos += blk[b];
+        f += n;
+      }
+      for (f = 0u; f < pos / hop; f++)
+      {
+        for (n = 0u; n < N; n++)
+        {
+          idx = (int32_t) ((f + 1u) * hop + n) - (int32_t) N;
+          frame[n] = (idx >= 0) ? (float64_t) SrcF[idx] * winF[n] : 0.0;
+        }
+        stft_ref(frame, N, numBands, edges, ref);
+        for (n = 0u, energy = FLT_MIN; n < N; n++)
+        {
+          energy += frame[n] * frame[n] * N;
+        }
+        for (k = 0u; k < frameSize; k++)
+        {
+          e = fabs(outF[0][f * frameSize + k] - ref[k]) / energy;
+          errF = (e > errF) ? e : errF;
+          badF += (e > 5.0e-7);
+          e = fabs(outF[1][f * frameSize + k] - 10.0 * log10(fmax(outF[0][f * frameSize + k], 1.0e-20)));
+          errDbF = (e > errDbF) ? e : errDbF;
+          badF += (e > 1.0e-4);
+        }
+      }
+    }
+    else
+    {
+      /* Q15: the DFT scaled down by N/2, powers in 3.13 format, error in LSB */
+      if((arm_stft_init_q15(&SQ[0], (uint16_t) N, (uint16_t) hop, winQ15, (uint16_t) numBands, edges, wtQ15, 0u, stateQ15[0], bufQ15[0]) != ARM_MATH_SUCCESS) ||
+         (arm_stft_init_q15(&SQ[1], (uint16_t) N, (uint16_t) hop, winQ15, (uint16_t) numBands, edges, wtQ15, 1u, stateQ15[1], bufQ15[1]) != ARM_MATH_SUCCESS))
+      {
+        badQ15++;
+        continue;
+      }
+      for (b = 0u, pos = 0u, f = 0u; b < 3u; b++)
+      {
+        n = arm_stft_q15(&SQ[0], SrcQ15 + pos, outQ15[0] + f * frameSize, blk[b]);
+        badQ15 += (arm_stft_q15(&SQ[1], SrcQ15 + pos, outQ15[1] + f * frameSize, blk[b]) != n);
+        badQ15 += (n != (pos + blk[b]) / hop - pos / hop) || (SQ[0].count != (pos + blk[b]) % hop);
+        pos += blk[b];
+        f += n;
+      }
+      for (f = 0u; f < pos / hop; f++)
+      {
+        for (n = 0u; n < N; n++)
+        {
+          /* Windowed as by arm_mult_q15() */
+          idx = (int32_t) ((f + 1u) * hop + n) - (int32_t) N;
+          frame[n] = (idx >= 0) ? (float64_t) (((q31_t) SrcQ15[idx] * winQ15[n]) >> 15) / (16384.0 * N) : 0.0;
+        }
+        stft_ref(frame, N, numBands, edges, ref);
+        for (k = 0u; k < frameSize; k++)
+        {
+          e = fabs(outQ15[0][f * frameSize + k] - ref[k] * 8192.0);
+          errQ15 = (e > errQ15) ? e : errQ15;
+          badQ15 += (e > 8.0);
+
+          /* The power before its truncation to 3.13 format is between v and v + 1, the dB are rounded to 1/128 dB */
+          v = outQ15[0][f * frameSize + k];
+          if((v > 0) && (v < 32767))
+          {
+            d = outQ15[1][f * frameSize + k] / 128.0;
+            e = fmax(10.0 * log10(v / 8192.0) - d, d - 10.0 * log10((v + 1) / 8192.0));
+            errDbQ15 = (e > errDbQ15) ? e : errDbQ15;
+            badQ15 += (e > 1.0 / 256.0 + 4.0e-4);
+          }
+        }
+      }
+    }
+  }
+
+  printf("%-30s max error %.3g of the frame energy, %.3g dB\n", "arm_stft_f32", errF, errDbF);
+  report("arm_stft_f32", NumCases / 2u, badF, "within bound");
+  printf("%-30s max error %.3g LSB, %.3g dB out of the 3.13 truncation\n", "arm_stft_q15", errQ15, errDbQ15);
+  report("arm_stft_q15", NumCases - NumCases / 2u, badQ15, "within bound");
+}
+
+
+static void test_mat_mult(void)
+{
+  static float64_t srcA[MAX_LEN], srcB[MAX_LEN], dst[MAX_LEN], ref[MAX_LEN];
+  arm_matrix_instance_f32 A, B, C, R;
+  arm_matrix_instance_f64 Ad, Bd, Cd, Rd;
+  uint32_t c, i, m, k, p, bad32 = 0u, bad64 = 0u;
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    k = 1u + rnd() % MAX_MAT_K;
+    m = 1u + rnd() % ((MAX_LEN / k < MAX_MAT_DIM) ? MAX_LEN / k : MAX_MAT_DIM);
+    p = 1u + rnd() % ((MAX_LEN / k < MAX_MAT_DIM) ? MAX_LEN / k : MAX_MAT_DIM);
+    for (i = 0u; i < m * k; i++)
+    {
+      SrcF[i] = rnd_f32();
+      srcA[i] = SrcF[i];
+    }
+    for (i = 0u; i < k * p; i++)
+    {
+      CoefF[i] = rnd_f32();
+      srcB[i] = (float64_t) CoefF[i] * rnd_f32();
+    }
+
+    arm_mat_init_f32(&A, (uint16_t) m, (uint16_t) k, SrcF);
+    arm_mat_init_f32(&B, (uint16_t) k, (uint16_t) p, CoefF);
+    arm_mat_init_f32(&C, (uint16_t) m, (uint16_t) p, DstF);
+    arm_mat_init_f32(&R, (uint16_t) m, (uint16_t) p, RefF);
+    arm_mat_mult_f32(&A, &B, &C);
+    ref_arm_mat_mult_f32(&A, &B, &R);
+    bad32 += (memcmp(DstF, RefF, m * p * sizeof(float32_t)) != 0);
+
+    arm_mat_init_f64(&Ad, (uint16_t) m, (uint16_t) k, srcA);
+    arm_mat_init_f64(&Bd, (uint16_t) k, (uint16_t) p, srcB);
+    arm_mat_init_f64(&Cd, (uint16_t) m, (uint16_t) p, dst);
+    arm_mat_init_f64(&Rd, (uint16_t) m, (uint16_t) p, ref);
+    arm_mat_mult_f64(&Ad, &Bd, &Cd);
+    ref_arm_mat_mult_f64(&Ad, &Bd, &Rd);
+    bad64 += (memcmp(dst, ref, m * p * sizeof(float64_t)) != 0);
+  }
+
+  report("arm_mat_mult_f32", NumCases, bad32, "bit-exact");
+  report("arm_mat_mult_f64", NumCases, bad64, "bit-exact");
+}
+
+
+/* Runs a factorization or a solve in single (f64 = 0) or double precision, on matrices stored in double precision */
+enum { SOLVE_CHOL, SOLVE_CHOL_SOLVE, SOLVE_LDLT, SOLVE_LU, SOLVE_LU_SOLVE, SOLVE_LOWER, SOLVE_UPPER };
+
+static arm_status mat_solve_op(uint32_t op, uint32_t f64, float64_t * pA, float64_t * pB, float64_t * pX, float64_t * pD, uint16_t * pp, uint32_t n, uint32_t m)
+{
+  static float32_t a[MAX_SOLVE * MAX_SOLVE], b[MAX_SOLVE * MAX_SOLVE], x[MAX_SOLVE * MAX_SOLVE], d[MAX_SOLVE * MAX_SOLVE];
+  arm_matrix_instance_f32 A, B, X, D;
+  arm_matrix_instance_f64 Ad, Bd, Xd, Dd;
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i, xCols = (op == SOLVE_CHOL || op == SOLVE_LDLT || op == SOLVE_LU) ? n : m;
+
+  if(f64)
+  {
+    arm_mat_init_f64(&Ad, (uint16_t) n, (uint16_t) n, pA);
+    arm_mat_init_f64(&Bd, (uint16_t) n, (uint16_t) m, pB);
+    arm_mat_init_f64(&Xd, (uint16_t) n, (uint16_t) xCols, pX);
+    arm_mat_init_f64(&Dd, (uint16_t) n, (uint16_t) n, pD);
+    switch (op)
+    {
+    case SOLVE_CHOL:
+      return arm_mat_cholesky_f64(&Ad, &Xd);
+    case SOLVE_CHOL_SOLVE:
+      return arm_mat_cholesky_solve_f64(&Ad, &Bd, &Xd);
+    case SOLVE_LDLT:
+      return arm_mat_ldlt_f64(&Ad, &Xd, &Dd, pp);
+    case SOLVE_LU:
+      return arm_mat_lu_f64(&Ad, &Xd, pp);
+    case SOLVE_LU_SOLVE:
+      return arm_mat_lu_solve_f64(&Ad, pp, &Bd, &Xd);
+    case SOLVE_LOWER:
+      return arm_mat_solve_lower_triangular_f64(&Ad, &Bd, &Xd);
+    default:
+      return arm_mat_solve_upper_triangular_f64(&Ad, &Bd, &Xd);
+    }
+  }
+
+  for (i = 0u; i < n * n; i++)
+  {
+    a[i] = (float32_t) pA[i];
+  }
+  for (i = 0u; i < n * m; i++)
+  {
+    b[i] = (float32_t) pB[i];
+  }
+  arm_mat_init_f32(&A, (uint16_t) n, (uint16_t) n, a);
+  arm_mat_init_f32(&B, (uint16_t) n, (uint16_t) m, b);
+  arm_mat_init_f32(&X, (uint16_t) n, (uint16_t) xCols, x);
+  arm_mat_init_f32(&D, (uint16_t) n, (uint16_t) n, d);
+  switch (op)
+  {
+  case SOLVE_CHOL:
+    status = arm_mat_cholesky_f32(&A, &X);
+    break;
+  case SOLVE_CHOL_SOLVE:
+    status = arm_mat_cholesky_solve_f32(&A, &B, &X);
+    break;
+  case SOLVE_LDLT:
+    status = arm_mat_ldlt_f32(&A, &X, &D, pp);
+    break;
+  case SOLVE_LU:
+    status = arm_mat_lu_f32(&A, &X, pp);
+    break;
+  case SOLVE_LU_SOLVE:
+    status = arm_mat_lu_solve_f32(&A, pp, &B, &X);
+    break;
+  case SOLVE_LOWER:
+    status = arm_mat_solve_lower_triangular_f32(&A, &B, &X);
+    break;
+  default:
+    status = arm_mat_solve_upper_triangular_f32(&A, &B, &X);
+    break;
+  }
+  for (i = 0u; i < n * xCols; i++)
+  {
+    pX[i] = x[i];
+  }
+  for (i = 0u; i < n * n; i++)
+  {
+    pD[i] = d[i];
+  }
+  return status;
+}
+
+/* Largest magnitude of n values */
+static float64_t max_abs_f64(const float64_t * p, uint32_t n)
+{
+  float64_t m = 0.0;
+
+  while(n-- > 0u)
+  {
+    m = (fabs(*p) > m) ? fabs(*p) : m;
+    p++;
+  }
+  return m;
+}
+
+/* Residual of A * X = B relative to the magnitudes of A, X and B, with A lower (tri = 1), upper (tri = 2) or full (tri = 0) */
+static float64_t mat_resid(const float64_t * pA, const float64_t * pX, const float64_t * pB, uint32_t n, uint32_t m, uint32_t tri)
+{
+  float64_t acc, e = 0.0;
+  uint32_t i, j, k;
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < m; j++)
+    {
+      acc = -pB[i * m + j];
+      for (k = (tri == 2u) ? i : 0u; k < ((tri == 1u) ? i + 1u : n); k++)
+      {
+        acc += pA[i * n + k] * pX[k * m + j];
+      }
+      e = (fabs(acc) > e) ? fabs(acc) : e;
+    }
+  }
+  return e / (n * max_abs_f64(pA, n * n) * max_abs_f64(pX, n * m) + max_abs_f64(pB, n * m));
+}
+
+
+/* Checks the factorizations against the products of their factors, and the solves by their residuals */
+static void test_mat_solve(void)
+{
+  static float64_t M[MAX_SOLVE * MAX_SOLVE], A[MAX_SOLVE * MAX_SOLVE], L[MAX_SOLVE * MAX_SOLVE], D[MAX_SOLVE * MAX_SOLVE];
+  static float64_t B[MAX_SOLVE * MAX_SOLVE], X[MAX_SOLVE * MAX_SOLVE];
+  static const char *names[2][7] = {
+    { "arm_mat_cholesky_f32", "arm_mat_cholesky_solve_f32", "arm_mat_ldlt_f32", "arm_mat_lu_f32",
+      "arm_mat_lu_solve_f32", "arm_mat_solve_lower_triangular_f32", "arm_mat_solve_upper_triangular_f32" },
+    { "arm_mat_cholesky_f64", "arm_mat_cholesky_solve_f64", "arm_mat_ldlt_f64", "arm_mat_lu_f64",
+      "arm_mat_lu_solve_f64", "arm_mat_solve_lower_triangular_f64", "arm_mat_solve_upper_triangular_f64" }
+  };
+  uint16_t pp[MAX_SOLVE];
+  float64_t acc, e, tol, err[2][7] = { { 0.0 } };
+  uint32_t c, f64, i, j, k, n, m, r, bad[2][7] = { { 0u } };
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    f64 = c & 1u;
+    tol = f64 ? 1.0e-15 : 1.0e-6;
+    n = 1u + rnd() % MAX_SOLVE;
+    m = 1u + rnd() % 4u;
+    for (i = 0u; i < n * n; i++)
+    {
+      M[i] = rnd_f32();
+    }
+    for (i = 0u; i < n * m; i++)
+    {
+      B[i] = rnd_f32();
+    }
+
+    /* Cholesky of the symmetric positive definite A = M * M' / n + I */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        for (k = 0u, acc = 0.0; k < n; k++)
+        {
+          acc += M[i * n + k] * M[j * n + k];
+        }
+        A[i * n + j] = acc / n + (i == j);
+      }
+    }
+    bad[f64][0] += (mat_solve_op(SOLVE_CHOL, f64, A, B, L, D, pp, n, m) != ARM_MATH_SUCCESS);
+    for (i = 0u, e = 0.0; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        for (k = 0u, acc = -A[i * n + j]; k < n; k++)
+        {
+          acc += L[i * n + k] * L[j * n + k];
+        }
+        e = (fabs(acc) > e) ? fabs(acc) : e;
+        bad[f64][0] += (j > i) && (L[i * n + j] != 0.0);
+      }
+    }
+    e /= n * max_abs_f64(A, n * n);
+    err[f64][0] = (e > err[f64][0]) ? e : err[f64][0];
+    bad[f64][0] += (e > tol);
+
+    bad[f64][1] += (mat_solve_op(SOLVE_CHOL_SOLVE, f64, L, B, X, D, pp, n, m) != ARM_MATH_SUCCESS);
+    e = mat_resid(A, X, B, n, m, 0u);
+    err[f64][1] = (e > err[f64][1]) ? e : err[f64][1];
+    bad[f64][1] += (e > tol);
+
+    /* LDLT of the semidefinite A = V * V' of rank r, with V the first r columns of M */
+    r = rnd() % (n + 1u);
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        for (k = 0u, acc = 0.0; k < r; k++)
+        {
+          acc += M[i * n + k] * M[j * n + k];
+        }
+        A[i * n + j] = acc;
+      }
+    }
+    bad[f64][2] += (mat_solve_op(SOLVE_LDLT, f64, A, B, L, D, pp, n, m) != ARM_MATH_SUCCESS);
+    for (i = 0u, e = 0.0; i < n; i++)
+    {
+      /* Zeros at the end of D */
+      bad[f64][2] += (i >= r) && (D[i * n + i] != 0.0);
+      for (j = 0u; j < n; j++)
+      {
+        for (k = 0u, acc = -A[pp[i] * n + pp[j]]; k < n; k++)
+        {
+          acc += L[i * n + k] * D[k * n + k] * L[j * n + k];
+        }
+        e = (fabs(acc) > e) ? fabs(acc) : e;
+      }
+    }
+    e /= n * max_abs_f64(A, n * n) + DBL_MIN;
+    err[f64][2] = (e > err[f64][2]) ? e : err[f64][2];
+    bad[f64][2] += (e > tol);
+
+    /* Neither factorization of the indefinite [0 S; S' 0] */
+    if(n >= 2u)
+    {
+      for (i = 0u; i < n * n; i++)
+      {
+        A[i] = 0.0;
+      }
+      for (i = 0u; i < n / 2u; i++)
+      {
+        for (j = n / 2u; j < n; j++)
+        {
+          A[i * n + j] = A[j * n + i] = M[i * n + j];
+        }
+      }
+      bad[f64][0] += (mat_solve_op(SOLVE_CHOL, f64, A, B, L, D, pp, n, m) != ARM_MATH_DECOMPOSITION_FAILURE);
+      bad[f64][2] += (mat_solve_op(SOLVE_LDLT, f64, A, B, L, D, pp, n, m) != ARM_MATH_DECOMPOSITION_FAILURE);
+    }
+
+    /* LU of the general M, and the solve */
+    bad[f64][3] += (mat_solve_op(SOLVE_LU, f64, M, B, L, D, pp, n, m) != ARM_MATH_SUCCESS);
+    for (i = 0u, e = 0.0; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        acc = -M[pp[i] * n + j] + ((j >= i) ? L[i * n + j] : 0.0);
+        for (k = 0u; k < i && k <= j; k++)
+        {
+          acc += L[i * n + k] * L[k * n + j];
+        }
+        e = (fabs(acc) > e) ? fabs(acc) : e;
+      }
+    }
+    e /= n * max_abs_f64(M, n * n);
+    err[f64][3] = (e > err[f64][3]) ? e : err[f64][3];
+    bad[f64][3] += (e > tol);
+
+    bad[f64][4] += (mat_solve_op(SOLVE_LU_SOLVE, f64, L, B, X, D, pp, n, m) != ARM_MATH_SUCCESS);
+    e = mat_resid(M, X, B, n, m, 0u);
+    err[f64][4] = (e > err[f64][4]) ? e : err[f64][4];
+    bad[f64][4] += (e > tol);
+
+    /* Triangular solves with the triangles of M and a dominant diagonal, the other triangle is not read */
+    for (i = 0u; i < n; i++)
+    {
+      M[i * n + i] = (M[i * n + i] < 0.0) ? M[i * n + i] - 1.0 : M[i * n + i] + 1.0;
+    }
+    memcpy(A, M, n * n * sizeof(float64_t));
+    for (i = 0u; i < n; i++)
+    {
+      for (j = i + 1u; j < n; j++)
+      {
+        A[i * n + j] = 1.0e30;
+      }
+    }
+    bad[f64][5] += (mat_solve_op(SOLVE_LOWER, f64, A, B, X, D, pp, n, m) != ARM_MATH_SUCCESS);
+    e = mat_resid(M, X, B, n, m, 1u);
+    err[f64][5] = (e > err[f64][5]) ? e : err[f64][5];
+    bad[f64][5] += (e > tol);
+
+    memcpy(A, M, n * n * sizeof(float64_t));
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < i; j++)
+      {
+        A[i * n + j] = 1.0e30;
+      }
+    }
+    bad[f64][6] += (mat_solve_op(SOLVE_UPPER, f64, A, B, X, D, pp, n, m) != ARM_MATH_SUCCESS);
+    e = mat_resid(M, X, B, n, m, 2u);
+    err[f64][6] = (e > err[f64][6]) ? e : err[f64][6];
+    bad[f64][6] += (e > tol);
+  }
+
+  for (f64 = 0u; f64 < 2u; f64++)
+  {
+    for (k = 0u; k < 7u; k++)
+    {
+      printf("%-30s max residual %.3g\n", names[f64][k], err[f64][k]);
+      report(names[f64][k], (NumCases + 1u - f64) / 2u, bad[f64][k], "within bound");
+    }
+  }
+}
+
+
+/* Random bit patterns (any magnitude, subnormals, infinities and NaN), special values and values in [-100, 100] */
+static float32_t rnd_bits_f32(void)
+{
+  static const float32_t special[8] = { 0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1.0f, -1.0f, 1.0e-40f };
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } v;
+
+  switch (rnd() % 3u)
+  {
+  case 0:
+    v.u = rnd();
+    return v.f;
+  case 1:
+    return special[rnd() % 8u];
+  default:
+    return rnd_f32() * 100.0f;
+  }
+}
+
+static void test_fast_math(void)
+{
+  uint32_t c, i, n, bad[6] = { 0u, 0u, 0u, 0u, 0u, 0u };
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    n = rnd() % 300u;
+    for (i = 0u; i < n; i++)
+    {
+      SrcF[i] = rnd_bits_f32();
+      CoefF[i] = rnd_bits_f32();
+    }
+
+    arm_vexp_f32(SrcF, DstF, n);
+    ref_arm_vexp_f32(SrcF, RefF, n);
+    bad[0] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+
+    arm_vlog_f32(SrcF, DstF, n);
+    ref_arm_vlog_f32(SrcF, RefF, n);
+    bad[1] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+
+    arm_vlog10_f32(SrcF, DstF, n);
+    ref_arm_vlog10_f32(SrcF, RefF, n);
+    bad[2] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+
+    arm_vatan2_f32(SrcF, CoefF, DstF, n);
+    ref_arm_vatan2_f32(SrcF, CoefF, RefF, n);
+    bad[3] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+
+    arm_vtanh_f32(SrcF, DstF, n);
+    ref_arm_vtanh_f32(SrcF, RefF, n);
+    bad[4] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+
+    arm_vsqrt_f32(SrcF, DstF, n);
+    ref_arm_vsqrt_f32(SrcF, RefF, n);
+    bad[5] += (memcmp(DstF, RefF, n * sizeof(float32_t)) != 0);
+  }
+
+  report("arm_vexp_f32", NumCases, bad[0], "bit-exact");
+  report("arm_vlog_f32", NumCases, bad[1], "bit-exact");
+  report("arm_vlog10_f32", NumCases, bad[2], "bit-exact");
+  report("arm_vatan2_f32", NumCases, bad[3], "bit-exact");
+  report("arm_vtanh_f32", NumCases, bad[4], "bit-exact");
+  report("arm_vsqrt_f32", NumCases, bad[5], "bit-exact");
+}
+
+
+/* Error of y in ULP of the single-precision result, against the double-precision value r */
+static double ulp_error(float32_t y, double r)
+{
+  int e;
+
+  if(isnan(y) || isnan(r))
+    return (isnan(y) && isnan(r)) ? 0.0 : INFINITY;
+  if(isinf(y) || isinf(r))
+    return (y == (float32_t) r) ? 0.0 : INFINITY;
+
+  /* The ULP of r is 2^(e - 24), and 2^-149 for the subnormals */
+  frexp(r, &e);
+  if(r == 0.0 || e < -125)
+    e = -125;
+  return fabs(y - r) / ldexp(1.0, e - 24);
+}
+
+/* Error of the fast math functions against libm in double precision, with the documented bounds */
+static void test_fast_math_libm(void)
+{
+  static const char *names[5] = { "arm_vexp_f32", "arm_vlog_f32", "arm_vlog10_f32", "arm_vatan2_f32",
+                                  "arm_vtanh_f32" };
+  static const double bound[5] = { 1.0, 1.0, 2.0, 3.0, 2.0 };
+  uint32_t c, i, k, n, bad[7] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u };
+  double e, err[7] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    /* Half of the inputs in [-8, 8], where the results are neither saturated nor trivial */
+    n = rnd() % 300u;
+    for (i = 0u; i < n; i++)
+    {
+      SrcF[i] = (i & 1u) ? rnd_bits_f32() : rnd_f32() * 8.0f;
+      CoefF[i] = (i & 2u) ? rnd_bits_f32() : rnd_f32() * 8.0f;
+    }
+
+    for (k = 0u; k < 5u; k++)
+    {
+      switch (k)
+      {
+      case 0:
+        arm_vexp_f32(SrcF, DstF, n);
+        break;
+      case 1:
+        arm_vlog_f32(SrcF, DstF, n);
+        break;
+      case 2:
+        arm_vlog10_f32(SrcF, DstF, n);
+        break;
+      case 3:
+        arm_vatan2_f32(SrcF, CoefF, DstF, n);
+        break;
+      default:
+        arm_vtanh_f32(SrcF, DstF, n);
+        break;
+      }
+
+      for (i = 0u; i < n; i++)
+      {
+        switch (k)
+        {
+        case 0:
+          e = ulp_error(DstF[i], exp((double) SrcF[i]));
+          break;
+        case 1:
+          e = ulp_error(DstF[i], log((double) SrcF[i]));
+          break;
+        case 2:
+          e = ulp_error(DstF[i], log10((double) SrcF[i]));
+          break;
+        case 3:
+          e = ulp_error(DstF[i], atan2((double) SrcF[i], (double) CoefF[i]));
+          break;
+        default:
+          e = ulp_error(DstF[i], tanh((double) SrcF[i]));
+          break;
+        }
+        err[k] = (e > err[k]) ? e : err[k];
+        bad[k] += (e > bound[k]);
+      }
+    }
+
+    /* Q31 logarithm in 5.26 format, of inputs of any magnitude */
+    n = rnd() % 300u;
+    for (i = 0u; i < n; i++)
+      SrcQ31[i] = (q31_t) (rnd() >> (rnd() % 32u));
+    arm_vlog_q31(SrcQ31, DstQ31, n);
+    for (i = 0u; i < n; i++)
+    {
+      if(SrcQ31[i] > 0)
+        e = fabs(DstQ31[i] - log(SrcQ31[i] / 2147483648.0) * 67108864.0);
+      else
+        e = (DstQ31[i] == (q31_t) 0x80000000) ? 0.0 : INFINITY;
+      err[5] = (e > err[5]) ? e : err[5];
+      bad[5] += (e > 0.6);
+    }
+  }
+
+  /* Q15 logarithm in 4.11 format, of all the inputs */
+  for (i = 0u; i < 65536u; i += MAX_LEN)
+  {
+    for (k = 0u; k < MAX_LEN; k++)
+      SrcQ15[k] = (q15_t) (i + k - 32768u);
+    arm_vlog_q15(SrcQ15, DstQ15, MAX_LEN);
+    for (k = 0u; k < MAX_LEN; k++)
+    {
+      if(SrcQ15[k] > 0)
+        e = fabs(DstQ15[k] - log(SrcQ15[k] / 32768.0) * 2048.0);
+      else
+        e = (DstQ15[k] == (q15_t) 0x8000) ? 0.0 : INFINITY;
+      err[6] = (e > err[6]) ? e : err[6];
+      bad[6] += (e > 0.52);
+    }
+  }
+
+  for (k = 0u; k < 5u; k++)
+  {
+    printf("%-30s max error %.3g ULP of libm\n", names[k], err[k]);
+    report(names[k], NumCases, bad[k], "within bound");
+  }
+  printf("%-30s max error %.3g LSB\n", "arm_vlog_q31", err[5]);
+  report("arm_vlog_q31", NumCases, bad[5], "within bound");
+  printf("%-30s max error %.3g LSB\n", "arm_vlog_q15", err[6]);
+  report("arm_vlog_q15", 65536u, bad[6], "within bound");
+}
+
+
+/* Mean, variance, standard deviation and RMS of n values in double precision, and the first indices of the minimum and maximum */
+static void stats_f64(const float64_t * x, uint32_t n, float64_t * r, uint32_t * idx)
+{
+  float64_t sum = 0.0, sq = 0.0;
+  uint32_t i;
+
+  idx[0] = idx[1] = 0u;
+  for (i = 0u; i < n; i++)
+  {
+    sum += x[i];
+    sq += x[i] * x[i];
+    idx[0] = (x[i] < x[idx[0]]) ? i : idx[0];
+    idx[1] = (x[i] > x[idx[1]]) ? i : idx[1];
+  }
+  r[0] = sum / n;
+  for (i = 0u, sum = 0.0; i < n; i++)
+  {
+    sum += (x[i] - r[0]) * (x[i] - r[0]);
+  }
+  r[1] = (n > 1u) ? sum / (n - 1u) : 0.0;
+  r[2] = sqrt(r[1]);
+  r[3] = sqrt(sq / n);
+}
+
+
+/* Largest error in LSB of the mean, variance, standard deviation and RMS of a fixed-point result,
+ * whose variance and mean of the squares saturate below 1. The standard deviation and RMS are
+ * square roots of values rounded to an LSB, so near zero their squares are compared instead. */
+static float64_t stats_err(const float64_t * got, const float64_t * r, float64_t lsb)
+{
+  float64_t e, ref, err = fabs(got[0] - r[0]) / lsb;
+  uint32_t k;
+
+  for (k = 1u; k < 4u; k++)
+  {
+    ref = (r[k] < 1.0 - lsb) ? r[k] : 1.0 - lsb;
+    e = fabs(got[k] - ref) / lsb;
+    e = (k == 1u) ? e : fmin(e, fabs(got[k] * got[k] - ref * ref) / lsb);
+    err = (e > err) ? e : err;
+  }
+  return (err);
+}
+
+
+/* Checks the one-pass statistics against the C code, and against a double reference:
+ * the extrema and their indices exactly, the other results within a bound */
+static void test_stats(void)
+{
+  static float64_t x[MAX_LEN];
+  float64_t r[4], got[4], e, errF = 0.0, err[3] = { 0.0, 0.0, 0.0 };
+  uint32_t c, i, n, mode, idx[2], bad[4] = { 0u, 0u, 0u, 0u }, badRef[4] = { 0u, 0u, 0u, 0u };
+  float32_t offset;
+  arm_stats_result_f32 f0, f1;
+  arm_stats_result_q31 r0, r1;
+  arm_stats_result_q15 s0, s1;
+  arm_stats_result_q7 b0, b1;
+
+  /* The results are zeroed first, as the memcmp takes in the padding of the Q7 ones */
+  memset(&b0, 0, sizeof(b0));
+  memset(&b1, 0, sizeof(b1));
+
+  for (c = 0u; c < NumCases; c++)
+  {
+    /* Full scale values give many ties of the extrema, and the offset a large mean */
+    n = 1u + rnd() % 300u;
+    mode = c % 3u;
+    offset = (mode == 2u) ? 1000.0f : 0.0f;
+    for (i = 0u; i < n; i++)
+    {
+      SrcQ31[i] = rnd_q31(mode);
+      SrcQ15[i] = rnd_q15(mode);
+      SrcQ7[i] = (q7_t) (rnd_q31(mode) >> 24);
+      SrcF[i] = (mode == 1u) ? (float32_t) (SrcQ7[i] >> 7) : rnd_f32() + offset;
+    }
+
+    arm_stats_f32(SrcF, n, &f0);
+    ref_arm_stats_f32(SrcF, n, &f1);
+    bad[0] += (memcmp(&f0, &f1, sizeof(f0)) != 0);
+
+    arm_stats_q31(SrcQ31, n, &r0);
+    ref_arm_stats_q31(SrcQ31, n, &r1);
+    bad[1] += (memcmp(&r0, &r1, sizeof(r0)) != 0);
+
+    arm_stats_q15(SrcQ15, n, &s0);
+    ref_arm_stats_q15(SrcQ15, n, &s1);
+    bad[2] += (memcmp(&s0, &s1, sizeof(s0)) != 0);
+
+    arm_stats_q7(SrcQ7, n, &b0);
+    ref_arm_stats_q7(SrcQ7, n, &b1);
+    bad[3] += (memcmp(&b0, &b1, sizeof(b0)) != 0);
+
+    /* Floating-point: mean and RMS relative to the RMS, variance and standard deviation to themselves */
+    for (i = 0u; i < n; i++)
+    {
+      x[i] = SrcF[i];
+    }
+    stats_f64(x, n, r, idx);
+    e = fabs(f0.mean - r[0]) / (r[3] + DBL_MIN);
+    e = fmax(e, fabs(f0.rms - r[3]) / (r[3] + DBL_MIN));
+    e = fmax(e, fabs(f0.var - r[1]) / (r[1] + DBL_MIN));
+    e = fmax(e, fabs(f0.std - r[2]) / (r[2] + DBL_MIN));
+    errF = fmax(errF, e);
+    badRef[0] += (e > 4.0e-6) || (f0.minIndex != idx[0]) || (f0.maxIndex != idx[1]) ||
+                 (f0.min != SrcF[idx[0]]) || (f0.max != SrcF[idx[1]]);
+
+    for (i = 0u; i < n; i++)
+    {
+      x[i] = SrcQ31[i] / 2147483648.0;
+    }
+    stats_f64(x, n, r, idx);
+    got[0] = r0.mean / 2147483648.0;
+    got[1] = r0.var / 2147483648.0;
+    got[2] = r0.std / 2147483648.0;
+    got[3] = r0.rms / 2147483648.0;
+    /* arm_sqrt_q31() is up to about 8 LSB low */
+    e = stats_err(got, r, 1.0 / 2147483648.0);
+    err[0] = fmax(err[0], e);
+    badRef[1] += (e > 16.0) || (r0.minIndex != idx[0]) || (r0.maxIndex != idx[1]) ||
+                 (r0.min != SrcQ31[idx[0]]) || (r0.max != SrcQ31[idx[1]]);
+
+    for (i = 0u; i < n; i++)
+    {
+      x[i] = SrcQ15[i] / 32768.0;
+    }
+    stats_f64(x, n, r, idx);
+    got[0] = s0.mean / 32768.0;
+    got[1] = s0.var / 32768.0;
+    got[2] = s0.std / 32768.0;
+    got[3] = s0.rms / 32768.0;
+    e = stats_err(got, r, 1.0 / 32768.0);
+    err[1] = fmax(err[1], e);
+    badRef[2] += (e > 2.0) || (s0.minIndex != idx[0]) || (s0.maxIndex != idx[1]) ||
+                 (s0.min != SrcQ15[idx[0]]) || (s0.max != SrcQ15[idx[1]]);
+
+    for (i = 0u; i < n; i++)
+    {
+      x[i] = SrcQ7[i] / 128.0;
+    }
+    stats_f64(x, n, r, idx);
+    got[0] = b0.mean / 128.0;
+    got[1] = b0.var / 128.0;
+    got[2] = b0.std / 128.0;
+    got[3] = b0.rms / 128.0;
+    e = stats_err(got, r, 1.0 / 128.0);
+    err[2] = fmax(err[2], e);
+    badRef[3] += (e > 2.0) || (b0.minIndex != idx[0]) || (b0.maxIndex != idx[1]) ||
+                 (b0.min != SrcQ7[idx[0]]) || (b0.max != SrcQ7[idx[1]]);
+  }
+
+  report("arm_stats_f32", NumCases, bad[0], "bit-exact");
+  report("arm_stats_q31", NumCases, bad[1], "bit-exact");
+  report("arm_stats_q15", NumCases, bad[2], "bit-exact");
+  report("arm_stats_q7", NumCases, bad[3], "bit-exact");
+  printf("%-30s max error %.3g\n", "arm_stats_f32 vs double", errF);
+  report("arm_stats_f32 vs double", NumCases, badRef[0], "within bound");
+  printf("%-30s max error %.3g LSB\n", "arm_stats_q31 vs double", err[0]);
+  report("arm_stats_q31 vs double", NumCases, badRef[1], "within bound");
+  printf("%-30s max error %.3g LSB\n", "arm_stats_q15 vs double", err[1]);
+  report("arm_stats_q15 vs double", NumCases, badRef[2], "within bound");
+  printf("%-30s max error %.3g LSB\n", "arm_stats_q7 vs double", err[2]);
+  report("arm_stats_q7 vs double", NumCases, badRef[3], "within bound");
+}
+
+
+int main(int argc, char *argv[])
+{
+  int i;
+
+  for (i = 1; i + 1 < argc; i += 2)
+  {
+    if(!strcmp(argv[i], "-s"))
+      Seed = (uint32_t) strtoul(argv[i + 1], 0, 0);
+    else if(!strcmp(argv[i], "-n"))
+      NumCases = (uint32_t) strtoul(argv[i + 1], 0, 0);
+    else
+      break;
+  }
+  if(i < argc || Seed == 0u)
+  {
+    printf("usage: arm_host_test [-s seed] [-n cases]\n");
+    return 2;
+  }
+
+#if defined (ARM_MATH_AVX2)
+  printf("CMSIS DSP host build, AVX2 kernels, seed %u\n", (unsigned) Seed);
+#elif defined (ARM_MATH_SSE41)
+  printf("CMSIS DSP host build, SSE4.1 kernels, seed %u\n", (unsigned) Seed);
+#elif defined (ARM_MATH_SSE2)
+  printf("CMSIS DSP host build, SSE2 kernels, seed %u\n", (unsigned) Seed);
+#else
+  printf("CMSIS DSP host build, C code only, seed %u\n", (unsigned) Seed);
+#endif
+
+  test_dot_prod();
+  test_cmplx_mag();
+  test_fir_q15();
+  test_fir_q31();
+  test_fir_f32();
+  test_fir_ols_f32();
+  test_fir_mc();
+  test_biquad_f32();
+  test_biquad_mc();
+  test_fir_resample();
+  test_biquad_df2T();
+  test_cfft_f32();
+  test_cfft_mixed();
+  test_goertzel_sdft_f32();
+  test_goertzel_sdft_q31();
+  test_stft();
+  test_mat_mult();
+  test_mat_solve();
+  test_fast_math();
+  test_fast_math_libm();
+  test_stats();
+
+  printf(Failed ? "FAILED\n" : "PASSED\n");
+  return Failed;
+}
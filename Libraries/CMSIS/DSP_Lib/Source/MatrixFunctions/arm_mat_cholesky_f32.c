@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_cholesky_f32.c    
+*    
+* Description:	Floating-point Cholesky factorization.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixChol Cholesky Factorization    
+ *    
+ * Factors a symmetric positive definite matrix into a lower triangular matrix    
+ * and its transpose, <code>A = L * L<sup>T</sup></code>, and solves linear systems with the factor.    
+ *    
+ * \par    
+ * The factor is computed row by row:    
+ * <pre>    
+ *     L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k = 0..j-1)) / L(j,j)      for j < i    
+ *     L(i,i) = sqrt(A(i,i) - sum(L(i,k)<sup>2</sup>, k = 0..i-1))    
+ * </pre>    
+ * If a value under the square root is not positive, the matrix is not positive definite    
+ * and the functions return <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.    
+ * The upper triangle of the factor is set to zero.    
+ *    
+ * \par    
+ * The solve functions then compute <code>X = A<sup>-1</sup> * B</code> by a forward substitution    
+ * with <code>L</code> and a backward substitution with <code>L<sup>T</sup></code>.    
+ * The factorization takes n<sup>3</sup>/6 multiplications and each column of <code>B</code> 2n<sup>2</sup>,    
+ * against n<sup>3</sup> for arm_mat_inverse_f32() and n<sup>2</sup> per column for the product with the inverse.    
+ * The substitutions are also more accurate than the product with an explicit inverse.    
+ * Covariance matrices, the innovation covariance of Kalman filters and the normal    
+ * equations of least-squares fits are symmetric positive definite.    
+ * For symmetric matrices that may be singular use the \ref MatrixLDLT "LDL<sup>T</sup> factorization",    
+ * and for other square matrices the \ref MatrixLU "LU factorization".    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief  Dot product of two rows.    
+ * @param[in]       *pA  points to the first row    
+ * @param[in]       *pB  points to the second row    
+ * @param[in]       n    number of values    
+ * @return the dot product.    
+ */
+
+static __INLINE float32_t arm_mat_row_dot_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t n)
+{
+  float32_t sum = 0.0f;                              /* Accumulator */
+  uint32_t cnt;                                  /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  cnt = n >> 2u;
+
+  while(cnt > 0u)
+  {
+    sum += pA[0] * pB[0];
+    sum += pA[1] * pB[1];
+    sum += pA[2] * pB[2];
+    sum += pA[3] * pB[3];
+    pA += 4u;
+    pB += 4u;
+
+    /* Decrement the loop counter */
+    cnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  cnt = n % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  cnt = n;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(cnt > 0u)
+  {
+    sum += *pA++ * *pB++;
+
+    /* Decrement the loop counter */
+    cnt--;
+  }
+
+  return (sum);
+}
+
+/**    
+ * @brief Floating-point Cholesky factorization.    
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, the lower triangular factor L    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices    
+ * are not square and of the same size when size checking is enabled,    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix is not positive definite,    
+ * else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * Only the lower triangle of <code>pSrc</code> is read. <code>pDst</code> may be <code>pSrc</code>.    
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                        /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                           /* rows i and j of the factor */
+  float32_t sum;                                      /* Accumulator */
+  uint32_t n = pSrc->numRows;                    /* number of rows and columns */
+  uint32_t i, j;                                 /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0u; i < n; i++)
+    {
+      pRowI = pL + i * n;
+
+      for (j = 0u; j <= i; j++)
+      {
+        pRowJ = pL + j * n;
+
+        /* A(i,j) - sum(L(i,k) * L(j,k)), k < j */
+        sum = pA[i * n + j] - arm_mat_row_dot_f32(pRowI, pRowJ, j);
+
+        if(j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else
+        {
+          /* The matrix is not positive definite (or has a NaN) */
+          if(!(sum > 0.0f))
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          arm_sqrt_f32(sum, &pRowI[i]);
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_cholesky_f64.c    
+*    
+* Description:	Double-precision floating-point Cholesky factorization.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief  Dot product of two rows.    
+ * @param[in]       *pA  points to the first row    
+ * @param[in]       *pB  points to the second row    
+ * @param[in]       n    number of values    
+ * @return the dot product.    
+ */
+
+static __INLINE float64_t arm_mat_row_dot_f64(
+  const float64_t * pA,
+  const float64_t * pB,
+  uint32_t n)
+{
+  float64_t sum = 0.0;                              /* Accumulator */
+  uint32_t cnt;                                  /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  cnt = n >> 2u;
+
+  while(cnt > 0u)
+  {
+    sum += pA[0] * pB[0];
+    sum += pA[1] * pB[1];
+    sum += pA[2] * pB[2];
+    sum += pA[3] * pB[3];
+    pA += 4u;
+    pB += 4u;
+
+    /* Decrement the loop counter */
+    cnt--;
+  }
+
+  /* The remaining 1 to 3 values */
+  cnt = n % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  cnt = n;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(cnt > 0u)
+  {
+    sum += *pA++ * *pB++;
+
+    /* Decrement the loop counter */
+    cnt--;
+  }
+
+  return (sum);
+}
+
+/**    
+ * @brief Double-precision floating-point Cholesky factorization.    
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, the lower triangular factor L    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices    
+ * are not square and of the same size when size checking is enabled,    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix is not positive definite,    
+ * else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * Only the lower triangle of <code>pSrc</code> is read. <code>pDst</code> may be <code>pSrc</code>.    
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pA = pSrc->pData;                  /* input data matrix pointer */
+  float64_t *pL = pDst->pData;                        /* output data matrix pointer */
+  float64_t *pRowI, *pRowJ;                           /* rows i and j of the factor */
+  float64_t sum;                                      /* Accumulator */
+  uint32_t n = pSrc->numRows;                    /* number of rows and columns */
+  uint32_t i, j;                                 /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0u; i < n; i++)
+    {
+      pRowI = pL + i * n;
+
+      for (j = 0u; j <= i; j++)
+      {
+        pRowJ = pL + j * n;
+
+        /* A(i,j) - sum(L(i,k) * L(j,k)), k < j */
+        sum = pA[i * n + j] - arm_mat_row_dot_f64(pRowI, pRowJ, j);
+
+        if(j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else
+        {
+          /* The matrix is not positive definite (or has a NaN) */
+          if(!(sum > 0.0))
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          pRowI[i] = sqrt(sum);
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
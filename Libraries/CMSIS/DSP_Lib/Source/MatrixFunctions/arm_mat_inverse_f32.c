@@ -64,6 +64,11 @@
  * If the input matrix is singular, then the algorithm terminates and returns error status    
  * <code>ARM_MATH_SINGULAR</code>.    
  * \image html MatrixInverse.gif "Matrix Inverse of a 3 x 3 matrix using Gauss-Jordan Method"    
+ *    
+ * \par    
+ * To solve linear systems, the \ref MatrixChol "Cholesky", \ref MatrixLDLT "LDLT" and    
+ * \ref MatrixLU "LU" factorizations with their solve functions are several times faster    
+ * and more accurate than a multiplication with the inverse.    
  */
 
 /**    
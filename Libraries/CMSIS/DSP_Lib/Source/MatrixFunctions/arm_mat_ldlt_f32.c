@@ -0,0 +1,236 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_ldlt_f32.c    
+*    
+* Description:	Floating-point LDLT factorization.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixLDLT LDLT Factorization    
+ *    
+ * Factors a symmetric matrix as <code>P * A * P<sup>T</sup> = L * D * L<sup>T</sup></code>,    
+ * where <code>L</code> is lower triangular with a unit diagonal, <code>D</code> is diagonal    
+ * and <code>P</code> is a permutation.    
+ *    
+ * \par    
+ * Unlike the \ref MatrixChol "Cholesky factorization" there is no square root, and the    
+ * matrix may be positive semidefinite: a singular covariance matrix gives zeros at the end of    
+ * <code>D</code>. At each step the largest remaining diagonal value is pivoted to the front,    
+ * which keeps the factorization stable for semidefinite matrices.    
+ * A pivot within <code>n</code> times the machine epsilon of the largest diagonal value of the    
+ * matrix is a rounding error and is taken as zero, like the rest of the remaining matrix.    
+ * The pivots are 1 x 1 only, so a matrix whose remaining diagonal is zero while its    
+ * off-diagonal values are not (an indefinite matrix such as <code>[0 1; 1 0]</code>)    
+ * cannot be factored and the functions return <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.    
+ * Use the \ref MatrixLU "LU factorization" for such matrices.    
+ *    
+ * \par    
+ * The permutation is returned as a vector <code>pp</code> of <code>n</code> row indices:    
+ * row <code>i</code> of <code>P * A * P<sup>T</sup></code> is row <code>pp[i]</code> of <code>A</code>,    
+ * and <code>(P * A * P<sup>T</sup>)(i,j) = A(pp[i],pp[j])</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixLDLT    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point LDL<sup>T</sup> factorization with symmetric pivoting.    
+ * @param[in]       *pSrc points to the symmetric input matrix structure    
+ * @param[out]      *pl points to the output matrix structure of the unit lower triangular factor L    
+ * @param[out]      *pd points to the output matrix structure of the diagonal factor D    
+ * @param[out]      *pp points to the output permutation vector, of length <code>pSrc->numRows</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices    
+ * are not square and of the same size when size checking is enabled,    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix needs a 2 x 2 pivot,    
+ * else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * The whole of <code>pSrc</code> is read, and it must be symmetric. <code>pl</code> may be <code>pSrc</code>.    
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp)
+{
+  float32_t *pW = pl->pData;                          /* working matrix, then the factor L */
+  float32_t *pD = pd->pData;                          /* output diagonal factor */
+  float32_t *pRowK, *pRowI;                           /* rows k and i of the working matrix */
+  float32_t maxD, d, tmp, tol;                             /* pivot values */
+  uint32_t n = pSrc->numRows;                    /* number of rows and columns */
+  uint32_t i, j, k, p;                           /* loop counters */
+  uint16_t idx;                                  /* permutation index */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) ||
+     (pl->numRows != n) || (pl->numCols != n) || (pd->numRows != n) || (pd->numCols != n))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pW != pSrc->pData)
+    {
+      memcpy(pW, pSrc->pData, n * n * sizeof(float32_t));
+    }
+
+    memset(pD, 0, n * n * sizeof(float32_t));
+
+    for (i = 0u; i < n; i++)
+    {
+      pp[i] = (uint16_t) i;
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      pRowK = pW + k * n;
+
+      /* Largest remaining diagonal value */
+      p = k;
+      maxD = fabsf(pRowK[k]);
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabsf(pW[i * n + i]) > maxD)
+        {
+          maxD = fabsf(pW[i * n + i]);
+          p = i;
+        }
+      }
+
+      /* Exchange the rows and then the columns k and p */
+      if(p != k)
+      {
+        pRowI = pW + p * n;
+
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pRowK[j];
+          pRowK[j] = pRowI[j];
+          pRowI[j] = tmp;
+        }
+
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pW[j * n + k];
+          pW[j * n + k] = pW[j * n + p];
+          pW[j * n + p] = tmp;
+        }
+
+        idx = pp[k];
+        pp[k] = pp[p];
+        pp[p] = idx;
+      }
+
+      /* Pivots below the rounding errors of the largest diagonal value of the matrix are zero */
+      if(k == 0u)
+      {
+        tol = (float32_t) n * 1.1920929e-7f * maxD;
+      }
+
+      d = pRowK[k];
+
+      if(fabsf(d) <= tol)
+      {
+        /* The remaining diagonal is zero, so the remaining matrix must be zero too */
+        for (i = k; i < n; i++)
+        {
+          for (j = k; j < n; j++)
+          {
+            if(fabsf(pW[i * n + j]) > tol)
+            {
+              return (ARM_MATH_DECOMPOSITION_FAILURE);
+            }
+            pW[i * n + j] = 0.0f;
+          }
+        }
+
+        break;
+      }
+
+      pD[k * n + k] = d;
+
+      /* Eliminate the column k from the remaining rows, A(i,j) -= L(i,k) * A(k,j) */
+      for (i = k + 1u; i < n; i++)
+      {
+        pRowI = pW + i * n;
+        tmp = pRowI[k] / d;
+
+        arm_mat_row_msub_f32(pRowI + k + 1u, pRowK + k + 1u, tmp, n - k - 1u);
+
+        pRowI[k] = tmp;
+      }
+    }
+
+    /* Set the unit diagonal and clear the upper triangle of L */
+    for (i = 0u; i < n; i++)
+    {
+      pRowI = pW + i * n;
+      pRowI[i] = 1.0f;
+
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixLDLT group    
+ */
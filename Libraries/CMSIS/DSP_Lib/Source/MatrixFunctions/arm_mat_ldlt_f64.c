@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_ldlt_f64.c    
+*    
+* Description:	Double-precision floating-point LDLT factorization.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixLDLT    
+ * @{    
+ */
+
+/**    
+ * @brief Double-precision floating-point LDL<sup>T</sup> factorization with symmetric pivoting.    
+ * @param[in]       *pSrc points to the symmetric input matrix structure    
+ * @param[out]      *pl points to the output matrix structure of the unit lower triangular factor L    
+ * @param[out]      *pd points to the output matrix structure of the diagonal factor D    
+ * @param[out]      *pp points to the output permutation vector, of length <code>pSrc->numRows</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices    
+ * are not square and of the same size when size checking is enabled,    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix needs a 2 x 2 pivot,    
+ * else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * The whole of <code>pSrc</code> is read, and it must be symmetric. <code>pl</code> may be <code>pSrc</code>.    
+ */
+
+arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pl,
+  arm_matrix_instance_f64 * pd,
+  uint16_t * pp)
+{
+  float64_t *pW = pl->pData;                          /* working matrix, then the factor L */
+  float64_t *pD = pd->pData;                          /* output diagonal factor */
+  float64_t *pRowK, *pRowI;                           /* rows k and i of the working matrix */
+  float64_t maxD, d, tmp, tol;                             /* pivot values */
+  uint32_t n = pSrc->numRows;                    /* number of rows and columns */
+  uint32_t i, j, k, p;                           /* loop counters */
+  uint16_t idx;                                  /* permutation index */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) ||
+     (pl->numRows != n) || (pl->numCols != n) || (pd->numRows != n) || (pd->numCols != n))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pW != pSrc->pData)
+    {
+      memcpy(pW, pSrc->pData, n * n * sizeof(float64_t));
+    }
+
+    memset(pD, 0, n * n * sizeof(float64_t));
+
+    for (i = 0u; i < n; i++)
+    {
+      pp[i] = (uint16_t) i;
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      pRowK = pW + k * n;
+
+      /* Largest remaining diagonal value */
+      p = k;
+      maxD = fabs(pRowK[k]);
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabs(pW[i * n + i]) > maxD)
+        {
+          maxD = fabs(pW[i * n + i]);
+          p = i;
+        }
+      }
+
+      /* Exchange the rows and then the columns k and p */
+      if(p != k)
+      {
+        pRowI = pW + p * n;
+
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pRowK[j];
+          pRowK[j] = pRowI[j];
+          pRowI[j] = tmp;
+        }
+
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pW[j * n + k];
+          pW[j * n + k] = pW[j * n + p];
+          pW[j * n + p] = tmp;
+        }
+
+        idx = pp[k];
+        pp[k] = pp[p];
+        pp[p] = idx;
+      }
+
+      /* Pivots below the rounding errors of the largest diagonal value of the matrix are zero */
+      if(k == 0u)
+      {
+        tol = (float64_t) n * 2.220446049250313e-16 * maxD;
+      }
+
+      d = pRowK[k];
+
+      if(fabs(d) <= tol)
+      {
+        /* The remaining diagonal is zero, so the remaining matrix must be zero too */
+        for (i = k; i < n; i++)
+        {
+          for (j = k; j < n; j++)
+          {
+            if(fabs(pW[i * n + j]) > tol)
+            {
+              return (ARM_MATH_DECOMPOSITION_FAILURE);
+            }
+            pW[i * n + j] = 0.0;
+          }
+        }
+
+        break;
+      }
+
+      pD[k * n + k] = d;
+
+      /* Eliminate the column k from the remaining rows, A(i,j) -= L(i,k) * A(k,j) */
+      for (i = k + 1u; i < n; i++)
+      {
+        pRowI = pW + i * n;
+        tmp = pRowI[k] / d;
+
+        arm_mat_row_msub_f64(pRowI + k + 1u, pRowK + k + 1u, tmp, n - k - 1u);
+
+        pRowI[k] = tmp;
+      }
+    }
+
+    /* Set the unit diagonal and clear the upper triangle of L */
+    for (i = 0u; i < n; i++)
+    {
+      pRowI = pW + i * n;
+      pRowI[i] = 1.0;
+
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixLDLT group    
+ */
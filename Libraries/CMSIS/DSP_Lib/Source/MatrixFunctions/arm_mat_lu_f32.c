@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_lu_f32.c    
+*    
+* Description:	Floating-point LU factorization.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixLU LU Factorization    
+ *    
+ * Factors a square matrix as <code>P * A = L * U</code>, where <code>L</code> is lower    
+ * triangular with a unit diagonal, <code>U</code> is upper triangular and <code>P</code>    
+ * is a row permutation, and solves linear systems with the factors.    
+ *    
+ * \par    
+ * The factorization is Gaussian elimination with partial pivoting: at each step the row    
+ * with the largest value in the column is exchanged to the front.    
+ * <code>L</code> and <code>U</code> are returned in one matrix, <code>L</code> below the    
+ * diagonal (its unit diagonal is not stored) and <code>U</code> on and above it.    
+ * The permutation is returned as a vector <code>pPerm</code> of <code>n</code> row indices:    
+ * row <code>i</code> of <code>P * A</code> is row <code>pPerm[i]</code> of <code>A</code>.    
+ * If a column has no nonzero pivot the matrix is singular and the functions return    
+ * <code>ARM_MATH_SINGULAR</code>.    
+ *    
+ * \par    
+ * The factorization takes n<sup>3</sup>/3 multiplications and each column of <code>B</code>    
+ * in the solve n<sup>2</sup>, against n<sup>3</sup> for arm_mat_inverse_f32().    
+ * The \ref MatrixChol "Cholesky factorization" is twice as fast for symmetric positive definite matrices.    
+ */
+
+/**    
+ * @addtogroup MatrixLU    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point LU factorization with partial pivoting.    
+ * @param[in]       *pSrc points to the input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure of the factors L and U    
+ * @param[out]      *pPerm points to the output permutation vector, of length <code>pSrc->numRows</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices    
+ * are not square and of the same size when size checking is enabled,    
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,    
+ * else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * <code>pDst</code> may be <code>pSrc</code>.    
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPerm)
+{
+  float32_t *pLU = pDst->pData;                       /* output data matrix pointer */
+  float32_t *pRowK, *pRowI;                           /* rows k and i of the factors */
+  float32_t maxC, pivot, tmp;                         /* pivot values */
+  uint32_t n = pSrc->numRows;                    /* number of rows and columns */
+  uint32_t i, j, k, p;                           /* loop counters */
+  uint16_t idx;                                  /* permutation index */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pLU != pSrc->pData)
+    {
+      memcpy(pLU, pSrc->pData, n * n * sizeof(float32_t));
+    }
+
+    for (i = 0u; i < n; i++)
+    {
+      pPerm[i] = (uint16_t) i;
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      pRowK = pLU + k * n;
+
+      /* Row with the largest value in the column k */
+      p = k;
+      maxC = fabsf(pRowK[k]);
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabsf(pLU[i * n + k]) > maxC)
+        {
+          maxC = fabsf(pLU[i * n + k]);
+          p = i;
+        }
+      }
+
+      /* The matrix is singular (or has a NaN) */
+      if(!(maxC > 0.0f))
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      /* Exchange the rows k and p */
+      if(p != k)
+      {
+        pRowI = pLU + p * n;
+
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pRowK[j];
+          pRowK[j] = pRowI[j];
+          pRowI[j] = tmp;
+        }
+
+        idx = pPerm[k];
+        pPerm[k] = pPerm[p];
+        pPerm[p] = idx;
+      }
+
+      pivot = pRowK[k];
+
+      /* Eliminate the column k from the rows below, U(i,j) -= L(i,k) * U(k,j) */
+      for (i = k + 1u; i < n; i++)
+      {
+        pRowI = pLU + i * n;
+        tmp = pRowI[k] / pivot;
+
+        arm_mat_row_msub_f32(pRowI + k + 1u, pRowK + k + 1u, tmp, n - k - 1u);
+
+        pRowI[k] = tmp;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixLU group    
+ */
@@ -58,6 +58,12 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of    
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output    
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.    
+ *    
+ * \par    
+ * The host build of the floating-point functions is cache and register blocked.    
+ * Up to 256 rows of 8 columns of <code>pSrcB</code> are packed into a panel that stays    
+ * in the L1 cache, and each block of 4 x 8 outputs is accumulated in SIMD registers.    
+ * The products are added in the same order as in the C code, so the results are bit-exact.    
  */
 
 
@@ -66,6 +72,156 @@
  * @{    
  */
 
+#if defined (ARM_MATH_SSE2)
+
+/* Number of rows of pSrcB in a panel. A panel of 256 x 8 values is 8 KB */
+#define MAT_MULT_KC   256u
+
+/**    
+ * @brief  Multiplies up to 4 rows of A with a panel of 8 columns of B.    
+ * @param[in]       *pA      points to the first row of A, at the first row of the panel    
+ * @param[in]       strideA  number of columns of A    
+ * @param[in]       rows     number of rows, 1 to 4    
+ * @param[in]       *pPanel  points to the panel, 8 values for each row of B    
+ * @param[in]       kc       number of rows of the panel    
+ * @param[in,out]   *pC      points to the first output    
+ * @param[in]       strideC  number of columns of C    
+ * @param[in]       first    the outputs start from zero if nonzero, else from the partial sums in C    
+ * @return none.    
+ */
+
+static void arm_mat_mult_kernel8_f32(
+  const float32_t * pA,
+  uint32_t strideA,
+  uint32_t rows,
+  const float32_t * pPanel,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t strideC,
+  uint32_t first)
+{
+  /* Missing rows repeat the first one and are not stored */
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = (rows > 1u) ? pA + strideA : pA;
+  const float32_t *pA2 = (rows > 2u) ? pA + 2u * strideA : pA;
+  const float32_t *pA3 = (rows > 3u) ? pA + 3u * strideA : pA;
+  float32_t *pC1 = (rows > 1u) ? pC + strideC : pC;
+  float32_t *pC2 = (rows > 2u) ? pC + 2u * strideC : pC;
+  float32_t *pC3 = (rows > 3u) ? pC + 3u * strideC : pC;
+  __m128 c00, c01, c10, c11, c20, c21, c30, c31, a, b0, b1;
+  uint32_t k;
+
+  if(first)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = _mm_setzero_ps();
+  }
+  else
+  {
+    c00 = _mm_loadu_ps(pC);
+    c01 = _mm_loadu_ps(pC + 4);
+    c10 = _mm_loadu_ps(pC1);
+    c11 = _mm_loadu_ps(pC1 + 4);
+    c20 = _mm_loadu_ps(pC2);
+    c21 = _mm_loadu_ps(pC2 + 4);
+    c30 = _mm_loadu_ps(pC3);
+    c31 = _mm_loadu_ps(pC3 + 4);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    b0 = _mm_load_ps(pPanel);
+    b1 = _mm_load_ps(pPanel + 4);
+    pPanel += 8u;
+
+    a = _mm_set1_ps(pA0[k]);
+    c00 = _mm_add_ps(c00, _mm_mul_ps(a, b0));
+    c01 = _mm_add_ps(c01, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(pA1[k]);
+    c10 = _mm_add_ps(c10, _mm_mul_ps(a, b0));
+    c11 = _mm_add_ps(c11, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(pA2[k]);
+    c20 = _mm_add_ps(c20, _mm_mul_ps(a, b0));
+    c21 = _mm_add_ps(c21, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(pA3[k]);
+    c30 = _mm_add_ps(c30, _mm_mul_ps(a, b0));
+    c31 = _mm_add_ps(c31, _mm_mul_ps(a, b1));
+  }
+
+  /* Stored from the last row, so that the first row is written last */
+  _mm_storeu_ps(pC3, c30);
+  _mm_storeu_ps(pC3 + 4, c31);
+  _mm_storeu_ps(pC2, c20);
+  _mm_storeu_ps(pC2 + 4, c21);
+  _mm_storeu_ps(pC1, c10);
+  _mm_storeu_ps(pC1 + 4, c11);
+  _mm_storeu_ps(pC, c00);
+  _mm_storeu_ps(pC + 4, c01);
+}
+
+/**    
+ * @brief  Multiplies up to 4 rows of A with a panel of 4 columns of B.    
+ * @param[in]       *pA      points to the first row of A, at the first row of the panel    
+ * @param[in]       strideA  number of columns of A    
+ * @param[in]       rows     number of rows, 1 to 4    
+ * @param[in]       *pPanel  points to the panel, 4 values for each row of B    
+ * @param[in]       kc       number of rows of the panel    
+ * @param[in,out]   *pC      points to the first output    
+ * @param[in]       strideC  number of columns of C    
+ * @param[in]       first    the outputs start from zero if nonzero, else from the partial sums in C    
+ * @return none.    
+ */
+
+static void arm_mat_mult_kernel4_f32(
+  const float32_t * pA,
+  uint32_t strideA,
+  uint32_t rows,
+  const float32_t * pPanel,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t strideC,
+  uint32_t first)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = (rows > 1u) ? pA + strideA : pA;
+  const float32_t *pA2 = (rows > 2u) ? pA + 2u * strideA : pA;
+  const float32_t *pA3 = (rows > 3u) ? pA + 3u * strideA : pA;
+  float32_t *pC1 = (rows > 1u) ? pC + strideC : pC;
+  float32_t *pC2 = (rows > 2u) ? pC + 2u * strideC : pC;
+  float32_t *pC3 = (rows > 3u) ? pC + 3u * strideC : pC;
+  __m128 c0, c1, c2, c3, b;
+  uint32_t k;
+
+  if(first)
+  {
+    c0 = c1 = c2 = c3 = _mm_setzero_ps();
+  }
+  else
+  {
+    c0 = _mm_loadu_ps(pC);
+    c1 = _mm_loadu_ps(pC1);
+    c2 = _mm_loadu_ps(pC2);
+    c3 = _mm_loadu_ps(pC3);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    b = _mm_load_ps(pPanel);
+    pPanel += 4u;
+
+    c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_set1_ps(pA0[k]), b));
+    c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_set1_ps(pA1[k]), b));
+    c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_set1_ps(pA2[k]), b));
+    c3 = _mm_add_ps(c3, _mm_mul_ps(_mm_set1_ps(pA3[k]), b));
+  }
+
+  _mm_storeu_ps(pC3, c3);
+  _mm_storeu_ps(pC2, c2);
+  _mm_storeu_ps(pC1, c1);
+  _mm_storeu_ps(pC, c0);
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 /**    
  * @brief Floating-point matrix multiplication.    
  * @param[in]       *pSrcA points to the first input matrix structure    
@@ -80,6 +236,115 @@ arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcB,
   arm_matrix_instance_f32 * pDst)
 {
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2 */
+
+  const float32_t *pInA = pSrcA->pData;          /* input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;          /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  __m128 panel[MAT_MULT_KC * 2u];                /* packed rows of B, 8 columns each */
+  float32_t *pPanel = (float32_t *) panel;
+  const float32_t *pIn1, *pIn2;
+  float32_t sum;                                 /* Accumulator */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t kb, kc, i, j, k, width;               /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Columns of B that are not in a strip of 8 or 4 are computed by the scalar loop below */
+    width = numColsB & ~3u;
+
+    /* The panel loop. The outputs of each panel carry on from the previous one */
+    for (kb = 0u; kb < numColsA; kb += kc)
+    {
+      kc = ((numColsA - kb) < MAT_MULT_KC) ? (numColsA - kb) : MAT_MULT_KC;
+
+      for (j = 0u; j < width; j += ((width - j) >= 8u) ? 8u : 4u)
+      {
+        if((width - j) >= 8u)
+        {
+          /* Pack 8 columns of the rows kb to kb + kc - 1 of B */
+          pIn2 = pInB + kb * numColsB + j;
+          for (k = 0u; k < kc; k++)
+          {
+            _mm_store_ps(pPanel + 8u * k, _mm_loadu_ps(pIn2));
+            _mm_store_ps(pPanel + 8u * k + 4u, _mm_loadu_ps(pIn2 + 4));
+            pIn2 += numColsB;
+          }
+
+          for (i = 0u; i < numRowsA; i += 4u)
+          {
+            arm_mat_mult_kernel8_f32(pInA + i * numColsA + kb, numColsA,
+                                     ((numRowsA - i) < 4u) ? (numRowsA - i) : 4u,
+                                     pPanel, kc, pOut + i * numColsB + j, numColsB,
+                                     kb == 0u);
+          }
+        }
+        else
+        {
+          /* Pack 4 columns */
+          pIn2 = pInB + kb * numColsB + j;
+          for (k = 0u; k < kc; k++)
+          {
+            _mm_store_ps(pPanel + 4u * k, _mm_loadu_ps(pIn2));
+            pIn2 += numColsB;
+          }
+
+          for (i = 0u; i < numRowsA; i += 4u)
+          {
+            arm_mat_mult_kernel4_f32(pInA + i * numColsA + kb, numColsA,
+                                     ((numRowsA - i) < 4u) ? (numRowsA - i) : 4u,
+                                     pPanel, kc, pOut + i * numColsB + j, numColsB,
+                                     kb == 0u);
+          }
+        }
+      }
+    }
+
+    /* The last 1 to 3 columns */
+    for (i = 0u; i < numRowsA; i++)
+    {
+      for (j = width; j < numColsB; j++)
+      {
+        pIn1 = pInA + i * numColsA;
+        pIn2 = pInB + j;
+        sum = 0.0f;
+
+        for (k = 0u; k < numColsA; k++)
+        {
+          sum += *pIn1++ * (*pIn2);
+          pIn2 += numColsB;
+        }
+
+        pOut[i * numColsB + j] = sum;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+
+#else
+
   float32_t *pIn1 = pSrcA->pData;                /* input data matrix pointer A */
   float32_t *pIn2 = pSrcB->pData;                /* input data matrix pointer B */
   float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A  */
@@ -279,6 +544,8 @@ arm_status arm_mat_mult_f32(
 
   /* Return to application */
   return (status);
+
+#endif /* #if defined (ARM_MATH_SSE2) */
 }
 
 /**    
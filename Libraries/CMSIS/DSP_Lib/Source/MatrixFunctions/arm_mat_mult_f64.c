@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_mult_f64.c    
+*    
+* Description:	Double-precision floating-point matrix multiplication.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixMult    
+ * @{    
+ */
+
+#if defined (ARM_MATH_SSE2)
+
+/* Number of rows of pSrcB in a panel. A panel of 256 x 4 values is 8 KB */
+#define MAT_MULT_KC   256u
+
+/**    
+ * @brief  Multiplies up to 4 rows of A with a panel of 4 columns of B.    
+ * @param[in]       *pA      points to the first row of A, at the first row of the panel    
+ * @param[in]       strideA  number of columns of A    
+ * @param[in]       rows     number of rows, 1 to 4    
+ * @param[in]       *pPanel  points to the panel, 4 values for each row of B    
+ * @param[in]       kc       number of rows of the panel    
+ * @param[in,out]   *pC      points to the first output    
+ * @param[in]       strideC  number of columns of C    
+ * @param[in]       first    the outputs start from zero if nonzero, else from the partial sums in C    
+ * @return none.    
+ */
+
+static void arm_mat_mult_kernel4_f64(
+  const float64_t * pA,
+  uint32_t strideA,
+  uint32_t rows,
+  const float64_t * pPanel,
+  uint32_t kc,
+  float64_t * pC,
+  uint32_t strideC,
+  uint32_t first)
+{
+  /* Missing rows repeat the first one and are not stored */
+  const float64_t *pA0 = pA;
+  const float64_t *pA1 = (rows > 1u) ? pA + strideA : pA;
+  const float64_t *pA2 = (rows > 2u) ? pA + 2u * strideA : pA;
+  const float64_t *pA3 = (rows > 3u) ? pA + 3u * strideA : pA;
+  float64_t *pC1 = (rows > 1u) ? pC + strideC : pC;
+  float64_t *pC2 = (rows > 2u) ? pC + 2u * strideC : pC;
+  float64_t *pC3 = (rows > 3u) ? pC + 3u * strideC : pC;
+  __m128d c00, c01, c10, c11, c20, c21, c30, c31, a, b0, b1;
+  uint32_t k;
+
+  if(first)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = _mm_setzero_pd();
+  }
+  else
+  {
+    c00 = _mm_loadu_pd(pC);
+    c01 = _mm_loadu_pd(pC + 2);
+    c10 = _mm_loadu_pd(pC1);
+    c11 = _mm_loadu_pd(pC1 + 2);
+    c20 = _mm_loadu_pd(pC2);
+    c21 = _mm_loadu_pd(pC2 + 2);
+    c30 = _mm_loadu_pd(pC3);
+    c31 = _mm_loadu_pd(pC3 + 2);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    b0 = _mm_load_pd(pPanel);
+    b1 = _mm_load_pd(pPanel + 2);
+    pPanel += 4u;
+
+    a = _mm_set1_pd(pA0[k]);
+    c00 = _mm_add_pd(c00, _mm_mul_pd(a, b0));
+    c01 = _mm_add_pd(c01, _mm_mul_pd(a, b1));
+    a = _mm_set1_pd(pA1[k]);
+    c10 = _mm_add_pd(c10, _mm_mul_pd(a, b0));
+    c11 = _mm_add_pd(c11, _mm_mul_pd(a, b1));
+    a = _mm_set1_pd(pA2[k]);
+    c20 = _mm_add_pd(c20, _mm_mul_pd(a, b0));
+    c21 = _mm_add_pd(c21, _mm_mul_pd(a, b1));
+    a = _mm_set1_pd(pA3[k]);
+    c30 = _mm_add_pd(c30, _mm_mul_pd(a, b0));
+    c31 = _mm_add_pd(c31, _mm_mul_pd(a, b1));
+  }
+
+  /* Stored from the last row, so that the first row is written last */
+  _mm_storeu_pd(pC3, c30);
+  _mm_storeu_pd(pC3 + 2, c31);
+  _mm_storeu_pd(pC2, c20);
+  _mm_storeu_pd(pC2 + 2, c21);
+  _mm_storeu_pd(pC1, c10);
+  _mm_storeu_pd(pC1 + 2, c11);
+  _mm_storeu_pd(pC, c00);
+  _mm_storeu_pd(pC + 2, c01);
+}
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+/**    
+ * @brief Double-precision floating-point matrix multiplication.    
+ * @param[in]       *pSrcA points to the first input matrix structure    
+ * @param[in]       *pSrcB points to the second input matrix structure    
+ * @param[out]      *pDst points to output matrix structure    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * The Cortex-M cores do double-precision arithmetic in software, so the C code is not unrolled.    
+ * The host build packs up to 256 rows of 4 columns of <code>pSrcB</code> into a panel    
+ * and accumulates blocks of 4 x 4 outputs in SIMD registers, with the same results.    
+ */
+
+arm_status arm_mat_mult_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pInA = pSrcA->pData;          /* input data matrix pointer A */
+  const float64_t *pInB = pSrcB->pData;          /* input data matrix pointer B */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  const float64_t *pIn1, *pIn2;
+  float64_t sum;                                 /* Accumulator */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t i, j, k, width;                       /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#if defined (ARM_MATH_SSE2)
+  __m128d panel[MAT_MULT_KC * 2u];               /* packed rows of B, 4 columns each */
+  float64_t *pPanel = (float64_t *) panel;
+  uint32_t kb, kc;
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+#if defined (ARM_MATH_SSE2)
+
+    /* Run the below code for the host build with SSE2.    
+     ** Columns of B that are not in a strip of 4 are computed by the loop below. */
+    width = numColsB & ~3u;
+
+    /* The panel loop. The outputs of each panel carry on from the previous one */
+    for (kb = 0u; kb < numColsA; kb += kc)
+    {
+      kc = ((numColsA - kb) < MAT_MULT_KC) ? (numColsA - kb) : MAT_MULT_KC;
+
+      for (j = 0u; j < width; j += 4u)
+      {
+        /* Pack 4 columns of the rows kb to kb + kc - 1 of B */
+        pIn2 = pInB + kb * numColsB + j;
+        for (k = 0u; k < kc; k++)
+        {
+          _mm_store_pd(pPanel + 4u * k, _mm_loadu_pd(pIn2));
+          _mm_store_pd(pPanel + 4u * k + 2u, _mm_loadu_pd(pIn2 + 2));
+          pIn2 += numColsB;
+        }
+
+        for (i = 0u; i < numRowsA; i += 4u)
+        {
+          arm_mat_mult_kernel4_f64(pInA + i * numColsA + kb, numColsA,
+                                   ((numRowsA - i) < 4u) ? (numRowsA - i) : 4u,
+                                   pPanel, kc, pOut + i * numColsB + j, numColsB,
+                                   kb == 0u);
+        }
+      }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+    width = 0u;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* The dot-product of each row in pSrcA with each column in pSrcB */
+    for (i = 0u; i < numRowsA; i++)
+    {
+      for (j = width; j < numColsB; j++)
+      {
+        pIn1 = pInA + i * numColsA;
+        pIn2 = pInB + j;
+        sum = 0.0;
+
+        for (k = 0u; k < numColsA; k++)
+        {
+          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+          sum += *pIn1++ * (*pIn2);
+          pIn2 += numColsB;
+        }
+
+        /* Store the result in the destination buffer */
+        pOut[i * numColsB + j] = sum;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixMult group    
+ */
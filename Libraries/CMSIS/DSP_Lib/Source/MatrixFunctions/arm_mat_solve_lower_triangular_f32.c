@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_solve_lower_triangular_f32.c    
+*    
+* Description:	Floating-point lower triangular solve.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixSolve Triangular Solvers    
+ *    
+ * Solve <code>T * X = B</code> for a lower or upper triangular matrix <code>T</code>,    
+ * by forward or backward substitution:    
+ * <pre>    
+ *     X(i,:) = (B(i,:) - sum(T(i,k) * X(k,:), k = 0..i-1)) / T(i,i)      lower triangular    
+ *     X(i,:) = (B(i,:) - sum(T(i,k) * X(k,:), k = i+1..n-1)) / T(i,i)    upper triangular    
+ * </pre>    
+ * The other triangle of <code>T</code> is not read. The rows of <code>X</code> are    
+ * updated as a whole, so all the columns of <code>B</code> are solved in one pass.    
+ * If a diagonal value is zero the functions return <code>ARM_MATH_SINGULAR</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point solve of <code>T * X = B</code> for a lower triangular <code>T</code>.    
+ * @param[in]       *pSrcT points to the lower triangular matrix structure    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the solution matrix structure, of the size of <code>pSrcB</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes do not    
+ * match when size checking is enabled, <code>ARM_MATH_SINGULAR</code> if a diagonal value    
+ * of <code>pSrcT</code> is zero, else <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * <code>pDst</code> may be <code>pSrcB</code>.    
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pT = pSrcT->pData;                 /* triangular data matrix pointer */
+  float32_t *pX = pDst->pData;                        /* output data matrix pointer */
+  float32_t *pRowX;                                   /* row of the output */
+  uint32_t n = pSrcT->numRows;                   /* number of unknowns */
+  uint32_t m = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k;                                 /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcT->numRows != pSrcT->numCols) || (pSrcB->numRows != pSrcT->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pX != pSrcB->pData)
+    {
+      memcpy(pX, pSrcB->pData, n * m * sizeof(float32_t));
+    }
+
+    for (i = 0u; i < n; i++)
+    {
+      pRowX = pX + i * m;
+
+      for (k = 0u; k < i; k++)
+      {
+        arm_mat_row_msub_f32(pRowX, pX + k * m, pT[i * n + k], m);
+      }
+
+      if(pT[i * n + i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      arm_mat_row_div_f32(pRowX, pT[i * n + i], m);
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
@@ -0,0 +1,384 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_f32.c    
+*    
+* Description:	Floating-point statistics in one pass.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup stats Statistics in One Pass    
+ *    
+ * Computes the mean, variance, standard deviation, RMS, minimum and maximum    
+ * of a vector, and the indices of the minimum and maximum, in a single pass over the input.    
+ * Frame-based feature extraction that would call \ref mean, \ref variance, \ref STD,    
+ * \ref RMS, \ref Min and \ref Max on the same buffer reads it once instead of six times.    
+ *    
+ * The variance is the unbiased estimate as in \ref variance:    
+ * <pre>    
+ *     var = sum((pSrc[n] - mean)<sup>2</sup>) / (blockSize - 1)    
+ *     std = sqrt(var)    
+ *     rms = sqrt(sum(pSrc[n]<sup>2</sup>) / blockSize)    
+ * </pre>    
+ * with a variance of 0 when blockSize is 1. The indices are those of the first minimum and maximum.    
+ * <code>blockSize</code> must be at least 1.    
+ *    
+ * \par Floating-point algorithm    
+ * The input is processed in blocks of 64 samples. The sums of a block are taken    
+ * about its first sample, which keeps them small, and the mean and the sum of the squared    
+ * deviations of the block are then merged into those of the previous blocks (Chan, Golub and LeVeque).    
+ * The running mean is kept relative to the first sample of the vector, so that its rounding    
+ * does not depend on the offset of the signal.    
+ * Unlike the sum of the squares less the squared sum of \ref variance, this does not lose    
+ * the variance of signals with a large offset. The RMS is taken from the mean and the variance.    
+ *    
+ * \par Fixed-point algorithm    
+ * The sum and the sum of the squares are accumulated in 64 bits, exactly except for the    
+ * Q31 sum of the squares (see arm_stats_q31()). The variance is the mean of the squares    
+ * less the square of the mean, with all the bits of the accumulators, and is saturated    
+ * to the format of the input.    
+ *    
+ * The host build computes 4 (f32, q31) or 8 (q15, q7) samples at a time with SSE and    
+ * its results are bit-exact with the C code.    
+ *    
+ * There are separate functions for floating point, Q31, Q15 and Q7 data types.    
+ */
+
+/**    
+ * @addtogroup stats    
+ * @{    
+ */
+
+/* Number of samples of the blocks that are merged */
+#define STATS_BLOCK_SIZE  64u
+
+/**    
+ * @brief Statistics of the elements of a floating-point vector, in one pass.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @param[out]      *pResult statistics returned here    
+ * @return none.    
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t offset;                              /* First sample, that the mean is taken from */
+  float32_t mean = 0.0f;                         /* Mean of the blocks so far, less the offset */
+  float32_t m2 = 0.0f;                           /* Sum of the squared deviations of the blocks so far */
+  float32_t minVal, maxVal;                      /* Minimum and maximum values */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum values */
+  float32_t shift;                               /* First sample of the block */
+  float32_t sum1, sum2;                          /* Sums of the block */
+  float32_t blkMean, blkM2, delta, f;            /* Statistics of the block and merge */
+  float32_t in, d;                               /* Input value and its difference to the shift */
+  uint32_t count = 0u;                           /* Number of samples of the blocks so far */
+  uint32_t index = 0u;                           /* Index of the input value */
+  uint32_t blkLen, blkCnt;                       /* Length of the block and loop counter */
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Run the below code for the host build with SSE2.    
+   ** Each lane keeps its own minimum and maximum with their indices, and its own sums    
+   ** of the block, added in the same order as the C code below. */
+  __m128 x, dv, acc1, acc2, vs, mask;
+  __m128 vMin, vMax;
+  __m128i vMinIdx, vMaxIdx, vIdx;
+  float32_t t1[4], t2[4];
+  uint32_t i1[4], i2[4];
+  uint32_t l;
+
+  vMin = _mm_set1_ps(pSrc[0]);
+  vMax = vMin;
+  vMinIdx = _mm_setzero_si128();
+  vMaxIdx = vMinIdx;
+  vIdx = _mm_setr_epi32(0, 1, 2, 3);
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Input values */
+  float32_t sum1b, sum1c, sum1d;                 /* Additional accumulators */
+  float32_t sum2b, sum2c, sum2d;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  offset = pSrc[0];
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  while(count < blockSize)
+  {
+    blkLen = blockSize - count;
+    blkLen = (blkLen > STATS_BLOCK_SIZE) ? STATS_BLOCK_SIZE : blkLen;
+
+    /* The sums of the block are taken about its first sample */
+    shift = *pSrc;
+
+#if defined (ARM_MATH_SSE2)
+
+    vs = _mm_set1_ps(shift);
+    acc1 = _mm_setzero_ps();
+    acc2 = _mm_setzero_ps();
+
+    blkCnt = blkLen >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      x = _mm_loadu_ps(pSrc);
+
+      dv = _mm_sub_ps(x, vs);
+      acc1 = _mm_add_ps(acc1, dv);
+      acc2 = _mm_add_ps(acc2, _mm_mul_ps(dv, dv));
+
+      /* Strict comparisons, so that each lane keeps the first index of its extremum */
+      mask = _mm_cmplt_ps(x, vMin);
+      vMin = _mm_min_ps(x, vMin);
+      vMinIdx = _mm_or_si128(_mm_and_si128(_mm_castps_si128(mask), vIdx),
+                             _mm_andnot_si128(_mm_castps_si128(mask), vMinIdx));
+      mask = _mm_cmpgt_ps(x, vMax);
+      vMax = _mm_max_ps(x, vMax);
+      vMaxIdx = _mm_or_si128(_mm_and_si128(_mm_castps_si128(mask), vIdx),
+                             _mm_andnot_si128(_mm_castps_si128(mask), vMaxIdx));
+
+      vIdx = _mm_add_epi32(vIdx, _mm_set1_epi32(4));
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    _mm_storeu_ps(t1, acc1);
+    _mm_storeu_ps(t2, acc2);
+    sum1 = (t1[0] + t1[1]) + (t1[2] + t1[3]);
+    sum2 = (t2[0] + t2[1]) + (t2[2] + t2[3]);
+
+    index += blkLen & ~3u;
+
+    /* The remaining samples are processed by the scalar loop */
+    blkCnt = blkLen % 0x4u;
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+    sum1 = 0.0f;
+    sum1b = 0.0f;
+    sum1c = 0.0f;
+    sum1d = 0.0f;
+    sum2 = 0.0f;
+    sum2b = 0.0f;
+    sum2c = 0.0f;
+    sum2d = 0.0f;
+
+    /*loop Unrolling */
+    blkCnt = blkLen >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 samples at a time.    
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* Read 4 input values */
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      /* Sums of the differences to the shift and of their squares */
+      d = in1 - shift;
+      sum1 += d;
+      sum2 += d * d;
+      d = in2 - shift;
+      sum1b += d;
+      sum2b += d * d;
+      d = in3 - shift;
+      sum1c += d;
+      sum2c += d * d;
+      d = in4 - shift;
+      sum1d += d;
+      sum2d += d * d;
+
+      /* Compare for the minimum and maximum values */
+      if(in1 < minVal)
+      {
+        minVal = in1;
+        minIndex = index;
+      }
+      if(in1 > maxVal)
+      {
+        maxVal = in1;
+        maxIndex = index;
+      }
+      if(in2 < minVal)
+      {
+        minVal = in2;
+        minIndex = index + 1u;
+      }
+      if(in2 > maxVal)
+      {
+        maxVal = in2;
+        maxIndex = index + 1u;
+      }
+      if(in3 < minVal)
+      {
+        minVal = in3;
+        minIndex = index + 2u;
+      }
+      if(in3 > maxVal)
+      {
+        maxVal = in3;
+        maxIndex = index + 2u;
+      }
+      if(in4 < minVal)
+      {
+        minVal = in4;
+        minIndex = index + 3u;
+      }
+      if(in4 > maxVal)
+      {
+        maxVal = in4;
+        maxIndex = index + 3u;
+      }
+
+      index += 4u;
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the accumulators in the order of the host build */
+    sum1 = (sum1 + sum1b) + (sum1c + sum1d);
+    sum2 = (sum2 + sum2b) + (sum2c + sum2d);
+
+    /* If the block length is not a multiple of 4, compute any remaining samples here.    
+     ** No loop unrolling is used. */
+    blkCnt = blkLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+
+    blkCnt = blkLen;
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      d = in - shift;
+      sum1 += d;
+      sum2 += d * d;
+
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = index;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = index;
+      }
+
+      index++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Mean and sum of the squared deviations of the block */
+    blkMean = sum1 / (float32_t) blkLen;
+    blkM2 = sum2 - sum1 * blkMean;
+    blkM2 = (blkM2 > 0.0f) ? blkM2 : 0.0f;
+    blkMean += shift - offset;
+
+    /* Merge them with those of the previous blocks */
+    delta = blkMean - mean;
+    f = (float32_t) blkLen / (float32_t) (count + blkLen);
+    mean += delta * f;
+    m2 += blkM2 + (delta * delta) * ((float32_t) count * f);
+
+    count += blkLen;
+  }
+
+#if defined (ARM_MATH_SSE2)
+
+  /* Extrema of the lanes, the first index of the ties */
+  _mm_storeu_ps(t1, vMin);
+  _mm_storeu_ps(t2, vMax);
+  _mm_storeu_si128((__m128i *) i1, vMinIdx);
+  _mm_storeu_si128((__m128i *) i2, vMaxIdx);
+
+  for (l = 0u; l < 4u; l++)
+  {
+    if((t1[l] < minVal) || ((t1[l] == minVal) && (i1[l] < minIndex)))
+    {
+      minVal = t1[l];
+      minIndex = i1[l];
+    }
+    if((t2[l] > maxVal) || ((t2[l] == maxVal) && (i2[l] < maxIndex)))
+    {
+      maxVal = t2[l];
+      maxIndex = i2[l];
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+  /* Store the results */
+  mean += offset;
+  pResult->mean = mean;
+  pResult->var = (blockSize > 1u) ? m2 / (float32_t) (blockSize - 1u) : 0.0f;
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  arm_sqrt_f32(mean * mean + m2 / (float32_t) blockSize, &pResult->rms);
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**    
+ * @} end of stats group    
+ */
@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_q15.c    
+*    
+* Description:	Q15 statistics in one pass.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup stats    
+ * @{    
+ */
+
+/**    
+ * @brief Statistics of the elements of a Q15 vector, in one pass.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @param[out]      *pResult statistics returned here    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The sum of the input values and the sum of the squares, in 2.30 format, are    
+ * accumulated exactly in 64 bits, with no risk of overflow.    
+ * The mean is truncated to 1.15 format. The variance and the mean of the squares are    
+ * computed in 2.30 format and saturated to 1.31 format for the square roots, and all    
+ * the results are then truncated to 1.15 format.    
+ */
+
+void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the input values */
+  q63_t sumOfSquares = 0;                        /* Sum of the squares in 34.30 format */
+  q63_t meanOfSquares, var;                      /* Mean of the squares and variance in 2.30 format */
+  q31_t out;                                     /* Result in 1.31 format */
+  q15_t mean;                                    /* Mean value */
+  q15_t minVal, maxVal;                          /* Minimum and maximum values */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum values */
+  uint32_t index = 0u;                           /* Index of the input value */
+  q15_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE41)
+
+  /* Run the below code for the host build with SSE4.1.    
+   ** The sums are exact, so they are bit-exact with the C code in any order.    
+   ** _mm_minpos_epu16 finds the first minimum of 8 samples, with the values offset    
+   ** to unsigned for the minimum, and reversed for the maximum. */
+  __m128i x, r;
+  __m128i accSum, accSq;
+  q15_t v;
+
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  accSum = _mm_setzero_si128();
+  accSq = _mm_setzero_si128();
+
+  blkCnt = blockSize >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    x = _mm_loadu_si128((__m128i *) pSrc);
+
+    accSum = __HVI_ACC_MADD(accSum, _mm_madd_epi16(x, _mm_set1_epi16(1)));
+    accSq = __HVI_ACC_MADD(accSq, _mm_madd_epi16(x, x));
+
+    /* The strict comparisons keep the first index of the extrema */
+    r = _mm_minpos_epu16(_mm_xor_si128(x, _mm_set1_epi16((int16_t) 0x8000)));
+    v = (q15_t) (_mm_extract_epi16(r, 0) ^ 0x8000);
+    if(v < minVal)
+    {
+      minVal = v;
+      minIndex = index + (uint32_t) _mm_extract_epi16(r, 1);
+    }
+    r = _mm_minpos_epu16(_mm_xor_si128(x, _mm_set1_epi16(0x7FFF)));
+    v = (q15_t) (_mm_extract_epi16(r, 0) ^ 0x7FFF);
+    if(v > maxVal)
+    {
+      maxVal = v;
+      maxIndex = index + (uint32_t) _mm_extract_epi16(r, 1);
+    }
+
+    index += 8u;
+    pSrc += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = __HVI_HSUM64(accSum);
+  sumOfSquares = __HVI_HSUM64(accSq);
+
+  /* The remaining samples are processed by the scalar loop */
+  blkCnt = blockSize % 0x8u;
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2;                                /* Packed input values */
+  q15_t x1, x2, x3, x4;                          /* Input values */
+
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read 2 pairs of input values */
+    in1 = *__SIMD32(pSrc)++;
+    in2 = *__SIMD32(pSrc)++;
+
+    /* Sums of the values and of their squares, two at a time */
+    sum = __SMLALD(in1, 0x00010001, sum);
+    sumOfSquares = __SMLALD(in1, in1, sumOfSquares);
+    sum = __SMLALD(in2, 0x00010001, sum);
+    sumOfSquares = __SMLALD(in2, in2, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    x1 = (q15_t) in1;
+    x2 = (q15_t) (in1 >> 16);
+    x3 = (q15_t) in2;
+    x4 = (q15_t) (in2 >> 16);
+#else
+    x1 = (q15_t) (in1 >> 16);
+    x2 = (q15_t) in1;
+    x3 = (q15_t) (in2 >> 16);
+    x4 = (q15_t) in2;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Compare for the minimum and maximum values */
+    if(x1 < minVal)
+    {
+      minVal = x1;
+      minIndex = index;
+    }
+    if(x1 > maxVal)
+    {
+      maxVal = x1;
+      maxIndex = index;
+    }
+    if(x2 < minVal)
+    {
+      minVal = x2;
+      minIndex = index + 1u;
+    }
+    if(x2 > maxVal)
+    {
+      maxVal = x2;
+      maxIndex = index + 1u;
+    }
+    if(x3 < minVal)
+    {
+      minVal = x3;
+      minIndex = index + 2u;
+    }
+    if(x3 > maxVal)
+    {
+      maxVal = x3;
+      maxIndex = index + 2u;
+    }
+    if(x4 < minVal)
+    {
+      minVal = x4;
+      minIndex = index + 3u;
+    }
+    if(x4 > maxVal)
+    {
+      maxVal = x4;
+      maxIndex = index + 3u;
+    }
+
+    index += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE41) */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = index;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index;
+    }
+
+    index++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean in 1.15 format, and mean of the squares in 2.30 format */
+  mean = (q15_t) (sum / (q63_t) blockSize);
+  meanOfSquares = sumOfSquares / (q63_t) blockSize;
+
+  /* Mean of the squares less the square of the mean, scaled by blockSize / (blockSize - 1) */
+  var = meanOfSquares - ((q31_t) mean * mean);
+  var = (var > 0) ? var : 0;
+  if(blockSize > 1u)
+  {
+    var += var / (q63_t) (blockSize - 1u);
+  }
+
+  /* Store the results */
+  pResult->mean = mean;
+  out = clip_q63_to_q31(var << 1);
+  pResult->var = (q15_t) (out >> 16);
+  arm_sqrt_q31(out, &out);
+  pResult->std = (q15_t) (out >> 16);
+  arm_sqrt_q31(clip_q63_to_q31(meanOfSquares << 1), &out);
+  pResult->rms = (q15_t) (out >> 16);
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**    
+ * @} end of stats group    
+ */
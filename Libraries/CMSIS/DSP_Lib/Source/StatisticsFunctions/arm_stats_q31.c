@@ -0,0 +1,316 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_q31.c    
+*    
+* Description:	Q31 statistics in one pass.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup stats    
+ * @{    
+ */
+
+/**    
+ * @brief Statistics of the elements of a Q31 vector, in one pass.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @param[out]      *pResult statistics returned here    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The sum of the input values is accumulated exactly in 64 bits.    
+ * The intermediate multiplications are in 1.31 x 1.31 = 2.62 format and these    
+ * are truncated to 2.46 format by discarding the lower 16 bits.    
+ * The 2.46 results are added without saturation to a 64-bit accumulator in 18.46 format,    
+ * and there is no risk of overflow as long as blockSize is less than 2^17.    
+ * The mean is truncated to 1.31 format, and the variance and mean of the squares are    
+ * computed in 2.46 format and saturated to 1.31 format.    
+ * \par    
+ * So the variance saturates below 1, which a full scale input can exceed: with the    
+ * values 0x80000000 and 0x7FFFFFFF it is almost 2. arm_var_q31() returns the variance as a q63_t instead,    
+ * and does not saturate it.    
+ */
+
+void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the input values */
+  q63_t sumOfSquares = 0;                        /* Sum of the squares in 18.46 format */
+  q63_t meanOfSquares, var;                      /* Mean of the squares and variance in 2.46 format */
+  q31_t mean;                                    /* Mean value */
+  q31_t minVal, maxVal;                          /* Minimum and maximum values */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum values */
+  uint32_t index = 0u;                           /* Index of the input value */
+  q31_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_SSE41)
+
+  /* Run the below code for the host build with SSE4.1.    
+   ** Each lane keeps its own minimum and maximum with their indices. */
+  __m128i x, y, mask;
+  __m128i accSum, accSq;
+  __m128i vMin, vMax, vMinIdx, vMaxIdx, vIdx;
+  q31_t t1[4], t2[4];
+  uint32_t i1[4], i2[4];
+  uint32_t l;
+
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  accSum = _mm_setzero_si128();
+  accSq = _mm_setzero_si128();
+  vMin = _mm_set1_epi32(minVal);
+  vMax = vMin;
+  vMinIdx = _mm_setzero_si128();
+  vMaxIdx = vMinIdx;
+  vIdx = _mm_setr_epi32(0, 1, 2, 3);
+
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    x = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* Sign extended sum of the 4 values */
+    accSum = _mm_add_epi64(accSum, _mm_cvtepi32_epi64(x));
+    accSum = _mm_add_epi64(accSum, _mm_cvtepi32_epi64(_mm_srli_si128(x, 8)));
+
+    /* Squares of the even and then the odd lanes. They are positive, so the logical shift is exact. */
+    y = _mm_srli_epi64(x, 32);
+    accSq = _mm_add_epi64(accSq, _mm_srli_epi64(_mm_mul_epi32(x, x), 16));
+    accSq = _mm_add_epi64(accSq, _mm_srli_epi64(_mm_mul_epi32(y, y), 16));
+
+    /* Strict comparisons, so that each lane keeps the first index of its extremum */
+    mask = _mm_cmplt_epi32(x, vMin);
+    vMin = _mm_min_epi32(x, vMin);
+    vMinIdx = _mm_blendv_epi8(vMinIdx, vIdx, mask);
+    mask = _mm_cmpgt_epi32(x, vMax);
+    vMax = _mm_max_epi32(x, vMax);
+    vMaxIdx = _mm_blendv_epi8(vMaxIdx, vIdx, mask);
+
+    vIdx = _mm_add_epi32(vIdx, _mm_set1_epi32(4));
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = __HVI_HSUM64(accSum);
+  sumOfSquares = __HVI_HSUM64(accSq);
+
+  /* Extrema of the lanes, the first index of the ties */
+  _mm_storeu_si128((__m128i *) t1, vMin);
+  _mm_storeu_si128((__m128i *) t2, vMax);
+  _mm_storeu_si128((__m128i *) i1, vMinIdx);
+  _mm_storeu_si128((__m128i *) i2, vMaxIdx);
+
+  for (l = 0u; l < 4u; l++)
+  {
+    if((t1[l] < minVal) || ((t1[l] == minVal) && (i1[l] < minIndex)))
+    {
+      minVal = t1[l];
+      minIndex = i1[l];
+    }
+    if((t2[l] > maxVal) || ((t2[l] == maxVal) && (i2[l] < maxIndex)))
+    {
+      maxVal = t2[l];
+      maxIndex = i2[l];
+    }
+  }
+
+  index = blockSize & ~3u;
+
+  /* The remaining samples are processed by the scalar loop */
+  blkCnt = blockSize % 0x4u;
+
+#elif !defined (ARM_MATH_CM0_FAMILY)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q63_t sumOfSquares1 = 0;                       /* Second accumulator */
+  q31_t in1, in2, in3, in4;                      /* Input values */
+
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read 4 input values */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    /* Sums of the values and of their squares */
+    sum += in1;
+    sumOfSquares += ((q63_t) in1 * in1) >> 16;
+    sum += in2;
+    sumOfSquares1 += ((q63_t) in2 * in2) >> 16;
+    sum += in3;
+    sumOfSquares += ((q63_t) in3 * in3) >> 16;
+    sum += in4;
+    sumOfSquares1 += ((q63_t) in4 * in4) >> 16;
+
+    /* Compare for the minimum and maximum values */
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = index;
+    }
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = index;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIndex = index + 1u;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIndex = index + 1u;
+    }
+    if(in3 < minVal)
+    {
+      minVal = in3;
+      minIndex = index + 2u;
+    }
+    if(in3 > maxVal)
+    {
+      maxVal = in3;
+      maxIndex = index + 2u;
+    }
+    if(in4 < minVal)
+    {
+      minVal = in4;
+      minIndex = index + 3u;
+    }
+    if(in4 > maxVal)
+    {
+      maxVal = in4;
+      maxIndex = index + 3u;
+    }
+
+    index += 4u;
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* add two accumulators */
+  sumOfSquares = sumOfSquares + sumOfSquares1;
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_SSE41) */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 16;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = index;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index;
+    }
+
+    index++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean in 1.31 format, and mean of the squares in 2.46 format */
+  mean = (q31_t) (sum / (q63_t) blockSize);
+  meanOfSquares = sumOfSquares / (q63_t) blockSize;
+
+  /* Mean of the squares less the square of the mean, scaled by blockSize / (blockSize - 1) */
+  var = meanOfSquares - (((q63_t) mean * mean) >> 16);
+  var = (var > 0) ? var : 0;
+  if(blockSize > 1u)
+  {
+    var += var / (q63_t) (blockSize - 1u);
+  }
+
+  /* Store the results */
+  pResult->mean = mean;
+  pResult->var = clip_q63_to_q31(var >> 15);
+  arm_sqrt_q31(pResult->var, &pResult->std);
+  arm_sqrt_q31(clip_q63_to_q31(meanOfSquares >> 15), &pResult->rms);
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**    
+ * @} end of stats group    
+ */
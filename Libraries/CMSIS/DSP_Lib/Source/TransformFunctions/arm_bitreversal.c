@@ -240,3 +240,39 @@ uint16_t * pBitRevTab)
       pBitRevTab += bitRevFactor;
    }
 }
+
+
+#if defined (ARM_MATH_HOST)
+
+/*    
+   * @brief  In-place bit reversal function. C version of arm_bitreversal2.S for the host build.   
+   * @param[in, out] *pSrc        points to the in-place buffer of unknown 32-bit data type.   
+   * @param[in]      bitRevLen    bit reversal table length   
+   * @param[in]      *pBitRevTab  points to bit reversal table of byte offset pairs.   
+   * @return none.   
+*/
+
+void arm_bitreversal_32(
+uint32_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t a, b, i, in;
+
+   for (i = 0u; i + 1u < bitRevLen; i += 2u)
+   {
+      /*  The table holds byte offsets of the two complex values to swap */
+      a = pBitRevTab[i] >> 2u;
+      b = pBitRevTab[i + 1u] >> 2u;
+
+      in = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = in;
+
+      in = pSrc[a + 1u];
+      pSrc[a + 1u] = pSrc[b + 1u];
+      pSrc[b + 1u] = in;
+   }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) */
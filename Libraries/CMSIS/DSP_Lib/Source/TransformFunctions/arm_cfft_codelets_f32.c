@@ -0,0 +1,2423 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        19. October 2026
+* $Revision: 	V1.4.1
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_codelets_f32.c
+*
+* Description:	Fixed-size floating-point complex FFT codelets.
+*
+*               Generated by arm_cfft_codelets_gen.py, do not edit.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+#if !defined (ARM_MATH_CFFT_NO_CODELETS)
+
+/**   
+ * @brief  16-point forward complex FFT codelet.   
+ * @param[in, out] *p  points to the 16 complex values, in place.   
+ * @return none.   
+ */
+
+static void arm_cfft_codelet_16_f32(
+  float32_t * p)
+{
+  float32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11;
+  float32_t t12, t13, t14, t15, t16, t17, t18, t19, t20, t21, t22, t23;
+  float32_t t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35;
+  float32_t t36, t37, t38, t39, t40, t41, t42, t43, t44, t45, t46, t47;
+  float32_t t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  float32_t t60, t61, t62, t63, t64, t65, t66, t67, t68, t69, t70, t71;
+  float32_t t72, t73, t74, t75, t76, t77, t78, t79, t80, t81, t82, t83;
+  float32_t t84, t85, t86, t87, t88, t89, t90, t91, t92, t93, t94, t95;
+  float32_t t96, t97, t98, t99, t100, t101, t102, t103, t104, t105, t106, t107;
+  float32_t t108, t109, t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+  float32_t t120, t121, t122, t123, t124, t125, t126, t127, t128, t129, t130, t131;
+  float32_t t132, t133, t134, t135, t136, t137, t138, t139, t140, t141, t142, t143;
+  float32_t t144, t145, t146, t147, t148, t149, t150, t151, t152, t153, t154, t155;
+  float32_t t156, t157, t158, t159, t160, t161, t162, t163, t164, t165, t166, t167;
+  float32_t t168, t169, t170, t171, t172, t173, t174, t175;
+
+  t0 = p[0];
+  t1 = p[1];
+  t2 = p[2];
+  t3 = p[3];
+  t4 = p[4];
+  t5 = p[5];
+  t6 = p[6];
+  t7 = p[7];
+  t8 = p[8];
+  t9 = p[9];
+  t10 = p[10];
+  t11 = p[11];
+  t12 = p[12];
+  t13 = p[13];
+  t14 = p[14];
+  t15 = p[15];
+  t16 = p[16];
+  t17 = p[17];
+  t18 = p[18];
+  t19 = p[19];
+  t20 = p[20];
+  t21 = p[21];
+  t22 = p[22];
+  t23 = p[23];
+  t24 = p[24];
+  t25 = p[25];
+  t26 = p[26];
+  t27 = p[27];
+  t28 = p[28];
+  t29 = p[29];
+  t30 = p[30];
+  t31 = p[31];
+  t32 = t0 + t16;
+  t33 = t1 + t17;
+  t34 = t0 - t16;
+  t35 = t1 - t17;
+  t36 = t8 + t24;
+  t37 = t9 + t25;
+  t38 = t8 - t24;
+  t39 = t9 - t25;
+  t40 = t32 + t36;
+  t41 = t33 + t37;
+  t42 = t34 + t39;
+  t43 = t35 - t38;
+  t44 = t32 - t36;
+  t45 = t33 - t37;
+  t46 = t34 - t39;
+  t47 = t35 + t38;
+  t48 = t2 + t18;
+  t49 = t3 + t19;
+  t50 = t2 - t18;
+  t51 = t3 - t19;
+  t52 = t10 + t26;
+  t53 = t11 + t27;
+  t54 = t10 - t26;
+  t55 = t11 - t27;
+  t56 = t48 + t52;
+  t57 = t49 + t53;
+  t58 = t50 + t55;
+  t59 = t51 - t54;
+  t60 = t48 - t52;
+  t61 = t49 - t53;
+  t62 = t50 - t55;
+  t63 = t51 + t54;
+  t64 = t4 + t20;
+  t65 = t5 + t21;
+  t66 = t4 - t20;
+  t67 = t5 - t21;
+  t68 = t12 + t28;
+  t69 = t13 + t29;
+  t70 = t12 - t28;
+  t71 = t13 - t29;
+  t72 = t64 + t68;
+  t73 = t65 + t69;
+  t74 = t66 + t71;
+  t75 = t67 - t70;
+  t76 = t64 - t68;
+  t77 = t65 - t69;
+  t78 = t66 - t71;
+  t79 = t67 + t70;
+  t80 = t6 + t22;
+  t81 = t7 + t23;
+  t82 = t6 - t22;
+  t83 = t7 - t23;
+  t84 = t14 + t30;
+  t85 = t15 + t31;
+  t86 = t14 - t30;
+  t87 = t15 - t31;
+  t88 = t80 + t84;
+  t89 = t81 + t85;
+  t90 = t82 + t87;
+  t91 = t83 - t86;
+  t92 = t80 - t84;
+  t93 = t81 - t85;
+  t94 = t82 - t87;
+  t95 = t83 + t86;
+  t96 = t40 + t72;
+  t97 = t41 + t73;
+  t98 = t40 - t72;
+  t99 = t41 - t73;
+  t100 = t56 + t88;
+  t101 = t57 + t89;
+  t102 = t56 - t88;
+  t103 = t57 - t89;
+  t104 = t96 + t100;
+  t105 = t97 + t101;
+  t106 = t98 + t103;
+  t107 = t99 - t102;
+  t108 = t96 - t100;
+  t109 = t97 - t101;
+  t110 = t98 - t103;
+  t111 = t99 + t102;
+  t112 = t58 * 9.238795325e-01f + t59 * 3.826834324e-01f;
+  t113 = t59 * 9.238795325e-01f - t58 * 3.826834324e-01f;
+  t114 = (t74 + t75) * 7.071067812e-01f;
+  t115 = (t75 - t74) * 7.071067812e-01f;
+  t116 = t90 * 3.826834324e-01f + t91 * 9.238795325e-01f;
+  t117 = t91 * 3.826834324e-01f - t90 * 9.238795325e-01f;
+  t118 = t42 + t114;
+  t119 = t43 + t115;
+  t120 = t42 - t114;
+  t121 = t43 - t115;
+  t122 = t112 + t116;
+  t123 = t113 + t117;
+  t124 = t112 - t116;
+  t125 = t113 - t117;
+  t126 = t118 + t122;
+  t127 = t119 + t123;
+  t128 = t120 + t125;
+  t129 = t121 - t124;
+  t130 = t118 - t122;
+  t131 = t119 - t123;
+  t132 = t120 - t125;
+  t133 = t121 + t124;
+  t134 = (t60 + t61) * 7.071067812e-01f;
+  t135 = (t61 - t60) * 7.071067812e-01f;
+  t136 = (t93 - t92) * 7.071067812e-01f;
+  t137 = (t92 + t93) * 7.071067812e-01f;
+  t138 = t44 + t77;
+  t139 = t45 - t76;
+  t140 = t44 - t77;
+  t141 = t45 + t76;
+  t142 = t134 + t136;
+  t143 = t135 - t137;
+  t144 = t134 - t136;
+  t145 = t135 + t137;
+  t146 = t138 + t142;
+  t147 = t139 + t143;
+  t148 = t140 + t145;
+  t149 = t141 - t144;
+  t150 = t138 - t142;
+  t151 = t139 - t143;
+  t152 = t140 - t145;
+  t153 = t141 + t144;
+  t154 = t62 * 3.826834324e-01f + t63 * 9.238795325e-01f;
+  t155 = t63 * 3.826834324e-01f - t62 * 9.238795325e-01f;
+  t156 = (t79 - t78) * 7.071067812e-01f;
+  t157 = (t78 + t79) * 7.071067812e-01f;
+  t158 = t94 * 9.238795325e-01f + t95 * 3.826834324e-01f;
+  t159 = t94 * 3.826834324e-01f - t95 * 9.238795325e-01f;
+  t160 = t46 + t156;
+  t161 = t47 - t157;
+  t162 = t46 - t156;
+  t163 = t47 + t157;
+  t164 = t154 - t158;
+  t165 = t155 + t159;
+  t166 = t154 + t158;
+  t167 = t155 - t159;
+  t168 = t160 + t164;
+  t169 = t161 + t165;
+  t170 = t162 + t167;
+  t171 = t163 - t166;
+  t172 = t160 - t164;
+  t173 = t161 - t165;
+  t174 = t162 - t167;
+  t175 = t163 + t166;
+  p[0] = t104;
+  p[1] = t105;
+  p[2] = t126;
+  p[3] = t127;
+  p[4] = t146;
+  p[5] = t147;
+  p[6] = t168;
+  p[7] = t169;
+  p[8] = t106;
+  p[9] = t107;
+  p[10] = t128;
+  p[11] = t129;
+  p[12] = t148;
+  p[13] = t149;
+  p[14] = t170;
+  p[15] = t171;
+  p[16] = t108;
+  p[17] = t109;
+  p[18] = t130;
+  p[19] = t131;
+  p[20] = t150;
+  p[21] = t151;
+  p[22] = t172;
+  p[23] = t173;
+  p[24] = t110;
+  p[25] = t111;
+  p[26] = t132;
+  p[27] = t133;
+  p[28] = t152;
+  p[29] = t153;
+  p[30] = t174;
+  p[31] = t175;
+}
+
+/**   
+ * @brief  32-point forward complex FFT codelet.   
+ * @param[in, out] *p  points to the 32 complex values, in place.   
+ * @return none.   
+ */
+
+static void arm_cfft_codelet_32_f32(
+  float32_t * p)
+{
+  float32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11;
+  float32_t t12, t13, t14, t15, t16, t17, t18, t19, t20, t21, t22, t23;
+  float32_t t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35;
+  float32_t t36, t37, t38, t39, t40, t41, t42, t43, t44, t45, t46, t47;
+  float32_t t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  float32_t t60, t61, t62, t63, t64, t65, t66, t67, t68, t69, t70, t71;
+  float32_t t72, t73, t74, t75, t76, t77, t78, t79, t80, t81, t82, t83;
+  float32_t t84, t85, t86, t87, t88, t89, t90, t91, t92, t93, t94, t95;
+  float32_t t96, t97, t98, t99, t100, t101, t102, t103, t104, t105, t106, t107;
+  float32_t t108, t109, t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+  float32_t t120, t121, t122, t123, t124, t125, t126, t127, t128, t129, t130, t131;
+  float32_t t132, t133, t134, t135, t136, t137, t138, t139, t140, t141, t142, t143;
+  float32_t t144, t145, t146, t147, t148, t149, t150, t151, t152, t153, t154, t155;
+  float32_t t156, t157, t158, t159, t160, t161, t162, t163, t164, t165, t166, t167;
+  float32_t t168, t169, t170, t171, t172, t173, t174, t175, t176, t177, t178, t179;
+  float32_t t180, t181, t182, t183, t184, t185, t186, t187, t188, t189, t190, t191;
+  float32_t t192, t193, t194, t195, t196, t197, t198, t199, t200, t201, t202, t203;
+  float32_t t204, t205, t206, t207, t208, t209, t210, t211, t212, t213, t214, t215;
+  float32_t t216, t217, t218, t219, t220, t221, t222, t223, t224, t225, t226, t227;
+  float32_t t228, t229, t230, t231, t232, t233, t234, t235, t236, t237, t238, t239;
+  float32_t t240, t241, t242, t243, t244, t245, t246, t247, t248, t249, t250, t251;
+  float32_t t252, t253, t254, t255, t256, t257, t258, t259, t260, t261, t262, t263;
+  float32_t t264, t265, t266, t267, t268, t269, t270, t271, t272, t273, t274, t275;
+  float32_t t276, t277, t278, t279, t280, t281, t282, t283, t284, t285, t286, t287;
+  float32_t t288, t289, t290, t291, t292, t293, t294, t295, t296, t297, t298, t299;
+  float32_t t300, t301, t302, t303, t304, t305, t306, t307, t308, t309, t310, t311;
+  float32_t t312, t313, t314, t315, t316, t317, t318, t319, t320, t321, t322, t323;
+  float32_t t324, t325, t326, t327, t328, t329, t330, t331, t332, t333, t334, t335;
+  float32_t t336, t337, t338, t339, t340, t341, t342, t343, t344, t345, t346, t347;
+  float32_t t348, t349, t350, t351, t352, t353, t354, t355, t356, t357, t358, t359;
+  float32_t t360, t361, t362, t363, t364, t365, t366, t367, t368, t369, t370, t371;
+  float32_t t372, t373, t374, t375, t376, t377, t378, t379, t380, t381, t382, t383;
+  float32_t t384, t385, t386, t387, t388, t389, t390, t391, t392, t393, t394, t395;
+  float32_t t396, t397, t398, t399, t400, t401, t402, t403, t404, t405, t406, t407;
+  float32_t t408, t409, t410, t411, t412, t413, t414, t415, t416, t417, t418, t419;
+  float32_t t420, t421, t422, t423, t424, t425, t426, t427, t428, t429, t430, t431;
+  float32_t t432, t433, t434, t435, t436, t437, t438, t439;
+
+  t0 = p[0];
+  t1 = p[1];
+  t2 = p[2];
+  t3 = p[3];
+  t4 = p[4];
+  t5 = p[5];
+  t6 = p[6];
+  t7 = p[7];
+  t8 = p[8];
+  t9 = p[9];
+  t10 = p[10];
+  t11 = p[11];
+  t12 = p[12];
+  t13 = p[13];
+  t14 = p[14];
+  t15 = p[15];
+  t16 = p[16];
+  t17 = p[17];
+  t18 = p[18];
+  t19 = p[19];
+  t20 = p[20];
+  t21 = p[21];
+  t22 = p[22];
+  t23 = p[23];
+  t24 = p[24];
+  t25 = p[25];
+  t26 = p[26];
+  t27 = p[27];
+  t28 = p[28];
+  t29 = p[29];
+  t30 = p[30];
+  t31 = p[31];
+  t32 = p[32];
+  t33 = p[33];
+  t34 = p[34];
+  t35 = p[35];
+  t36 = p[36];
+  t37 = p[37];
+  t38 = p[38];
+  t39 = p[39];
+  t40 = p[40];
+  t41 = p[41];
+  t42 = p[42];
+  t43 = p[43];
+  t44 = p[44];
+  t45 = p[45];
+  t46 = p[46];
+  t47 = p[47];
+  t48 = p[48];
+  t49 = p[49];
+  t50 = p[50];
+  t51 = p[51];
+  t52 = p[52];
+  t53 = p[53];
+  t54 = p[54];
+  t55 = p[55];
+  t56 = p[56];
+  t57 = p[57];
+  t58 = p[58];
+  t59 = p[59];
+  t60 = p[60];
+  t61 = p[61];
+  t62 = p[62];
+  t63 = p[63];
+  t64 = t0 + t32;
+  t65 = t1 + t33;
+  t66 = t0 - t32;
+  t67 = t1 - t33;
+  t68 = t8 + t40;
+  t69 = t9 + t41;
+  t70 = t8 - t40;
+  t71 = t9 - t41;
+  t72 = t16 + t48;
+  t73 = t17 + t49;
+  t74 = t16 - t48;
+  t75 = t17 - t49;
+  t76 = t24 + t56;
+  t77 = t25 + t57;
+  t78 = t24 - t56;
+  t79 = t25 - t57;
+  t80 = t64 + t72;
+  t81 = t65 + t73;
+  t82 = t64 - t72;
+  t83 = t65 - t73;
+  t84 = t68 + t76;
+  t85 = t69 + t77;
+  t86 = t68 - t76;
+  t87 = t69 - t77;
+  t88 = t80 + t84;
+  t89 = t81 + t85;
+  t90 = t82 + t87;
+  t91 = t83 - t86;
+  t92 = t80 - t84;
+  t93 = t81 - t85;
+  t94 = t82 - t87;
+  t95 = t83 + t86;
+  t96 = (t70 + t71) * 7.071067812e-01f;
+  t97 = (t71 - t70) * 7.071067812e-01f;
+  t98 = (t79 - t78) * 7.071067812e-01f;
+  t99 = (t78 + t79) * 7.071067812e-01f;
+  t100 = t66 + t75;
+  t101 = t67 - t74;
+  t102 = t66 - t75;
+  t103 = t67 + t74;
+  t104 = t96 + t98;
+  t105 = t97 - t99;
+  t106 = t96 - t98;
+  t107 = t97 + t99;
+  t108 = t100 + t104;
+  t109 = t101 + t105;
+  t110 = t102 + t107;
+  t111 = t103 - t106;
+  t112 = t100 - t104;
+  t113 = t101 - t105;
+  t114 = t102 - t107;
+  t115 = t103 + t106;
+  t116 = t2 + t34;
+  t117 = t3 + t35;
+  t118 = t2 - t34;
+  t119 = t3 - t35;
+  t120 = t10 + t42;
+  t121 = t11 + t43;
+  t122 = t10 - t42;
+  t123 = t11 - t43;
+  t124 = t18 + t50;
+  t125 = t19 + t51;
+  t126 = t18 - t50;
+  t127 = t19 - t51;
+  t128 = t26 + t58;
+  t129 = t27 + t59;
+  t130 = t26 - t58;
+  t131 = t27 - t59;
+  t132 = t116 + t124;
+  t133 = t117 + t125;
+  t134 = t116 - t124;
+  t135 = t117 - t125;
+  t136 = t120 + t128;
+  t137 = t121 + t129;
+  t138 = t120 - t128;
+  t139 = t121 - t129;
+  t140 = t132 + t136;
+  t141 = t133 + t137;
+  t142 = t134 + t139;
+  t143 = t135 - t138;
+  t144 = t132 - t136;
+  t145 = t133 - t137;
+  t146 = t134 - t139;
+  t147 = t135 + t138;
+  t148 = (t122 + t123) * 7.071067812e-01f;
+  t149 = (t123 - t122) * 7.071067812e-01f;
+  t150 = (t131 - t130) * 7.071067812e-01f;
+  t151 = (t130 + t131) * 7.071067812e-01f;
+  t152 = t118 + t127;
+  t153 = t119 - t126;
+  t154 = t118 - t127;
+  t155 = t119 + t126;
+  t156 = t148 + t150;
+  t157 = t149 - t151;
+  t158 = t148 - t150;
+  t159 = t149 + t151;
+  t160 = t152 + t156;
+  t161 = t153 + t157;
+  t162 = t154 + t159;
+  t163 = t155 - t158;
+  t164 = t152 - t156;
+  t165 = t153 - t157;
+  t166 = t154 - t159;
+  t167 = t155 + t158;
+  t168 = t4 + t36;
+  t169 = t5 + t37;
+  t170 = t4 - t36;
+  t171 = t5 - t37;
+  t172 = t12 + t44;
+  t173 = t13 + t45;
+  t174 = t12 - t44;
+  t175 = t13 - t45;
+  t176 = t20 + t52;
+  t177 = t21 + t53;
+  t178 = t20 - t52;
+  t179 = t21 - t53;
+  t180 = t28 + t60;
+  t181 = t29 + t61;
+  t182 = t28 - t60;
+  t183 = t29 - t61;
+  t184 = t168 + t176;
+  t185 = t169 + t177;
+  t186 = t168 - t176;
+  t187 = t169 - t177;
+  t188 = t172 + t180;
+  t189 = t173 + t181;
+  t190 = t172 - t180;
+  t191 = t173 - t181;
+  t192 = t184 + t188;
+  t193 = t185 + t189;
+  t194 = t186 + t191;
+  t195 = t187 - t190;
+  t196 = t184 - t188;
+  t197 = t185 - t189;
+  t198 = t186 - t191;
+  t199 = t187 + t190;
+  t200 = (t174 + t175) * 7.071067812e-01f;
+  t201 = (t175 - t174) * 7.071067812e-01f;
+  t202 = (t183 - t182) * 7.071067812e-01f;
+  t203 = (t182 + t183) * 7.071067812e-01f;
+  t204 = t170 + t179;
+  t205 = t171 - t178;
+  t206 = t170 - t179;
+  t207 = t171 + t178;
+  t208 = t200 + t202;
+  t209 = t201 - t203;
+  t210 = t200 - t202;
+  t211 = t201 + t203;
+  t212 = t204 + t208;
+  t213 = t205 + t209;
+  t214 = t206 + t211;
+  t215 = t207 - t210;
+  t216 = t204 - t208;
+  t217 = t205 - t209;
+  t218 = t206 - t211;
+  t219 = t207 + t210;
+  t220 = t6 + t38;
+  t221 = t7 + t39;
+  t222 = t6 - t38;
+  t223 = t7 - t39;
+  t224 = t14 + t46;
+  t225 = t15 + t47;
+  t226 = t14 - t46;
+  t227 = t15 - t47;
+  t228 = t22 + t54;
+  t229 = t23 + t55;
+  t230 = t22 - t54;
+  t231 = t23 - t55;
+  t232 = t30 + t62;
+  t233 = t31 + t63;
+  t234 = t30 - t62;
+  t235 = t31 - t63;
+  t236 = t220 + t228;
+  t237 = t221 + t229;
+  t238 = t220 - t228;
+  t239 = t221 - t229;
+  t240 = t224 + t232;
+  t241 = t225 + t233;
+  t242 = t224 - t232;
+  t243 = t225 - t233;
+  t244 = t236 + t240;
+  t245 = t237 + t241;
+  t246 = t238 + t243;
+  t247 = t239 - t242;
+  t248 = t236 - t240;
+  t249 = t237 - t241;
+  t250 = t238 - t243;
+  t251 = t239 + t242;
+  t252 = (t226 + t227) * 7.071067812e-01f;
+  t253 = (t227 - t226) * 7.071067812e-01f;
+  t254 = (t235 - t234) * 7.071067812e-01f;
+  t255 = (t234 + t235) * 7.071067812e-01f;
+  t256 = t222 + t231;
+  t257 = t223 - t230;
+  t258 = t222 - t231;
+  t259 = t223 + t230;
+  t260 = t252 + t254;
+  t261 = t253 - t255;
+  t262 = t252 - t254;
+  t263 = t253 + t255;
+  t264 = t256 + t260;
+  t265 = t257 + t261;
+  t266 = t258 + t263;
+  t267 = t259 - t262;
+  t268 = t256 - t260;
+  t269 = t257 - t261;
+  t270 = t258 - t263;
+  t271 = t259 + t262;
+  t272 = t88 + t192;
+  t273 = t89 + t193;
+  t274 = t88 - t192;
+  t275 = t89 - t193;
+  t276 = t140 + t244;
+  t277 = t141 + t245;
+  t278 = t140 - t244;
+  t279 = t141 - t245;
+  t280 = t272 + t276;
+  t281 = t273 + t277;
+  t282 = t274 + t279;
+  t283 = t275 - t278;
+  t284 = t272 - t276;
+  t285 = t273 - t277;
+  t286 = t274 - t279;
+  t287 = t275 + t278;
+  t288 = t160 * 9.807852804e-01f + t161 * 1.950903220e-01f;
+  t289 = t161 * 9.807852804e-01f - t160 * 1.950903220e-01f;
+  t290 = t212 * 9.238795325e-01f + t213 * 3.826834324e-01f;
+  t291 = t213 * 9.238795325e-01f - t212 * 3.826834324e-01f;
+  t292 = t264 * 8.314696123e-01f + t265 * 5.555702330e-01f;
+  t293 = t265 * 8.314696123e-01f - t264 * 5.555702330e-01f;
+  t294 = t108 + t290;
+  t295 = t109 + t291;
+  t296 = t108 - t290;
+  t297 = t109 - t291;
+  t298 = t288 + t292;
+  t299 = t289 + t293;
+  t300 = t288 - t292;
+  t301 = t289 - t293;
+  t302 = t294 + t298;
+  t303 = t295 + t299;
+  t304 = t296 + t301;
+  t305 = t297 - t300;
+  t306 = t294 - t298;
+  t307 = t295 - t299;
+  t308 = t296 - t301;
+  t309 = t297 + t300;
+  t310 = t142 * 9.238795325e-01f + t143 * 3.826834324e-01f;
+  t311 = t143 * 9.238795325e-01f - t142 * 3.826834324e-01f;
+  t312 = (t194 + t195) * 7.071067812e-01f;
+  t313 = (t195 - t194) * 7.071067812e-01f;
+  t314 = t246 * 3.826834324e-01f + t247 * 9.238795325e-01f;
+  t315 = t247 * 3.826834324e-01f - t246 * 9.238795325e-01f;
+  t316 = t90 + t312;
+  t317 = t91 + t313;
+  t318 = t90 - t312;
+  t319 = t91 - t313;
+  t320 = t310 + t314;
+  t321 = t311 + t315;
+  t322 = t310 - t314;
+  t323 = t311 - t315;
+  t324 = t316 + t320;
+  t325 = t317 + t321;
+  t326 = t318 + t323;
+  t327 = t319 - t322;
+  t328 = t316 - t320;
+  t329 = t317 - t321;
+  t330 = t318 - t323;
+  t331 = t319 + t322;
+  t332 = t162 * 8.314696123e-01f + t163 * 5.555702330e-01f;
+  t333 = t163 * 8.314696123e-01f - t162 * 5.555702330e-01f;
+  t334 = t214 * 3.826834324e-01f + t215 * 9.238795325e-01f;
+  t335 = t215 * 3.826834324e-01f - t214 * 9.238795325e-01f;
+  t336 = t267 * 9.807852804e-01f - t266 * 1.950903220e-01f;
+  t337 = t266 * 9.807852804e-01f + t267 * 1.950903220e-01f;
+  t338 = t110 + t334;
+  t339 = t111 + t335;
+  t340 = t110 - t334;
+  t341 = t111 - t335;
+  t342 = t332 + t336;
+  t343 = t333 - t337;
+  t344 = t332 - t336;
+  t345 = t333 + t337;
+  t346 = t338 + t342;
+  t347 = t339 + t343;
+  t348 = t340 + t345;
+  t349 = t341 - t344;
+  t350 = t338 - t342;
+  t351 = t339 - t343;
+  t352 = t340 - t345;
+  t353 = t341 + t344;
+  t354 = (t144 + t145) * 7.071067812e-01f;
+  t355 = (t145 - t144) * 7.071067812e-01f;
+  t356 = (t249 - t248) * 7.071067812e-01f;
+  t357 = (t248 + t249) * 7.071067812e-01f;
+  t358 = t92 + t197;
+  t359 = t93 - t196;
+  t360 = t92 - t197;
+  t361 = t93 + t196;
+  t362 = t354 + t356;
+  t363 = t355 - t357;
+  t364 = t354 - t356;
+  t365 = t355 + t357;
+  t366 = t358 + t362;
+  t367 = t359 + t363;
+  t368 = t360 + t365;
+  t369 = t361 - t364;
+  t370 = t358 - t362;
+  t371 = t359 - t363;
+  t372 = t360 - t365;
+  t373 = t361 + t364;
+  t374 = t164 * 5.555702330e-01f + t165 * 8.314696123e-01f;
+  t375 = t165 * 5.555702330e-01f - t164 * 8.314696123e-01f;
+  t376 = t217 * 9.238795325e-01f - t216 * 3.826834324e-01f;
+  t377 = t216 * 9.238795325e-01f + t217 * 3.826834324e-01f;
+  t378 = t269 * 1.950903220e-01f - t268 * 9.807852804e-01f;
+  t379 = t268 * 1.950903220e-01f + t269 * 9.807852804e-01f;
+  t380 = t112 + t376;
+  t381 = t113 - t377;
+  t382 = t112 - t376;
+  t383 = t113 + t377;
+  t384 = t374 + t378;
+  t385 = t375 - t379;
+  t386 = t374 - t378;
+  t387 = t375 + t379;
+  t388 = t380 + t384;
+  t389 = t381 + t385;
+  t390 = t382 + t387;
+  t391 = t383 - t386;
+  t392 = t380 - t384;
+  t393 = t381 - t385;
+  t394 = t382 - t387;
+  t395 = t383 + t386;
+  t396 = t146 * 3.826834324e-01f + t147 * 9.238795325e-01f;
+  t397 = t147 * 3.826834324e-01f - t146 * 9.238795325e-01f;
+  t398 = (t199 - t198) * 7.071067812e-01f;
+  t399 = (t198 + t199) * 7.071067812e-01f;
+  t400 = t250 * 9.238795325e-01f + t251 * 3.826834324e-01f;
+  t401 = t250 * 3.826834324e-01f - t251 * 9.238795325e-01f;
+  t402 = t94 + t398;
+  t403 = t95 - t399;
+  t404 = t94 - t398;
+  t405 = t95 + t399;
+  t406 = t396 - t400;
+  t407 = t397 + t401;
+  t408 = t396 + t400;
+  t409 = t397 - t401;
+  t410 = t402 + t406;
+  t411 = t403 + t407;
+  t412 = t404 + t409;
+  t413 = t405 - t408;
+  t414 = t402 - t406;
+  t415 = t403 - t407;
+  t416 = t404 - t409;
+  t417 = t405 + t408;
+  t418 = t166 * 1.950903220e-01f + t167 * 9.807852804e-01f;
+  t419 = t167 * 1.950903220e-01f - t166 * 9.807852804e-01f;
+  t420 = t219 * 3.826834324e-01f - t218 * 9.238795325e-01f;
+  t421 = t218 * 3.826834324e-01f + t219 * 9.238795325e-01f;
+  t422 = t270 * 5.555702330e-01f + t271 * 8.314696123e-01f;
+  t423 = t270 * 8.314696123e-01f - t271 * 5.555702330e-01f;
+  t424 = t114 + t420;
+  t425 = t115 - t421;
+  t426 = t114 - t420;
+  t427 = t115 + t421;
+  t428 = t418 - t422;
+  t429 = t419 + t423;
+  t430 = t418 + t422;
+  t431 = t419 - t423;
+  t432 = t424 + t428;
+  t433 = t425 + t429;
+  t434 = t426 + t431;
+  t435 = t427 - t430;
+  t436 = t424 - t428;
+  t437 = t425 - t429;
+  t438 = t426 - t431;
+  t439 = t427 + t430;
+  p[0] = t280;
+  p[1] = t281;
+  p[2] = t302;
+  p[3] = t303;
+  p[4] = t324;
+  p[5] = t325;
+  p[6] = t346;
+  p[7] = t347;
+  p[8] = t366;
+  p[9] = t367;
+  p[10] = t388;
+  p[11] = t389;
+  p[12] = t410;
+  p[13] = t411;
+  p[14] = t432;
+  p[15] = t433;
+  p[16] = t282;
+  p[17] = t283;
+  p[18] = t304;
+  p[19] = t305;
+  p[20] = t326;
+  p[21] = t327;
+  p[22] = t348;
+  p[23] = t349;
+  p[24] = t368;
+  p[25] = t369;
+  p[26] = t390;
+  p[27] = t391;
+  p[28] = t412;
+  p[29] = t413;
+  p[30] = t434;
+  p[31] = t435;
+  p[32] = t284;
+  p[33] = t285;
+  p[34] = t306;
+  p[35] = t307;
+  p[36] = t328;
+  p[37] = t329;
+  p[38] = t350;
+  p[39] = t351;
+  p[40] = t370;
+  p[41] = t371;
+  p[42] = t392;
+  p[43] = t393;
+  p[44] = t414;
+  p[45] = t415;
+  p[46] = t436;
+  p[47] = t437;
+  p[48] = t286;
+  p[49] = t287;
+  p[50] = t308;
+  p[51] = t309;
+  p[52] = t330;
+  p[53] = t331;
+  p[54] = t352;
+  p[55] = t353;
+  p[56] = t372;
+  p[57] = t373;
+  p[58] = t394;
+  p[59] = t395;
+  p[60] = t416;
+  p[61] = t417;
+  p[62] = t438;
+  p[63] = t439;
+}
+
+/**   
+ * @brief  64-point forward complex FFT codelet.   
+ * @param[in, out] *p  points to the 64 complex values, in place.   
+ * @return none.   
+ */
+
+static void arm_cfft_codelet_64_f32(
+  float32_t * p)
+{
+  float32_t buf[128];                          /* Output of the radix-4 passes */
+  float32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11;
+  float32_t t12, t13, t14, t15, t16, t17, t18, t19, t20, t21, t22, t23;
+  float32_t t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35;
+  float32_t t36, t37, t38, t39, t40, t41, t42, t43, t44, t45, t46, t47;
+  float32_t t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  float32_t t60, t61, t62, t63, t64, t65, t66, t67, t68, t69, t70, t71;
+  float32_t t72, t73, t74, t75, t76, t77, t78, t79, t80, t81, t82, t83;
+  float32_t t84, t85, t86, t87, t88, t89, t90, t91, t92, t93, t94, t95;
+  float32_t t96, t97, t98, t99, t100, t101, t102, t103, t104, t105, t106, t107;
+  float32_t t108, t109, t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+  float32_t t120, t121, t122, t123, t124, t125, t126, t127, t128, t129, t130, t131;
+  float32_t t132, t133, t134, t135, t136, t137, t138, t139, t140, t141, t142, t143;
+  float32_t t144, t145, t146, t147, t148, t149, t150, t151, t152, t153, t154, t155;
+  float32_t t156, t157, t158, t159, t160, t161, t162, t163, t164, t165, t166, t167;
+  float32_t t168, t169, t170, t171, t172, t173, t174, t175, t176, t177, t178, t179;
+  float32_t t180, t181, t182, t183, t184, t185, t186, t187, t188, t189, t190, t191;
+  float32_t t192, t193, t194, t195, t196, t197, t198, t199, t200, t201, t202, t203;
+  float32_t t204, t205, t206, t207, t208, t209, t210, t211, t212, t213, t214, t215;
+  float32_t t216, t217, t218, t219, t220, t221, t222, t223, t224, t225, t226, t227;
+  float32_t t228, t229, t230, t231, t232, t233, t234, t235, t236, t237, t238, t239;
+  float32_t t240, t241, t242, t243, t244, t245, t246, t247, t248, t249, t250, t251;
+  float32_t t252, t253, t254, t255, t256, t257, t258, t259, t260, t261, t262, t263;
+  float32_t t264, t265, t266, t267, t268, t269, t270, t271, t272, t273, t274, t275;
+  float32_t t276, t277, t278, t279, t280, t281, t282, t283, t284, t285, t286, t287;
+  float32_t t288, t289, t290, t291, t292, t293, t294, t295, t296, t297, t298, t299;
+  float32_t t300, t301, t302, t303, t304, t305, t306, t307, t308, t309, t310, t311;
+  float32_t t312, t313, t314, t315, t316, t317, t318, t319, t320, t321, t322, t323;
+  float32_t t324, t325, t326, t327, t328, t329, t330, t331, t332, t333, t334, t335;
+  float32_t t336, t337, t338, t339, t340, t341, t342, t343, t344, t345, t346, t347;
+  float32_t t348, t349, t350, t351, t352, t353, t354, t355, t356, t357, t358, t359;
+  float32_t t360, t361, t362, t363, t364, t365, t366, t367, t368, t369, t370, t371;
+  float32_t t372, t373, t374, t375, t376, t377, t378, t379, t380, t381, t382, t383;
+  float32_t t384, t385, t386, t387, t388, t389, t390, t391, t392, t393, t394, t395;
+  float32_t t396, t397, t398, t399, t400, t401, t402, t403, t404, t405, t406, t407;
+  float32_t t408, t409, t410, t411, t412, t413, t414, t415, t416, t417, t418, t419;
+  float32_t t420, t421, t422, t423, t424, t425, t426, t427, t428, t429, t430, t431;
+  float32_t t432, t433, t434, t435, t436, t437, t438, t439, t440, t441, t442, t443;
+  float32_t t444, t445, t446, t447, t448, t449, t450, t451, t452, t453, t454, t455;
+  float32_t t456, t457, t458, t459, t460, t461, t462, t463, t464, t465, t466, t467;
+  float32_t t468, t469, t470, t471, t472, t473, t474, t475, t476, t477, t478, t479;
+  float32_t t480, t481, t482, t483, t484, t485, t486, t487, t488, t489, t490, t491;
+  float32_t t492, t493, t494, t495, t496, t497, t498, t499, t500, t501, t502, t503;
+  float32_t t504, t505, t506, t507, t508, t509, t510, t511, t512, t513, t514, t515;
+  float32_t t516, t517, t518, t519, t520, t521, t522, t523, t524, t525, t526, t527;
+  float32_t t528, t529, t530, t531, t532, t533, t534, t535, t536, t537, t538, t539;
+  float32_t t540, t541, t542, t543, t544, t545, t546, t547, t548, t549, t550, t551;
+  float32_t t552, t553, t554, t555, t556, t557, t558, t559, t560, t561, t562, t563;
+  float32_t t564, t565, t566, t567, t568, t569, t570, t571, t572, t573, t574, t575;
+  float32_t t576, t577, t578, t579, t580, t581, t582, t583, t584, t585, t586, t587;
+  float32_t t588, t589, t590, t591, t592, t593, t594, t595, t596, t597, t598, t599;
+  float32_t t600, t601, t602, t603, t604, t605, t606, t607, t608, t609, t610, t611;
+  float32_t t612, t613, t614, t615, t616, t617, t618, t619, t620, t621, t622, t623;
+  float32_t t624, t625, t626, t627, t628, t629, t630, t631, t632, t633, t634, t635;
+  float32_t t636, t637, t638, t639, t640, t641, t642, t643, t644, t645, t646, t647;
+  float32_t t648, t649, t650, t651, t652, t653, t654, t655, t656, t657, t658, t659;
+  float32_t t660, t661, t662, t663, t664, t665, t666, t667, t668, t669, t670, t671;
+  float32_t t672, t673, t674, t675, t676, t677, t678, t679, t680, t681, t682, t683;
+  float32_t t684, t685, t686, t687, t688, t689, t690, t691, t692, t693, t694, t695;
+  float32_t t696, t697, t698, t699, t700, t701, t702, t703, t704, t705, t706, t707;
+  float32_t t708, t709, t710, t711, t712, t713, t714, t715, t716, t717, t718, t719;
+  float32_t t720, t721, t722, t723, t724, t725, t726, t727, t728, t729, t730, t731;
+  float32_t t732, t733, t734, t735, t736, t737, t738, t739, t740, t741, t742, t743;
+  float32_t t744, t745, t746, t747, t748, t749, t750, t751, t752, t753, t754, t755;
+  float32_t t756, t757, t758, t759, t760, t761, t762, t763, t764, t765, t766, t767;
+  float32_t t768, t769, t770, t771, t772, t773, t774, t775, t776, t777, t778, t779;
+  float32_t t780, t781, t782, t783, t784, t785, t786, t787, t788, t789, t790, t791;
+  float32_t t792, t793, t794, t795, t796, t797, t798, t799, t800, t801, t802, t803;
+  float32_t t804, t805, t806, t807, t808, t809, t810, t811, t812, t813, t814, t815;
+  float32_t t816, t817, t818, t819, t820, t821, t822, t823, t824, t825, t826, t827;
+  float32_t t828, t829, t830, t831, t832, t833, t834, t835, t836, t837, t838, t839;
+  float32_t t840, t841, t842, t843, t844, t845, t846, t847, t848, t849, t850, t851;
+  float32_t t852, t853, t854, t855, t856, t857, t858, t859, t860, t861, t862, t863;
+  float32_t t864, t865, t866, t867, t868, t869, t870, t871, t872, t873, t874, t875;
+  float32_t t876, t877, t878, t879, t880, t881, t882, t883, t884, t885, t886, t887;
+  float32_t t888, t889, t890, t891, t892, t893, t894, t895, t896, t897, t898, t899;
+  float32_t t900, t901, t902, t903, t904, t905, t906, t907, t908, t909, t910, t911;
+  float32_t t912, t913, t914, t915, t916, t917, t918, t919, t920, t921, t922, t923;
+  float32_t t924, t925, t926, t927, t928, t929, t930, t931, t932, t933, t934, t935;
+  float32_t t936, t937, t938, t939, t940, t941, t942, t943, t944, t945, t946, t947;
+  float32_t t948, t949, t950, t951, t952, t953, t954, t955, t956, t957, t958, t959;
+  float32_t t960, t961, t962, t963, t964, t965, t966, t967, t968, t969, t970, t971;
+  float32_t t972, t973, t974, t975, t976, t977, t978, t979, t980, t981, t982, t983;
+  float32_t t984, t985, t986, t987, t988, t989, t990, t991, t992, t993, t994, t995;
+  float32_t t996, t997, t998, t999, t1000, t1001, t1002, t1003, t1004, t1005, t1006, t1007;
+  float32_t t1008, t1009, t1010, t1011, t1012, t1013, t1014, t1015, t1016, t1017, t1018, t1019;
+  float32_t t1020, t1021, t1022, t1023, t1024, t1025, t1026, t1027, t1028, t1029, t1030, t1031;
+  float32_t t1032, t1033, t1034, t1035, t1036, t1037, t1038, t1039, t1040, t1041, t1042, t1043;
+  float32_t t1044, t1045, t1046, t1047, t1048, t1049, t1050, t1051, t1052, t1053, t1054, t1055;
+  float32_t t1056, t1057, t1058, t1059, t1060, t1061, t1062, t1063, t1064, t1065, t1066, t1067;
+  float32_t t1068, t1069, t1070, t1071, t1072, t1073, t1074, t1075, t1076, t1077, t1078, t1079;
+  float32_t t1080, t1081, t1082, t1083, t1084, t1085, t1086, t1087, t1088, t1089, t1090, t1091;
+  float32_t t1092, t1093, t1094, t1095, t1096, t1097, t1098, t1099, t1100, t1101, t1102, t1103;
+  float32_t t1104, t1105, t1106, t1107, t1108, t1109, t1110, t1111, t1112, t1113, t1114, t1115;
+  float32_t t1116, t1117, t1118, t1119, t1120, t1121, t1122, t1123, t1124, t1125, t1126, t1127;
+  float32_t t1128, t1129, t1130, t1131, t1132, t1133, t1134, t1135, t1136, t1137, t1138, t1139;
+  float32_t t1140, t1141, t1142, t1143, t1144, t1145, t1146, t1147, t1148, t1149, t1150, t1151;
+  float32_t t1152, t1153, t1154, t1155, t1156, t1157, t1158, t1159, t1160, t1161, t1162, t1163;
+  float32_t t1164, t1165, t1166, t1167, t1168, t1169, t1170, t1171, t1172, t1173, t1174, t1175;
+
+  t0 = p[0];
+  t1 = p[1];
+  t2 = p[32];
+  t3 = p[33];
+  t4 = p[64];
+  t5 = p[65];
+  t6 = p[96];
+  t7 = p[97];
+  t8 = t0 + t4;
+  t9 = t1 + t5;
+  t10 = t0 - t4;
+  t11 = t1 - t5;
+  t12 = t2 + t6;
+  t13 = t3 + t7;
+  t14 = t2 - t6;
+  t15 = t3 - t7;
+  t16 = t8 + t12;
+  t17 = t9 + t13;
+  t18 = t10 + t15;
+  t19 = t11 - t14;
+  t20 = t8 - t12;
+  t21 = t9 - t13;
+  t22 = t10 - t15;
+  t23 = t11 + t14;
+  buf[0] = t16;
+  buf[1] = t17;
+  buf[32] = t18;
+  buf[33] = t19;
+  buf[64] = t20;
+  buf[65] = t21;
+  buf[96] = t22;
+  buf[97] = t23;
+  t24 = p[2];
+  t25 = p[3];
+  t26 = p[34];
+  t27 = p[35];
+  t28 = p[66];
+  t29 = p[67];
+  t30 = p[98];
+  t31 = p[99];
+  t32 = t24 + t28;
+  t33 = t25 + t29;
+  t34 = t24 - t28;
+  t35 = t25 - t29;
+  t36 = t26 + t30;
+  t37 = t27 + t31;
+  t38 = t26 - t30;
+  t39 = t27 - t31;
+  t40 = t32 + t36;
+  t41 = t33 + t37;
+  t42 = t34 + t39;
+  t43 = t35 - t38;
+  t44 = t32 - t36;
+  t45 = t33 - t37;
+  t46 = t34 - t39;
+  t47 = t35 + t38;
+  buf[2] = t40;
+  buf[3] = t41;
+  t48 = t42 * 9.951847267e-01f + t43 * 9.801714033e-02f;
+  t49 = t43 * 9.951847267e-01f - t42 * 9.801714033e-02f;
+  buf[34] = t48;
+  buf[35] = t49;
+  t50 = t44 * 9.807852804e-01f + t45 * 1.950903220e-01f;
+  t51 = t45 * 9.807852804e-01f - t44 * 1.950903220e-01f;
+  buf[66] = t50;
+  buf[67] = t51;
+  t52 = t46 * 9.569403357e-01f + t47 * 2.902846773e-01f;
+  t53 = t47 * 9.569403357e-01f - t46 * 2.902846773e-01f;
+  buf[98] = t52;
+  buf[99] = t53;
+  t54 = p[4];
+  t55 = p[5];
+  t56 = p[36];
+  t57 = p[37];
+  t58 = p[68];
+  t59 = p[69];
+  t60 = p[100];
+  t61 = p[101];
+  t62 = t54 + t58;
+  t63 = t55 + t59;
+  t64 = t54 - t58;
+  t65 = t55 - t59;
+  t66 = t56 + t60;
+  t67 = t57 + t61;
+  t68 = t56 - t60;
+  t69 = t57 - t61;
+  t70 = t62 + t66;
+  t71 = t63 + t67;
+  t72 = t64 + t69;
+  t73 = t65 - t68;
+  t74 = t62 - t66;
+  t75 = t63 - t67;
+  t76 = t64 - t69;
+  t77 = t65 + t68;
+  buf[4] = t70;
+  buf[5] = t71;
+  t78 = t72 * 9.807852804e-01f + t73 * 1.950903220e-01f;
+  t79 = t73 * 9.807852804e-01f - t72 * 1.950903220e-01f;
+  buf[36] = t78;
+  buf[37] = t79;
+  t80 = t74 * 9.238795325e-01f + t75 * 3.826834324e-01f;
+  t81 = t75 * 9.238795325e-01f - t74 * 3.826834324e-01f;
+  buf[68] = t80;
+  buf[69] = t81;
+  t82 = t76 * 8.314696123e-01f + t77 * 5.555702330e-01f;
+  t83 = t77 * 8.314696123e-01f - t76 * 5.555702330e-01f;
+  buf[100] = t82;
+  buf[101] = t83;
+  t84 = p[6];
+  t85 = p[7];
+  t86 = p[38];
+  t87 = p[39];
+  t88 = p[70];
+  t89 = p[71];
+  t90 = p[102];
+  t91 = p[103];
+  t92 = t84 + t88;
+  t93 = t85 + t89;
+  t94 = t84 - t88;
+  t95 = t85 - t89;
+  t96 = t86 + t90;
+  t97 = t87 + t91;
+  t98 = t86 - t90;
+  t99 = t87 - t91;
+  t100 = t92 + t96;
+  t101 = t93 + t97;
+  t102 = t94 + t99;
+  t103 = t95 - t98;
+  t104 = t92 - t96;
+  t105 = t93 - t97;
+  t106 = t94 - t99;
+  t107 = t95 + t98;
+  buf[6] = t100;
+  buf[7] = t101;
+  t108 = t102 * 9.569403357e-01f + t103 * 2.902846773e-01f;
+  t109 = t103 * 9.569403357e-01f - t102 * 2.902846773e-01f;
+  buf[38] = t108;
+  buf[39] = t109;
+  t110 = t104 * 8.314696123e-01f + t105 * 5.555702330e-01f;
+  t111 = t105 * 8.314696123e-01f - t104 * 5.555702330e-01f;
+  buf[70] = t110;
+  buf[71] = t111;
+  t112 = t106 * 6.343932842e-01f + t107 * 7.730104534e-01f;
+  t113 = t107 * 6.343932842e-01f - t106 * 7.730104534e-01f;
+  buf[102] = t112;
+  buf[103] = t113;
+  t114 = p[8];
+  t115 = p[9];
+  t116 = p[40];
+  t117 = p[41];
+  t118 = p[72];
+  t119 = p[73];
+  t120 = p[104];
+  t121 = p[105];
+  t122 = t114 + t118;
+  t123 = t115 + t119;
+  t124 = t114 - t118;
+  t125 = t115 - t119;
+  t126 = t116 + t120;
+  t127 = t117 + t121;
+  t128 = t116 - t120;
+  t129 = t117 - t121;
+  t130 = t122 + t126;
+  t131 = t123 + t127;
+  t132 = t124 + t129;
+  t133 = t125 - t128;
+  t134 = t122 - t126;
+  t135 = t123 - t127;
+  t136 = t124 - t129;
+  t137 = t125 + t128;
+  buf[8] = t130;
+  buf[9] = t131;
+  t138 = t132 * 9.238795325e-01f + t133 * 3.826834324e-01f;
+  t139 = t133 * 9.238795325e-01f - t132 * 3.826834324e-01f;
+  buf[40] = t138;
+  buf[41] = t139;
+  t140 = (t134 + t135) * 7.071067812e-01f;
+  t141 = (t135 - t134) * 7.071067812e-01f;
+  buf[72] = t140;
+  buf[73] = t141;
+  t142 = t136 * 3.826834324e-01f + t137 * 9.238795325e-01f;
+  t143 = t137 * 3.826834324e-01f - t136 * 9.238795325e-01f;
+  buf[104] = t142;
+  buf[105] = t143;
+  t144 = p[10];
+  t145 = p[11];
+  t146 = p[42];
+  t147 = p[43];
+  t148 = p[74];
+  t149 = p[75];
+  t150 = p[106];
+  t151 = p[107];
+  t152 = t144 + t148;
+  t153 = t145 + t149;
+  t154 = t144 - t148;
+  t155 = t145 - t149;
+  t156 = t146 + t150;
+  t157 = t147 + t151;
+  t158 = t146 - t150;
+  t159 = t147 - t151;
+  t160 = t152 + t156;
+  t161 = t153 + t157;
+  t162 = t154 + t159;
+  t163 = t155 - t158;
+  t164 = t152 - t156;
+  t165 = t153 - t157;
+  t166 = t154 - t159;
+  t167 = t155 + t158;
+  buf[10] = t160;
+  buf[11] = t161;
+  t168 = t162 * 8.819212643e-01f + t163 * 4.713967368e-01f;
+  t169 = t163 * 8.819212643e-01f - t162 * 4.713967368e-01f;
+  buf[42] = t168;
+  buf[43] = t169;
+  t170 = t164 * 5.555702330e-01f + t165 * 8.314696123e-01f;
+  t171 = t165 * 5.555702330e-01f - t164 * 8.314696123e-01f;
+  buf[74] = t170;
+  buf[75] = t171;
+  t172 = t166 * 9.801714033e-02f + t167 * 9.951847267e-01f;
+  t173 = t167 * 9.801714033e-02f - t166 * 9.951847267e-01f;
+  buf[106] = t172;
+  buf[107] = t173;
+  t174 = p[12];
+  t175 = p[13];
+  t176 = p[44];
+  t177 = p[45];
+  t178 = p[76];
+  t179 = p[77];
+  t180 = p[108];
+  t181 = p[109];
+  t182 = t174 + t178;
+  t183 = t175 + t179;
+  t184 = t174 - t178;
+  t185 = t175 - t179;
+  t186 = t176 + t180;
+  t187 = t177 + t181;
+  t188 = t176 - t180;
+  t189 = t177 - t181;
+  t190 = t182 + t186;
+  t191 = t183 + t187;
+  t192 = t184 + t189;
+  t193 = t185 - t188;
+  t194 = t182 - t186;
+  t195 = t183 - t187;
+  t196 = t184 - t189;
+  t197 = t185 + t188;
+  buf[12] = t190;
+  buf[13] = t191;
+  t198 = t192 * 8.314696123e-01f + t193 * 5.555702330e-01f;
+  t199 = t193 * 8.314696123e-01f - t192 * 5.555702330e-01f;
+  buf[44] = t198;
+  buf[45] = t199;
+  t200 = t194 * 3.826834324e-01f + t195 * 9.238795325e-01f;
+  t201 = t195 * 3.826834324e-01f - t194 * 9.238795325e-01f;
+  buf[76] = t200;
+  buf[77] = t201;
+  t202 = t197 * 9.807852804e-01f - t196 * 1.950903220e-01f;
+  t203 = t196 * 9.807852804e-01f + t197 * 1.950903220e-01f;
+  buf[108] = t202;
+  buf[109] = -t203;
+  t204 = p[14];
+  t205 = p[15];
+  t206 = p[46];
+  t207 = p[47];
+  t208 = p[78];
+  t209 = p[79];
+  t210 = p[110];
+  t211 = p[111];
+  t212 = t204 + t208;
+  t213 = t205 + t209;
+  t214 = t204 - t208;
+  t215 = t205 - t209;
+  t216 = t206 + t210;
+  t217 = t207 + t211;
+  t218 = t206 - t210;
+  t219 = t207 - t211;
+  t220 = t212 + t216;
+  t221 = t213 + t217;
+  t222 = t214 + t219;
+  t223 = t215 - t218;
+  t224 = t212 - t216;
+  t225 = t213 - t217;
+  t226 = t214 - t219;
+  t227 = t215 + t218;
+  buf[14] = t220;
+  buf[15] = t221;
+  t228 = t222 * 7.730104534e-01f + t223 * 6.343932842e-01f;
+  t229 = t223 * 7.730104534e-01f - t222 * 6.343932842e-01f;
+  buf[46] = t228;
+  buf[47] = t229;
+  t230 = t224 * 1.950903220e-01f + t225 * 9.807852804e-01f;
+  t231 = t225 * 1.950903220e-01f - t224 * 9.807852804e-01f;
+  buf[78] = t230;
+  buf[79] = t231;
+  t232 = t227 * 8.819212643e-01f - t226 * 4.713967368e-01f;
+  t233 = t226 * 8.819212643e-01f + t227 * 4.713967368e-01f;
+  buf[110] = t232;
+  buf[111] = -t233;
+  t234 = p[16];
+  t235 = p[17];
+  t236 = p[48];
+  t237 = p[49];
+  t238 = p[80];
+  t239 = p[81];
+  t240 = p[112];
+  t241 = p[113];
+  t242 = t234 + t238;
+  t243 = t235 + t239;
+  t244 = t234 - t238;
+  t245 = t235 - t239;
+  t246 = t236 + t240;
+  t247 = t237 + t241;
+  t248 = t236 - t240;
+  t249 = t237 - t241;
+  t250 = t242 + t246;
+  t251 = t243 + t247;
+  t252 = t244 + t249;
+  t253 = t245 - t248;
+  t254 = t242 - t246;
+  t255 = t243 - t247;
+  t256 = t244 - t249;
+  t257 = t245 + t248;
+  buf[16] = t250;
+  buf[17] = t251;
+  t258 = (t252 + t253) * 7.071067812e-01f;
+  t259 = (t253 - t252) * 7.071067812e-01f;
+  buf[48] = t258;
+  buf[49] = t259;
+  buf[80] = t255;
+  buf[81] = -t254;
+  t260 = (t257 - t256) * 7.071067812e-01f;
+  t261 = (t256 + t257) * 7.071067812e-01f;
+  buf[112] = t260;
+  buf[113] = -t261;
+  t262 = p[18];
+  t263 = p[19];
+  t264 = p[50];
+  t265 = p[51];
+  t266 = p[82];
+  t267 = p[83];
+  t268 = p[114];
+  t269 = p[115];
+  t270 = t262 + t266;
+  t271 = t263 + t267;
+  t272 = t262 - t266;
+  t273 = t263 - t267;
+  t274 = t264 + t268;
+  t275 = t265 + t269;
+  t276 = t264 - t268;
+  t277 = t265 - t269;
+  t278 = t270 + t274;
+  t279 = t271 + t275;
+  t280 = t272 + t277;
+  t281 = t273 - t276;
+  t282 = t270 - t274;
+  t283 = t271 - t275;
+  t284 = t272 - t277;
+  t285 = t273 + t276;
+  buf[18] = t278;
+  buf[19] = t279;
+  t286 = t280 * 6.343932842e-01f + t281 * 7.730104534e-01f;
+  t287 = t281 * 6.343932842e-01f - t280 * 7.730104534e-01f;
+  buf[50] = t286;
+  buf[51] = t287;
+  t288 = t283 * 9.807852804e-01f - t282 * 1.950903220e-01f;
+  t289 = t282 * 9.807852804e-01f + t283 * 1.950903220e-01f;
+  buf[82] = t288;
+  buf[83] = -t289;
+  t290 = t285 * 4.713967368e-01f - t284 * 8.819212643e-01f;
+  t291 = t284 * 4.713967368e-01f + t285 * 8.819212643e-01f;
+  buf[114] = t290;
+  buf[115] = -t291;
+  t292 = p[20];
+  t293 = p[21];
+  t294 = p[52];
+  t295 = p[53];
+  t296 = p[84];
+  t297 = p[85];
+  t298 = p[116];
+  t299 = p[117];
+  t300 = t292 + t296;
+  t301 = t293 + t297;
+  t302 = t292 - t296;
+  t303 = t293 - t297;
+  t304 = t294 + t298;
+  t305 = t295 + t299;
+  t306 = t294 - t298;
+  t307 = t295 - t299;
+  t308 = t300 + t304;
+  t309 = t301 + t305;
+  t310 = t302 + t307;
+  t311 = t303 - t306;
+  t312 = t300 - t304;
+  t313 = t301 - t305;
+  t314 = t302 - t307;
+  t315 = t303 + t306;
+  buf[20] = t308;
+  buf[21] = t309;
+  t316 = t310 * 5.555702330e-01f + t311 * 8.314696123e-01f;
+  t317 = t311 * 5.555702330e-01f - t310 * 8.314696123e-01f;
+  buf[52] = t316;
+  buf[53] = t317;
+  t318 = t313 * 9.238795325e-01f - t312 * 3.826834324e-01f;
+  t319 = t312 * 9.238795325e-01f + t313 * 3.826834324e-01f;
+  buf[84] = t318;
+  buf[85] = -t319;
+  t320 = t315 * 1.950903220e-01f - t314 * 9.807852804e-01f;
+  t321 = t314 * 1.950903220e-01f + t315 * 9.807852804e-01f;
+  buf[116] = t320;
+  buf[117] = -t321;
+  t322 = p[22];
+  t323 = p[23];
+  t324 = p[54];
+  t325 = p[55];
+  t326 = p[86];
+  t327 = p[87];
+  t328 = p[118];
+  t329 = p[119];
+  t330 = t322 + t326;
+  t331 = t323 + t327;
+  t332 = t322 - t326;
+  t333 = t323 - t327;
+  t334 = t324 + t328;
+  t335 = t325 + t329;
+  t336 = t324 - t328;
+  t337 = t325 - t329;
+  t338 = t330 + t334;
+  t339 = t331 + t335;
+  t340 = t332 + t337;
+  t341 = t333 - t336;
+  t342 = t330 - t334;
+  t343 = t331 - t335;
+  t344 = t332 - t337;
+  t345 = t333 + t336;
+  buf[22] = t338;
+  buf[23] = t339;
+  t346 = t340 * 4.713967368e-01f + t341 * 8.819212643e-01f;
+  t347 = t341 * 4.713967368e-01f - t340 * 8.819212643e-01f;
+  buf[54] = t346;
+  buf[55] = t347;
+  t348 = t343 * 8.314696123e-01f - t342 * 5.555702330e-01f;
+  t349 = t342 * 8.314696123e-01f + t343 * 5.555702330e-01f;
+  buf[86] = t348;
+  buf[87] = -t349;
+  t350 = t344 * 9.951847267e-01f + t345 * 9.801714033e-02f;
+  t351 = t344 * 9.801714033e-02f - t345 * 9.951847267e-01f;
+  buf[118] = -t350;
+  buf[119] = t351;
+  t352 = p[24];
+  t353 = p[25];
+  t354 = p[56];
+  t355 = p[57];
+  t356 = p[88];
+  t357 = p[89];
+  t358 = p[120];
+  t359 = p[121];
+  t360 = t352 + t356;
+  t361 = t353 + t357;
+  t362 = t352 - t356;
+  t363 = t353 - t357;
+  t364 = t354 + t358;
+  t365 = t355 + t359;
+  t366 = t354 - t358;
+  t367 = t355 - t359;
+  t368 = t360 + t364;
+  t369 = t361 + t365;
+  t370 = t362 + t367;
+  t371 = t363 - t366;
+  t372 = t360 - t364;
+  t373 = t361 - t365;
+  t374 = t362 - t367;
+  t375 = t363 + t366;
+  buf[24] = t368;
+  buf[25] = t369;
+  t376 = t370 * 3.826834324e-01f + t371 * 9.238795325e-01f;
+  t377 = t371 * 3.826834324e-01f - t370 * 9.238795325e-01f;
+  buf[56] = t376;
+  buf[57] = t377;
+  t378 = (t373 - t372) * 7.071067812e-01f;
+  t379 = (t372 + t373) * 7.071067812e-01f;
+  buf[88] = t378;
+  buf[89] = -t379;
+  t380 = t374 * 9.238795325e-01f + t375 * 3.826834324e-01f;
+  t381 = t374 * 3.826834324e-01f - t375 * 9.238795325e-01f;
+  buf[120] = -t380;
+  buf[121] = t381;
+  t382 = p[26];
+  t383 = p[27];
+  t384 = p[58];
+  t385 = p[59];
+  t386 = p[90];
+  t387 = p[91];
+  t388 = p[122];
+  t389 = p[123];
+  t390 = t382 + t386;
+  t391 = t383 + t387;
+  t392 = t382 - t386;
+  t393 = t383 - t387;
+  t394 = t384 + t388;
+  t395 = t385 + t389;
+  t396 = t384 - t388;
+  t397 = t385 - t389;
+  t398 = t390 + t394;
+  t399 = t391 + t395;
+  t400 = t392 + t397;
+  t401 = t393 - t396;
+  t402 = t390 - t394;
+  t403 = t391 - t395;
+  t404 = t392 - t397;
+  t405 = t393 + t396;
+  buf[26] = t398;
+  buf[27] = t399;
+  t406 = t400 * 2.902846773e-01f + t401 * 9.569403357e-01f;
+  t407 = t401 * 2.902846773e-01f - t400 * 9.569403357e-01f;
+  buf[58] = t406;
+  buf[59] = t407;
+  t408 = t403 * 5.555702330e-01f - t402 * 8.314696123e-01f;
+  t409 = t402 * 5.555702330e-01f + t403 * 8.314696123e-01f;
+  buf[90] = t408;
+  buf[91] = -t409;
+  t410 = t404 * 7.730104534e-01f + t405 * 6.343932842e-01f;
+  t411 = t404 * 6.343932842e-01f - t405 * 7.730104534e-01f;
+  buf[122] = -t410;
+  buf[123] = t411;
+  t412 = p[28];
+  t413 = p[29];
+  t414 = p[60];
+  t415 = p[61];
+  t416 = p[92];
+  t417 = p[93];
+  t418 = p[124];
+  t419 = p[125];
+  t420 = t412 + t416;
+  t421 = t413 + t417;
+  t422 = t412 - t416;
+  t423 = t413 - t417;
+  t424 = t414 + t418;
+  t425 = t415 + t419;
+  t426 = t414 - t418;
+  t427 = t415 - t419;
+  t428 = t420 + t424;
+  t429 = t421 + t425;
+  t430 = t422 + t427;
+  t431 = t423 - t426;
+  t432 = t420 - t424;
+  t433 = t421 - t425;
+  t434 = t422 - t427;
+  t435 = t423 + t426;
+  buf[28] = t428;
+  buf[29] = t429;
+  t436 = t430 * 1.950903220e-01f + t431 * 9.807852804e-01f;
+  t437 = t431 * 1.950903220e-01f - t430 * 9.807852804e-01f;
+  buf[60] = t436;
+  buf[61] = t437;
+  t438 = t433 * 3.826834324e-01f - t432 * 9.238795325e-01f;
+  t439 = t432 * 3.826834324e-01f + t433 * 9.238795325e-01f;
+  buf[92] = t438;
+  buf[93] = -t439;
+  t440 = t434 * 5.555702330e-01f + t435 * 8.314696123e-01f;
+  t441 = t434 * 8.314696123e-01f - t435 * 5.555702330e-01f;
+  buf[124] = -t440;
+  buf[125] = t441;
+  t442 = p[30];
+  t443 = p[31];
+  t444 = p[62];
+  t445 = p[63];
+  t446 = p[94];
+  t447 = p[95];
+  t448 = p[126];
+  t449 = p[127];
+  t450 = t442 + t446;
+  t451 = t443 + t447;
+  t452 = t442 - t446;
+  t453 = t443 - t447;
+  t454 = t444 + t448;
+  t455 = t445 + t449;
+  t456 = t444 - t448;
+  t457 = t445 - t449;
+  t458 = t450 + t454;
+  t459 = t451 + t455;
+  t460 = t452 + t457;
+  t461 = t453 - t456;
+  t462 = t450 - t454;
+  t463 = t451 - t455;
+  t464 = t452 - t457;
+  t465 = t453 + t456;
+  buf[30] = t458;
+  buf[31] = t459;
+  t466 = t460 * 9.801714033e-02f + t461 * 9.951847267e-01f;
+  t467 = t461 * 9.801714033e-02f - t460 * 9.951847267e-01f;
+  buf[62] = t466;
+  buf[63] = t467;
+  t468 = t463 * 1.950903220e-01f - t462 * 9.807852804e-01f;
+  t469 = t462 * 1.950903220e-01f + t463 * 9.807852804e-01f;
+  buf[94] = t468;
+  buf[95] = -t469;
+  t470 = t464 * 2.902846773e-01f + t465 * 9.569403357e-01f;
+  t471 = t464 * 9.569403357e-01f - t465 * 2.902846773e-01f;
+  buf[126] = -t470;
+  buf[127] = t471;
+  t472 = buf[0];
+  t473 = buf[1];
+  t474 = buf[2];
+  t475 = buf[3];
+  t476 = buf[4];
+  t477 = buf[5];
+  t478 = buf[6];
+  t479 = buf[7];
+  t480 = buf[8];
+  t481 = buf[9];
+  t482 = buf[10];
+  t483 = buf[11];
+  t484 = buf[12];
+  t485 = buf[13];
+  t486 = buf[14];
+  t487 = buf[15];
+  t488 = buf[16];
+  t489 = buf[17];
+  t490 = buf[18];
+  t491 = buf[19];
+  t492 = buf[20];
+  t493 = buf[21];
+  t494 = buf[22];
+  t495 = buf[23];
+  t496 = buf[24];
+  t497 = buf[25];
+  t498 = buf[26];
+  t499 = buf[27];
+  t500 = buf[28];
+  t501 = buf[29];
+  t502 = buf[30];
+  t503 = buf[31];
+  t504 = t472 + t488;
+  t505 = t473 + t489;
+  t506 = t472 - t488;
+  t507 = t473 - t489;
+  t508 = t480 + t496;
+  t509 = t481 + t497;
+  t510 = t480 - t496;
+  t511 = t481 - t497;
+  t512 = t504 + t508;
+  t513 = t505 + t509;
+  t514 = t506 + t511;
+  t515 = t507 - t510;
+  t516 = t504 - t508;
+  t517 = t505 - t509;
+  t518 = t506 - t511;
+  t519 = t507 + t510;
+  t520 = t474 + t490;
+  t521 = t475 + t491;
+  t522 = t474 - t490;
+  t523 = t475 - t491;
+  t524 = t482 + t498;
+  t525 = t483 + t499;
+  t526 = t482 - t498;
+  t527 = t483 - t499;
+  t528 = t520 + t524;
+  t529 = t521 + t525;
+  t530 = t522 + t527;
+  t531 = t523 - t526;
+  t532 = t520 - t524;
+  t533 = t521 - t525;
+  t534 = t522 - t527;
+  t535 = t523 + t526;
+  t536 = t476 + t492;
+  t537 = t477 + t493;
+  t538 = t476 - t492;
+  t539 = t477 - t493;
+  t540 = t484 + t500;
+  t541 = t485 + t501;
+  t542 = t484 - t500;
+  t543 = t485 - t501;
+  t544 = t536 + t540;
+  t545 = t537 + t541;
+  t546 = t538 + t543;
+  t547 = t539 - t542;
+  t548 = t536 - t540;
+  t549 = t537 - t541;
+  t550 = t538 - t543;
+  t551 = t539 + t542;
+  t552 = t478 + t494;
+  t553 = t479 + t495;
+  t554 = t478 - t494;
+  t555 = t479 - t495;
+  t556 = t486 + t502;
+  t557 = t487 + t503;
+  t558 = t486 - t502;
+  t559 = t487 - t503;
+  t560 = t552 + t556;
+  t561 = t553 + t557;
+  t562 = t554 + t559;
+  t563 = t555 - t558;
+  t564 = t552 - t556;
+  t565 = t553 - t557;
+  t566 = t554 - t559;
+  t567 = t555 + t558;
+  t568 = t512 + t544;
+  t569 = t513 + t545;
+  t570 = t512 - t544;
+  t571 = t513 - t545;
+  t572 = t528 + t560;
+  t573 = t529 + t561;
+  t574 = t528 - t560;
+  t575 = t529 - t561;
+  t576 = t568 + t572;
+  t577 = t569 + t573;
+  t578 = t570 + t575;
+  t579 = t571 - t574;
+  t580 = t568 - t572;
+  t581 = t569 - t573;
+  t582 = t570 - t575;
+  t583 = t571 + t574;
+  t584 = t530 * 9.238795325e-01f + t531 * 3.826834324e-01f;
+  t585 = t531 * 9.238795325e-01f - t530 * 3.826834324e-01f;
+  t586 = (t546 + t547) * 7.071067812e-01f;
+  t587 = (t547 - t546) * 7.071067812e-01f;
+  t588 = t562 * 3.826834324e-01f + t563 * 9.238795325e-01f;
+  t589 = t563 * 3.826834324e-01f - t562 * 9.238795325e-01f;
+  t590 = t514 + t586;
+  t591 = t515 + t587;
+  t592 = t514 - t586;
+  t593 = t515 - t587;
+  t594 = t584 + t588;
+  t595 = t585 + t589;
+  t596 = t584 - t588;
+  t597 = t585 - t589;
+  t598 = t590 + t594;
+  t599 = t591 + t595;
+  t600 = t592 + t597;
+  t601 = t593 - t596;
+  t602 = t590 - t594;
+  t603 = t591 - t595;
+  t604 = t592 - t597;
+  t605 = t593 + t596;
+  t606 = (t532 + t533) * 7.071067812e-01f;
+  t607 = (t533 - t532) * 7.071067812e-01f;
+  t608 = (t565 - t564) * 7.071067812e-01f;
+  t609 = (t564 + t565) * 7.071067812e-01f;
+  t610 = t516 + t549;
+  t611 = t517 - t548;
+  t612 = t516 - t549;
+  t613 = t517 + t548;
+  t614 = t606 + t608;
+  t615 = t607 - t609;
+  t616 = t606 - t608;
+  t617 = t607 + t609;
+  t618 = t610 + t614;
+  t619 = t611 + t615;
+  t620 = t612 + t617;
+  t621 = t613 - t616;
+  t622 = t610 - t614;
+  t623 = t611 - t615;
+  t624 = t612 - t617;
+  t625 = t613 + t616;
+  t626 = t534 * 3.826834324e-01f + t535 * 9.238795325e-01f;
+  t627 = t535 * 3.826834324e-01f - t534 * 9.238795325e-01f;
+  t628 = (t551 - t550) * 7.071067812e-01f;
+  t629 = (t550 + t551) * 7.071067812e-01f;
+  t630 = t566 * 9.238795325e-01f + t567 * 3.826834324e-01f;
+  t631 = t566 * 3.826834324e-01f - t567 * 9.238795325e-01f;
+  t632 = t518 + t628;
+  t633 = t519 - t629;
+  t634 = t518 - t628;
+  t635 = t519 + t629;
+  t636 = t626 - t630;
+  t637 = t627 + t631;
+  t638 = t626 + t630;
+  t639 = t627 - t631;
+  t640 = t632 + t636;
+  t641 = t633 + t637;
+  t642 = t634 + t639;
+  t643 = t635 - t638;
+  t644 = t632 - t636;
+  t645 = t633 - t637;
+  t646 = t634 - t639;
+  t647 = t635 + t638;
+  p[0] = t576;
+  p[1] = t577;
+  p[8] = t598;
+  p[9] = t599;
+  p[16] = t618;
+  p[17] = t619;
+  p[24] = t640;
+  p[25] = t641;
+  p[32] = t578;
+  p[33] = t579;
+  p[40] = t600;
+  p[41] = t601;
+  p[48] = t620;
+  p[49] = t621;
+  p[56] = t642;
+  p[57] = t643;
+  p[64] = t580;
+  p[65] = t581;
+  p[72] = t602;
+  p[73] = t603;
+  p[80] = t622;
+  p[81] = t623;
+  p[88] = t644;
+  p[89] = t645;
+  p[96] = t582;
+  p[97] = t583;
+  p[104] = t604;
+  p[105] = t605;
+  p[112] = t624;
+  p[113] = t625;
+  p[120] = t646;
+  p[121] = t647;
+  t648 = buf[32];
+  t649 = buf[33];
+  t650 = buf[34];
+  t651 = buf[35];
+  t652 = buf[36];
+  t653 = buf[37];
+  t654 = buf[38];
+  t655 = buf[39];
+  t656 = buf[40];
+  t657 = buf[41];
+  t658 = buf[42];
+  t659 = buf[43];
+  t660 = buf[44];
+  t661 = buf[45];
+  t662 = buf[46];
+  t663 = buf[47];
+  t664 = buf[48];
+  t665 = buf[49];
+  t666 = buf[50];
+  t667 = buf[51];
+  t668 = buf[52];
+  t669 = buf[53];
+  t670 = buf[54];
+  t671 = buf[55];
+  t672 = buf[56];
+  t673 = buf[57];
+  t674 = buf[58];
+  t675 = buf[59];
+  t676 = buf[60];
+  t677 = buf[61];
+  t678 = buf[62];
+  t679 = buf[63];
+  t680 = t648 + t664;
+  t681 = t649 + t665;
+  t682 = t648 - t664;
+  t683 = t649 - t665;
+  t684 = t656 + t672;
+  t685 = t657 + t673;
+  t686 = t656 - t672;
+  t687 = t657 - t673;
+  t688 = t680 + t684;
+  t689 = t681 + t685;
+  t690 = t682 + t687;
+  t691 = t683 - t686;
+  t692 = t680 - t684;
+  t693 = t681 - t685;
+  t694 = t682 - t687;
+  t695 = t683 + t686;
+  t696 = t650 + t666;
+  t697 = t651 + t667;
+  t698 = t650 - t666;
+  t699 = t651 - t667;
+  t700 = t658 + t674;
+  t701 = t659 + t675;
+  t702 = t658 - t674;
+  t703 = t659 - t675;
+  t704 = t696 + t700;
+  t705 = t697 + t701;
+  t706 = t698 + t703;
+  t707 = t699 - t702;
+  t708 = t696 - t700;
+  t709 = t697 - t701;
+  t710 = t698 - t703;
+  t711 = t699 + t702;
+  t712 = t652 + t668;
+  t713 = t653 + t669;
+  t714 = t652 - t668;
+  t715 = t653 - t669;
+  t716 = t660 + t676;
+  t717 = t661 + t677;
+  t718 = t660 - t676;
+  t719 = t661 - t677;
+  t720 = t712 + t716;
+  t721 = t713 + t717;
+  t722 = t714 + t719;
+  t723 = t715 - t718;
+  t724 = t712 - t716;
+  t725 = t713 - t717;
+  t726 = t714 - t719;
+  t727 = t715 + t718;
+  t728 = t654 + t670;
+  t729 = t655 + t671;
+  t730 = t654 - t670;
+  t731 = t655 - t671;
+  t732 = t662 + t678;
+  t733 = t663 + t679;
+  t734 = t662 - t678;
+  t735 = t663 - t679;
+  t736 = t728 + t732;
+  t737 = t729 + t733;
+  t738 = t730 + t735;
+  t739 = t731 - t734;
+  t740 = t728 - t732;
+  t741 = t729 - t733;
+  t742 = t730 - t735;
+  t743 = t731 + t734;
+  t744 = t688 + t720;
+  t745 = t689 + t721;
+  t746 = t688 - t720;
+  t747 = t689 - t721;
+  t748 = t704 + t736;
+  t749 = t705 + t737;
+  t750 = t704 - t736;
+  t751 = t705 - t737;
+  t752 = t744 + t748;
+  t753 = t745 + t749;
+  t754 = t746 + t751;
+  t755 = t747 - t750;
+  t756 = t744 - t748;
+  t757 = t745 - t749;
+  t758 = t746 - t751;
+  t759 = t747 + t750;
+  t760 = t706 * 9.238795325e-01f + t707 * 3.826834324e-01f;
+  t761 = t707 * 9.238795325e-01f - t706 * 3.826834324e-01f;
+  t762 = (t722 + t723) * 7.071067812e-01f;
+  t763 = (t723 - t722) * 7.071067812e-01f;
+  t764 = t738 * 3.826834324e-01f + t739 * 9.238795325e-01f;
+  t765 = t739 * 3.826834324e-01f - t738 * 9.238795325e-01f;
+  t766 = t690 + t762;
+  t767 = t691 + t763;
+  t768 = t690 - t762;
+  t769 = t691 - t763;
+  t770 = t760 + t764;
+  t771 = t761 + t765;
+  t772 = t760 - t764;
+  t773 = t761 - t765;
+  t774 = t766 + t770;
+  t775 = t767 + t771;
+  t776 = t768 + t773;
+  t777 = t769 - t772;
+  t778 = t766 - t770;
+  t779 = t767 - t771;
+  t780 = t768 - t773;
+  t781 = t769 + t772;
+  t782 = (t708 + t709) * 7.071067812e-01f;
+  t783 = (t709 - t708) * 7.071067812e-01f;
+  t784 = (t741 - t740) * 7.071067812e-01f;
+  t785 = (t740 + t741) * 7.071067812e-01f;
+  t786 = t692 + t725;
+  t787 = t693 - t724;
+  t788 = t692 - t725;
+  t789 = t693 + t724;
+  t790 = t782 + t784;
+  t791 = t783 - t785;
+  t792 = t782 - t784;
+  t793 = t783 + t785;
+  t794 = t786 + t790;
+  t795 = t787 + t791;
+  t796 = t788 + t793;
+  t797 = t789 - t792;
+  t798 = t786 - t790;
+  t799 = t787 - t791;
+  t800 = t788 - t793;
+  t801 = t789 + t792;
+  t802 = t710 * 3.826834324e-01f + t711 * 9.238795325e-01f;
+  t803 = t711 * 3.826834324e-01f - t710 * 9.238795325e-01f;
+  t804 = (t727 - t726) * 7.071067812e-01f;
+  t805 = (t726 + t727) * 7.071067812e-01f;
+  t806 = t742 * 9.238795325e-01f + t743 * 3.826834324e-01f;
+  t807 = t742 * 3.826834324e-01f - t743 * 9.238795325e-01f;
+  t808 = t694 + t804;
+  t809 = t695 - t805;
+  t810 = t694 - t804;
+  t811 = t695 + t805;
+  t812 = t802 - t806;
+  t813 = t803 + t807;
+  t814 = t802 + t806;
+  t815 = t803 - t807;
+  t816 = t808 + t812;
+  t817 = t809 + t813;
+  t818 = t810 + t815;
+  t819 = t811 - t814;
+  t820 = t808 - t812;
+  t821 = t809 - t813;
+  t822 = t810 - t815;
+  t823 = t811 + t814;
+  p[2] = t752;
+  p[3] = t753;
+  p[10] = t774;
+  p[11] = t775;
+  p[18] = t794;
+  p[19] = t795;
+  p[26] = t816;
+  p[27] = t817;
+  p[34] = t754;
+  p[35] = t755;
+  p[42] = t776;
+  p[43] = t777;
+  p[50] = t796;
+  p[51] = t797;
+  p[58] = t818;
+  p[59] = t819;
+  p[66] = t756;
+  p[67] = t757;
+  p[74] = t778;
+  p[75] = t779;
+  p[82] = t798;
+  p[83] = t799;
+  p[90] = t820;
+  p[91] = t821;
+  p[98] = t758;
+  p[99] = t759;
+  p[106] = t780;
+  p[107] = t781;
+  p[114] = t800;
+  p[115] = t801;
+  p[122] = t822;
+  p[123] = t823;
+  t824 = buf[64];
+  t825 = buf[65];
+  t826 = buf[66];
+  t827 = buf[67];
+  t828 = buf[68];
+  t829 = buf[69];
+  t830 = buf[70];
+  t831 = buf[71];
+  t832 = buf[72];
+  t833 = buf[73];
+  t834 = buf[74];
+  t835 = buf[75];
+  t836 = buf[76];
+  t837 = buf[77];
+  t838 = buf[78];
+  t839 = buf[79];
+  t840 = buf[80];
+  t841 = buf[81];
+  t842 = buf[82];
+  t843 = buf[83];
+  t844 = buf[84];
+  t845 = buf[85];
+  t846 = buf[86];
+  t847 = buf[87];
+  t848 = buf[88];
+  t849 = buf[89];
+  t850 = buf[90];
+  t851 = buf[91];
+  t852 = buf[92];
+  t853 = buf[93];
+  t854 = buf[94];
+  t855 = buf[95];
+  t856 = t824 + t840;
+  t857 = t825 + t841;
+  t858 = t824 - t840;
+  t859 = t825 - t841;
+  t860 = t832 + t848;
+  t861 = t833 + t849;
+  t862 = t832 - t848;
+  t863 = t833 - t849;
+  t864 = t856 + t860;
+  t865 = t857 + t861;
+  t866 = t858 + t863;
+  t867 = t859 - t862;
+  t868 = t856 - t860;
+  t869 = t857 - t861;
+  t870 = t858 - t863;
+  t871 = t859 + t862;
+  t872 = t826 + t842;
+  t873 = t827 + t843;
+  t874 = t826 - t842;
+  t875 = t827 - t843;
+  t876 = t834 + t850;
+  t877 = t835 + t851;
+  t878 = t834 - t850;
+  t879 = t835 - t851;
+  t880 = t872 + t876;
+  t881 = t873 + t877;
+  t882 = t874 + t879;
+  t883 = t875 - t878;
+  t884 = t872 - t876;
+  t885 = t873 - t877;
+  t886 = t874 - t879;
+  t887 = t875 + t878;
+  t888 = t828 + t844;
+  t889 = t829 + t845;
+  t890 = t828 - t844;
+  t891 = t829 - t845;
+  t892 = t836 + t852;
+  t893 = t837 + t853;
+  t894 = t836 - t852;
+  t895 = t837 - t853;
+  t896 = t888 + t892;
+  t897 = t889 + t893;
+  t898 = t890 + t895;
+  t899 = t891 - t894;
+  t900 = t888 - t892;
+  t901 = t889 - t893;
+  t902 = t890 - t895;
+  t903 = t891 + t894;
+  t904 = t830 + t846;
+  t905 = t831 + t847;
+  t906 = t830 - t846;
+  t907 = t831 - t847;
+  t908 = t838 + t854;
+  t909 = t839 + t855;
+  t910 = t838 - t854;
+  t911 = t839 - t855;
+  t912 = t904 + t908;
+  t913 = t905 + t909;
+  t914 = t906 + t911;
+  t915 = t907 - t910;
+  t916 = t904 - t908;
+  t917 = t905 - t909;
+  t918 = t906 - t911;
+  t919 = t907 + t910;
+  t920 = t864 + t896;
+  t921 = t865 + t897;
+  t922 = t864 - t896;
+  t923 = t865 - t897;
+  t924 = t880 + t912;
+  t925 = t881 + t913;
+  t926 = t880 - t912;
+  t927 = t881 - t913;
+  t928 = t920 + t924;
+  t929 = t921 + t925;
+  t930 = t922 + t927;
+  t931 = t923 - t926;
+  t932 = t920 - t924;
+  t933 = t921 - t925;
+  t934 = t922 - t927;
+  t935 = t923 + t926;
+  t936 = t882 * 9.238795325e-01f + t883 * 3.826834324e-01f;
+  t937 = t883 * 9.238795325e-01f - t882 * 3.826834324e-01f;
+  t938 = (t898 + t899) * 7.071067812e-01f;
+  t939 = (t899 - t898) * 7.071067812e-01f;
+  t940 = t914 * 3.826834324e-01f + t915 * 9.238795325e-01f;
+  t941 = t915 * 3.826834324e-01f - t914 * 9.238795325e-01f;
+  t942 = t866 + t938;
+  t943 = t867 + t939;
+  t944 = t866 - t938;
+  t945 = t867 - t939;
+  t946 = t936 + t940;
+  t947 = t937 + t941;
+  t948 = t936 - t940;
+  t949 = t937 - t941;
+  t950 = t942 + t946;
+  t951 = t943 + t947;
+  t952 = t944 + t949;
+  t953 = t945 - t948;
+  t954 = t942 - t946;
+  t955 = t943 - t947;
+  t956 = t944 - t949;
+  t957 = t945 + t948;
+  t958 = (t884 + t885) * 7.071067812e-01f;
+  t959 = (t885 - t884) * 7.071067812e-01f;
+  t960 = (t917 - t916) * 7.071067812e-01f;
+  t961 = (t916 + t917) * 7.071067812e-01f;
+  t962 = t868 + t901;
+  t963 = t869 - t900;
+  t964 = t868 - t901;
+  t965 = t869 + t900;
+  t966 = t958 + t960;
+  t967 = t959 - t961;
+  t968 = t958 - t960;
+  t969 = t959 + t961;
+  t970 = t962 + t966;
+  t971 = t963 + t967;
+  t972 = t964 + t969;
+  t973 = t965 - t968;
+  t974 = t962 - t966;
+  t975 = t963 - t967;
+  t976 = t964 - t969;
+  t977 = t965 + t968;
+  t978 = t886 * 3.826834324e-01f + t887 * 9.238795325e-01f;
+  t979 = t887 * 3.826834324e-01f - t886 * 9.238795325e-01f;
+  t980 = (t903 - t902) * 7.071067812e-01f;
+  t981 = (t902 + t903) * 7.071067812e-01f;
+  t982 = t918 * 9.238795325e-01f + t919 * 3.826834324e-01f;
+  t983 = t918 * 3.826834324e-01f - t919 * 9.238795325e-01f;
+  t984 = t870 + t980;
+  t985 = t871 - t981;
+  t986 = t870 - t980;
+  t987 = t871 + t981;
+  t988 = t978 - t982;
+  t989 = t979 + t983;
+  t990 = t978 + t982;
+  t991 = t979 - t983;
+  t992 = t984 + t988;
+  t993 = t985 + t989;
+  t994 = t986 + t991;
+  t995 = t987 - t990;
+  t996 = t984 - t988;
+  t997 = t985 - t989;
+  t998 = t986 - t991;
+  t999 = t987 + t990;
+  p[4] = t928;
+  p[5] = t929;
+  p[12] = t950;
+  p[13] = t951;
+  p[20] = t970;
+  p[21] = t971;
+  p[28] = t992;
+  p[29] = t993;
+  p[36] = t930;
+  p[37] = t931;
+  p[44] = t952;
+  p[45] = t953;
+  p[52] = t972;
+  p[53] = t973;
+  p[60] = t994;
+  p[61] = t995;
+  p[68] = t932;
+  p[69] = t933;
+  p[76] = t954;
+  p[77] = t955;
+  p[84] = t974;
+  p[85] = t975;
+  p[92] = t996;
+  p[93] = t997;
+  p[100] = t934;
+  p[101] = t935;
+  p[108] = t956;
+  p[109] = t957;
+  p[116] = t976;
+  p[117] = t977;
+  p[124] = t998;
+  p[125] = t999;
+  t1000 = buf[96];
+  t1001 = buf[97];
+  t1002 = buf[98];
+  t1003 = buf[99];
+  t1004 = buf[100];
+  t1005 = buf[101];
+  t1006 = buf[102];
+  t1007 = buf[103];
+  t1008 = buf[104];
+  t1009 = buf[105];
+  t1010 = buf[106];
+  t1011 = buf[107];
+  t1012 = buf[108];
+  t1013 = buf[109];
+  t1014 = buf[110];
+  t1015 = buf[111];
+  t1016 = buf[112];
+  t1017 = buf[113];
+  t1018 = buf[114];
+  t1019 = buf[115];
+  t1020 = buf[116];
+  t1021 = buf[117];
+  t1022 = buf[118];
+  t1023 = buf[119];
+  t1024 = buf[120];
+  t1025 = buf[121];
+  t1026 = buf[122];
+  t1027 = buf[123];
+  t1028 = buf[124];
+  t1029 = buf[125];
+  t1030 = buf[126];
+  t1031 = buf[127];
+  t1032 = t1000 + t1016;
+  t1033 = t1001 + t1017;
+  t1034 = t1000 - t1016;
+  t1035 = t1001 - t1017;
+  t1036 = t1008 + t1024;
+  t1037 = t1009 + t1025;
+  t1038 = t1008 - t1024;
+  t1039 = t1009 - t1025;
+  t1040 = t1032 + t1036;
+  t1041 = t1033 + t1037;
+  t1042 = t1034 + t1039;
+  t1043 = t1035 - t1038;
+  t1044 = t1032 - t1036;
+  t1045 = t1033 - t1037;
+  t1046 = t1034 - t1039;
+  t1047 = t1035 + t1038;
+  t1048 = t1002 + t1018;
+  t1049 = t1003 + t1019;
+  t1050 = t1002 - t1018;
+  t1051 = t1003 - t1019;
+  t1052 = t1010 + t1026;
+  t1053 = t1011 + t1027;
+  t1054 = t1010 - t1026;
+  t1055 = t1011 - t1027;
+  t1056 = t1048 + t1052;
+  t1057 = t1049 + t1053;
+  t1058 = t1050 + t1055;
+  t1059 = t1051 - t1054;
+  t1060 = t1048 - t1052;
+  t1061 = t1049 - t1053;
+  t1062 = t1050 - t1055;
+  t1063 = t1051 + t1054;
+  t1064 = t1004 + t1020;
+  t1065 = t1005 + t1021;
+  t1066 = t1004 - t1020;
+  t1067 = t1005 - t1021;
+  t1068 = t1012 + t1028;
+  t1069 = t1013 + t1029;
+  t1070 = t1012 - t1028;
+  t1071 = t1013 - t1029;
+  t1072 = t1064 + t1068;
+  t1073 = t1065 + t1069;
+  t1074 = t1066 + t1071;
+  t1075 = t1067 - t1070;
+  t1076 = t1064 - t1068;
+  t1077 = t1065 - t1069;
+  t1078 = t1066 - t1071;
+  t1079 = t1067 + t1070;
+  t1080 = t1006 + t1022;
+  t1081 = t1007 + t1023;
+  t1082 = t1006 - t1022;
+  t1083 = t1007 - t1023;
+  t1084 = t1014 + t1030;
+  t1085 = t1015 + t1031;
+  t1086 = t1014 - t1030;
+  t1087 = t1015 - t1031;
+  t1088 = t1080 + t1084;
+  t1089 = t1081 + t1085;
+  t1090 = t1082 + t1087;
+  t1091 = t1083 - t1086;
+  t1092 = t1080 - t1084;
+  t1093 = t1081 - t1085;
+  t1094 = t1082 - t1087;
+  t1095 = t1083 + t1086;
+  t1096 = t1040 + t1072;
+  t1097 = t1041 + t1073;
+  t1098 = t1040 - t1072;
+  t1099 = t1041 - t1073;
+  t1100 = t1056 + t1088;
+  t1101 = t1057 + t1089;
+  t1102 = t1056 - t1088;
+  t1103 = t1057 - t1089;
+  t1104 = t1096 + t1100;
+  t1105 = t1097 + t1101;
+  t1106 = t1098 + t1103;
+  t1107 = t1099 - t1102;
+  t1108 = t1096 - t1100;
+  t1109 = t1097 - t1101;
+  t1110 = t1098 - t1103;
+  t1111 = t1099 + t1102;
+  t1112 = t1058 * 9.238795325e-01f + t1059 * 3.826834324e-01f;
+  t1113 = t1059 * 9.238795325e-01f - t1058 * 3.826834324e-01f;
+  t1114 = (t1074 + t1075) * 7.071067812e-01f;
+  t1115 = (t1075 - t1074) * 7.071067812e-01f;
+  t1116 = t1090 * 3.826834324e-01f + t1091 * 9.238795325e-01f;
+  t1117 = t1091 * 3.826834324e-01f - t1090 * 9.238795325e-01f;
+  t1118 = t1042 + t1114;
+  t1119 = t1043 + t1115;
+  t1120 = t1042 - t1114;
+  t1121 = t1043 - t1115;
+  t1122 = t1112 + t1116;
+  t1123 = t1113 + t1117;
+  t1124 = t1112 - t1116;
+  t1125 = t1113 - t1117;
+  t1126 = t1118 + t1122;
+  t1127 = t1119 + t1123;
+  t1128 = t1120 + t1125;
+  t1129 = t1121 - t1124;
+  t1130 = t1118 - t1122;
+  t1131 = t1119 - t1123;
+  t1132 = t1120 - t1125;
+  t1133 = t1121 + t1124;
+  t1134 = (t1060 + t1061) * 7.071067812e-01f;
+  t1135 = (t1061 - t1060) * 7.071067812e-01f;
+  t1136 = (t1093 - t1092) * 7.071067812e-01f;
+  t1137 = (t1092 + t1093) * 7.071067812e-01f;
+  t1138 = t1044 + t1077;
+  t1139 = t1045 - t1076;
+  t1140 = t1044 - t1077;
+  t1141 = t1045 + t1076;
+  t1142 = t1134 + t1136;
+  t1143 = t1135 - t1137;
+  t1144 = t1134 - t1136;
+  t1145 = t1135 + t1137;
+  t1146 = t1138 + t1142;
+  t1147 = t1139 + t1143;
+  t1148 = t1140 + t1145;
+  t1149 = t1141 - t1144;
+  t1150 = t1138 - t1142;
+  t1151 = t1139 - t1143;
+  t1152 = t1140 - t1145;
+  t1153 = t1141 + t1144;
+  t1154 = t1062 * 3.826834324e-01f + t1063 * 9.238795325e-01f;
+  t1155 = t1063 * 3.826834324e-01f - t1062 * 9.238795325e-01f;
+  t1156 = (t1079 - t1078) * 7.071067812e-01f;
+  t1157 = (t1078 + t1079) * 7.071067812e-01f;
+  t1158 = t1094 * 9.238795325e-01f + t1095 * 3.826834324e-01f;
+  t1159 = t1094 * 3.826834324e-01f - t1095 * 9.238795325e-01f;
+  t1160 = t1046 + t1156;
+  t1161 = t1047 - t1157;
+  t1162 = t1046 - t1156;
+  t1163 = t1047 + t1157;
+  t1164 = t1154 - t1158;
+  t1165 = t1155 + t1159;
+  t1166 = t1154 + t1158;
+  t1167 = t1155 - t1159;
+  t1168 = t1160 + t1164;
+  t1169 = t1161 + t1165;
+  t1170 = t1162 + t1167;
+  t1171 = t1163 - t1166;
+  t1172 = t1160 - t1164;
+  t1173 = t1161 - t1165;
+  t1174 = t1162 - t1167;
+  t1175 = t1163 + t1166;
+  p[6] = t1104;
+  p[7] = t1105;
+  p[14] = t1126;
+  p[15] = t1127;
+  p[22] = t1146;
+  p[23] = t1147;
+  p[30] = t1168;
+  p[31] = t1169;
+  p[38] = t1106;
+  p[39] = t1107;
+  p[46] = t1128;
+  p[47] = t1129;
+  p[54] = t1148;
+  p[55] = t1149;
+  p[62] = t1170;
+  p[63] = t1171;
+  p[70] = t1108;
+  p[71] = t1109;
+  p[78] = t1130;
+  p[79] = t1131;
+  p[86] = t1150;
+  p[87] = t1151;
+  p[94] = t1172;
+  p[95] = t1173;
+  p[102] = t1110;
+  p[103] = t1111;
+  p[110] = t1132;
+  p[111] = t1133;
+  p[118] = t1152;
+  p[119] = t1153;
+  p[126] = t1174;
+  p[127] = t1175;
+}
+
+/**
+ * @brief  Forward complex FFT with a codelet of the length, if there is one.
+ * @param[in, out] *p1     points to the complex data, in place.
+ * @param[in]      fftLen  length of the FFT.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if there is no codelet of <code>fftLen</code>.
+ *
+ * \par
+ * The result is in natural order, as arm_cfft_f32() with <code>bitReverseFlag</code> set.
+ */
+
+arm_status arm_cfft_codelet_f32(
+  float32_t * p1,
+  uint16_t fftLen)
+{
+  switch (fftLen)
+  {
+  case 16:
+    arm_cfft_codelet_16_f32(p1);
+    break;
+  case 32:
+    arm_cfft_codelet_32_f32(p1);
+    break;
+  case 64:
+    arm_cfft_codelet_64_f32(p1);
+    break;
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+#endif /* #if !defined (ARM_MATH_CFFT_NO_CODELETS) */
+
+/**
+* @} end of ComplexFFT group
+*/
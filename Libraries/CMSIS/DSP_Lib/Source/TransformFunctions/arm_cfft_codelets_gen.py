@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+# ----------------------------------------------------------------------
+# Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+#
+# Project:      CMSIS DSP Library
+# Title:        arm_cfft_codelets_gen.py
+#
+# Description:  Generates arm_cfft_codelets_f32.c, the fixed-size complex
+#               FFT codelets used by arm_cfft_f32().
+#
+#               Usage: arm_cfft_codelets_gen.py [-o file] [size ...]
+#
+#               The sizes are powers of 2 from 16 to 256, by default 16, 32
+#               and 64. Each codelet is straight-line code with the twiddle
+#               factors as immediate constants, and writes its result in
+#               natural order. Up to 32 points, the codelet is a single
+#               radix-4/radix-2 decimation in time on local variables. Larger
+#               sizes take one radix-4 decimation in frequency pass into a
+#               buffer on the stack, then 4 codelets of a quarter size.
+#               From 128 points the code outgrows the instruction cache and
+#               the radix-8 functions of arm_cfft_f32() are faster on the
+#               host, so these sizes are left out by default.
+#
+# Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+# ----------------------------------------------------------------------
+
+import math
+import sys
+import time
+
+SIZES = [16, 32, 64, 128, 256]
+DEFAULT = [16, 32, 64]
+SSA_MAX = 32                    # Largest codelet on local variables only
+
+
+def const(x):
+    return '%.9ef' % x
+
+
+class Codelet:
+    """Straight-line code of one codelet. A complex value is a pair of
+    (name, sign) terms, so multiplications by -1 and by +-j cost nothing."""
+
+    def __init__(self):
+        self.lines = []
+        self.temps = 0
+
+    def temp(self, expr):
+        name = 't%d' % self.temps
+        self.temps += 1
+        self.lines.append('  %s = %s;' % (name, expr))
+        return name
+
+    def sum(self, terms, scale=None):
+        """Sum of (name, sign) terms, times a positive constant."""
+        pos = [n for n, s in terms if s > 0]
+        neg = [n for n, s in terms if s < 0]
+        sign = 1
+        if not pos:
+            pos, neg, sign = neg, [], -1
+        expr = ' + '.join(pos) + ''.join(' - ' + n for n in neg)
+        if scale is not None:
+            expr = ('(%s) * %s' % (expr, const(scale))) if len(terms) > 1 else '%s * %s' % (expr, const(scale))
+        return (self.temp(expr), sign)
+
+    def lin(self, terms):
+        """Sum of (name, sign, positive constant) products."""
+        pos = ['%s * %s' % (n, const(c)) for n, s, c in terms if s > 0]
+        neg = ['%s * %s' % (n, const(c)) for n, s, c in terms if s < 0]
+        sign = 1
+        if not pos:
+            pos, neg, sign = neg, [], -1
+        return (self.temp(' + '.join(pos) + ''.join(' - ' + n for n in neg)), sign)
+
+    def add(self, a, b):
+        return (self.sum([a[0], b[0]]), self.sum([a[1], b[1]]))
+
+    def sub(self, a, b):
+        return (self.sum([a[0], neg(b[0])]), self.sum([a[1], neg(b[1])]))
+
+    def twiddle(self, a, k, n):
+        """a * exp(-2j * pi * k / n)."""
+        k %= n
+        if (8 * k) % n == 0:
+            octant = 8 * k // n
+            (ar, ai) = a
+            # Quarter turns swap the parts
+            for _ in range(octant // 2):
+                (ar, ai) = (ai, neg(ar))
+            if octant % 2 == 0:
+                return (ar, ai)
+            # exp(-j pi / 4) = (1 - j) / sqrt(2)
+            c = math.sqrt(0.5)
+            return (self.sum([ar, ai], c), self.sum([ai, neg(ar)], c))
+        w = -2.0 * math.pi * k / n
+        c, s = math.cos(w), math.sin(w)
+        (ar, ai) = a
+        re = self.lin([(ar[0], ar[1] * sgn(c), abs(c)), (ai[0], -ai[1] * sgn(s), abs(s))])
+        im = self.lin([(ar[0], ar[1] * sgn(s), abs(s)), (ai[0], ai[1] * sgn(c), abs(c))])
+        return (re, im)
+
+    def radix4(self, a0, a1, a2, a3):
+        """Forward radix-4 butterfly."""
+        s0, d0 = self.add(a0, a2), self.sub(a0, a2)
+        s1, d1 = self.add(a1, a3), self.sub(a1, a3)
+        # d1 * -j = (d1.i, -d1.r)
+        return (self.add(s0, s1),
+                (self.sum([d0[0], d1[1]]), self.sum([d0[1], neg(d1[0])])),
+                self.sub(s0, s1),
+                (self.sum([d0[0], neg(d1[1])]), self.sum([d0[1], d1[0]])))
+
+    def dft(self, x):
+        """Decimation in time DFT of the list of complex values x."""
+        n = len(x)
+        if n == 1:
+            return list(x)
+        if n == 2:
+            return [self.add(x[0], x[1]), self.sub(x[0], x[1])]
+        if n % 4 == 0:
+            sub = [self.dft(x[r::4]) for r in range(4)]
+            y = [None] * n
+            for k in range(n // 4):
+                a = [sub[r][k] if r == 0 else self.twiddle(sub[r][k], r * k, n) for r in range(4)]
+                b = self.radix4(*a)
+                for q in range(4):
+                    y[k + q * n // 4] = b[q]
+            return y
+        sub = [self.dft(x[r::2]) for r in range(2)]
+        y = [None] * n
+        for k in range(n // 2):
+            b = self.twiddle(sub[1][k], k, n)
+            y[k] = self.add(sub[0][k], b)
+            y[k + n // 2] = self.sub(sub[0][k], b)
+        return y
+
+    def load(self, src, idx):
+        return ((self.temp('%s[%d]' % (src, 2 * idx)), 1), (self.temp('%s[%d]' % (src, 2 * idx + 1)), 1))
+
+    def store(self, dst, idx, v):
+        for part in range(2):
+            (name, sign) = v[part]
+            self.lines.append('  %s[%d] = %s%s;' % (dst, 2 * idx + part, '' if sign > 0 else '-', name))
+
+    def ssa(self, n, src, src_ofs, dst, dst_ofs, dst_stride):
+        x = [self.load(src, src_ofs + i) for i in range(n)]
+        y = self.dft(x)
+        for k in range(n):
+            self.store(dst, dst_ofs + k * dst_stride, y[k])
+
+    def dif4(self, n, src, ofs, dst):
+        """Radix-4 decimation in frequency pass, block r of dst gets the inputs of X[4k + r]."""
+        q = n // 4
+        for i in range(q):
+            x = [self.load(src, ofs + i + r * q) for r in range(4)]
+            b = self.radix4(*x)
+            for r in range(4):
+                self.store(dst, ofs + i + r * q, b[r] if r == 0 else self.twiddle(b[r], r * i, n))
+
+    def fft(self, n, src, ofs, dst, dst_ofs, dst_stride):
+        """DFT of src[ofs ...] into dst[dst_ofs + k * dst_stride]. The passes after the first work in place in buf."""
+        if n <= SSA_MAX:
+            self.ssa(n, src, ofs, dst, dst_ofs, dst_stride)
+            return
+        self.dif4(n, src, ofs, 'buf')
+        for r in range(4):
+            self.fft(n // 4, 'buf', ofs + r * n // 4, dst, dst_ofs + r * dst_stride, 4 * dst_stride)
+
+
+def neg(t):
+    return (t[0], -t[1])
+
+
+def sgn(x):
+    return 1 if x >= 0 else -1
+
+
+def codelet(n):
+    g = Codelet()
+    scratch = n > SSA_MAX
+    g.fft(n, 'p', 0, 'p', 0, 1)
+
+    out = ['/**   ',
+           ' * @brief  %d-point forward complex FFT codelet.   ' % n,
+           ' * @param[in, out] *p  points to the %d complex values, in place.   ' % n,
+           ' * @return none.   ',
+           ' */',
+           '',
+           'static void arm_cfft_codelet_%d_f32(' % n,
+           '  float32_t * p)',
+           '{']
+    if scratch:
+        out.append('  float32_t buf[%d];                          /* Output of the radix-4 passes */' % (2 * n))
+    names = ['t%d' % i for i in range(g.temps)]
+    for i in range(0, len(names), 12):
+        out.append('  float32_t ' + ', '.join(names[i:i + 12]) + ';')
+    out.append('')
+    out.extend(g.lines)
+    out.append('}')
+    out.append('')
+    return out
+
+
+HEADER = '''/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        %s
+* $Revision: 	V1.4.1
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_codelets_f32.c
+*
+* Description:	Fixed-size floating-point complex FFT codelets.
+*
+*               Generated by arm_cfft_codelets_gen.py%s, do not edit.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+#if !defined (ARM_MATH_CFFT_NO_CODELETS)
+'''
+
+FOOTER = '''/**
+ * @brief  Forward complex FFT with a codelet of the length, if there is one.
+ * @param[in, out] *p1     points to the complex data, in place.
+ * @param[in]      fftLen  length of the FFT.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if there is no codelet of <code>fftLen</code>.
+ *
+ * \\par
+ * The result is in natural order, as arm_cfft_f32() with <code>bitReverseFlag</code> set.
+ */
+
+arm_status arm_cfft_codelet_f32(
+  float32_t * p1,
+  uint16_t fftLen)
+{
+  switch (fftLen)
+  {
+%s
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+#endif /* #if !defined (ARM_MATH_CFFT_NO_CODELETS) */
+
+/**
+* @} end of ComplexFFT group
+*/
+'''
+
+
+def main(argv):
+    path = 'arm_cfft_codelets_f32.c'
+    sizes = []
+    i = 0
+    while i < len(argv):
+        if argv[i] == '-o' and i + 1 < len(argv):
+            path = argv[i + 1]
+            i += 2
+            continue
+        if not argv[i].isdigit() or int(argv[i]) not in SIZES:
+            sys.exit('usage: arm_cfft_codelets_gen.py [-o file] [size ...], sizes %s' % ' '.join(map(str, SIZES)))
+        sizes.append(int(argv[i]))
+        i += 1
+    sizes = sorted(set(sizes)) or DEFAULT
+
+    args = '' if sizes == DEFAULT else ' ' + ' '.join(map(str, sizes))
+    now = time.localtime()
+    date = '%d. %s' % (now.tm_mday, time.strftime('%B %Y', now))
+    out = (HEADER % (date, args)).split('\n')
+    for n in sizes:
+        out.extend(codelet(n))
+    cases = '\n'.join('  case %d:\n    arm_cfft_codelet_%d_f32(p1);\n    break;' % (n, n) for n in sizes)
+    out.extend((FOOTER % cases).split('\n'))
+
+    with open(path, 'w', newline='\r\n') as f:
+        f.write('\n'.join(out).rstrip('\n') + '\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -53,6 +53,12 @@ extern void arm_bitreversal_32(
 		const uint16_t bitRevLen,
 		const uint16_t * pBitRevTable);
 
+#if !defined (ARM_MATH_CFFT_NO_CODELETS)
+extern arm_status arm_cfft_codelet_f32(
+  float32_t * p1,
+  uint16_t fftLen);
+#endif
+
 /**   
 * @ingroup groupTransforms   
 */
@@ -84,6 +90,14 @@ extern void arm_bitreversal_32(
 * The algorithm supports lengths of [16, 32, 64, ..., 4096] and each length uses
 * a different twiddle factor table.  
 * \par
+* With <code>bitReverseFlag</code> set, the lengths that have a codelet in
+* arm_cfft_codelets_f32.c are computed instead by straight-line code, with the
+* twiddle factors as immediate constants and the result written in natural order,
+* so there are no loops, table loads or bit reversal. The codelets are generated
+* by arm_cfft_codelets_gen.py for the lengths 16, 32 and 64, and the generator
+* takes other lengths up to 256: each length adds its code size to arm_cfft_f32().
+* Define <code>ARM_MATH_CFFT_NO_CODELETS</code> to build the library without them.
+* \par
 * The function uses the standard FFT definition and output values may grow by a
 * factor of <code>fftLen</code> when computing the forward transform.  The
 * inverse transform includes a scale of <code>1/fftLen</code> as part of the
@@ -569,6 +583,7 @@ void arm_cfft_f32(
 
    uint32_t  L = S->fftLen, l;
    float32_t invL, * pSrc;
+   arm_status status = ARM_MATH_ARGUMENT_ERROR;
 
   if(ifftFlag == 1u)
   {
@@ -580,26 +595,38 @@ void arm_cfft_f32(
 	  }
   }
 
-		switch (L) {
-		case 16: 
-		case 128:
-		case 1024:
-			 arm_cfft_radix8by2_f32  ( (arm_cfft_instance_f32 *) S, p1);
-			 break;
-		case 32:
-		case 256:
-		case 2048:
-			 arm_cfft_radix8by4_f32  ( (arm_cfft_instance_f32 *) S, p1);
-			 break;
-		case 64:
-		case 512:
-		case 4096:
-          arm_radix8_butterfly_f32( p1, L, (float32_t *) S->pTwiddle, 1);
-			 break;
-		}  
-
-	if( bitReverseFlag )
-		arm_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);
+#if !defined (ARM_MATH_CFFT_NO_CODELETS)
+  /* Codelet of the length, in natural order */
+  if(bitReverseFlag)
+  {
+    status = arm_cfft_codelet_f32(p1, S->fftLen);
+  }
+#endif
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    switch (L)
+    {
+    case 16:
+    case 128:
+    case 1024:
+      arm_cfft_radix8by2_f32((arm_cfft_instance_f32 *) S, p1);
+      break;
+    case 32:
+    case 256:
+    case 2048:
+      arm_cfft_radix8by4_f32((arm_cfft_instance_f32 *) S, p1);
+      break;
+    case 64:
+    case 512:
+    case 4096:
+      arm_radix8_butterfly_f32(p1, L, (float32_t *) S->pTwiddle, 1);
+      break;
+    }
+
+    if(bitReverseFlag)
+      arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
 
   if(ifftFlag == 1u)
   {
@@ -0,0 +1,379 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_f32.c    
+*    
+* Description:	Mixed-radix (2, 3, 4, 5) floating-point CFFT & CIFFT processing function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Constants of the radix-3 and radix-5 butterflies */
+#define C3_1      0.866025403784438647f          /* sin(2*pi/3) */
+#define C5_1      0.309016994374947424f          /* cos(2*pi/5) */
+#define C5_2     -0.809016994374947424f          /* cos(4*pi/5) */
+#define S5_1      0.951056516295153572f          /* sin(2*pi/5) */
+#define S5_2      0.587785252292473129f          /* sin(4*pi/5) */
+
+/*    
+* Each stage is a Stockham step of radix r on sub-transforms of length n = r * m,    
+* repeated with a stride of s = fftLen / n: the inputs a[j] = x[q + s*(p + j*m)]    
+* give the outputs y[q + s*(r*p + k)] = (sum of a[j] * exp(-2*pi*i*j*k/r)) * w(k*p),    
+* w(k*p) = exp(-2*pi*i*k*p/n), for p = 0 .. m-1 and q = 0 .. s-1. The results are    
+* in natural order after the last stage, so no bit reversal is needed. The    
+* twiddles of p = 0 are 1 and are not stored or applied.    
+*/
+
+/* Stores the complex output (br, bi) rotated by the twiddle *pW, or as it is for p = 0 */
+#define STORE_TW(pY, br, bi, pW)                                \
+  if(p == 0u)                                                   \
+  {                                                             \
+    (pY)[0] = (br);                                             \
+    (pY)[1] = (bi);                                             \
+  }                                                             \
+  else                                                          \
+  {                                                             \
+    (pY)[0] = ((br) * (pW)[0]) - ((bi) * (pW)[1]);              \
+    (pY)[1] = ((br) * (pW)[1]) + ((bi) * (pW)[0]);              \
+  }
+
+static void arm_cfft_mixed_radix2_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA;                           /* Inputs of the butterfly */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t a0r, a0i, a1r, a1i;                  /* Temporary variables */
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 4u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[0];
+      a0i = pA[1];
+      a1r = pA[sm];
+      a1i = pA[sm + 1u];
+
+      pY[0] = a0r + a1r;
+      pY[1] = a0i + a1i;
+      STORE_TW(pY + 2u * s, a0r - a1r, a0i - a1i, pTw);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 2u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix3_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA;                           /* Inputs of the butterfly */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i;     /* Temporary variables */
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 6u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[0];
+      a0i = pA[1];
+
+      /* t1 = a1 + a2, t3 = sin(2*pi/3) * (a1 - a2) */
+      t1r = pA[sm] + pA[2u * sm];
+      t1i = pA[sm + 1u] + pA[2u * sm + 1u];
+      t3r = C3_1 * (pA[sm] - pA[2u * sm]);
+      t3i = C3_1 * (pA[sm + 1u] - pA[2u * sm + 1u]);
+
+      /* t2 = a0 - t1 / 2 */
+      t2r = a0r - 0.5f * t1r;
+      t2i = a0i - 0.5f * t1i;
+
+      /* y0 = a0 + t1, y1 = t2 - i*t3, y2 = t2 + i*t3 */
+      pY[0] = a0r + t1r;
+      pY[1] = a0i + t1i;
+      STORE_TW(pY + 2u * s, t2r + t3i, t2i - t3r, pTw);
+      STORE_TW(pY + 4u * s, t2r - t3i, t2i + t3r, pTw + 2u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 4u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix4_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA;                           /* Inputs of the butterfly */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;     /* Temporary variables */
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 8u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      /* t0 = a0 + a2, t1 = a0 - a2, t2 = a1 + a3, t3 = a1 - a3 */
+      t0r = pA[0] + pA[2u * sm];
+      t0i = pA[1] + pA[2u * sm + 1u];
+      t1r = pA[0] - pA[2u * sm];
+      t1i = pA[1] - pA[2u * sm + 1u];
+      t2r = pA[sm] + pA[3u * sm];
+      t2i = pA[sm + 1u] + pA[3u * sm + 1u];
+      t3r = pA[sm] - pA[3u * sm];
+      t3i = pA[sm + 1u] - pA[3u * sm + 1u];
+
+      /* y0 = t0 + t2, y1 = t1 - i*t3, y2 = t0 - t2, y3 = t1 + i*t3 */
+      pY[0] = t0r + t2r;
+      pY[1] = t0i + t2i;
+      STORE_TW(pY + 2u * s, t1r + t3i, t1i - t3r, pTw);
+      STORE_TW(pY + 4u * s, t0r - t2r, t0i - t2i, pTw + 2u);
+      STORE_TW(pY + 6u * s, t1r - t3i, t1i + t3r, pTw + 4u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 6u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix5_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA;                           /* Inputs of the butterfly */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;   /* Temporary variables */
+  float32_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 10u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[0];
+      a0i = pA[1];
+
+      /* t1 = a1 + a4, t2 = a2 + a3, t3 = a1 - a4, t4 = a2 - a3 */
+      t1r = pA[sm] + pA[4u * sm];
+      t1i = pA[sm + 1u] + pA[4u * sm + 1u];
+      t2r = pA[2u * sm] + pA[3u * sm];
+      t2i = pA[2u * sm + 1u] + pA[3u * sm + 1u];
+      t3r = pA[sm] - pA[4u * sm];
+      t3i = pA[sm + 1u] - pA[4u * sm + 1u];
+      t4r = pA[2u * sm] - pA[3u * sm];
+      t4i = pA[2u * sm + 1u] - pA[3u * sm + 1u];
+
+      /* Real parts b and imaginary parts d of the rotations */
+      b1r = a0r + C5_1 * t1r + C5_2 * t2r;
+      b1i = a0i + C5_1 * t1i + C5_2 * t2i;
+      b2r = a0r + C5_2 * t1r + C5_1 * t2r;
+      b2i = a0i + C5_2 * t1i + C5_1 * t2i;
+      d1r = S5_1 * t3r + S5_2 * t4r;
+      d1i = S5_1 * t3i + S5_2 * t4i;
+      d2r = S5_2 * t3r - S5_1 * t4r;
+      d2i = S5_2 * t3i - S5_1 * t4i;
+
+      /* y0 = a0 + t1 + t2, y1 = b1 - i*d1, y2 = b2 - i*d2, y3 = b2 + i*d2, y4 = b1 + i*d1 */
+      pY[0] = a0r + t1r + t2r;
+      pY[1] = a0i + t1i + t2i;
+      STORE_TW(pY + 2u * s, b1r + d1i, b1i - d1r, pTw);
+      STORE_TW(pY + 4u * s, b2r + d2i, b2i - d2r, pTw + 2u);
+      STORE_TW(pY + 6u * s, b2r - d2i, b2i + d2r, pTw + 4u);
+      STORE_TW(pY + 8u * s, b1r - d1i, b1i + d1r, pTw + 6u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 8u;
+    }
+  }
+}
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+* @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.   
+* @param[in]      *S        points to an instance of the floating-point mixed-radix CFFT structure.   
+* @param[in, out] *p1       points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.   
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.   
+* @return none.   
+*    
+* \par Description:   
+* \par    
+* Computes the FFT of lengths that are not a power of two, such as 480, 960 or 1200,    
+* without zero padding. The stages are self-sorting, so the output is in natural order.    
+* As for arm_cfft_f32(), the inverse transform includes a scale of <code>1/fftLen</code>.    
+* \par    
+* The instance is set up by arm_cfft_mixed_init_f32(). Its work buffer is used    
+* during the call, so instances that may run at the same time need their own buffers.    
+*/
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen, n, m, s, i, l;         /* Lengths, stride and loop counters */
+  const float32_t *pTw = S->pTwiddle;            /* Twiddles of the current stage */
+  float32_t *pIn, *pOut, *pTmp;                  /* Buffers of the current stage */
+  float32_t invL;                                /* Scale of the inverse transform */
+
+  if(ifftFlag == 1u)
+  {
+    /*  Conjugate input data  */
+    pIn = p1 + 1;
+    for (l = 0u; l < L; l++)
+    {
+      *pIn = -*pIn;
+      pIn += 2;
+    }
+  }
+
+  /* The stages alternate between p1 and the work buffer. With an odd number    
+   ** of stages, the input is moved to the work buffer first so that the result ends in p1. */
+  if((S->numStages & 1u) != 0u)
+  {
+    memcpy(S->pBuffer, p1, 2u * L * sizeof(float32_t));
+    pIn = S->pBuffer;
+    pOut = p1;
+  }
+  else
+  {
+    pIn = p1;
+    pOut = S->pBuffer;
+  }
+
+  n = L;
+  s = 1u;
+
+  for (i = 0u; i < S->numStages; i++)
+  {
+    m = n / S->radix[i];
+
+    switch (S->radix[i])
+    {
+    case 2u:
+      arm_cfft_mixed_radix2_f32(pIn, pOut, pTw, m, s);
+      break;
+    case 3u:
+      arm_cfft_mixed_radix3_f32(pIn, pOut, pTw, m, s);
+      break;
+    case 4u:
+      arm_cfft_mixed_radix4_f32(pIn, pOut, pTw, m, s);
+      break;
+    default:
+      arm_cfft_mixed_radix5_f32(pIn, pOut, pTw, m, s);
+      break;
+    }
+
+    /* Twiddles of the next stage */
+    pTw += 2u * (S->radix[i] - 1u) * (m - 1u);
+    s *= S->radix[i];
+    n = m;
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  if(ifftFlag == 1u)
+  {
+    invL = 1.0f / (float32_t) L;
+    /*  Conjugate and scale output data */
+    pIn = p1;
+    for (l = 0u; l < L; l++)
+    {
+      *pIn++ *= invL;
+      *pIn = -(*pIn) * invL;
+      pIn++;
+    }
+  }
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
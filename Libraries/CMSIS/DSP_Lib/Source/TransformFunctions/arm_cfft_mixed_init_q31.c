@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_init_q31.c    
+*    
+* Description:	Mixed-radix (2, 3, 4, 5) Q31 CFFT & CIFFT initialization function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+* @brief  Initialization function for the Q31 mixed-radix CFFT/CIFFT.   
+* @param[in,out] *S         points to an instance of the Q31 mixed-radix CFFT structure.   
+* @param[in]     fftLen     length of the FFT.   
+* @param[out]    *pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>, filled by this function.   
+* @param[in]     *pBuffer   points to the work buffer of size <code>2*fftLen</code>.   
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.   
+*    
+* \par Description:   
+* \par    
+* <code>fftLen</code> can be any length from 2 to 65535 of the form 2^a * 3^b * 5^c, such as 480, 960 or 1200.    
+* The length is split into radix-4 stages, at most one radix-2 stage, and radix-3 and radix-5 stages,    
+* in that order. The twiddle factors of all the stages are computed into <code>pTwiddle</code>, which    
+* together with the instance makes up the plan of the transform and may be shared by instances of the same length.    
+* \par    
+* The work buffer is used by arm_cfft_mixed_q31() to hold every other stage and is free between calls.    
+*/
+
+arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pBuffer)
+{
+  uint32_t n, m, r, p, k, i;                     /* Stage length, sub-length, radix and loop counters */
+  uint32_t nTwo = 0u, nFour = 0u, nThree = 0u, nFive = 0u;      /* Number of factors of each radix */
+  float64_t phase;                               /* Twiddle angle */
+
+  if(fftLen < 2u)
+  {
+    /* Reporting argument error if fftLen is not a supported value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Factor the length */
+  n = fftLen;
+  while((n & 3u) == 0u)
+  {
+    n >>= 2u;
+    nFour++;
+  }
+  if((n & 1u) == 0u)
+  {
+    n >>= 1u;
+    nTwo++;
+  }
+  while((n % 3u) == 0u)
+  {
+    n /= 3u;
+    nThree++;
+  }
+  while((n % 5u) == 0u)
+  {
+    n /= 5u;
+    nFive++;
+  }
+
+  if((n != 1u) || (nFour + nTwo + nThree + nFive > ARM_CFFT_MIXED_MAX_STAGES))
+  {
+    /* Reporting argument error if fftLen has other prime factors */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialise the FFT length, the stages and the work buffer */
+  S->fftLen = fftLen;
+  S->numStages = (uint8_t) (nFour + nTwo + nThree + nFive);
+  S->pTwiddle = pTwiddle;
+  S->pBuffer = pBuffer;
+
+  for (i = 0u; i < S->numStages; i++)
+  {
+    S->radix[i] = (i < nFour) ? 4u : (i < nFour + nTwo) ? 2u : (i < nFour + nTwo + nThree) ? 3u : 5u;
+  }
+
+  /* Twiddle factors exp(-2*pi*j*k*p/n) in 1.31 format, with 1 saturated to 0x7FFFFFFF, of each stage of length n = r * m, for    
+   ** p = 1 .. m-1 and k = 1 .. r-1, in the order used by the stage */
+  n = fftLen;
+  for (i = 0u; i < S->numStages; i++)
+  {
+    r = S->radix[i];
+    m = n / r;
+
+    for (p = 1u; p < m; p++)
+    {
+      for (k = 1u; k < r; k++)
+      {
+        phase = (6.283185307179586 * ((k * p) % n)) / n;
+        *pTwiddle++ = clip_q63_to_q31((q63_t) floor(cos(phase) * 2147483648.0 + 0.5));
+        *pTwiddle++ = clip_q63_to_q31((q63_t) floor(-sin(phase) * 2147483648.0 + 0.5));
+      }
+    }
+
+    n = m;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
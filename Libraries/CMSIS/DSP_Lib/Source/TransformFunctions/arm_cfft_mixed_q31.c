@@ -0,0 +1,408 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_q31.c    
+*    
+* Description:	Mixed-radix (2, 3, 4, 5) Q31 CFFT & CIFFT processing function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Constants of the butterflies in 1.31 format */
+#define ONE_THIRD   0x2AAAAAAB                   /* 1/3 */
+#define ONE_FIFTH   0x1999999A                   /* 1/5 */
+#define C3_1        0x6ED9EBA1                   /* sin(2*pi/3) */
+#define C5_1        0x278DDE6E                   /* cos(2*pi/5) */
+#define C5_2        (-0x678DDE6E)                /* cos(4*pi/5) */
+#define S5_1        0x79BC384D                   /* sin(2*pi/5) */
+#define S5_2        0x4B3C8C12                   /* sin(4*pi/5) */
+
+/* 1.31 x 1.31 multiplication truncated to 1.31 */
+#define MUL_Q31(a, b)   ((q31_t) (((q63_t) (a) * (b)) >> 31))
+
+/*    
+* The stages are those of arm_cfft_mixed_f32.c. The inputs of a radix-r    
+* butterfly are divided by r, so the magnitude of the values never grows    
+* and the output of the forward transform is the DFT divided by fftLen.    
+*/
+
+/* Stores the complex output (br, bi) rotated by the twiddle *pW, or as it is for p = 0 */
+#define STORE_TW(pY, br, bi, pW)                                                  \
+  if(p == 0u)                                                                     \
+  {                                                                               \
+    (pY)[0] = (br);                                                               \
+    (pY)[1] = (bi);                                                               \
+  }                                                                               \
+  else                                                                            \
+  {                                                                               \
+    (pY)[0] = (q31_t) ((((q63_t) (br) * (pW)[0]) - ((q63_t) (bi) * (pW)[1])) >> 31);  \
+    (pY)[1] = (q31_t) ((((q63_t) (br) * (pW)[1]) + ((q63_t) (bi) * (pW)[0])) >> 31);  \
+  }
+
+static void arm_cfft_mixed_radix2_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA;                               /* Inputs of the butterfly */
+  q31_t *pY;                                     /* Outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i;                      /* Temporary variables */
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 4u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      /* Inputs divided by 2 */
+      a0r = pA[0] >> 1;
+      a0i = pA[1] >> 1;
+      a1r = pA[sm] >> 1;
+      a1i = pA[sm + 1u] >> 1;
+
+      pY[0] = a0r + a1r;
+      pY[1] = a0i + a1i;
+      STORE_TW(pY + 2u * s, a0r - a1r, a0i - a1i, pTw);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 2u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix3_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA;                               /* Inputs of the butterfly */
+  q31_t *pY;                                     /* Outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i;            /* Temporary variables */
+  q31_t t1r, t1i, t2r, t2i, t3r, t3i;
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 6u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      /* Inputs divided by 3 */
+      a0r = MUL_Q31(pA[0], ONE_THIRD);
+      a0i = MUL_Q31(pA[1], ONE_THIRD);
+      a1r = MUL_Q31(pA[sm], ONE_THIRD);
+      a1i = MUL_Q31(pA[sm + 1u], ONE_THIRD);
+      a2r = MUL_Q31(pA[2u * sm], ONE_THIRD);
+      a2i = MUL_Q31(pA[2u * sm + 1u], ONE_THIRD);
+
+      /* t1 = a1 + a2, t3 = sin(2*pi/3) * (a1 - a2), t2 = a0 - t1 / 2 */
+      t1r = a1r + a2r;
+      t1i = a1i + a2i;
+      t3r = MUL_Q31(a1r - a2r, C3_1);
+      t3i = MUL_Q31(a1i - a2i, C3_1);
+      t2r = a0r - (t1r >> 1);
+      t2i = a0i - (t1i >> 1);
+
+      /* y0 = a0 + t1, y1 = t2 - i*t3, y2 = t2 + i*t3 */
+      pY[0] = a0r + t1r;
+      pY[1] = a0i + t1i;
+      STORE_TW(pY + 2u * s, t2r + t3i, t2i - t3r, pTw);
+      STORE_TW(pY + 4u * s, t2r - t3i, t2i + t3r, pTw + 2u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 4u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix4_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA;                               /* Inputs of the butterfly */
+  q31_t *pY;                                     /* Outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;  /* Temporary variables */
+  q31_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 8u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      /* Inputs divided by 4 */
+      a0r = pA[0] >> 2;
+      a0i = pA[1] >> 2;
+      a1r = pA[sm] >> 2;
+      a1i = pA[sm + 1u] >> 2;
+      a2r = pA[2u * sm] >> 2;
+      a2i = pA[2u * sm + 1u] >> 2;
+      a3r = pA[3u * sm] >> 2;
+      a3i = pA[3u * sm + 1u] >> 2;
+
+      /* t0 = a0 + a2, t1 = a0 - a2, t2 = a1 + a3, t3 = a1 - a3 */
+      t0r = a0r + a2r;
+      t0i = a0i + a2i;
+      t1r = a0r - a2r;
+      t1i = a0i - a2i;
+      t2r = a1r + a3r;
+      t2i = a1i + a3i;
+      t3r = a1r - a3r;
+      t3i = a1i - a3i;
+
+      /* y0 = t0 + t2, y1 = t1 - i*t3, y2 = t0 - t2, y3 = t1 + i*t3 */
+      pY[0] = t0r + t2r;
+      pY[1] = t0i + t2i;
+      STORE_TW(pY + 2u * s, t1r + t3i, t1i - t3r, pTw);
+      STORE_TW(pY + 4u * s, t0r - t2r, t0i - t2i, pTw + 2u);
+      STORE_TW(pY + 6u * s, t1r - t3i, t1i + t3r, pTw + 4u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 6u;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix5_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTw,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA;                               /* Inputs of the butterfly */
+  q31_t *pY;                                     /* Outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;       /* Temporary variables */
+  q31_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  q31_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+  uint32_t p, q, sm = 2u * s * m;                /* Loop counters and input stride */
+
+  for (p = 0u; p < m; p++)
+  {
+    pA = pIn + 2u * s * p;
+    pY = pOut + 10u * s * p;
+
+    for (q = 0u; q < s; q++)
+    {
+      /* Inputs divided by 5 */
+      a0r = MUL_Q31(pA[0], ONE_FIFTH);
+      a0i = MUL_Q31(pA[1], ONE_FIFTH);
+      a1r = MUL_Q31(pA[sm], ONE_FIFTH);
+      a1i = MUL_Q31(pA[sm + 1u], ONE_FIFTH);
+      a2r = MUL_Q31(pA[2u * sm], ONE_FIFTH);
+      a2i = MUL_Q31(pA[2u * sm + 1u], ONE_FIFTH);
+      a3r = MUL_Q31(pA[3u * sm], ONE_FIFTH);
+      a3i = MUL_Q31(pA[3u * sm + 1u], ONE_FIFTH);
+      a4r = MUL_Q31(pA[4u * sm], ONE_FIFTH);
+      a4i = MUL_Q31(pA[4u * sm + 1u], ONE_FIFTH);
+
+      /* t1 = a1 + a4, t2 = a2 + a3, t3 = a1 - a4, t4 = a2 - a3 */
+      t1r = a1r + a4r;
+      t1i = a1i + a4i;
+      t2r = a2r + a3r;
+      t2i = a2i + a3i;
+      t3r = a1r - a4r;
+      t3i = a1i - a4i;
+      t4r = a2r - a3r;
+      t4i = a2i - a3i;
+
+      /* Real parts b and imaginary parts d of the rotations */
+      b1r = a0r + (q31_t) ((((q63_t) t1r * C5_1) + ((q63_t) t2r * C5_2)) >> 31);
+      b1i = a0i + (q31_t) ((((q63_t) t1i * C5_1) + ((q63_t) t2i * C5_2)) >> 31);
+      b2r = a0r + (q31_t) ((((q63_t) t1r * C5_2) + ((q63_t) t2r * C5_1)) >> 31);
+      b2i = a0i + (q31_t) ((((q63_t) t1i * C5_2) + ((q63_t) t2i * C5_1)) >> 31);
+      d1r = (q31_t) ((((q63_t) t3r * S5_1) + ((q63_t) t4r * S5_2)) >> 31);
+      d1i = (q31_t) ((((q63_t) t3i * S5_1) + ((q63_t) t4i * S5_2)) >> 31);
+      d2r = (q31_t) ((((q63_t) t3r * S5_2) - ((q63_t) t4r * S5_1)) >> 31);
+      d2i = (q31_t) ((((q63_t) t3i * S5_2) - ((q63_t) t4i * S5_1)) >> 31);
+
+      /* y0 = a0 + t1 + t2, y1 = b1 - i*d1, y2 = b2 - i*d2, y3 = b2 + i*d2, y4 = b1 + i*d1 */
+      pY[0] = a0r + t1r + t2r;
+      pY[1] = a0i + t1i + t2i;
+      STORE_TW(pY + 2u * s, b1r + d1i, b1i - d1r, pTw);
+      STORE_TW(pY + 4u * s, b2r + d2i, b2i - d2r, pTw + 2u);
+      STORE_TW(pY + 6u * s, b2r - d2i, b2i + d2r, pTw + 4u);
+      STORE_TW(pY + 8u * s, b1r - d1i, b1i + d1r, pTw + 6u);
+
+      pA += 2u;
+      pY += 2u;
+    }
+
+    if(p > 0u)
+    {
+      pTw += 8u;
+    }
+  }
+}
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+* @brief Processing function for the Q31 mixed-radix CFFT/CIFFT.   
+* @param[in]      *S        points to an instance of the Q31 mixed-radix CFFT structure.   
+* @param[in, out] *p1       points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.   
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.   
+* @return none.   
+*    
+* \par Description:   
+* \par    
+* Computes the FFT of lengths that are not a power of two, such as 480, 960 or 1200,    
+* without zero padding. The stages are self-sorting, so the output is in natural order.    
+* \par Scaling and Overflow Behavior:   
+* \par    
+* The inputs of each radix-r stage are divided by r, so the forward transform gives    
+* the DFT divided by <code>fftLen</code> and the inverse transform gives the textbook    
+* inverse DFT, both in 1.31 format. Inputs of magnitude below 1 cannot overflow.    
+* \par    
+* The instance is set up by arm_cfft_mixed_init_q31(). Its work buffer is used    
+* during the call, so instances that may run at the same time need their own buffers.    
+*/
+
+void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen, n, m, s, i, l;         /* Lengths, stride and loop counters */
+  const q31_t *pTw = S->pTwiddle;                /* Twiddles of the current stage */
+  q31_t *pIn, *pOut, *pTmp;                      /* Buffers of the current stage */
+
+  if(ifftFlag == 1u)
+  {
+    /*  Conjugate input data  */
+    pIn = p1 + 1;
+    for (l = 0u; l < L; l++)
+    {
+      *pIn = __QSUB(0, *pIn);
+      pIn += 2;
+    }
+  }
+
+  /* The stages alternate between p1 and the work buffer. With an odd number    
+   ** of stages, the input is moved to the work buffer first so that the result ends in p1. */
+  if((S->numStages & 1u) != 0u)
+  {
+    memcpy(S->pBuffer, p1, 2u * L * sizeof(q31_t));
+    pIn = S->pBuffer;
+    pOut = p1;
+  }
+  else
+  {
+    pIn = p1;
+    pOut = S->pBuffer;
+  }
+
+  n = L;
+  s = 1u;
+
+  for (i = 0u; i < S->numStages; i++)
+  {
+    m = n / S->radix[i];
+
+    switch (S->radix[i])
+    {
+    case 2u:
+      arm_cfft_mixed_radix2_q31(pIn, pOut, pTw, m, s);
+      break;
+    case 3u:
+      arm_cfft_mixed_radix3_q31(pIn, pOut, pTw, m, s);
+      break;
+    case 4u:
+      arm_cfft_mixed_radix4_q31(pIn, pOut, pTw, m, s);
+      break;
+    default:
+      arm_cfft_mixed_radix5_q31(pIn, pOut, pTw, m, s);
+      break;
+    }
+
+    /* Twiddles of the next stage */
+    pTw += 2u * (S->radix[i] - 1u) * (m - 1u);
+    s *= S->radix[i];
+    n = m;
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  if(ifftFlag == 1u)
+  {
+    /*  Conjugate output data  */
+    pIn = p1 + 1;
+    for (l = 0u; l < L; l++)
+    {
+      *pIn = __QSUB(0, *pIn);
+      pIn += 2;
+    }
+  }
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
@@ -137,6 +137,214 @@
 * @return none.   
 */
 
+#if defined (ARM_MATH_SSE2)
+
+/*    
+* Host build with SSE2. Four butterflies of a stage run at a time, one per    
+* lane, with the real and imaginary parts in separate vectors: consecutive    
+* butterflies j of a group, or the butterflies of consecutive groups in the    
+* last stage. Each lane computes the same expressions as the C code, so the    
+* result is bit-exact. The outputs of the butterflies without twiddles are    
+* the values that are otherwise multiplied by the twiddles.    
+*/
+
+/*    
+* @brief  Four butterflies on the points i1[l] + k * n2 of lane l.   
+* @param[in]      contig  the butterflies are consecutive (i1[l] = i1[0] + l), else lanes may repeat.   
+* @param[in]      *tw     twiddles co2..co8 in tw[0..6] and si2..si8 in tw[7..13], or NULL.   
+* @param[in]      lane0   lane 0 takes no twiddles (j = 0).   
+*/
+
+static __INLINE void arm_radix8_bfly_sse(
+float32_t * pSrc,
+const uint32_t * i1,
+uint32_t n2,
+uint32_t contig,
+const __m128 * tw,
+uint32_t lane0)
+{
+   __m128 xr[8], xi[8];
+   __m128 a, b;
+   __m128 r1, r2, r3, r4, r5, r6, r7, r8;
+   __m128 t1, t2;
+   __m128 s1, s2, s3, s4, s5, s6, s7, s8;
+   const __m128 C81 = _mm_set1_ps(0.70710678118f);
+   uint32_t k, o;
+
+   for (k = 0u; k < 8u; k++)
+   {
+      o = k * n2;
+      if(contig)
+      {
+         a = _mm_loadu_ps(&pSrc[2u * (i1[0] + o)]);
+         b = _mm_loadu_ps(&pSrc[2u * (i1[0] + o) + 4u]);
+      }
+      else
+      {
+         a = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (__m64 *) &pSrc[2u * (i1[0] + o)]),
+                          (__m64 *) &pSrc[2u * (i1[1] + o)]);
+         b = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (__m64 *) &pSrc[2u * (i1[2] + o)]),
+                          (__m64 *) &pSrc[2u * (i1[3] + o)]);
+      }
+      xr[k] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+      xi[k] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+   }
+
+/* Output k from the values re, im before the twiddle co(k+1), si(k+1) */
+#define R8_TWIDDLE(k, re, im)                                                               \
+   if(tw == NULL)                                                                           \
+   {                                                                                        \
+      xr[k] = (re);                                                                         \
+      xi[k] = (im);                                                                         \
+   }                                                                                        \
+   else                                                                                     \
+   {                                                                                        \
+      a = _mm_add_ps(_mm_mul_ps(tw[(k) - 1], (re)), _mm_mul_ps(tw[(k) + 6], (im)));         \
+      b = _mm_sub_ps(_mm_mul_ps(tw[(k) - 1], (im)), _mm_mul_ps(tw[(k) + 6], (re)));         \
+      xr[k] = lane0 ? _mm_move_ss(a, (re)) : a;                                             \
+      xi[k] = lane0 ? _mm_move_ss(b, (im)) : b;                                             \
+   }
+
+   r1 = _mm_add_ps(xr[0], xr[4]);
+   r5 = _mm_sub_ps(xr[0], xr[4]);
+   r2 = _mm_add_ps(xr[1], xr[5]);
+   r6 = _mm_sub_ps(xr[1], xr[5]);
+   r3 = _mm_add_ps(xr[2], xr[6]);
+   r7 = _mm_sub_ps(xr[2], xr[6]);
+   r4 = _mm_add_ps(xr[3], xr[7]);
+   r8 = _mm_sub_ps(xr[3], xr[7]);
+   t1 = _mm_sub_ps(r1, r3);
+   r1 = _mm_add_ps(r1, r3);
+   r3 = _mm_sub_ps(r2, r4);
+   r2 = _mm_add_ps(r2, r4);
+   xr[0] = _mm_add_ps(r1, r2);
+   r2 = _mm_sub_ps(r1, r2);
+   s1 = _mm_add_ps(xi[0], xi[4]);
+   s5 = _mm_sub_ps(xi[0], xi[4]);
+   s2 = _mm_add_ps(xi[1], xi[5]);
+   s6 = _mm_sub_ps(xi[1], xi[5]);
+   s3 = _mm_add_ps(xi[2], xi[6]);
+   s7 = _mm_sub_ps(xi[2], xi[6]);
+   s4 = _mm_add_ps(xi[3], xi[7]);
+   s8 = _mm_sub_ps(xi[3], xi[7]);
+   t2 = _mm_sub_ps(s1, s3);
+   s1 = _mm_add_ps(s1, s3);
+   s3 = _mm_sub_ps(s2, s4);
+   s2 = _mm_add_ps(s2, s4);
+   r1 = _mm_add_ps(t1, s3);
+   t1 = _mm_sub_ps(t1, s3);
+   xi[0] = _mm_add_ps(s1, s2);
+   s2 = _mm_sub_ps(s1, s2);
+   s1 = _mm_sub_ps(t2, r3);
+   t2 = _mm_add_ps(t2, r3);
+   R8_TWIDDLE(4, r2, s2);
+   R8_TWIDDLE(2, r1, s1);
+   R8_TWIDDLE(6, t1, t2);
+   r1 = _mm_mul_ps(_mm_sub_ps(r6, r8), C81);
+   r6 = _mm_mul_ps(_mm_add_ps(r6, r8), C81);
+   s1 = _mm_mul_ps(_mm_sub_ps(s6, s8), C81);
+   s6 = _mm_mul_ps(_mm_add_ps(s6, s8), C81);
+   t1 = _mm_sub_ps(r5, r1);
+   r5 = _mm_add_ps(r5, r1);
+   r8 = _mm_sub_ps(r7, r6);
+   r7 = _mm_add_ps(r7, r6);
+   t2 = _mm_sub_ps(s5, s1);
+   s5 = _mm_add_ps(s5, s1);
+   s8 = _mm_sub_ps(s7, s6);
+   s7 = _mm_add_ps(s7, s6);
+   r1 = _mm_add_ps(r5, s7);
+   r5 = _mm_sub_ps(r5, s7);
+   r6 = _mm_add_ps(t1, s8);
+   t1 = _mm_sub_ps(t1, s8);
+   s1 = _mm_sub_ps(s5, r7);
+   s5 = _mm_add_ps(s5, r7);
+   s6 = _mm_sub_ps(t2, r8);
+   t2 = _mm_add_ps(t2, r8);
+   R8_TWIDDLE(1, r1, s1);
+   R8_TWIDDLE(7, r5, s5);
+   R8_TWIDDLE(5, r6, s6);
+   R8_TWIDDLE(3, t1, t2);
+
+#undef R8_TWIDDLE
+
+   for (k = 0u; k < 8u; k++)
+   {
+      o = k * n2;
+      a = _mm_unpacklo_ps(xr[k], xi[k]);
+      b = _mm_unpackhi_ps(xr[k], xi[k]);
+      if(contig)
+      {
+         _mm_storeu_ps(&pSrc[2u * (i1[0] + o)], a);
+         _mm_storeu_ps(&pSrc[2u * (i1[0] + o) + 4u], b);
+      }
+      else
+      {
+         _mm_storel_pi((__m64 *) &pSrc[2u * (i1[0] + o)], a);
+         _mm_storeh_pi((__m64 *) &pSrc[2u * (i1[1] + o)], a);
+         _mm_storel_pi((__m64 *) &pSrc[2u * (i1[2] + o)], b);
+         _mm_storeh_pi((__m64 *) &pSrc[2u * (i1[3] + o)], b);
+      }
+   }
+}
+
+void arm_radix8_butterfly_f32(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier)
+{
+   uint32_t i1[4], ia, i, j, k, l;
+   uint32_t n1, n2;
+   __m128 tw[14];
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      if(n2 >= 8u)
+      {
+         /* Butterflies j .. j + 3 of every group, with the twiddle indices k * j * twidCoefModifier */
+         for (j = 0u; j < n2; j += 4u)
+         {
+            for (k = 0u; k < 7u; k++)
+            {
+               ia = (k + 1u) * j * twidCoefModifier;
+               l = (k + 1u) * twidCoefModifier;
+               tw[k] = _mm_setr_ps(pCoef[2u * ia], pCoef[2u * (ia + l)],
+                                   pCoef[2u * (ia + 2u * l)], pCoef[2u * (ia + 3u * l)]);
+               tw[k + 7u] = _mm_setr_ps(pCoef[2u * ia + 1u], pCoef[2u * (ia + l) + 1u],
+                                        pCoef[2u * (ia + 2u * l) + 1u], pCoef[2u * (ia + 3u * l) + 1u]);
+            }
+
+            for (i = j; i < fftLen; i += n1)
+            {
+               i1[0] = i;
+               arm_radix8_bfly_sse(pSrc, i1, n2, 1u, tw, (j == 0u));
+            }
+         }
+      }
+      else
+      {
+         /* Butterflies without twiddles of the groups i1 = 0, n1, 2 * n1... */
+         for (i = 0u; i < fftLen; i += 4u * n1)
+         {
+            for (l = 0u; l < 4u; l++)
+            {
+               i1[l] = (i + l * n1 < fftLen) ? i + l * n1 : i1[l - 1u];
+            }
+            arm_radix8_bfly_sse(pSrc, i1, n2, 0u, NULL, 0u);
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while(n2 > 7);
+}
+
+#else
+
 void arm_radix8_butterfly_f32(
 float32_t * pSrc,
 uint16_t fftLen,
@@ -379,6 +587,8 @@ uint16_t twidCoefModifier)
    } while(n2 > 7);   
 }
 
+#endif /* #if defined (ARM_MATH_SSE2) */
+
 /**    
 * @} end of Radix8_CFFT_CIFFT group    
 */
@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_f32.c    
+*    
+* Description:	Floating-point Goertzel filter bank.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup Goertzel Goertzel Filter Bank    
+ *    
+ * Computes the power of a few selected frequencies of consecutive blocks of    
+ * <code>blockLength</code> samples, such as the eight tones of DTMF signaling,    
+ * for far less than a full FFT. Each bin is a second order resonator    
+ * <pre>    
+ *    s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]    
+ * </pre>    
+ * which costs one multiply and two additions per sample and per bin. After the    
+ * last sample of the block the DFT value of the bin follows from the two states    
+ * <pre>    
+ *    X = s[n] - exp(-j * w) * s[n-1]    
+ * </pre>    
+ * up to a phase, and the function writes its power |X|^2. The frequency w = 2*pi*f    
+ * of a bin is set by any normalized frequency f in cycles per sample, so it need    
+ * not fall on the grid k / blockLength of the DFT.    
+ *    
+ * \par    
+ * The processing function takes any number of samples per call. It returns the    
+ * number of analyses completed within the call and writes <code>numBins</code> powers    
+ * for each of them to the output buffer, so the output buffer must hold    
+ * <code>numBins * (blockSize / blockLength + 1)</code> values. The analyses are not    
+ * windowed and do not overlap.    
+ *    
+ * \par    
+ * The work is O(numBins) per sample against O(log2(blockLength)) per sample for    
+ * an FFT, so the filter bank is faster than arm_rfft_fast_f32() followed by    
+ * arm_cmplx_mag_squared_f32() for up to about log2(blockLength) bins. Use the \ref SlidingDFT "sliding DFT" instead    
+ * when the bins are needed after every sample.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables of a filter bank are stored together in an    
+ * instance data structure. A separate instance structure must be defined for each    
+ * filter bank. The coefficient arrays may be shared among several instances.    
+ * There are separate instance structure declarations for the floating-point and Q31 data types.    
+ *    
+ * \par Initialization Functions    
+ * The initialization functions compute the coefficients <code>{cos(w), sin(w)}</code>    
+ * of each bin from the list of frequencies, clear the state and start the first analysis.    
+ * There are separate initialization functions for the floating-point and Q31 data types.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The Q31 resonators have 64-bit states and do not overflow for a block length of up to 32768.    
+ * The power is that of X scaled down by 2^ceil(log2(blockLength)), as computed by    
+ * arm_cmplx_mag_squared_q31(), in 3.29 format.    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point Goertzel filter bank.    
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the powers of the analyses completed within the call.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        number of analyses completed within the call.    
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs;                      /* Coefficient pointer */
+  float32_t *pState;                             /* State pointer */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t c2, s0, s1, s2, re, im;              /* Coefficient, states and DFT value */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t count = S->count;                     /* Samples of the current analysis */
+  uint32_t numOut = 0u;                          /* Number of completed analyses */
+  uint32_t n, k, i, done;                        /* Loop counters and end of analysis flag */
+
+  while(blockSize > 0u)
+  {
+    /* Samples of the current analysis in this call */
+    n = S->blockLength - count;
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+    done = (count + n == S->blockLength);
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    k = numBins;
+
+#if defined (ARM_MATH_SSE2)
+
+    /* Run the below code for the host build with SSE2.    
+     ** Four bins run in the lanes, with the operations of the C code in the same order.    
+     ** Two groups of four bins hide the latency of the recursion. For the last four bins    
+     ** the second group is a copy of the first. */
+    while(k >= 4u)
+    {
+      __m128 va, vb, vx, vc[2], vs[2], vc2[2], vs1[2], vs2[2], vre, vim;
+      uint32_t m = (k >= 8u) ? 4u : 0u;          /* Offset of the second group */
+      uint32_t j;                                /* Group counter */
+
+      for (j = 0u; j < 2u; j++)
+      {
+        va = _mm_loadu_ps(pCoeffs + 2u * m * j);
+        vb = _mm_loadu_ps(pCoeffs + 2u * m * j + 4u);
+        vc[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(2, 0, 2, 0));
+        vs[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(3, 1, 3, 1));
+        vc2[j] = _mm_add_ps(vc[j], vc[j]);
+
+        va = _mm_loadu_ps(pState + 2u * m * j);
+        vb = _mm_loadu_ps(pState + 2u * m * j + 4u);
+        vs1[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(2, 0, 2, 0));
+        vs2[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(3, 1, 3, 1));
+      }
+
+      /* Two samples per iteration, the states swap roles in between */
+      pIn = pSrc;
+      for (i = n >> 1u; i > 0u; i--)
+      {
+        vx = _mm_set1_ps(pIn[0]);
+        vs2[0] = _mm_sub_ps(_mm_add_ps(vx, _mm_mul_ps(vc2[0], vs1[0])), vs2[0]);
+        vs2[1] = _mm_sub_ps(_mm_add_ps(vx, _mm_mul_ps(vc2[1], vs1[1])), vs2[1]);
+        vx = _mm_set1_ps(pIn[1]);
+        vs1[0] = _mm_sub_ps(_mm_add_ps(vx, _mm_mul_ps(vc2[0], vs2[0])), vs1[0]);
+        vs1[1] = _mm_sub_ps(_mm_add_ps(vx, _mm_mul_ps(vc2[1], vs2[1])), vs1[1]);
+        pIn += 2u;
+      }
+
+      for (j = 0u; j < 2u; j++)
+      {
+        if((n & 1u) != 0u)
+        {
+          va = _mm_sub_ps(_mm_add_ps(_mm_set1_ps(*pIn), _mm_mul_ps(vc2[j], vs1[j])), vs2[j]);
+          vs2[j] = vs1[j];
+          vs1[j] = va;
+        }
+
+        if(done)
+        {
+          /* Power of the DFT value, and a new analysis */
+          vre = _mm_sub_ps(vs1[j], _mm_mul_ps(vc[j], vs2[j]));
+          vim = _mm_mul_ps(vs[j], vs2[j]);
+          _mm_storeu_ps(pDst + (numBins - k) + m * j,
+                        _mm_add_ps(_mm_mul_ps(vre, vre), _mm_mul_ps(vim, vim)));
+          vs1[j] = _mm_setzero_ps();
+          vs2[j] = vs1[j];
+        }
+
+        _mm_storeu_ps(pState + 2u * m * j, _mm_unpacklo_ps(vs1[j], vs2[j]));
+        _mm_storeu_ps(pState + 2u * m * j + 4u, _mm_unpackhi_ps(vs1[j], vs2[j]));
+      }
+
+      pCoeffs += 8u + 2u * m;
+      pState += 8u + 2u * m;
+      k -= 4u + m;
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    while(k > 0u)
+    {
+      c2 = 2.0f * pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Two samples per iteration, the states swap roles in between */
+      i = n >> 1u;
+      while(i > 0u)
+      {
+        s2 = (pIn[0] + (c2 * s1)) - s2;
+        s1 = (pIn[1] + (c2 * s2)) - s1;
+        pIn += 2u;
+        i--;
+      }
+
+      if((n & 1u) != 0u)
+      {
+        s0 = (*pIn + (c2 * s1)) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      for (i = 0u; i < n; i++)
+      {
+        s0 = (*pIn++ + (c2 * s1)) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      if(done)
+      {
+        /* Power of the DFT value, and a new analysis */
+        re = s1 - (pCoeffs[0] * s2);
+        im = pCoeffs[1] * s2;
+        pDst[numBins - k] = (re * re) + (im * im);
+        s1 = 0.0f;
+        s2 = 0.0f;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+
+      pCoeffs += 2u;
+      pState += 2u;
+      k--;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    count += n;
+
+    if(done)
+    {
+      count = 0u;
+      pDst += numBins;
+      numOut++;
+    }
+  }
+
+  S->count = (uint16_t) count;
+
+  return (numOut);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_init_q31.c    
+*    
+* Description:	Q31 Goertzel filter bank initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 Goertzel filter bank.    
+ * @param[in,out] *S            points to an instance of the Q31 Goertzel structure.    
+ * @param[in]     numBins       number of frequency bins.    
+ * @param[in]     blockLength   number of samples of each analysis, from 1 to 32768.    
+ * @param[in]     *pFreqs       points to the normalized frequencies of the bins, in cycles per sample, in 1.31 format.    
+ * @param[out]    *pCoeffs      points to the coefficient buffer of size <code>2*numBins</code>, filled by this function.    
+ * @param[in]     *pState       points to the state buffer of size <code>2*numBins</code>.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>blockLength</code> is not a supported value.    
+ *    
+ * \par Description:    
+ * \par    
+ * The frequencies range from 0 to 0.5, 0x40000000. The coefficients are rounded to 1.31 format,    
+ * with cos(0) saturated to 0x7FFFFFFF.    
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState)
+{
+  float64_t phase;                               /* Frequency in radians per sample */
+  uint32_t k;                                    /* Loop counter */
+
+  if((blockLength == 0u) || (blockLength > 32768u))
+  {
+    /* Reporting argument error if blockLength is not a supported value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialise the number of bins, the block length and the buffers */
+  S->numBins = numBins;
+  S->blockLength = blockLength;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Coefficients {cos(w), sin(w)} of each bin in 1.31 format */
+  for (k = 0u; k < numBins; k++)
+  {
+    phase = (6.283185307179586 * pFreqs[k]) / 2147483648.0;
+    *pCoeffs++ = clip_q63_to_q31((q63_t) floor(cos(phase) * 2147483648.0 + 0.5));
+    *pCoeffs++ = clip_q63_to_q31((q63_t) floor(sin(phase) * 2147483648.0 + 0.5));
+  }
+
+  /* Clear state buffer and size is always 2*numBins */
+  memset(pState, 0, (2u * numBins) * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_q31.c    
+*    
+* Description:	Q31 Goertzel filter bank.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/* (c * s) >> 30, that is 2 * c * s in the units of s, for a Q31 coefficient and a 64-bit state */
+static __INLINE q63_t arm_goertzel_mult2_q31(
+  q31_t c,
+  q63_t s)
+{
+  return ((((q63_t) c * (q31_t) (s >> 32)) * 4) + (((q63_t) c * (uint32_t) s) >> 30));
+}
+
+/* (c * s) >> 31 for a Q31 coefficient and a 64-bit state */
+static __INLINE q63_t arm_goertzel_mult_q31(
+  q31_t c,
+  q63_t s)
+{
+  return ((((q63_t) c * (q31_t) (s >> 32)) * 2) + (((q63_t) c * (uint32_t) s) >> 31));
+}
+
+/**    
+ * @brief Processing function for the Q31 Goertzel filter bank.    
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the powers of the analyses completed within the call.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        number of analyses completed within the call.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The states are kept in 64-bit integers in the units of the input and cannot overflow    
+ * for a block length of up to 32768. The 64 x 32-bit products are computed exactly from    
+ * two 32 x 32-bit products and truncated. The real and imaginary parts of the DFT value    
+ * are scaled down by 2^ceil(log2(blockLength)) and saturated to 1.31 format, and their    
+ * power is written in 3.29 format as by arm_cmplx_mag_squared_q31().    
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pCoeffs;                          /* Coefficient pointer */
+  q63_t *pState;                                 /* State pointer */
+  q31_t *pIn;                                    /* Input pointer */
+  q31_t c, re, im;                               /* Coefficient and scaled DFT value */
+  q63_t s0, s1, s2;                              /* States */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t count = S->count;                     /* Samples of the current analysis */
+  uint32_t shift = 32u - __CLZ((uint32_t) S->blockLength - 1u);   /* ceil(log2(blockLength)) */
+  uint32_t numOut = 0u;                          /* Number of completed analyses */
+  uint32_t n, k, i, done;                        /* Loop counters and end of analysis flag */
+
+  while(blockSize > 0u)
+  {
+    /* Samples of the current analysis in this call */
+    n = S->blockLength - count;
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+    done = (count + n == S->blockLength);
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (k = 0u; k < numBins; k++)
+    {
+      c = pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Two samples per iteration, the states swap roles in between */
+      i = n >> 1u;
+      while(i > 0u)
+      {
+        s2 = (q63_t) pIn[0] + arm_goertzel_mult2_q31(c, s1) - s2;
+        s1 = (q63_t) pIn[1] + arm_goertzel_mult2_q31(c, s2) - s1;
+        pIn += 2u;
+        i--;
+      }
+
+      if((n & 1u) != 0u)
+      {
+        s0 = (q63_t) * pIn + arm_goertzel_mult2_q31(c, s1) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      for (i = 0u; i < n; i++)
+      {
+        s0 = (q63_t) * pIn++ + arm_goertzel_mult2_q31(c, s1) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      if(done)
+      {
+        /* Power of the scaled DFT value in 3.29 format, and a new analysis */
+        re = clip_q63_to_q31((s1 - arm_goertzel_mult_q31(c, s2)) >> shift);
+        im = clip_q63_to_q31(arm_goertzel_mult_q31(pCoeffs[1], s2) >> shift);
+        pDst[k] = (q31_t) ((((q63_t) re * re) + ((q63_t) im * im)) >> 33);
+        s1 = 0;
+        s2 = 0;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+
+      pCoeffs += 2u;
+      pState += 2u;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    count += n;
+
+    if(done)
+    {
+      count = 0u;
+      pDst += numBins;
+      numOut++;
+    }
+  }
+
+  S->count = (uint16_t) count;
+
+  return (numOut);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
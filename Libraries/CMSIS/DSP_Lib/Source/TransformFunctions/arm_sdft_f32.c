@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_f32.c    
+*    
+* Description:	Floating-point sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Number of samples of the comb stage computed ahead of the resonators */
+#define SDFT_BLOCK    32u
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup SlidingDFT Sliding DFT    
+ *    
+ * Keeps selected bins of the DFT of the last <code>fftLen</code> samples up to date    
+ * after every sample. With the bins on the DFT grid, bin k of the window ending at    
+ * sample n is updated from the one ending at sample n-1 by    
+ * <pre>    
+ *    X[k] = (X[k] + x[n] - x[n-fftLen]) * exp(j * 2*pi * k / fftLen)    
+ * </pre>    
+ * which is a comb stage shared by all the bins followed by a complex resonator per    
+ * bin, or four multiplies and four additions per sample and per bin. The bins are    
+ * those of the window in natural order, as computed by arm_cfft_radix4_f32() of the    
+ * last <code>fftLen</code> samples with the oldest one first.    
+ *    
+ * \par    
+ * The resonators sit on the unit circle and would keep the rounding errors forever,    
+ * so they are damped by a radius r slightly below 1 and the comb stage subtracts    
+ * r^fftLen * x[n-fftLen]. The bins are then those of the window weighted by    
+ * r^(fftLen-m) for its sample m, from r^fftLen for the oldest to r for the newest.    
+ * r is 1 - 2^-17 in floating-point, a weight of 0.992 at the oldest sample of a    
+ * 1024-sample window, and 1 - 2^-20 in Q31.    
+ *    
+ * \par    
+ * The processing function takes any number of samples and writes the complex bins    
+ * after the last sample, <code>{real, imag}</code> for each bin. The comb stage runs    
+ * ahead of the resonators in runs of 32 samples on the stack, so each resonator    
+ * keeps its state in registers over the run. Use the \ref Goertzel "Goertzel filter bank"    
+ * instead when the power of consecutive blocks is enough.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables of a sliding DFT are stored together in an    
+ * instance data structure. A separate instance structure must be defined for each    
+ * sliding DFT. The coefficient arrays may be shared among several instances of the same length.    
+ * There are separate instance structure declarations for the floating-point and Q31 data types.    
+ *    
+ * \par Initialization Functions    
+ * The initialization functions compute the coefficients <code>{r*cos(2*pi*k/fftLen), r*sin(2*pi*k/fftLen)}</code>    
+ * of each bin from the list of bin indices, and clear the bins and the delay line.    
+ * The state buffer holds the <code>2*numBins</code> bin values followed by the    
+ * <code>fftLen</code> samples of the delay line.    
+ * There are separate initialization functions for the floating-point and Q31 data types.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The Q31 comb stage scales the input down by 2^(ceil(log2(fftLen))+1), so the    
+ * Q31 bins are those of the DFT scaled down by the same amount and cannot overflow.    
+ * The resonators round their products to 1.31 format.    
+ */
+
+/**    
+ * @addtogroup SlidingDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point sliding DFT.    
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the <code>2*numBins</code> complex bins after the last sample.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        none.    
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t diff[SDFT_BLOCK];                    /* Output of the comb stage */
+  float32_t *pBins = S->pState;                  /* Bins */
+  float32_t *pDelay = S->pState + (2u * S->numBins);    /* Delay line */
+  const float32_t *pCoeffs;                      /* Coefficient pointer */
+  float32_t *pB;                                 /* Bin pointer */
+  float32_t rN = S->rN;                          /* Damping of the oldest sample */
+  float32_t x, t, re, im, cr, ci;                /* Temporary variables */
+  uint32_t index = S->delayIndex;                /* Oldest sample of the delay line */
+  uint32_t n, k, i;                              /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    n = (blockSize < SDFT_BLOCK) ? blockSize : SDFT_BLOCK;
+
+    /* Comb stage x[n] - r^N * x[n-N], and the delay line */
+    for (i = 0u; i < n; i++)
+    {
+      x = *pSrc++;
+      diff[i] = x - (rN * pDelay[index]);
+      pDelay[index] = x;
+
+      index++;
+      if(index == S->fftLen)
+      {
+        index = 0u;
+      }
+    }
+
+    pCoeffs = S->pCoeffs;
+    pB = pBins;
+    k = S->numBins;
+
+#if defined (ARM_MATH_SSE2)
+
+    /* Run the below code for the host build with SSE2.    
+     ** Four bins run in the lanes, with the operations of the C code in the same order.    
+     ** Two groups of four bins hide the latency of the resonators. For the last four bins    
+     ** the second group is a copy of the first. */
+    while(k >= 4u)
+    {
+      __m128 va, vb, vd, vt0, vt1, vcr[2], vci[2], vre[2], vim[2];
+      uint32_t m = (k >= 8u) ? 4u : 0u;          /* Offset of the second group */
+      uint32_t j;                                /* Group counter */
+
+      for (j = 0u; j < 2u; j++)
+      {
+        va = _mm_loadu_ps(pCoeffs + 2u * m * j);
+        vb = _mm_loadu_ps(pCoeffs + 2u * m * j + 4u);
+        vcr[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(2, 0, 2, 0));
+        vci[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(3, 1, 3, 1));
+
+        va = _mm_loadu_ps(pB + 2u * m * j);
+        vb = _mm_loadu_ps(pB + 2u * m * j + 4u);
+        vre[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(2, 0, 2, 0));
+        vim[j] = _mm_shuffle_ps(va, vb, _MM_SHUFFLE(3, 1, 3, 1));
+      }
+
+      for (i = 0u; i < n; i++)
+      {
+        vd = _mm_set1_ps(diff[i]);
+        vt0 = _mm_add_ps(vre[0], vd);
+        vt1 = _mm_add_ps(vre[1], vd);
+        vre[0] = _mm_sub_ps(_mm_mul_ps(vt0, vcr[0]), _mm_mul_ps(vim[0], vci[0]));
+        vre[1] = _mm_sub_ps(_mm_mul_ps(vt1, vcr[1]), _mm_mul_ps(vim[1], vci[1]));
+        vim[0] = _mm_add_ps(_mm_mul_ps(vt0, vci[0]), _mm_mul_ps(vim[0], vcr[0]));
+        vim[1] = _mm_add_ps(_mm_mul_ps(vt1, vci[1]), _mm_mul_ps(vim[1], vcr[1]));
+      }
+
+      for (j = 0u; j < 2u; j++)
+      {
+        _mm_storeu_ps(pB + 2u * m * j, _mm_unpacklo_ps(vre[j], vim[j]));
+        _mm_storeu_ps(pB + 2u * m * j + 4u, _mm_unpackhi_ps(vre[j], vim[j]));
+      }
+
+      pCoeffs += 8u + 2u * m;
+      pB += 8u + 2u * m;
+      k -= 4u + m;
+    }
+
+#endif /* #if defined (ARM_MATH_SSE2) */
+
+    /* Resonators (X + d) * r * exp(j*2*pi*k/N) */
+    while(k > 0u)
+    {
+      cr = pCoeffs[0];
+      ci = pCoeffs[1];
+      re = pB[0];
+      im = pB[1];
+
+      for (i = 0u; i < n; i++)
+      {
+        t = re + diff[i];
+        re = (t * cr) - (im * ci);
+        im = (t * ci) + (im * cr);
+      }
+
+      pB[0] = re;
+      pB[1] = im;
+
+      pCoeffs += 2u;
+      pB += 2u;
+      k--;
+    }
+
+    blockSize -= n;
+  }
+
+  S->delayIndex = (uint16_t) index;
+
+  /* Copy the bins to the destination */
+  memcpy(pDst, pBins, (2u * S->numBins) * sizeof(float32_t));
+}
+
+/**    
+ * @} end of SlidingDFT group    
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_init_q31.c    
+*    
+* Description:	Q31 sliding DFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Radius of the resonators, 1 - 2^-20 */
+#define SDFT_RADIUS   0.9999990463256836
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SlidingDFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 sliding DFT.    
+ * @param[in,out] *S            points to an instance of the Q31 sliding DFT structure.    
+ * @param[in]     numBins       number of DFT bins.    
+ * @param[in]     fftLen        length of the sliding window.    
+ * @param[in]     *pBinIndex    points to the indices k of the bins, from 0 to <code>fftLen-1</code>.    
+ * @param[out]    *pCoeffs      points to the coefficient buffer of size <code>2*numBins</code>, filled by this function.    
+ * @param[in]     *pState       points to the state buffer of size <code>2*numBins+fftLen</code>.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is 0 or a bin index is not below <code>fftLen</code>.    
+ *    
+ * \par Description:    
+ * \par    
+ * The coefficients are the rotations by the bin frequencies scaled by the radius 1 - 2^-20 in 1.31 format.    
+ * The bins and the delay line start at zero, so the bins are those of a window    
+ * padded with zeros until <code>fftLen</code> samples have been processed.    
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBinIndex,
+  q31_t * pCoeffs,
+  q31_t * pState)
+{
+  float64_t phase;                               /* Bin frequency in radians per sample */
+  uint32_t k;                                    /* Loop counter */
+
+  if(fftLen == 0u)
+  {
+    /* Reporting argument error if fftLen is not a supported value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0u; k < numBins; k++)
+  {
+    if(pBinIndex[k] >= fftLen)
+    {
+      /* Reporting argument error if a bin is out of range */
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* Initialise the number of bins, the window length and the buffers */
+  S->numBins = numBins;
+  S->fftLen = fftLen;
+  S->delayIndex = 0u;
+  S->rN = clip_q63_to_q31((q63_t) floor((pow(SDFT_RADIUS, fftLen)) * 2147483648.0 + 0.5));
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Coefficients {r*cos(2*pi*k/N), r*sin(2*pi*k/N)} of each bin */
+  for (k = 0u; k < numBins; k++)
+  {
+    phase = (6.283185307179586 * pBinIndex[k]) / fftLen;
+    *pCoeffs++ = clip_q63_to_q31((q63_t) floor((SDFT_RADIUS * cos(phase)) * 2147483648.0 + 0.5));
+    *pCoeffs++ = clip_q63_to_q31((q63_t) floor((SDFT_RADIUS * sin(phase)) * 2147483648.0 + 0.5));
+  }
+
+  /* Clear state buffer and size is always 2*numBins+fftLen */
+  memset(pState, 0, ((2u * numBins) + fftLen) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SlidingDFT group    
+ */
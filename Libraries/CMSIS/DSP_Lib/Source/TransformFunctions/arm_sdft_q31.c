@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_q31.c    
+*    
+* Description:	Q31 sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Number of samples of the comb stage computed ahead of the resonators */
+#define SDFT_BLOCK    32u
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SlidingDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 sliding DFT.    
+ * @param[in,out] *S         points to an instance of the Q31 sliding DFT structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the <code>2*numBins</code> complex bins after the last sample.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The comb stage is computed in 64 bits, rounded and scaled down by 2^(ceil(log2(fftLen))+1),    
+ * so the bins are at most half of full scale and the additions cannot overflow. The    
+ * products of the resonators are accumulated in 2.62 format and rounded to 1.31 format.    
+ * The bins keep the rounding errors for about 2^20 samples, and drift by up to about    
+ * 2000 LSB from the exact sliding DFT.    
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t diff[SDFT_BLOCK];                        /* Output of the comb stage */
+  q31_t *pBins = S->pState;                      /* Bins */
+  q31_t *pDelay = S->pState + (2u * S->numBins); /* Delay line */
+  const q31_t *pCoeffs;                          /* Coefficient pointer */
+  q31_t *pB;                                     /* Bin pointer */
+  q31_t rN = S->rN;                              /* Damping of the oldest sample */
+  q31_t x, t, re, im, cr, ci;                    /* Temporary variables */
+  uint32_t shift = 32u - __CLZ((uint32_t) S->fftLen - 1u) + 1u + 31u;     /* Down scaling of the comb stage */
+  uint32_t index = S->delayIndex;                /* Oldest sample of the delay line */
+  uint32_t n, k, i;                              /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    n = (blockSize < SDFT_BLOCK) ? blockSize : SDFT_BLOCK;
+
+    /* Comb stage x[n] - r^N * x[n-N] in 2.62 format, rounded and scaled down, and the delay line */
+    for (i = 0u; i < n; i++)
+    {
+      x = *pSrc++;
+      diff[i] = (q31_t) ((((q63_t) x << 31) - ((q63_t) rN * pDelay[index]) + ((q63_t) 1 << (shift - 1u))) >> shift);
+      pDelay[index] = x;
+
+      index++;
+      if(index == S->fftLen)
+      {
+        index = 0u;
+      }
+    }
+
+    /* Resonators (X + d) * r * exp(j*2*pi*k/N) */
+    pCoeffs = S->pCoeffs;
+    pB = pBins;
+
+    for (k = 0u; k < S->numBins; k++)
+    {
+      cr = pCoeffs[0];
+      ci = pCoeffs[1];
+      re = pB[0];
+      im = pB[1];
+
+      for (i = 0u; i < n; i++)
+      {
+        t = re + diff[i];
+        re = (q31_t) ((((q63_t) t * cr) - ((q63_t) im * ci) + 0x40000000) >> 31);
+        im = (q31_t) ((((q63_t) t * ci) + ((q63_t) im * cr) + 0x40000000) >> 31);
+      }
+
+      pB[0] = re;
+      pB[1] = im;
+
+      pCoeffs += 2u;
+      pB += 2u;
+    }
+
+    blockSize -= n;
+  }
+
+  S->delayIndex = (uint16_t) index;
+
+  /* Copy the bins to the destination */
+  memcpy(pDst, pBins, (2u * S->numBins) * sizeof(q31_t));
+}
+
+/**    
+ * @} end of SlidingDFT group    
+ */
@@ -0,0 +1,259 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stft_f32.c    
+*    
+* Description:	Floating-point short-time Fourier transform.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* 10 * log10(2), the dB per octave of power */
+#define STFT_DB_LOG2     3.010299956639812f
+
+/* log2(1 + t) for t in [0, 1), with an error below 1.5e-5 */
+#define STFT_LOG2_C1     1.4419656174876816f
+#define STFT_LOG2_C2    -0.70966282891874f
+#define STFT_LOG2_C3     0.41759580405380675f
+#define STFT_LOG2_C4    -0.1962696591243035f
+#define STFT_LOG2_C5     0.04638536870538555f
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup STFT Short-Time Fourier Transform    
+ *    
+ * Turns a stream of samples into a spectrogram: every <code>hopSize</code> samples    
+ * the last <code>fftLen</code> samples are windowed, transformed by a real FFT and    
+ * reduced to the power of each bin, or to the energy of mel bands, optionally in dB.    
+ * The stages run on a single work buffer of the instance, without the separate passes    
+ * and scratch buffers of arm_mult_f32(), arm_rfft_fast_f32() and arm_cmplx_mag_squared_f32()    
+ * called one after the other.    
+ *    
+ * \par    
+ * The processing function takes any number of samples per call. The samples go to a    
+ * ring buffer of the last <code>fftLen</code> samples, which starts at zero, and a frame    
+ * is emitted each time <code>hopSize</code> more samples have arrived, so frames overlap    
+ * by <code>fftLen - hopSize</code> samples. The function returns the number of frames emitted    
+ * within the call and writes them one after the other to the output buffer, which must    
+ * hold <code>(blockSize / hopSize + 1)</code> frames. Nothing is allocated.    
+ *    
+ * \par Frames    
+ * Without bands, a frame is the power <code>|X[k]|^2</code> of the bins k = 0 to <code>fftLen/2</code>.    
+ * With <code>numBands</code> bands, band m is a triangular filter over the bins from    
+ * <code>pBandEdges[m]</code> to <code>pBandEdges[m+2]</code>, with its peak at    
+ * <code>pBandEdges[m+1]</code>, and a frame holds the <code>numBands</code> weighted sums of the power.    
+ * For mel bands the edges are spaced evenly on the mel scale <code>2595 * log10(1 + f / 700)</code>    
+ * between the lowest and the highest frequency, and rounded to the nearest bin <code>f * fftLen / Fs</code>.    
+ * The edges must increase strictly and be at most <code>fftLen/2</code>.    
+ *    
+ * \par    
+ * With <code>logFlag</code> set the frames are in dB, <code>10 * log10(power)</code>. The logarithm    
+ * is taken from the exponent of the power and a polynomial of its mantissa. The error is    
+ * below 0.0001 dB in floating-point, and below 0.0004 dB before the rounding to 1/128 dB in Q15.    
+ *    
+ * \par Instance Structure    
+ * The window, the bands, the ring buffer and the work buffer of an STFT are referred to by    
+ * an instance data structure, which also holds the instance of the real FFT. A separate    
+ * instance structure must be defined for each STFT. The window, the band edges and the band    
+ * weights may be shared among several instances.    
+ * There are separate instance structure declarations for the floating-point and Q15 data types.    
+ *    
+ * \par Initialization Functions    
+ * The initialization functions check the lengths and the bands, initialize the real FFT,    
+ * compute the weights of the bins in the bands and clear the ring buffer.    
+ * A Hann window is <code>0.5 - 0.5 * cos(2 * pi * n / fftLen)</code>.    
+ * There are separate initialization functions for the floating-point and Q15 data types.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The Q15 STFT runs arm_rfft_q15(), whose output is the DFT scaled down by <code>fftLen/2</code>.    
+ * Powers are in 3.13 format as computed by arm_cmplx_mag_squared_q15(), and    
+ * dB are in 8.7 format, that is in steps of 1/128 dB.    
+ */
+
+/**    
+ * @addtogroup STFT    
+ * @{    
+ */
+
+/* 10 * log10(x) for x above 1e-20, and -200 dB below */
+static __INLINE float32_t arm_stft_db_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the power */
+  float32_t t;                                   /* Mantissa - 1 */
+  int32_t e;                                     /* Exponent */
+
+  u.f = (x > 1.0e-20f) ? x : 1.0e-20f;
+  e = (u.i >> 23) - 127;
+  u.i = (u.i & 0x007FFFFF) | 0x3F800000;
+  t = u.f - 1.0f;
+
+  return (STFT_DB_LOG2 * ((float32_t) e +
+                          (t * (STFT_LOG2_C1 + t * (STFT_LOG2_C2 + t * (STFT_LOG2_C3 + t * (STFT_LOG2_C4 + t * STFT_LOG2_C5)))))));
+}
+
+/**    
+ * @brief Processing function for the floating-point STFT.    
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the frames emitted within the call.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        number of frames emitted within the call.    
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Ring buffer */
+  float32_t *pFrame = S->pBuffer;                /* Windowed frame */
+  float32_t *pSpec = S->pBuffer + S->fftLen;     /* Spectrum, then power */
+  const uint16_t *pEdge = S->pBandEdges;         /* Band edges */
+  const float32_t *pW = S->pBandWeights;         /* Band weights */
+  float32_t re, im, nyq, acc;                    /* Temporary variables */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t half = S->fftLen >> 1u;               /* Index of the Nyquist bin */
+  uint32_t frameSize = (S->numBands != 0u) ? S->numBands : half + 1u;      /* Values per frame */
+  uint32_t index = S->stateIndex;                /* Oldest sample of the ring buffer */
+  uint32_t count = S->count;                     /* Samples since the last frame */
+  uint32_t numOut = 0u;                          /* Number of frames */
+  uint32_t n, k, m;                              /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the next frame, or up to the end of the ring buffer */
+    n = S->hopSize - count;
+    if(n > fftLen - index)
+    {
+      n = fftLen - index;
+    }
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    memcpy(pState + index, pSrc, n * sizeof(float32_t));
+    pSrc += n;
+    blockSize -= n;
+    count += n;
+    index += n;
+    if(index == fftLen)
+    {
+      index = 0u;
+    }
+
+    if(count < S->hopSize)
+    {
+      continue;
+    }
+    count = 0u;
+
+    /* Windowed frame, with the oldest sample first */
+    arm_mult_f32(pState + index, (float32_t *) S->pWindow, pFrame, fftLen - index);
+    arm_mult_f32(pState, (float32_t *) S->pWindow + (fftLen - index), pFrame + (fftLen - index), index);
+
+    arm_rfft_fast_f32(&S->Srfft, pFrame, pSpec, 0u);
+
+    if(S->numBands == 0u)
+    {
+      /* Power of the bins, the real DC and Nyquist values are packed in the first two */
+      pDst[0] = pSpec[0] * pSpec[0];
+      pDst[half] = pSpec[1] * pSpec[1];
+      for (k = 1u; k < half; k++)
+      {
+        re = pSpec[2u * k];
+        im = pSpec[(2u * k) + 1u];
+        pDst[k] = (re * re) + (im * im);
+      }
+    }
+    else
+    {
+      /* Power of the bins in place, each written below the values still to be read */
+      nyq = pSpec[1];
+      pSpec[0] = pSpec[0] * pSpec[0];
+      for (k = 1u; k < half; k++)
+      {
+        re = pSpec[2u * k];
+        im = pSpec[(2u * k) + 1u];
+        pSpec[k] = (re * re) + (im * im);
+      }
+      pSpec[half] = nyq * nyq;
+
+      /* Rising and falling slope of each band */
+      for (m = 0u; m < S->numBands; m++)
+      {
+        acc = 0.0f;
+        for (k = pEdge[m]; k < pEdge[m + 1u]; k++)
+        {
+          acc += pW[k] * pSpec[k];
+        }
+        for (k = pEdge[m + 1u]; k < pEdge[m + 2u]; k++)
+        {
+          acc += (1.0f - pW[k]) * pSpec[k];
+        }
+        pDst[m] = acc;
+      }
+    }
+
+    if(S->logFlag != 0u)
+    {
+      for (k = 0u; k < frameSize; k++)
+      {
+        pDst[k] = arm_stft_db_f32(pDst[k]);
+      }
+    }
+
+    pDst += frameSize;
+    numOut++;
+  }
+
+  S->stateIndex = (uint16_t) index;
+  S->count = (uint16_t) count;
+
+  return (numOut);
+}
+
+/**    
+ * @} end of STFT group    
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stft_init_f32.c    
+*    
+* Description:	Floating-point short-time Fourier transform initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup STFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point STFT.    
+ * @param[in,out] *S            points to an instance of the floating-point STFT structure.    
+ * @param[in]     fftLen        length of the frames, 32 to 4096 as supported by arm_rfft_fast_init_f32().    
+ * @param[in]     hopSize       number of samples between two frames, from 1 to <code>fftLen</code>.    
+ * @param[in]     *pWindow      points to the window of length <code>fftLen</code>.    
+ * @param[in]     numBands      number of bands, or 0 for the power of the <code>fftLen/2+1</code> bins.    
+ * @param[in]     *pBandEdges   points to the <code>numBands+2</code> band edges, in bins. Not used when <code>numBands</code> is 0.    
+ * @param[out]    *pBandWeights points to the band weight buffer of size <code>fftLen/2+1</code>, filled by this function. Not used when <code>numBands</code> is 0.    
+ * @param[in]     logFlag       selects the power (logFlag=0) or the power in dB (logFlag=1).    
+ * @param[in]     *pState       points to the state buffer of size <code>fftLen</code>.    
+ * @param[in]     *pBuffer      points to the work buffer of size <code>2*fftLen</code>.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if a length or the band edges are not supported.    
+ *    
+ * \par Description:    
+ * \par    
+ * The weight of bin k between two edges <code>pBandEdges[j] <= k < pBandEdges[j+1]</code> is    
+ * <code>(k - pBandEdges[j]) / (pBandEdges[j+1] - pBandEdges[j])</code>. It is the weight    
+ * of the bin on the rising slope of band j, and one minus it is its weight on the falling    
+ * slope of band j-1.    
+ * \par    
+ * The work buffer is free between calls of the processing function.    
+ */
+
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  uint16_t numBands,
+  const uint16_t * pBandEdges,
+  float32_t * pBandWeights,
+  uint8_t logFlag,
+  float32_t * pState,
+  float32_t * pBuffer)
+{
+  uint32_t j, k;                                 /* Loop counters */
+
+  if(arm_rfft_fast_init_f32(&S->Srfft, fftLen) != ARM_MATH_SUCCESS)
+  {
+    /* Reporting argument error if fftLen is not a supported value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if((hopSize == 0u) || (hopSize > fftLen))
+  {
+    /* Reporting argument error if hopSize is not a supported value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if(numBands > 0u)
+  {
+    for (j = 0u; j <= numBands; j++)
+    {
+      if(pBandEdges[j] >= pBandEdges[j + 1u])
+      {
+        /* Reporting argument error if the edges do not increase */
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+    }
+
+    if(pBandEdges[numBands + 1u] > (fftLen >> 1u))
+    {
+      /* Reporting argument error if the last edge is above the Nyquist bin */
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Weights of the bins on the rising slopes */
+    for (j = 0u; j <= numBands; j++)
+    {
+      for (k = pBandEdges[j]; k < pBandEdges[j + 1u]; k++)
+      {
+        pBandWeights[k] = (float32_t) (k - pBandEdges[j]) / (float32_t) (pBandEdges[j + 1u] - pBandEdges[j]);
+      }
+    }
+  }
+
+  /* Initialise the lengths, the bands and the buffers */
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->stateIndex = 0u;
+  S->count = 0u;
+  S->numBands = numBands;
+  S->logFlag = logFlag;
+  S->pWindow = pWindow;
+  S->pBandEdges = pBandEdges;
+  S->pBandWeights = pBandWeights;
+  S->pState = pState;
+  S->pBuffer = pBuffer;
+
+  /* Clear state buffer and size is always fftLen */
+  memset(pState, 0, fftLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of STFT group    
+ */
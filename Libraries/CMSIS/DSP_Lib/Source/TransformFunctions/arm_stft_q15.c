@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        18. October 2026  
+* $Revision: 	V1.4.1  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stft_q15.c    
+*    
+* Description:	Q15 short-time Fourier transform.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.     
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* 10 * log10(2) * 128 * 2^16, the steps of 1/128 dB per octave of power in 16.16 format */
+#define STFT_DB_LOG2     25252226
+
+/* log2(1 + t) for t in [0, 1) in 2.30 format, with an error below 1.1e-4 */
+#define STFT_LOG2_C1     1545130047
+#define STFT_LOG2_C2     (-730083073)
+#define STFT_LOG2_C3     349603344
+#define STFT_LOG2_C4     (-91018350)
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup STFT    
+ * @{    
+ */
+
+/* 10 * log10(x * 2^-q) in 8.7 format for a 64-bit energy x, and 0x8000 for x = 0 */
+static q15_t arm_stft_db_q15(
+  q63_t x,
+  int32_t q)
+{
+  uint32_t hi = (uint32_t) ((uint64_t) x >> 32); /* Upper word of the energy */
+  uint32_t lo = (uint32_t) x;                    /* Lower word of the energy */
+  uint32_t z;                                    /* Leading zeros */
+  int32_t e;                                     /* Exponent */
+  q31_t t, p;                                    /* Mantissa - 1 in 1.31 format and its logarithm */
+  q63_t l;                                       /* log2(x) - q in 34.30 format */
+
+  if(hi != 0u)
+  {
+    z = __CLZ(hi);
+    e = 63 - (int32_t) z;
+    t = (q31_t) (((hi << z) | ((z != 0u) ? (lo >> (32u - z)) : 0u)) & 0x7FFFFFFFu);
+  }
+  else if(lo != 0u)
+  {
+    z = __CLZ(lo);
+    e = 31 - (int32_t) z;
+    t = (q31_t) ((lo << z) & 0x7FFFFFFFu);
+  }
+  else
+  {
+    return ((q15_t) 0x8000);
+  }
+
+  /* Polynomial of the mantissa */
+  p = STFT_LOG2_C4;
+  p = STFT_LOG2_C3 + (q31_t) (((q63_t) p * t) >> 31);
+  p = STFT_LOG2_C2 + (q31_t) (((q63_t) p * t) >> 31);
+  p = STFT_LOG2_C1 + (q31_t) (((q63_t) p * t) >> 31);
+  p = (q31_t) (((q63_t) p * t) >> 31);
+
+  l = ((q63_t) (e - q) * 1073741824) + p;
+
+  return ((q15_t) __SSAT((q31_t) (((l * STFT_DB_LOG2) + ((q63_t) 1 << 45)) >> 46), 16));
+}
+
+/**    
+ * @brief Processing function for the Q15 STFT.    
+ * @param[in,out] *S         points to an instance of the Q15 STFT structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the frames emitted within the call.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return        number of frames emitted within the call.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The window is applied with arm_mult_q15() and the frame transformed with arm_rfft_q15(),    
+ * whose output is the DFT scaled down by <code>fftLen/2</code>. The power of a bin is computed    
+ * in 2.30 format and truncated to 3.13 format as by arm_cmplx_mag_squared_q15().    
+ * The energy of a band is the sum of the 2.30 powers times the 1.15 weights in a 64-bit    
+ * accumulator, truncated to 3.13 format and saturated. In dB, the 2.30 power or the 64-bit    
+ * energy give <code>10 * log10(power)</code> in 8.7 format, rounded and saturated, and a power of    
+ * zero gives 0x8000.    
+ */
+
+uint32_t arm_stft_q15(
+  arm_stft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* Ring buffer */
+  q15_t *pFrame = S->pBuffer;                    /* Windowed frame */
+  q15_t *pSpec = S->pBuffer + S->fftLen;         /* Spectrum */
+  const uint16_t *pEdge = S->pBandEdges;         /* Band edges */
+  const q15_t *pW = S->pBandWeights;             /* Band weights */
+  q31_t re, im;                                  /* Temporary variables */
+  q63_t power, acc;                              /* Power of a bin and energy of a band */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t half = S->fftLen >> 1u;               /* Index of the Nyquist bin */
+  uint32_t frameSize = (S->numBands != 0u) ? S->numBands : half + 1u;      /* Values per frame */
+  uint32_t index = S->stateIndex;                /* Oldest sample of the ring buffer */
+  uint32_t count = S->count;                     /* Samples since the last frame */
+  uint32_t numOut = 0u;                          /* Number of frames */
+  uint32_t n, k, m;                              /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the next frame, or up to the end of the ring buffer */
+    n = S->hopSize - count;
+    if(n > fftLen - index)
+    {
+      n = fftLen - index;
+    }
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    memcpy(pState + index, pSrc, n * sizeof(q15_t));
+    pSrc += n;
+    blockSize -= n;
+    count += n;
+    index += n;
+    if(index == fftLen)
+    {
+      index = 0u;
+    }
+
+    if(count < S->hopSize)
+    {
+      continue;
+    }
+    count = 0u;
+
+    /* Windowed frame, with the oldest sample first */
+    arm_mult_q15(pState + index, (q15_t *) S->pWindow, pFrame, fftLen - index);
+    arm_mult_q15(pState, (q15_t *) S->pWindow + (fftLen - index), pFrame + (fftLen - index), index);
+
+    /* The complex spectrum of fftLen/2 + 1 bins, the frame is overwritten */
+    arm_rfft_q15(&S->Srfft, pFrame, pSpec);
+
+    if(S->numBands == 0u)
+    {
+      for (k = 0u; k <= half; k++)
+      {
+        re = pSpec[2u * k];
+        im = pSpec[(2u * k) + 1u];
+        power = ((q63_t) re * re) + ((q63_t) im * im);
+
+        pDst[k] = (S->logFlag != 0u) ? arm_stft_db_q15(power, 30) : (q15_t) (power >> 17);
+      }
+    }
+    else
+    {
+      /* Rising and falling slope of each band */
+      for (m = 0u; m < S->numBands; m++)
+      {
+        acc = 0;
+        for (k = pEdge[m]; k < pEdge[m + 1u]; k++)
+        {
+          re = pSpec[2u * k];
+          im = pSpec[(2u * k) + 1u];
+          acc += (((q63_t) re * re) + ((q63_t) im * im)) * pW[k];
+        }
+        for (k = pEdge[m + 1u]; k < pEdge[m + 2u]; k++)
+        {
+          re = pSpec[2u * k];
+          im = pSpec[(2u * k) + 1u];
+          acc += (((q63_t) re * re) + ((q63_t) im * im)) * (32768 - pW[k]);
+        }
+
+        pDst[m] = (S->logFlag != 0u) ? arm_stft_db_q15(acc, 45) :
+          (q15_t) __SSAT((q31_t) (acc >> 32), 16);
+      }
+    }
+
+    pDst += frameSize;
+    numOut++;
+  }
+
+  S->stateIndex = (uint16_t) index;
+  S->count = (uint16_t) count;
+
+  return (numOut);
+}
+
+/**    
+ * @} end of STFT group    
+ */
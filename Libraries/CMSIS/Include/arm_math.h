@@ -128,6 +128,14 @@
    * Define macro ARM_MATH_CM4 for building the library on Cortex-M4 target, ARM_MATH_CM3 for building library on Cortex-M3 target
    * and ARM_MATH_CM0 for building library on cortex-M0 target, ARM_MATH_CM0PLUS for building library on cortex-M0+ target.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST for building the library on an x86-64 host with GCC or Clang (see <code>CMSIS\\DSP_Lib\\Source\\Host</code>).
+   * The Cortex-M3 code paths are used, and arm_fir_f32, arm_biquad_cascade_df1_f32, arm_dot_prod_f32, arm_cmplx_mag_f32,
+   * arm_cfft_f32, arm_dot_prod_q15 and arm_fir_q15 run SSE2 kernels, or AVX2 kernels when built with -mavx2 -mfma.
+   * arm_dot_prod_q31 and arm_fir_q31 need SSE4.1 (-msse4.1) for their kernels.
+   * The fixed-point kernels are bit-exact with the C code. Define ARM_MATH_HOST_NOSIMD in addition to build the C code only.
+   *
    * - __FPU_PRESENT:
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries
@@ -145,8 +153,10 @@
 /**
  * @defgroup groupFastMath Fast Math Functions
  * This set of functions provides a fast approximation to sine, cosine, and square root.
- * As compared to most of the other functions in the CMSIS math library, the fast math functions
+ * As compared to most of the other functions in the CMSIS math library, these fast math functions
  * operate on individual values and not arrays.
+ * The vector functions compute the exponential, logarithm, arc tangent, hyperbolic tangent
+ * and square root of arrays, with the maximum error of each documented.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
  */
@@ -181,7 +191,7 @@
  *       float32_t *pData;     // points to the data of the matrix.
  *     } arm_matrix_instance_f32;
  * </pre>
- * There are similar definitions for Q15 and Q31 data types.
+ * There are similar definitions for double-precision floating-point, Q15 and Q31 data types.
  *
  * The structure specifies the size of the matrix and then points to
  * an array of data.  The array is of size <code>numRows X numCols</code>
@@ -195,8 +205,8 @@
  * There is an associated initialization function for each type of matrix
  * data structure.
  * The initialization function sets the values of the internal structure fields.
- * Refer to the function <code>arm_mat_init_f32()</code>, <code>arm_mat_init_q31()</code>
- * and <code>arm_mat_init_q15()</code> for floating-point, Q31 and Q15 types,  respectively.
+ * Refer to the function <code>arm_mat_init_f32()</code>, <code>arm_mat_init_f64()</code>, <code>arm_mat_init_q31()</code>
+ * and <code>arm_mat_init_q15()</code> for floating-point, double-precision floating-point, Q31 and Q15 types,  respectively.
  *
  * \par
  * Use of the initialization function is optional. However, if initialization function is used
@@ -276,6 +286,8 @@
 #elif defined (ARM_MATH_CM0PLUS)
 #include "core_cm0plus.h"
 #define ARM_MATH_CM0_FAMILY
+#elif defined (ARM_MATH_HOST)
+#include "core_host.h"
 #else
 #include "ARMCM4.h"
 #warning "Define either ARM_MATH_CM4 OR ARM_MATH_CM3...By Default building on ARM_MATH_CM4....."
@@ -341,7 +353,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by the Cholesky and LDLT factorizations if the input matrix cannot be factored. */
   } arm_status;
 
   /**
@@ -397,7 +410,7 @@ extern "C"
 
 #define __SIMD64(addr)  (*(int64_t **) & (addr))
 
-#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY)
+#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY) || defined (ARM_MATH_HOST)
   /**
    * @brief definition to pack two 16 bit values.
    */
@@ -480,6 +493,136 @@ extern "C"
             (((q63_t) (x >> 32) * y)));
   }
 
+  /**
+   * @brief Subtracts a scaled row from another, pDst[j] -= scale * pSrc[j], in the matrix factorizations and solves.
+   */
+  static __INLINE void arm_mat_row_msub_f32(
+  float32_t * pDst,
+  const float32_t * pSrc,
+  float32_t scale,
+  uint32_t n)
+  {
+    uint32_t cnt;                                  /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    cnt = n >> 2u;
+
+    while(cnt > 0u)
+    {
+      pDst[0] -= scale * pSrc[0];
+      pDst[1] -= scale * pSrc[1];
+      pDst[2] -= scale * pSrc[2];
+      pDst[3] -= scale * pSrc[3];
+      pDst += 4u;
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+
+    /* The remaining 1 to 3 values */
+    cnt = n % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    cnt = n;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(cnt > 0u)
+    {
+      *pDst++ -= scale * *pSrc++;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+  }
+
+  /**
+   * @brief Divides a row by a value, in the matrix solves.
+   */
+  static __INLINE void arm_mat_row_div_f32(
+  float32_t * pDst,
+  float32_t div,
+  uint32_t n)
+  {
+    while(n > 0u)
+    {
+      *pDst++ /= div;
+      n--;
+    }
+  }
+
+  /**
+   * @brief Subtracts a scaled row from another, pDst[j] -= scale * pSrc[j], in the matrix factorizations and solves.
+   */
+  static __INLINE void arm_mat_row_msub_f64(
+  float64_t * pDst,
+  const float64_t * pSrc,
+  float64_t scale,
+  uint32_t n)
+  {
+    uint32_t cnt;                                  /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    cnt = n >> 2u;
+
+    while(cnt > 0u)
+    {
+      pDst[0] -= scale * pSrc[0];
+      pDst[1] -= scale * pSrc[1];
+      pDst[2] -= scale * pSrc[2];
+      pDst[3] -= scale * pSrc[3];
+      pDst += 4u;
+      pSrc += 4u;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+
+    /* The remaining 1 to 3 values */
+    cnt = n % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    cnt = n;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(cnt > 0u)
+    {
+      *pDst++ -= scale * *pSrc++;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+  }
+
+  /**
+   * @brief Divides a row by a value, in the matrix solves.
+   */
+  static __INLINE void arm_mat_row_div_f64(
+  float64_t * pDst,
+  float64_t div,
+  uint32_t n)
+  {
+    while(n > 0u)
+    {
+      *pDst++ /= div;
+      n--;
+    }
+  }
+
 
 #if defined (ARM_MATH_CM0_FAMILY) && defined ( __CC_ARM   )
 #define __CLZ __clz
@@ -658,9 +801,9 @@ extern "C"
 
 
   /*
-   * @brief C custom defined intrinsic function for M3 and M0 processors
+   * @brief C custom defined intrinsic function for M3 and M0 processors and the host build
    */
-#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY)
+#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY) || defined (ARM_MATH_HOST)
 
   /*
    * @brief C custom defined QADD8 for M3 and M0 processors
@@ -1036,7 +1179,7 @@ extern "C"
   }
 
 
-#endif /* defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY) */
+#endif /* defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY) || defined (ARM_MATH_HOST) */
 
 
   /**
@@ -1232,6 +1375,92 @@ extern "C"
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    q15_t *pCoeffs;           /**< points to the coefficient array shared by the channels. The array is of length numTaps.*/
+  } arm_fir_mc_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    float32_t *pCoeffs;       /**< points to the coefficient array shared by the channels. The array is of length numTaps. */
+  } arm_fir_mc_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 multichannel FIR filter.
+   * @param[in] *S points to an instance of the Q15 multichannel FIR structure.
+   * @param[in] *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in] blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_mc_q15(
+  const arm_fir_mc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 multichannel FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	numChannels  Number of interleaved channels.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of frames that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_mc_init_q15(
+  arm_fir_mc_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multichannel FIR filter.
+   * @param[in] *S points to an instance of the floating-point multichannel FIR structure.
+   * @param[in] *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in] blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point multichannel FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	numChannels  Number of interleaved channels.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of frames that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_mc_init_f32(
+  arm_fir_mc_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -1399,6 +1628,142 @@ extern "C"
   float32_t * pState);
 
 
+  /**
+   * @brief Instance structure for the Q15 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t *pCoeffs;           /**< Points to the array of coefficients shared by the channels.  The array is of length 6*numStages. */
+    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_mc_inst_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of interleaved channels. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients shared by the channels.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_mc_inst_q31;
+
+  /**
+   * @brief Instance structure for the floating-point multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;       /**< number of interleaved channels. */
+    float32_t *pState;          /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    float32_t *pCoeffs;         /**< Points to the array of coefficients shared by the channels.  The array is of length 5*numStages. */
+  } arm_biquad_casd_df1_mc_inst_f32;
+
+  /**
+   * @brief Processing function for the Q15 multichannel Biquad cascade filter.
+   * @param[in]  *S points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_mc_q15(
+  const arm_biquad_casd_df1_mc_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_mc_init_q15(
+  arm_biquad_casd_df1_mc_inst_q15 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
+  /**
+   * @brief Processing function for the Q31 multichannel Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of interleaved input frames.
+   * @param[out] *pDst      points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_mc_q31(
+  const arm_biquad_casd_df1_mc_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_mc_init_q31(
+  arm_biquad_casd_df1_mc_inst_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+  /**
+   * @brief Processing function for the floating-point multichannel Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the floating-point multichannel Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of interleaved input frames.
+   * @param[out] *pDst      points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_mc_f32(
+  const arm_biquad_casd_df1_mc_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the floating-point multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_mc_init_f32(
+  arm_biquad_casd_df1_mc_inst_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
   /**
    * @brief Instance structure for the floating-point matrix structure.
    */
@@ -1434,6 +1799,17 @@ extern "C"
 
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the double-precision floating-point matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float64_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_instance_f64;
+
 
 
   /**
@@ -1531,6 +1907,20 @@ extern "C"
   const arm_matrix_instance_f32 * pSrcB,
   arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Double-precision floating-point matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
   /**
    * @brief Q15 matrix multiplication
    * @param[in]       *pSrcA points to the first input matrix structure
@@ -1726,6 +2116,21 @@ extern "C"
   uint16_t nColumns,
   float32_t * pData);
 
+  /**
+   * @brief  Double-precision floating-point matrix initialization.
+   * @param[in,out] *S             points to an instance of the double-precision floating-point matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
+   */
+
+  void arm_mat_init_f64(
+  arm_matrix_instance_f64 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  float64_t * pData);
+
 
 
   /**
@@ -2134,43 +2539,206 @@ extern "C"
   uint8_t bitReverseFlag);
 
   /**
-   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   * @brief Maximum number of radix stages of the mixed-radix CFFT/CIFFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES  16u
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
    */
 
   typedef struct
   {
-    uint32_t fftLenReal;                      /**< length of the real FFT. */
-    uint32_t fftLenBy2;                       /**< length of the complex FFT. */
-    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-    uint8_t bitReverseFlagR;                      /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
-    q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
-    arm_cfft_radix4_instance_q15 *pCfft;          /**< points to the complex FFT instance. */
-  } arm_rfft_instance_q15;
-
-  arm_status arm_rfft_init_q15(
-  arm_rfft_instance_q15 * S,
-  arm_cfft_radix4_instance_q15 * S_CFFT,
-  uint32_t fftLenReal,
-  uint32_t ifftFlagR,
-  uint32_t bitReverseFlag);
+    uint16_t fftLen;                                /**< length of the FFT, of the form 2^a * 3^b * 5^c. */
+    uint8_t numStages;                              /**< number of radix stages. */
+    uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];       /**< radix (2, 3, 4 or 5) of each stage, from the first one. */
+    const float32_t *pTwiddle;                      /**< points to the twiddle factors of the stages. */
+    float32_t *pBuffer;                             /**< points to the work buffer of size 2*fftLen. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pBuffer);
 
-  void arm_rfft_q15(
-  const arm_rfft_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst);
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
 
   /**
-   * @brief Instance structure for the Q31 RFFT/RIFFT function.
+   * @brief Instance structure for the Q31 mixed-radix CFFT/CIFFT function.
    */
 
   typedef struct
   {
-    uint32_t fftLenReal;                        /**< length of the real FFT. */
-    uint32_t fftLenBy2;                         /**< length of the complex FFT. */
-    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-    uint8_t bitReverseFlagR;                        /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint16_t fftLen;                                /**< length of the FFT, of the form 2^a * 3^b * 5^c. */
+    uint8_t numStages;                              /**< number of radix stages. */
+    uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];       /**< radix (2, 3, 4 or 5) of each stage, from the first one. */
+    const q31_t *pTwiddle;                          /**< points to the twiddle factors of the stages. */
+    q31_t *pBuffer;                                 /**< points to the work buffer of size 2*fftLen. */
+  } arm_cfft_mixed_instance_q31;
+
+  arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pBuffer);
+
+  void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                               /**< number of frequency bins. */
+    uint16_t blockLength;                           /**< number of samples of each analysis. */
+    uint16_t count;                                 /**< number of samples of the current analysis so far. */
+    const float32_t *pCoeffs;                       /**< points to {cos(w), sin(w)} of each bin, of length 2*numBins. */
+    float32_t *pState;                              /**< points to {s[n-1], s[n-2]} of each bin, of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                               /**< number of frequency bins. */
+    uint16_t blockLength;                           /**< number of samples of each analysis. */
+    uint16_t count;                                 /**< number of samples of the current analysis so far. */
+    const q31_t *pCoeffs;                           /**< points to {cos(w), sin(w)} of each bin, of length 2*numBins. */
+    q63_t *pState;                                  /**< points to {s[n-1], s[n-2]} of each bin, of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState);
+
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                               /**< number of DFT bins. */
+    uint16_t fftLen;                                /**< length of the sliding window. */
+    uint16_t delayIndex;                            /**< index of the oldest sample in the delay line. */
+    float32_t rN;                                   /**< damping of the sample leaving the window, r^fftLen. */
+    const float32_t *pCoeffs;                       /**< points to {r*cos(2*pi*k/fftLen), r*sin(2*pi*k/fftLen)} of each bin, of length 2*numBins. */
+    float32_t *pState;                              /**< points to the complex bins followed by the delay line, of length 2*numBins+fftLen. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                               /**< number of DFT bins. */
+    uint16_t fftLen;                                /**< length of the sliding window. */
+    uint16_t delayIndex;                            /**< index of the oldest sample in the delay line. */
+    q31_t rN;                                       /**< damping of the sample leaving the window, r^fftLen. */
+    const q31_t *pCoeffs;                           /**< points to {r*cos(2*pi*k/fftLen), r*sin(2*pi*k/fftLen)} of each bin, of length 2*numBins. */
+    q31_t *pState;                                  /**< points to the complex bins followed by the delay line, of length 2*numBins+fftLen. */
+  } arm_sdft_instance_q31;
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBinIndex,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBinIndex,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   */
+
+  typedef struct
+  {
+    uint32_t fftLenReal;                      /**< length of the real FFT. */
+    uint32_t fftLenBy2;                       /**< length of the complex FFT. */
+    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                      /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
+    q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
+    arm_cfft_radix4_instance_q15 *pCfft;          /**< points to the complex FFT instance. */
+  } arm_rfft_instance_q15;
+
+  arm_status arm_rfft_init_q15(
+  arm_rfft_instance_q15 * S,
+  arm_cfft_radix4_instance_q15 * S_CFFT,
+  uint32_t fftLenReal,
+  uint32_t ifftFlagR,
+  uint32_t bitReverseFlag);
+
+  void arm_rfft_q15(
+  const arm_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q31 RFFT/RIFFT function.
+   */
+
+  typedef struct
+  {
+    uint32_t fftLenReal;                        /**< length of the real FFT. */
+    uint32_t fftLenBy2;                         /**< length of the complex FFT. */
+    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                        /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
     uint32_t twidCoefRModifier;                 /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
     q31_t *pTwiddleAReal;                       /**< points to the real twiddle factor table. */
     q31_t *pTwiddleBReal;                       /**< points to the imag twiddle factor table. */
@@ -2237,6 +2805,83 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the floating-point STFT.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                      /**< length of the frames and of the real FFT. */
+    uint16_t hopSize;                     /**< number of samples between two frames. */
+    uint16_t stateIndex;                  /**< index of the oldest sample in the state buffer. */
+    uint16_t count;                       /**< number of samples since the last frame. */
+    uint16_t numBands;                    /**< number of mel bands, or 0 for the fftLen/2+1 bins. */
+    uint8_t logFlag;                      /**< selects the power (logFlag=0) or the power in dB (logFlag=1). */
+    const float32_t *pWindow;             /**< points to the window of length fftLen. */
+    const uint16_t *pBandEdges;           /**< points to the numBands+2 band edges, in bins. */
+    const float32_t *pBandWeights;        /**< points to the weights of the bins in the bands, of length fftLen/2+1. */
+    float32_t *pState;                    /**< points to the last fftLen samples, of length fftLen. */
+    float32_t *pBuffer;                   /**< points to the work buffer, of length 2*fftLen. */
+    arm_rfft_fast_instance_f32 Srfft;     /**< real FFT of the frames. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 STFT.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                      /**< length of the frames and of the real FFT. */
+    uint16_t hopSize;                     /**< number of samples between two frames. */
+    uint16_t stateIndex;                  /**< index of the oldest sample in the state buffer. */
+    uint16_t count;                       /**< number of samples since the last frame. */
+    uint16_t numBands;                    /**< number of mel bands, or 0 for the fftLen/2+1 bins. */
+    uint8_t logFlag;                      /**< selects the power (logFlag=0) or the power in dB (logFlag=1). */
+    const q15_t *pWindow;                 /**< points to the window of length fftLen. */
+    const uint16_t *pBandEdges;           /**< points to the numBands+2 band edges, in bins. */
+    const q15_t *pBandWeights;            /**< points to the weights of the bins in the bands, of length fftLen/2+1. */
+    q15_t *pState;                        /**< points to the last fftLen samples, of length fftLen. */
+    q15_t *pBuffer;                       /**< points to the work buffer, of length 3*fftLen. */
+    arm_rfft_instance_q15 Srfft;          /**< real FFT of the frames. */
+    arm_cfft_radix4_instance_q15 Scfft;   /**< complex FFT of the real FFT. */
+  } arm_stft_instance_q15;
+
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  uint16_t numBands,
+  const uint16_t * pBandEdges,
+  float32_t * pBandWeights,
+  uint8_t logFlag,
+  float32_t * pState,
+  float32_t * pBuffer);
+
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  arm_status arm_stft_init_q15(
+  arm_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const q15_t * pWindow,
+  uint16_t numBands,
+  const uint16_t * pBandEdges,
+  q15_t * pBandWeights,
+  uint8_t logFlag,
+  q15_t * pState,
+  q15_t * pBuffer);
+
+  uint32_t arm_stft_q15(
+  arm_stft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3490,6 +4135,56 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point overlap-save FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t numPart;                   /**< number of filter partitions, 0 when the direct form is used. */
+    uint16_t partLen;                   /**< length of the partitions. The FFT length is 2*partLen. */
+    uint16_t partIndex;                 /**< delay line slot of the latest input spectrum. */
+    float32_t *pState;                  /**< points to the state variable array. The array is of length 4*numTaps+9*blockSize. */
+    float32_t *pCoeffsFreq;             /**< points to the spectra of the partitions, which are kept in the state array. */
+    arm_fir_instance_f32 Sfir;          /**< direct form filter, used when numPart is 0. */
+    arm_rfft_fast_instance_f32 Srfft;   /**< real FFT of length 2*partLen. */
+  } arm_fir_ols_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point overlap-save FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point overlap-save FIR filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process per call. It must be a multiple of partLen.
+   * @return none.
+   */
+
+  void arm_fir_ols_f32(
+  arm_fir_ols_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point overlap-save FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point overlap-save FIR filter structure.
+   * @param[in] numTaps  number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples that are processed per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>blockSize</code> is 0.
+   */
+
+  arm_status arm_fir_ols_init_f32(
+  arm_fir_ols_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
 
   /**
    * @brief Instance structure for the Q15 FIR interpolator.
@@ -3499,7 +4194,7 @@ void arm_rfft_fast_f32(
   {
     uint8_t L;                      /**< upsample factor. */
     uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
     q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
   } arm_fir_interpolate_instance_q15;
 
@@ -3511,7 +4206,7 @@ void arm_rfft_fast_f32(
   {
     uint8_t L;                      /**< upsample factor. */
     uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
     q31_t *pState;                   /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
   } arm_fir_interpolate_instance_q31;
 
@@ -3523,7 +4218,7 @@ void arm_rfft_fast_f32(
   {
     uint8_t L;                     /**< upsample factor. */
     uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
     float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
   } arm_fir_interpolate_instance_f32;
 
@@ -3632,70 +4327,321 @@ void arm_rfft_fast_f32(
   uint8_t L,
   uint16_t numTaps,
   float32_t * pCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 FIR rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    int32_t pos;                   /**< position of the next output from the start of the next block, in units of 1/L input samples. */
+    uint32_t frac;                 /**< fractional part of the position, in units of 2^-32/L input samples. */
+    int32_t stepFrac;              /**< fractional adjustment of the step M between outputs, in units of 2^-32/L input samples. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    int32_t pos;                   /**< position of the next output from the start of the next block, in units of 1/L input samples. */
+    uint32_t frac;                 /**< fractional part of the position, in units of 2^-32/L input samples. */
+    int32_t stepFrac;              /**< fractional adjustment of the step M between outputs, in units of 2^-32/L input samples. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    int32_t pos;                   /**< position of the next output from the start of the next block, in units of 1/L input samples. */
+    uint32_t frac;                 /**< fractional part of the position, in units of 2^-32/L input samples. */
+    int32_t stepFrac;              /**< fractional adjustment of the step M between outputs, in units of 2^-32/L input samples. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or <code>L</code> or <code>M</code> is zero.
+   */
+
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or <code>L</code> or <code>M</code> is zero.
+   */
+
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] *S        points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or <code>L</code> or <code>M</code> is zero.
+   */
+
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cas_df1_32x64_init_q31(
+  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_init_f32(
+  arm_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the Q15 transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q15;
 
-  } arm_biquad_cas_df1_32x64_ins_q31;
+
+  /**
+   * @brief Instance structure for the Q31 transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q31;
 
 
   /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
    * @param[in]  *pSrc     points to the block of input data.
    * @param[out] *pDst     points to the block of output data
    * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
+  void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @brief  Initialization function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
    * @param[in]     numStages    number of 2nd order stages in the filter.
    * @param[in]     *pCoeffs     points to the filter coefficients.
    * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
    * @return        none
    */
 
-  void arm_biquad_cas_df1_32x64_init_q31(
-  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  void arm_biquad_cascade_df2T_init_q15(
+  arm_biquad_cascade_df2T_instance_q15 * S,
   uint8_t numStages,
-  q31_t * pCoeffs,
-  q63_t * pState,
-  uint8_t postShift);
-
-
-
-  /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
-   */
-
-  typedef struct
-  {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
+  q15_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
    * @param[in]  *S        points to an instance of the filter data structure.
    * @param[in]  *pSrc     points to the block of input data.
    * @param[out] *pDst     points to the block of output data
@@ -3703,27 +4649,29 @@ void arm_rfft_fast_f32(
    * @return none.
    */
 
-  void arm_biquad_cascade_df2T_f32(
-  const arm_biquad_cascade_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief  Initialization function for the Q31 transposed direct form II Biquad cascade filter.
    * @param[in,out] *S           points to an instance of the filter data structure.
    * @param[in]     numStages    number of 2nd order stages in the filter.
    * @param[in]     *pCoeffs     points to the filter coefficients.
    * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
    * @return        none
    */
 
-  void arm_biquad_cascade_df2T_init_f32(
-  arm_biquad_cascade_df2T_instance_f32 * S,
+  void arm_biquad_cascade_df2T_init_q31(
+  arm_biquad_cascade_df2T_instance_q31 * S,
   uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
 
 
 
@@ -5022,6 +5970,202 @@ void arm_rfft_fast_f32(
   const arm_matrix_instance_f32 * src,
   arm_matrix_instance_f32 * dst);
 
+  /**
+   * @brief Floating-point Cholesky factorization, A = L * L'.
+   * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of the lower triangular factor.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point Cholesky factorization, A = L * L'.
+   * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of the lower triangular factor.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B with the Cholesky factor of A.
+   * @param[in]  *pSrcL points to the lower triangular factor computed by arm_mat_cholesky_f32().
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B with the Cholesky factor of A.
+   * @param[in]  *pSrcL points to the lower triangular factor computed by arm_mat_cholesky_f64().
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point LDLT factorization with symmetric pivoting, P * A * P' = L * D * L'.
+   * @param[in]  *pSrc points to the symmetric input matrix structure.
+   * @param[out] *pl points to the output matrix structure of the unit lower triangular factor.
+   * @param[out] *pd points to the output matrix structure of the diagonal factor.
+   * @param[out] *pp points to the permutation vector, row i of P * A * P' is row pp[i] of A.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix needs a 2 x 2 pivot, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp);
+
+  /**
+   * @brief Double-precision floating-point LDLT factorization with symmetric pivoting, P * A * P' = L * D * L'.
+   * @param[in]  *pSrc points to the symmetric input matrix structure.
+   * @param[out] *pl points to the output matrix structure of the unit lower triangular factor.
+   * @param[out] *pd points to the output matrix structure of the diagonal factor.
+   * @param[out] *pp points to the permutation vector, row i of P * A * P' is row pp[i] of A.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix needs a 2 x 2 pivot, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pl,
+  arm_matrix_instance_f64 * pd,
+  uint16_t * pp);
+
+  /**
+   * @brief Floating-point LU factorization with partial pivoting, P * A = L * U.
+   * @param[in]  *pSrc points to the input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of L below the diagonal and U on and above it.
+   * @param[out] *pPerm points to the permutation vector, row i of P * A is row pPerm[i] of A.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if the input matrix is singular, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPerm);
+
+  /**
+   * @brief Double-precision floating-point LU factorization with partial pivoting, P * A = L * U.
+   * @param[in]  *pSrc points to the input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of L below the diagonal and U on and above it.
+   * @param[out] *pPerm points to the permutation vector, row i of P * A is row pPerm[i] of A.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if the input matrix is singular, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_lu_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  uint16_t * pPerm);
+
+  /**
+   * @brief Floating-point solve of A * X = B with the LU factors of A.
+   * @param[in]  *pSrcLU points to the factors computed by arm_mat_lu_f32().
+   * @param[in]  *pPerm points to the permutation vector computed by arm_mat_lu_f32().
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It must not be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLU,
+  const uint16_t * pPerm,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B with the LU factors of A.
+   * @param[in]  *pSrcLU points to the factors computed by arm_mat_lu_f64().
+   * @param[in]  *pPerm points to the permutation vector computed by arm_mat_lu_f64().
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It must not be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_lu_solve_f64(
+  const arm_matrix_instance_f64 * pSrcLU,
+  const uint16_t * pPerm,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point solve of T * X = B for a lower triangular T.
+   * @param[in]  *pSrcT points to the lower triangular matrix structure.
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if a diagonal value is zero, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of T * X = B for a lower triangular T.
+   * @param[in]  *pSrcT points to the lower triangular matrix structure.
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if a diagonal value is zero, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcT,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point solve of T * X = B for an upper triangular T.
+   * @param[in]  *pSrcT points to the upper triangular matrix structure.
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if a diagonal value is zero, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of T * X = B for an upper triangular T.
+   * @param[in]  *pSrcT points to the upper triangular matrix structure.
+   * @param[in]  *pSrcB points to the right-hand side matrix structure.
+   * @param[out] *pDst points to the solution matrix structure. It may be pSrcB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match when size checking is enabled,
+   * ARM_MATH_SINGULAR if a diagonal value is zero, else ARM_MATH_SUCCESS.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcT,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
 
 
   /**
@@ -5912,10 +7056,108 @@ void arm_rfft_fast_f32(
   q15_t in,
   q15_t * pOut);
 
+  /**
+   * @brief  Floating-point vector square root.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @} end of SQRT group
    */
 
+  /**
+   * @brief  Floating-point vector exponential.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector natural logarithm.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector base 10 logarithm.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vlog10_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 vector natural logarithm.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector in 5.26 format
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 vector natural logarithm.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector in 4.11 format
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector four-quadrant arc tangent.
+   * @param[in]   *pSrcY     points to the vector of ordinates
+   * @param[in]   *pSrcX     points to the vector of abscissas
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector hyperbolic tangent.
+   * @param[in]   *pSrc      points to the input vector
+   * @param[out]  *pDst      points to the output vector
+   * @param[in]   blockSize  number of samples in the vectors
+   * @return none.
+   */
+  void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
 
 
 
@@ -5982,12 +7224,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6000,7 +7243,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6082,13 +7325,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6101,7 +7345,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6184,13 +7428,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6203,7 +7448,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6697,6 +7942,122 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Statistics of a floating-point vector, returned by arm_stats_f32().
+   */
+
+  typedef struct
+  {
+    float32_t mean;                                 /**< mean value. */
+    float32_t var;                                  /**< variance, with blockSize - 1 in the denominator. */
+    float32_t std;                                  /**< standard deviation. */
+    float32_t rms;                                  /**< root mean square. */
+    float32_t min;                                  /**< minimum value. */
+    float32_t max;                                  /**< maximum value. */
+    uint32_t minIndex;                              /**< index of the first minimum value. */
+    uint32_t maxIndex;                              /**< index of the first maximum value. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Statistics of a Q31 vector, returned by arm_stats_q31().
+   */
+
+  typedef struct
+  {
+    q31_t mean;                                     /**< mean value. */
+    q31_t var;                                      /**< variance, with blockSize - 1 in the denominator, saturated to 1.31 format (arm_var_q31() returns a q63_t). */
+    q31_t std;                                      /**< standard deviation. */
+    q31_t rms;                                      /**< root mean square. */
+    q31_t min;                                      /**< minimum value. */
+    q31_t max;                                      /**< maximum value. */
+    uint32_t minIndex;                              /**< index of the first minimum value. */
+    uint32_t maxIndex;                              /**< index of the first maximum value. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Statistics of a Q15 vector, returned by arm_stats_q15().
+   */
+
+  typedef struct
+  {
+    q15_t mean;                                     /**< mean value. */
+    q15_t var;                                      /**< variance, with blockSize - 1 in the denominator. */
+    q15_t std;                                      /**< standard deviation. */
+    q15_t rms;                                      /**< root mean square. */
+    q15_t min;                                      /**< minimum value. */
+    q15_t max;                                      /**< maximum value. */
+    uint32_t minIndex;                              /**< index of the first minimum value. */
+    uint32_t maxIndex;                              /**< index of the first maximum value. */
+  } arm_stats_result_q15;
+
+  /**
+   * @brief Statistics of a Q7 vector, returned by arm_stats_q7().
+   */
+
+  typedef struct
+  {
+    q7_t mean;                                      /**< mean value. */
+    q7_t var;                                       /**< variance, with blockSize - 1 in the denominator. */
+    q7_t std;                                       /**< standard deviation. */
+    q7_t rms;                                       /**< root mean square. */
+    q7_t min;                                       /**< minimum value. */
+    q7_t max;                                       /**< maximum value. */
+    uint32_t minIndex;                              /**< index of the first minimum value. */
+    uint32_t maxIndex;                              /**< index of the first maximum value. */
+  } arm_stats_result_q7;
+
+  /**
+   * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a floating-point vector, in one pass.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @return none.
+   */
+
+  void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+  /**
+   * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a Q31 vector, in one pass.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @return none.
+   */
+
+  void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult);
+
+  /**
+   * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a Q15 vector, in one pass.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @return none.
+   */
+
+  void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief  Mean, variance, standard deviation, RMS, minimum and maximum of a Q7 vector, in one pass.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @return none.
+   */
+
+  void arm_stats_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q7 * pResult);
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  *pSrcA points to the first input vector
@@ -0,0 +1,212 @@
+/**************************************************************************//**
+ * @file     core_host.h
+ * @brief    CMSIS host (x86-64) Header File for the DSP library
+ * @version  V3.20
+ * @date     18. October 2026
+ *
+ * @note
+ * Used by arm_math.h when ARM_MATH_HOST is defined. Provides the core
+ * intrinsics that the DSP library takes from the Cortex-M headers as plain C,
+ * and selects the SIMD instruction set of the host kernels:
+ * - ARM_MATH_SSE2 when the compiler targets SSE2 (always on x86-64)
+ * - ARM_MATH_SSE41 in addition when it targets SSE4.1 (-msse4.1), used by
+ *   the q31 kernels
+ * - ARM_MATH_AVX2 in addition when it targets AVX2 and FMA (-mavx2 -mfma)
+ * Define ARM_MATH_HOST_NOSIMD to build the reference C code only.
+ *
+ ******************************************************************************/
+/* Copyright (c) 2009 - 2013 ARM LIMITED
+
+   All rights reserved.
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+   - Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   - Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in the
+     documentation and/or other materials provided with the distribution.
+   - Neither the name of ARM nor the names of its contributors may be used
+     to endorse or promote products derived from this software without
+     specific prior written permission.
+   *
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS AND CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+   ---------------------------------------------------------------------------*/
+
+
+#ifndef __CORE_HOST_H_GENERIC
+#define __CORE_HOST_H_GENERIC
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#if defined ( __GNUC__ )
+  #define __ASM            __asm                                      /*!< asm keyword for GNU Compiler          */
+  #define __INLINE         inline                                     /*!< inline keyword for GNU Compiler       */
+  #define __STATIC_INLINE  static inline
+#else
+  #error "ARM_MATH_HOST is supported with GCC and Clang only"
+#endif
+
+
+/* ###########################  Core Instructions  ########################## */
+
+/** \brief  Count leading zeros
+
+    \param [in]  value  Value to count the leading zeros
+    \return             number of leading zeros in value
+ */
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  return (value == 0u) ? 32u : (uint8_t)__builtin_clz(value);
+}
+
+
+/** \brief  Rotate Right in unsigned value (32 bit)
+
+    \param [in]    value  Value to rotate
+    \param [in]    value  Number of Bits to rotate
+    \return               Rotated value
+ */
+__STATIC_INLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  return (op2 & 31u) ? (op1 >> (op2 & 31u)) | (op1 << (32u - (op2 & 31u))) : op1;
+}
+
+
+/** \brief  Signed Saturate
+
+    \param [in]  value  Value to be saturated
+    \param [in]    sat  Bit position to saturate to (1..32)
+    \return             Saturated value
+ */
+__STATIC_INLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1ull << (sat - 1u)) - 1u);
+  int32_t min = -max - 1;
+
+  return (val > max) ? max : (val < min) ? min : val;
+}
+
+
+/** \brief  Unsigned Saturate
+
+    \param [in]  value  Value to be saturated
+    \param [in]    sat  Bit position to saturate to (0..31)
+    \return             Saturated value
+ */
+__STATIC_INLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1ull << sat) - 1u);
+
+  return (uint32_t)((val > max) ? max : (val < 0) ? 0 : val);
+}
+
+
+/* ###########################  SIMD Kernels  ############################### */
+
+#if !defined (ARM_MATH_HOST_NOSIMD) && defined (__SSE2__)
+#define ARM_MATH_SSE2
+#if defined (__SSE4_1__)
+#define ARM_MATH_SSE41
+#endif
+#if defined (__AVX2__) && defined (__FMA__)
+#define ARM_MATH_AVX2
+#endif
+#endif
+
+#if defined (ARM_MATH_SSE2)
+#include <immintrin.h>
+
+/* Vector of float32 lanes, 8 with AVX2 and 4 with SSE2. __HVF_MAC is fused
+   with AVX2, so its results may differ from the reference C in the last bit. */
+#if defined (ARM_MATH_AVX2)
+typedef __m256 __HVF;
+#define __HVF_LANES             8
+#define __HVF_LOAD(p)           _mm256_loadu_ps(p)
+#define __HVF_STORE(p, v)       _mm256_storeu_ps((p), (v))
+#define __HVF_SET1(x)           _mm256_set1_ps(x)
+#define __HVF_ZERO()            _mm256_setzero_ps()
+#define __HVF_ADD(a, b)         _mm256_add_ps((a), (b))
+#define __HVF_MUL(a, b)         _mm256_mul_ps((a), (b))
+#define __HVF_MAC(acc, a, b)    _mm256_fmadd_ps((a), (b), (acc))
+
+__STATIC_INLINE float __HVF_HSUM(__HVF v)
+{
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+#else
+typedef __m128 __HVF;
+#define __HVF_LANES             4
+#define __HVF_LOAD(p)           _mm_loadu_ps(p)
+#define __HVF_STORE(p, v)       _mm_storeu_ps((p), (v))
+#define __HVF_SET1(x)           _mm_set1_ps(x)
+#define __HVF_ZERO()            _mm_setzero_ps()
+#define __HVF_ADD(a, b)         _mm_add_ps((a), (b))
+#define __HVF_MUL(a, b)         _mm_mul_ps((a), (b))
+#define __HVF_MAC(acc, a, b)    _mm_add_ps((acc), _mm_mul_ps((a), (b)))
+
+__STATIC_INLINE float __HVF_HSUM(__HVF v)
+{
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+
+  return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+#endif
+
+/** \brief  Sign extends four int32 lanes to int64 and adds them to two int64 lanes
+
+    A lane of 0x80000000 is taken as +2^31. It is the only value _mm_madd_epi16
+    gets wrong, by (-32768 * -32768) * 2.
+ */
+__STATIC_INLINE __m128i __HVI_ACC_MADD(__m128i acc, __m128i v)
+{
+  __m128i hi = _mm_andnot_si128(_mm_cmpeq_epi32(v, _mm_set1_epi32((int32_t)0x80000000)),
+                                _mm_srai_epi32(v, 31));
+
+  acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, hi));
+  return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, hi));
+}
+
+/** \brief  Arithmetic right shift of two int64 lanes, biased by 2^(63 - n)
+
+    Flipping the sign bit adds 2^63, so the logical shift gives (x >> n) + 2^(63 - n).
+    Sums of the lanes subtract the bias once per term at the end.
+ */
+__STATIC_INLINE __m128i __HVI_SRAI_EPI64_BIASED(__m128i x, int n)
+{
+  return _mm_srli_epi64(_mm_xor_si128(x, _mm_set1_epi64x((int64_t)0x8000000000000000ull)), n);
+}
+
+/** \brief  Sum of two int64 lanes
+ */
+__STATIC_INLINE int64_t __HVI_HSUM64(__m128i v)
+{
+  int64_t s[2];
+
+  _mm_storeu_si128((__m128i *) s, v);
+  return s[0] + s[1];
+}
+
+#endif /* ARM_MATH_SSE2 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_HOST_H_GENERIC */
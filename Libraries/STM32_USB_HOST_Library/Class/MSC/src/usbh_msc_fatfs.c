@@ -10,6 +10,12 @@ Module Private Functions and Variables
 
 static volatile DSTATUS Stat = STA_NOINIT;	/* Disk status */
 
+#if _USE_ASYNC
+static BYTE *ReadBuff;	/* Buffer of the read in progress (0: no read in progress) */
+static DWORD ReadSector;	/* Start sector of the read in progress */
+static DWORD ReadBytes;	/* Byte count of the read in progress */
+#endif
+
 extern USB_OTG_CORE_HANDLE          USB_OTG_Core;
 extern USBH_HOST                     USB_Host;
 
@@ -64,6 +70,10 @@ DRESULT disk_read (
   if (drv || !count) return RES_PARERR;
   if (Stat & STA_NOINIT) return RES_NOTRDY;
   
+#if _USE_ASYNC
+  /* Complete the read in progress, the BOT transfer can not be shared */
+  while (disk_read_poll(drv) == RES_BUSY);
+#endif
   
   if(HCD_IsDeviceConnected(&USB_OTG_Core))
   {  
@@ -106,6 +116,10 @@ DRESULT disk_write (
   if (Stat & STA_NOINIT) return RES_NOTRDY;
   if (Stat & STA_PROTECT) return RES_WRPRT;
   
+#if _USE_ASYNC
+  /* Complete the read in progress, the BOT transfer can not be shared */
+  while (disk_read_poll(drv) == RES_BUSY);
+#endif
   
   if(HCD_IsDeviceConnected(&USB_OTG_Core))
   {  
@@ -132,6 +146,72 @@ DRESULT disk_write (
 
 
 
+#if _USE_ASYNC
+/*-----------------------------------------------------------------------*/
+/* Start Reading Sector(s) without waiting for completion               */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read_start (
+                         BYTE drv,			/* Physical drive number (0) */
+                         BYTE *buff,			/* Pointer to the data buffer to store read data */
+                         DWORD sector,		/* Start sector number (LBA) */
+                         BYTE count			/* Sector count (1..255) */
+                           )
+{
+  DRESULT res;
+  
+  if (drv || !count) return RES_PARERR;
+  if (Stat & STA_NOINIT) return RES_NOTRDY;
+  
+  /* Only one read can be in progress */
+  while (disk_read_poll(drv) == RES_BUSY);
+  
+  ReadBuff = buff;
+  ReadSector = sector;
+  ReadBytes = 512 * count;
+  
+  /* Send the command, the transfer is advanced by disk_read_poll */
+  res = disk_read_poll(drv);
+  
+  return (res == RES_BUSY) ? RES_OK : res;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Advance the Read started by disk_read_start                          */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read_poll (
+                        BYTE drv			/* Physical drive number (0) */
+                          )
+{
+  BYTE status;
+  
+  if (drv) return RES_PARERR;
+  if (!ReadBuff) return RES_OK;
+  
+  if(!HCD_IsDeviceConnected(&USB_OTG_Core))
+  {
+    ReadBuff = 0;
+    return RES_ERROR;
+  }
+  
+  status = USBH_MSC_Read10(&USB_OTG_Core, ReadBuff, ReadSector, ReadBytes);
+  USBH_MSC_HandleBOTXfer(&USB_OTG_Core ,&USB_Host);
+  
+  if(status == USBH_MSC_BUSY)
+    return RES_BUSY;
+  
+  ReadBuff = 0;
+  if(status == USBH_MSC_OK)
+    return RES_OK;
+  return RES_ERROR;
+}
+#endif /* _USE_ASYNC */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Miscellaneous Functions                                               */
 /*-----------------------------------------------------------------------*/
@@ -63,6 +63,8 @@
                                            More the size is higher, the recorded quality is better */ 
   #define TIME_REC                3000 /* Recording time in millisecond(Systick Time Base*TIME_REC= 10ms*3000)
                                          (default: 30s) */
+  #define REC_PREALLOC_SIZE       (512 + (TIME_REC * 10 * 32)) /* Contiguous area allocated to the recorded
+                                         wave file before recording (header + 32 bytes of PCM per ms) */
 #endif /* MEDIA_USB_KEY */
 
 /* Exported macro ------------------------------------------------------------*/
@@ -38,6 +38,12 @@ extern uint16_t AUDIO_SAMPLE[];
 #define AUIDO_START_ADDRESS     58 /* Offset relative to audio file header size */
 #endif
 
+#if defined MEDIA_USB_KEY
+ /* Number of _MAX_SS byte slots in the read-ahead ring: one is played by the
+    DMA while the others are filled from the USB Key */
+#define WAVE_RING_SLOTS         4
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 #if defined MEDIA_USB_KEY
@@ -49,8 +55,9 @@ extern uint16_t AUDIO_SAMPLE[];
  UINT BytesRead;
  WAVE_FormatTypeDef WAVE_Format;
  uint16_t buffer1[_MAX_SS] ={0x00};
- uint16_t buffer2[_MAX_SS] ={0x00};
- uint8_t buffer_switch = 1;
+ static uint16_t WaveRing[WAVE_RING_SLOTS * _MAX_SS / 2];
+ static FSTREAM WaveStream;
+ static const BYTE *WaveData;
  extern FATFS fatfs;
  extern FIL file;
  extern FIL fileR;
@@ -158,14 +165,17 @@ void WavePlayBack(uint32_t AudioFreq)
   WavePlayerInit(AudioFreq);
   AudioRemSize   = 0; 
 
-  /* Get Data from USB Key */
+  /* Start streaming data from USB Key: the next slots are read ahead 
+     while the DMA plays the current one */
   f_lseek(&fileR, WaveCounter);
-  f_read (&fileR, buffer1, _MAX_SS, &BytesRead); 
-  f_read (&fileR, buffer2, _MAX_SS, &BytesRead);
+  if ((f_sopen(&WaveStream, &fileR, WaveRing, _MAX_SS, WAVE_RING_SLOTS) != FR_OK) ||
+      (f_sget(&WaveStream, &WaveData, &BytesRead) != FR_OK) || (BytesRead == 0))
+  {
+    WaveDataLength = 0;
+  }
  
   /* Start playing wave */
-  Audio_MAL_Play((uint32_t)buffer1, _MAX_SS);
-  buffer_switch = 1;
+  Audio_MAL_Play((uint32_t)WaveData, BytesRead);
   XferCplt = 0;
   LED_Toggle = 6;
   PauseResumeStatus = 1;
@@ -179,6 +189,9 @@ void WavePlayBack(uint32_t AudioFreq)
       /* wait for DMA transfert complete */
       while((XferCplt == 0) &&  HCD_IsDeviceConnected(&USB_OTG_Core))
       {
+        /* Keep the read-ahead going */
+        f_spoll(&WaveStream);
+        
         if (PauseResumeStatus == 0)
         {
           /* Pause Playing wave */
@@ -196,22 +209,14 @@ void WavePlayBack(uint32_t AudioFreq)
       }
       XferCplt = 0;
 
-      if(buffer_switch == 0)
+      /* Release the slot played and play the next one */
+      f_sfree(&WaveStream);
+      if ((f_sget(&WaveStream, &WaveData, &BytesRead) != FR_OK) || (BytesRead == 0))
       {
-        /* Play data from buffer1 */
-        Audio_MAL_Play((uint32_t)buffer1, _MAX_SS);
-        /* Store data in buffer2 */
-        f_read (&fileR, buffer2, _MAX_SS, &BytesRead);
-        buffer_switch = 1;
+        WaveDataLength = 0;
+        break;
       }
-      else 
-      {   
-        /* Play data from buffer2 */
-        Audio_MAL_Play((uint32_t)buffer2, _MAX_SS);
-        /* Store data in buffer1 */
-        f_read (&fileR, buffer1, _MAX_SS, &BytesRead);
-        buffer_switch = 0;
-      } 
+      Audio_MAL_Play((uint32_t)WaveData, BytesRead);
     }
     else 
     {
@@ -221,6 +226,7 @@ void WavePlayBack(uint32_t AudioFreq)
       break;
     }
   }
+  f_sclose(&WaveStream);
 #if defined PLAY_REPEAT_OFF 
   RepeatState = 1;
   WavePlayerStop();
@@ -349,7 +355,9 @@ void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size)
   
 #elif defined MEDIA_USB_KEY  
   XferCplt = 1;
-  if (WaveDataLength) WaveDataLength -= _MAX_SS;
+  /* Subtract the bytes of the slot played: the first one ends at the sector 
+     boundary after the header, so that it is shorter than _MAX_SS */
+  WaveDataLength = (WaveDataLength > BytesRead) ? (WaveDataLength - BytesRead) : 0;
   if (WaveDataLength < _MAX_SS) WaveDataLength = 0;
     
 #endif 
@@ -456,8 +464,6 @@ void WavePlayerStart(void)
 {
   char path[] = "0:/";
   
-  buffer_switch = 1;
-  
   /* Get the read out protection status */
   if (f_opendir(&dir, path)!= FR_OK)
   {
@@ -328,6 +328,8 @@ uint32_t WavaRecorderHeaderInit(uint8_t* pHeadBuf)
   */
 void WaveRecorderUpdate(void)
 {     
+  FRESULT res;
+
   WaveRecorderInit(32000,16, 1);
   WaveCounter = 0;
   LED_Toggle = 7;
@@ -348,6 +350,21 @@ void WaveRecorderUpdate(void)
   {
     WaveRecStatus = 1;
   }
+  
+  /* Allocate a contiguous area to the file so that the recorded data is written 
+     without cluster allocation, the unused part is released on closing the file. 
+     When there is no such free area (FR_DENIED), the file grows cluster by 
+     cluster, any other error is a failure of the USB Key */
+  res = f_expand(&file, REC_PREALLOC_SIZE);
+  if ((res != FR_OK) && (res != FR_DENIED))
+  {
+    /* Set ON Red LED */ 
+    while(1)
+    {
+      STM_EVAL_LEDToggle(LED5); 
+    }
+  }
+  
   /* Initialize the Header Wave */
   WavaRecorderHeaderInit(RecBufHeader);
   
@@ -30,6 +30,7 @@
 /* Private defines -----------------------------------------------------------*/
 #define UPLOAD_FILENAME            "0:UPLOAD.BIN"
 #define DOWNLOAD_FILENAME          "0:image.BIN"
+#define FLASH_SLOT_SIZE            4096 /* Bytes per read-ahead slot of RAM_Buf */
 
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -39,6 +40,7 @@ static uint8_t RAM_Buf[BUFFER_SIZE] =
   };
 static uint32_t TmpProgramCounter = 0x00, TmpReadSize = 0x00 , RamAddress = 0x00;
 static uint32_t LastPGAddress = APPLICATION_ADDRESS;
+static FSTREAM FlashStream;
 
 extern FATFS fatfs;
 extern FIL file;
@@ -194,45 +196,64 @@ void COMMAND_JUMP(void)
 void COMMAND_ProgramFlashMemory(void)
 {
   __IO uint32_t programcounter = 0x00;
-  uint8_t readflag = TRUE;
-  uint16_t BytesRead;
-  
-  /* RAM Address Initialization */
-  RamAddress = (uint32_t) & RAM_Buf;
+  const BYTE *slot;
+  UINT BytesRead;
   
   /* Erase address init */
   LastPGAddress = APPLICATION_ADDRESS;
   
+  /* Stream the selected file through RAM_Buf: the next slots are read from
+     the USB disk while the current one is programmed */
+  if (f_sopen(&FlashStream, &fileR, RAM_Buf, FLASH_SLOT_SIZE, BUFFER_SIZE / FLASH_SLOT_SIZE) != FR_OK)
+  {
+    /* Toggle Red LED in infinite loop: File read error */
+    Fail_Handler();
+  }
+  
   /* While file still contain data */
-  while ((readflag == TRUE) && (HCD_IsDeviceConnected(&USB_OTG_Core) == 1))
+  while (HCD_IsDeviceConnected(&USB_OTG_Core) == 1)
   {
-    /* Read maximum 512 Kbyte from the selected file */
-    f_read (&fileR, RAM_Buf, BUFFER_SIZE, (void *)&BytesRead);
-    
-    /* Temp variable */
-    TmpReadSize = BytesRead;
+    /* Get the next slot read from the selected file */
+    if (f_sget(&FlashStream, &slot, &BytesRead) != FR_OK)
+    {
+      /* Toggle Red LED in infinite loop: File read error */
+      Fail_Handler();
+    }
     
-    /* The read data < "BUFFER_SIZE" Kbyte */
-    if (TmpReadSize < BUFFER_SIZE)
+    /* End of file */
+    if (BytesRead == 0)
     {
-      readflag = FALSE;
+      break;
     }
     
+    /* Temp variables */
+    RamAddress = (uint32_t)slot;
+    TmpReadSize = BytesRead;
+    
     /* Program flash memory */
-    for (programcounter = TmpReadSize; programcounter != 0; programcounter -= 4)
+    for (programcounter = 0; programcounter < TmpReadSize; programcounter += 4)
     {
       TmpProgramCounter = programcounter;
       /* Write word into flash memory */
-      if (FLASH_If_ProgramWord((LastPGAddress - TmpProgramCounter + TmpReadSize), \
-        *(__IO uint32_t *)(RamAddress - programcounter + TmpReadSize)) != FLASH_COMPLETE)
+      if (FLASH_If_ProgramWord((LastPGAddress + TmpProgramCounter), \
+        *(__IO uint32_t *)(RamAddress + programcounter)) != FLASH_COMPLETE)
       {
         /* Toggle Red LED in infinite loop: Flash programming error */
         Fail_Handler();
       }
+      /* Keep the read-ahead going every 512 bytes */
+      if ((programcounter & 0x1FF) == 0)
+      {
+        f_spoll(&FlashStream);
+      }
     }
+    /* Release the slot programmed */
+    f_sfree(&FlashStream);
+    
     /* Update last programmed address value */
     LastPGAddress = LastPGAddress + TmpReadSize;
   }
+  f_sclose(&FlashStream);
 }
 
 /**
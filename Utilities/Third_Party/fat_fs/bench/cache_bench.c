@@ -0,0 +1,172 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs sector cache benchmark                                          */
+/*-----------------------------------------------------------------------*/
+/* Measures the disk traffic of directory scans, name lookups and       */
+/* cluster chain walks on a RAM disk. The number of window loads served */
+/* by the sector cache is the number of disk reads saved against the    */
+/* single sector window.                                                 */
+/*                                                                       */
+/* Usage: cache_bench [files [cluster_bytes]]                           */
+/*-----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ff.h"
+#include "ramdisk.h"
+
+
+#define DISK_SECTORS	(128UL * 1024 * 2)	/* 128 MB image of 512 byte sectors */
+#define FRAG_CLUSTERS	512					/* Clusters of each fragmented file */
+#define SCAN_ROUNDS		20					/* Directory scans per measurement */
+#define WALK_ROUNDS		50					/* Chain walks per measurement */
+
+
+static FATFS Fatfs;
+static BYTE Buff[4096];
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+void die (const char *msg, FRESULT res)
+{
+	printf("%s failed (%d)\n", msg, (int)res);
+	exit(1);
+}
+
+
+/* Reset all counters before a measurement */
+static
+void start (void)
+{
+	memset(&RamDiskStat, 0, sizeof(RamDiskStat));
+#if _FS_CACHE_WAYS
+	Fatfs.cache_hit = Fatfs.cache_miss = 0;
+#endif
+}
+
+
+/* Report the counters of a measurement */
+static
+void report (const char *name, UINT ops, double t)
+{
+	printf("%-14s %8u ops %10.3f ms %8lu reads %8lu writes",
+		name, ops, t * 1e3, RamDiskStat.reads, RamDiskStat.writes);
+#if _FS_CACHE_WAYS
+	printf(" %8lu hits %8lu misses (%.1f%%)", Fatfs.cache_hit, Fatfs.cache_miss,
+		Fatfs.cache_hit + Fatfs.cache_miss ?
+		100.0 * Fatfs.cache_hit / (Fatfs.cache_hit + Fatfs.cache_miss) : 0.0);
+#endif
+	printf("\n");
+}
+
+
+int main (int argc, char *argv[])
+{
+	UINT nfiles, au, i, n, bw;
+	FRESULT res;
+	FIL fa, fb;
+	DIR dir;
+	FILINFO fno;
+	char path[32];
+	double t;
+
+
+	nfiles = argc > 1 ? (UINT)atoi(argv[1]) : 500;
+	au = argc > 2 ? (UINT)atoi(argv[2]) : 4096;
+	if (au > sizeof(Buff)) au = sizeof(Buff);
+
+	if (ramdisk_create(DISK_SECTORS, 512)) die("ramdisk_create", FR_NOT_ENOUGH_CORE);
+	f_mount(0, &Fatfs);
+	res = f_mkfs(0, 1, au);
+	if (res) die("f_mkfs", res);
+
+	printf("FatFs sector cache benchmark: %u files, %u byte clusters, ", nfiles, au);
+#if _FS_CACHE_WAYS
+	printf("%u sets x %u ways\n", _FS_CACHE_SETS, _FS_CACHE_WAYS);
+#else
+	printf("cache disabled\n");
+#endif
+
+	/* Populate a directory */
+	res = f_mkdir("DIR");
+	if (res) die("f_mkdir", res);
+	for (i = 0; i < nfiles; i++) {
+		sprintf(path, "DIR/F%05u.DAT", i);
+		res = f_open(&fa, path, FA_CREATE_ALWAYS | FA_WRITE);
+		if (res) die("f_open", res);
+		f_write(&fa, path, 8, &bw);
+		f_close(&fa);
+	}
+
+	/* Create two files with interleaved (fragmented) cluster chains */
+	memset(Buff, 0x55, sizeof(Buff));
+	if (f_open(&fa, "FRAG_A.DAT", FA_CREATE_ALWAYS | FA_WRITE) ||
+		f_open(&fb, "FRAG_B.DAT", FA_CREATE_ALWAYS | FA_WRITE)) die("f_open", FR_DISK_ERR);
+	for (i = 0; i < FRAG_CLUSTERS; i++) {
+		f_write(&fa, Buff, au, &bw);
+		f_write(&fb, Buff, au, &bw);
+	}
+	f_close(&fa);
+	f_close(&fb);
+
+	/* Directory scan */
+	start();
+	t = now();
+	for (n = i = 0; i < SCAN_ROUNDS; i++) {
+		res = f_opendir(&dir, "DIR");
+		if (res) die("f_opendir", res);
+		while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0]) n++;
+	}
+	report("dir scan", n, now() - t);
+
+	/* Name lookup */
+	start();
+	t = now();
+	for (i = 0; i < nfiles; i += (nfiles + 63) / 64) {
+		sprintf(path, "DIR/F%05u.DAT", i);
+		res = f_stat(path, &fno);
+		if (res) die("f_stat", res);
+	}
+	report("lookup", (nfiles + (nfiles + 63) / 64 - 1) / ((nfiles + 63) / 64), now() - t);
+
+	/* Cluster chain walk */
+	start();
+	t = now();
+	for (i = 0; i < WALK_ROUNDS; i++) {
+		if (f_open(&fa, "FRAG_A.DAT", FA_READ) || f_open(&fb, "FRAG_B.DAT", FA_READ))
+			die("f_open", FR_DISK_ERR);
+		f_lseek(&fa, fa.fsize);
+		f_lseek(&fb, fb.fsize);
+		f_close(&fa);
+		f_close(&fb);
+	}
+	report("chain walk", WALK_ROUNDS * 2, now() - t);
+
+	/* Metadata update */
+	start();
+	t = now();
+	for (i = 0; i < nfiles; i += 4) {
+		sprintf(path, "DIR/F%05u.DAT", i);
+		res = f_open(&fa, path, FA_OPEN_EXISTING | FA_WRITE);
+		if (res) die("f_open", res);
+		f_lseek(&fa, fa.fsize);
+		f_write(&fa, Buff, au, &bw);
+		f_close(&fa);
+	}
+	report("append+close", (nfiles + 3) / 4, now() - t);
+
+	f_mount(0, 0);
+	ramdisk_delete();
+	return 0;
+}
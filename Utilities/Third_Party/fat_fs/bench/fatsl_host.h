@@ -0,0 +1,23 @@
+/*-----------------------------------------------------------------------*/
+/* Host build of FreeRTOS-Plus-FAT-SL for the benchmarks                 */
+/*-----------------------------------------------------------------------*/
+/* FAT-SL is written for targets with a 32-bit long. Its structures are  */
+/* cleared and sized on that assumption, so it does not work on an LP64  */
+/* host as is. This header is included before each FAT-SL source (gcc    */
+/* -include) and maps long to int after the C library headers, which are */
+/* pulled in first so that they keep the native types.                   */
+/*-----------------------------------------------------------------------*/
+
+#ifndef _FATSL_HOST
+#define _FATSL_HOST
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__LP64__) || defined(_LP64)
+#define long int
+#endif
+
+#endif
@@ -0,0 +1,285 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs throughput benchmark                                            */
+/*-----------------------------------------------------------------------*/
+/* Formats a volume on a disk image file and measures sequential and     */
+/* random read/write throughput, file create/lookup/delete rate and      */
+/* directory scan time. The image can be delayed like a USB stick or an  */
+/* SD card. On the LFN cfg, the files are created with long names.       */
+/*                                                                       */
+/* Usage: ff_bench [-i image] [-v volume_MB] [-c cluster_bytes]          */
+/*                 [-s sector_bytes] [-l none|usb|sd] [-n file_KB]       */
+/*                 [-b buffer_bytes] [-r random_ops] [-f files]          */
+/*-----------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ff.h"
+#include "imgdisk.h"
+
+
+/* Latency models of the drives */
+static const struct {
+	const char *name;
+	IDLAT lat;
+} Profiles[] = {
+	{ "none", {    0,      0,      0 } },
+	{ "usb",  { 1000, 500000, 600000 } },	/* USB FS mass storage: 1 ms per BOT command, 1 MB/s */
+	{ "sd",   {  150,  25000,  80000 } }	/* SD card on 4-bit SDIO */
+};
+
+static FATFS Fatfs;
+static BYTE *Buff;
+static DWORD Rand = 1;
+
+/* Name of the files created in DIR */
+#if _USE_LFN
+#define	FILENAME	"DIR/Data logger record %05u.dat"
+#else
+#define	FILENAME	"DIR/F%05u.DAT"
+#endif
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+DWORD rnd (void)
+{
+	Rand = Rand * 1103515245 + 12345;
+	return Rand >> 8;
+}
+
+
+static
+void die (const char *msg, FRESULT res)
+{
+	printf("%s failed (%d)\n", msg, (int)res);
+	exit(1);
+}
+
+
+/* Reset all counters before a measurement */
+static
+double start (void)
+{
+	memset(&ImgDiskStat[0], 0, sizeof(IDSTAT));
+	return now();
+}
+
+
+/* Report the counters of a measurement (bytes == 0: operation rate) */
+static
+void report (const char *name, DWORD ops, double bytes, double t0)
+{
+	double t = now() - t0;
+
+	printf("%-12s %8lu ops %10.1f ms ", name, (unsigned long)ops, t * 1e3);
+	if (bytes)
+		printf("%9.2f MB/s", bytes / t / 1e6);
+	else
+		printf("%9.0f op/s", ops / t);
+	printf(" %8lu reads %8lu writes %8lu sectors %6.0f ms waited\n",
+		(unsigned long)ImgDiskStat[0].reads, (unsigned long)ImgDiskStat[0].writes,
+		(unsigned long)(ImgDiskStat[0].rsects + ImgDiskStat[0].wsects), ImgDiskStat[0].wait * 1e3);
+}
+
+
+static
+void usage (void)
+{
+	printf("usage: ff_bench [-i image] [-v volume_MB] [-c cluster_bytes] [-s sector_bytes]\n"
+		   "                [-l none|usb|sd] [-n file_KB] [-b buffer_bytes] [-r random_ops] [-f files]\n");
+	exit(1);
+}
+
+
+int main (int argc, char *argv[])
+{
+	const char *image = "ff_bench.img";
+	UINT vol_mb = 64, au = 0, ss = 512, file_kb = 4096, bsize = 4096, nrand = 500, nfiles = 500;
+	UINT prof = 0, i, n, bw;
+	DWORD blocks, ofs;
+	FRESULT res;
+	FIL fil;
+	DIR dir;
+	FILINFO fno;
+	char path[40];
+	double t;
+	int c;
+
+
+	while ((c = getopt(argc, argv, "i:v:c:s:l:n:b:r:f:")) != -1) {
+		switch (c) {
+		case 'i': image = optarg; break;
+		case 'v': vol_mb = (UINT)atoi(optarg); break;
+		case 'c': au = (UINT)atoi(optarg); break;
+		case 's': ss = (UINT)atoi(optarg); break;
+		case 'n': file_kb = (UINT)atoi(optarg); break;
+		case 'b': bsize = (UINT)atoi(optarg); break;
+		case 'r': nrand = (UINT)atoi(optarg); break;
+		case 'f': nfiles = (UINT)atoi(optarg); break;
+		case 'l':
+			for (prof = 0; prof < sizeof(Profiles) / sizeof(Profiles[0]); prof++) {
+				if (!strcmp(optarg, Profiles[prof].name)) break;
+			}
+			if (prof == sizeof(Profiles) / sizeof(Profiles[0])) usage();
+			break;
+		default: usage();
+		}
+	}
+	if (ss < 512 || ss > _MAX_SS || (ss & (ss - 1)) || !bsize || !file_kb) usage();
+	Buff = malloc(bsize);
+	if (!Buff) die("malloc", FR_NOT_ENOUGH_CORE);
+	for (i = 0; i < bsize; i++) Buff[i] = (BYTE)rnd();
+
+	/* Format the volume without latency */
+	if (imgdisk_open(0, image, (DWORD)vol_mb * 1024 * 1024 / ss, (WORD)ss)) die("imgdisk_open", FR_DISK_ERR);
+	f_mount(0, &Fatfs);
+	res = f_mkfs(0, 1, au);
+	if (res) die("f_mkfs", res);
+	res = f_mkdir("DIR");
+	if (res) die("f_mkdir", res);
+	f_mount(0, 0);
+	f_mount(0, &Fatfs);
+	res = f_opendir(&dir, "");		/* Mount the volume */
+	if (res) die("f_opendir", res);
+
+	printf("FatFs benchmark: %u MB FAT%u volume, %u byte clusters, %u byte sectors, %s latency\n",
+		vol_mb, Fatfs.fs_type == FS_FAT12 ? 12 : Fatfs.fs_type == FS_FAT16 ? 16 : 32,
+		Fatfs.csize * ss, ss, Profiles[prof].name);
+	printf("%u KB file, %u byte buffer, %u random ops, %u files\n", file_kb, bsize, nrand, nfiles);
+	imgdisk_latency(0, &Profiles[prof].lat);
+
+	/* Sequential write */
+	blocks = (DWORD)file_kb * 1024 / bsize;
+	t = start();
+	res = f_open(&fil, "SEQ.DAT", FA_CREATE_ALWAYS | FA_WRITE);
+	if (res) die("f_open", res);
+	for (ofs = 0; ofs < blocks; ofs++) {
+		res = f_write(&fil, Buff, bsize, &bw);
+		if (res || bw != bsize) die("f_write", res);
+	}
+	res = f_close(&fil);
+	if (res) die("f_close", res);
+	report("seq write", blocks, (double)blocks * bsize, t);
+
+	/* Sequential read */
+	t = start();
+	res = f_open(&fil, "SEQ.DAT", FA_READ);
+	if (res) die("f_open", res);
+	for (ofs = 0; ofs < blocks; ofs++) {
+		res = f_read(&fil, Buff, bsize, &bw);
+		if (res || bw != bsize) die("f_read", res);
+	}
+	f_close(&fil);
+	report("seq read", blocks, (double)blocks * bsize, t);
+
+#if _USE_STREAM
+	/* Sequential read with read-ahead */
+	{
+		FSTREAM st;
+		const BYTE *p;
+		BYTE *ring;
+		UINT slot = Fatfs.csize * ss < bsize ? Fatfs.csize * ss : bsize;
+
+		ring = malloc(slot * 4);
+		if (!ring) die("malloc", FR_NOT_ENOUGH_CORE);
+		t = start();
+		res = f_open(&fil, "SEQ.DAT", FA_READ);
+		if (res) die("f_open", res);
+		res = f_sopen(&st, &fil, ring, slot, 4);
+		if (res) die("f_sopen", res);
+		for (n = 0; ; n++) {
+			res = f_sget(&st, &p, &bw);
+			if (res) die("f_sget", res);
+			if (!bw) break;
+			f_sfree(&st);
+		}
+		f_sclose(&st);
+		f_close(&fil);
+		report("stream read", n, (double)blocks * bsize, t);
+		free(ring);
+	}
+#endif
+
+	/* Random write */
+	t = start();
+	res = f_open(&fil, "SEQ.DAT", FA_OPEN_EXISTING | FA_WRITE);
+	if (res) die("f_open", res);
+	for (i = 0; i < nrand; i++) {
+		f_lseek(&fil, rnd() % blocks * bsize);
+		res = f_write(&fil, Buff, bsize, &bw);
+		if (res || bw != bsize) die("f_write", res);
+	}
+	res = f_close(&fil);
+	if (res) die("f_close", res);
+	report("rand write", nrand, (double)nrand * bsize, t);
+
+	/* Random read */
+	t = start();
+	res = f_open(&fil, "SEQ.DAT", FA_READ);
+	if (res) die("f_open", res);
+	for (i = 0; i < nrand; i++) {
+		f_lseek(&fil, rnd() % blocks * bsize);
+		res = f_read(&fil, Buff, bsize, &bw);
+		if (res || bw != bsize) die("f_read", res);
+	}
+	f_close(&fil);
+	report("rand read", nrand, (double)nrand * bsize, t);
+
+	/* File creation */
+	t = start();
+	for (i = 0; i < nfiles; i++) {
+		sprintf(path, FILENAME, i);
+		res = f_open(&fil, path, FA_CREATE_NEW | FA_WRITE);
+		if (res) die("f_open", res);
+		f_write(&fil, path, 16, &bw);
+		res = f_close(&fil);
+		if (res) die("f_close", res);
+	}
+	report("create", nfiles, 0, t);
+
+	/* Directory scan */
+#if _USE_LFN
+	fno.lfname = 0;		/* Do not read the LFN */
+	fno.lfsize = 0;
+#endif
+	t = start();
+	res = f_opendir(&dir, "DIR");
+	if (res) die("f_opendir", res);
+	for (n = 0; f_readdir(&dir, &fno) == FR_OK && fno.fname[0]; n++) ;
+	report("dir scan", n, 0, t);
+
+	/* File lookup in random order */
+	t = start();
+	for (i = 0; i < nfiles; i++) {
+		sprintf(path, FILENAME, (UINT)(rnd() % nfiles));
+		res = f_stat(path, &fno);
+		if (res) die("f_stat", res);
+	}
+	report("lookup", nfiles, 0, t);
+
+	/* File deletion */
+	t = start();
+	for (i = 0; i < nfiles; i++) {
+		sprintf(path, FILENAME, i);
+		res = f_unlink(path);
+		if (res) die("f_unlink", res);
+	}
+	report("delete", nfiles, 0, t);
+
+	f_mount(0, 0);
+	imgdisk_close(0);
+	return 0;
+}
@@ -0,0 +1,447 @@
+/*-----------------------------------------------------------------------*/
+/* Cross-filesystem benchmark: FatFs vs FreeRTOS-Plus-FAT-SL             */
+/*-----------------------------------------------------------------------*/
+/* Runs the same workload on each file system. Before each run the disk  */
+/* image is formatted with the same f_mkfs parameters, so every file     */
+/* system starts from an identical volume and goes through the same      */
+/* latency model. The workload covers sequential streaming, random       */
+/* reads, small file create/scan/delete and lookups in a deep directory  */
+/* tree. For each phase the throughput or operation rate, the sector     */
+/* I/O per operation and the peak stack depth are reported, and the      */
+/* static work area of each file system is printed in the header.        */
+/*                                                                       */
+/* Sizes are taken on the host. FatFs is built with the host ABI (DWORD  */
+/* is 8 bytes on LP64), FAT-SL with a 32-bit long (see fatsl_host.h).    */
+/*                                                                       */
+/* Usage: fs_compare [-i image] [-v volume_MB] [-c cluster_bytes]        */
+/*                   [-l none|usb|sd] [-n file_KB] [-b buffer_bytes]     */
+/*                   [-r random_ops] [-f files] [-d depth] [-t ff|sl]    */
+/*-----------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "imgdisk.h"
+#include "fs_port.h"
+
+
+/* Latency models of the drives */
+static const struct {
+	const char *name;
+	IDLAT lat;
+} Profiles[] = {
+	{ "none", {    0,      0,      0 } },
+	{ "usb",  { 1000, 500000, 600000 } },	/* USB FS mass storage: 1 ms per BOT command, 1 MB/s */
+	{ "sd",   {  150,  25000,  80000 } }	/* SD card on 4-bit SDIO */
+};
+
+/* File systems under test */
+static const FSPORT *Ports[] = { &FsPortFatFs, &FsPortFatSL };
+#define N_PORTS		(sizeof Ports / sizeof Ports[0])
+
+/* Workload phases */
+enum { PH_SEQW, PH_SEQR, PH_RANDR, PH_CREATE, PH_SCAN, PH_DELETE, PH_MKTREE, PH_LOOKUP, N_PHASES };
+static const char *const PhaseName[N_PHASES] = {
+	"seq write", "seq read", "rand read", "create", "dir scan", "delete", "mkdir tree", "deep open"
+};
+
+/* Result of a phase */
+typedef struct {
+	DWORD	ops;		/* Number of operations */
+	double	bytes;		/* Bytes transferred (0:Operation rate) */
+	double	sec;		/* Elapsed time */
+	DWORD	sects;		/* Sectors read and written */
+	DWORD	cmds;		/* disk_read and disk_write calls */
+	UINT	stack;		/* Peak stack depth below the workload (bytes) */
+} RESULT;
+
+static RESULT Result[N_PORTS][N_PHASES];
+
+#define STACK_PROBE	0x10000		/* Depth of the stack painted before each phase */
+#define STACK_FILL	0xA5
+
+#define SMALL_SIZE	100			/* Size of the small files */
+#define TREE_FANOUT	4			/* Directories created on each level of the tree */
+
+static BYTE *Buff;
+static size_t StackArea;	/* Address of the stack area painted by stack_paint() */
+static DWORD Rand;
+static UINT FileKB = 4096, BSize = 4096, NRand = 500, NFiles = 200, Depth = 6;
+
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+DWORD rnd (void)
+{
+	Rand = Rand * 1103515245 + 12345;
+	return Rand >> 8;
+}
+
+
+static
+void die (const FSPORT *fs, const char *msg, int res)
+{
+	printf("%s: %s failed (%d)\n", fs->name, msg, res);
+	exit(1);
+}
+
+
+/* Fill the stack below the caller with a pattern */
+static __attribute__((noinline))
+void stack_paint (void)
+{
+	volatile BYTE area[STACK_PROBE];
+	UINT i;
+
+	for (i = 0; i < STACK_PROBE; i++) area[i] = STACK_FILL;
+	StackArea = (size_t)area;
+}
+
+
+/* Depth of the stack used below the caller since stack_paint() */
+static __attribute__((noinline))
+UINT stack_peak (void)
+{
+	UINT i;
+
+	for (i = 0; i < STACK_PROBE && ((volatile BYTE*)StackArea)[i] == STACK_FILL; i++) ;
+	return STACK_PROBE - i;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Workload phases (return the number of operations)                     */
+/*-----------------------------------------------------------------------*/
+
+static
+DWORD seq_write (const FSPORT *fs)
+{
+	DWORD n, blocks = (DWORD)FileKB * 1024 / BSize;
+	int res;
+
+	res = fs->open("SEQ.DAT", FSP_CREATE);
+	if (res) die(fs, "open", res);
+	for (n = 0; n < blocks; n++) {
+		if (fs->write(Buff, BSize) != (int)BSize) die(fs, "write", -1);
+	}
+	res = fs->close();
+	if (res) die(fs, "close", res);
+	return blocks;
+}
+
+
+static
+DWORD seq_read (const FSPORT *fs)
+{
+	DWORD n, blocks = (DWORD)FileKB * 1024 / BSize;
+	int res;
+
+	res = fs->open("SEQ.DAT", FSP_READ);
+	if (res) die(fs, "open", res);
+	for (n = 0; n < blocks; n++) {
+		if (fs->read(Buff, BSize) != (int)BSize) die(fs, "read", -1);
+	}
+	fs->close();
+	return blocks;
+}
+
+
+static
+DWORD rand_read (const FSPORT *fs)
+{
+	DWORD n, blocks = (DWORD)FileKB * 1024 / BSize;
+	int res;
+
+	res = fs->open("SEQ.DAT", FSP_READ);
+	if (res) die(fs, "open", res);
+	for (n = 0; n < NRand; n++) {
+		res = fs->seek(rnd() % blocks * BSize);
+		if (res) die(fs, "seek", res);
+		if (fs->read(Buff, BSize) != (int)BSize) die(fs, "read", -1);
+	}
+	fs->close();
+	return NRand;
+}
+
+
+static
+DWORD create (const FSPORT *fs)
+{
+	char path[32];
+	DWORD n;
+	int res;
+
+	for (n = 0; n < NFiles; n++) {
+		sprintf(path, "SMALL/F%05u.DAT", (UINT)n);
+		res = fs->open(path, FSP_CREATE);
+		if (res) die(fs, "open", res);
+		if (fs->write(Buff, SMALL_SIZE) != SMALL_SIZE) die(fs, "write", -1);
+		res = fs->close();
+		if (res) die(fs, "close", res);
+	}
+	return NFiles;
+}
+
+
+static
+DWORD scan (const FSPORT *fs)
+{
+	int n;
+
+	n = fs->scan("SMALL");
+	if (n != (int)NFiles) die(fs, "scan", n);
+	return (DWORD)n;
+}
+
+
+static
+DWORD delete (const FSPORT *fs)
+{
+	char path[32];
+	DWORD n;
+	int res;
+
+	for (n = 0; n < NFiles; n++) {
+		sprintf(path, "SMALL/F%05u.DAT", (UINT)n);
+		res = fs->unlink(path);
+		if (res) die(fs, "unlink", res);
+	}
+	return NFiles;
+}
+
+
+/* Path of directory i (1..TREE_FANOUT) on level lv of the tree */
+static
+void tree_path (char *path, UINT lv, UINT i)
+{
+	UINT l;
+
+	strcpy(path, "TREE");
+	for (l = 0; l < lv; l++) strcat(path, "/D1");
+	if (i) sprintf(path + strlen(path), "/D%u", i);
+}
+
+
+static
+DWORD mk_tree (const FSPORT *fs)
+{
+	char path[64];
+	UINT lv, i;
+	DWORD n = 0;
+	int res;
+
+	res = fs->mkdir("TREE");
+	if (res) die(fs, "mkdir", res);
+	for (lv = 0; lv < Depth; lv++) {		/* Directories D1..Dn on each level, the tree goes on under D1 */
+		for (i = 1; i <= TREE_FANOUT; i++, n++) {
+			tree_path(path, lv, i);
+			res = fs->mkdir(path);
+			if (res) die(fs, "mkdir", res);
+		}
+	}
+	tree_path(path, Depth, 0);
+	strcat(path, "/LEAF.DAT");
+	res = fs->open(path, FSP_CREATE);
+	if (res) die(fs, "open", res);
+	if (fs->write(Buff, SMALL_SIZE) != SMALL_SIZE) die(fs, "write", -1);
+	res = fs->close();
+	if (res) die(fs, "close", res);
+	return n;
+}
+
+
+static
+DWORD lookup (const FSPORT *fs)
+{
+	char path[64];
+	DWORD n;
+	int res;
+
+	tree_path(path, Depth, 0);
+	strcat(path, "/LEAF.DAT");
+	for (n = 0; n < NRand; n++) {
+		res = fs->open(path, FSP_READ);
+		if (res) die(fs, "open", res);
+		if (fs->read(Buff, SMALL_SIZE) != SMALL_SIZE) die(fs, "read", -1);
+		fs->close();
+	}
+	return NRand;
+}
+
+
+static DWORD (*const Phase[N_PHASES])(const FSPORT*) = {
+	seq_write, seq_read, rand_read, create, scan, delete, mk_tree, lookup
+};
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Run the workload on a file system                                     */
+/*-----------------------------------------------------------------------*/
+
+static
+void run (
+	UINT p,				/* Index of the file system in Ports[] */
+	UINT au,			/* Allocation unit of the volume */
+	const IDLAT *lat	/* Latency model */
+)
+{
+	const FSPORT *fs = Ports[p];
+	RESULT *r;
+	UINT ph, base;
+	double t;
+	UINT csize;
+	int res;
+
+
+	imgdisk_latency(0, 0);		/* Identical fresh volume for each file system */
+	res = fsport_mkfs(au, &csize);
+	if (res) die(fs, "mkfs", res);
+	res = fs->mount();
+	if (res) die(fs, "mount", res);
+	res = fs->mkdir("SMALL");
+	if (res) die(fs, "mkdir", res);
+	imgdisk_latency(0, lat);
+
+	stack_paint();
+	base = stack_peak();		/* Stack used by the probe itself */
+
+	Rand = 1;
+	for (ph = 0; ph < N_PHASES; ph++) {
+		r = &Result[p][ph];
+		memset(&ImgDiskStat[0], 0, sizeof(IDSTAT));
+		stack_paint();
+		t = now();
+		r->ops = Phase[ph](fs);
+		r->sec = now() - t;
+		r->stack = stack_peak() - base;
+		r->sects = ImgDiskStat[0].rsects + ImgDiskStat[0].wsects;
+		r->cmds = ImgDiskStat[0].reads + ImgDiskStat[0].writes;
+		if (ph <= PH_RANDR) r->bytes = (double)r->ops * BSize;
+	}
+	fs->unmount();
+}
+
+
+static
+void report (
+	UINT p
+)
+{
+	const RESULT *r;
+	UINT ph;
+
+
+	printf("\n%s: %u bytes of static work area\n", Ports[p]->name, Ports[p]->ram());
+	printf("%-12s %8s %10s %14s %10s %10s %8s\n", "phase", "ops", "ms", "rate", "cmds/op", "sects/op", "stack");
+	for (ph = 0; ph < N_PHASES; ph++) {
+		r = &Result[p][ph];
+		printf("%-12s %8lu %10.1f ", PhaseName[ph], (unsigned long)r->ops, r->sec * 1e3);
+		if (r->bytes)
+			printf("%9.2f MB/s ", r->bytes / r->sec / 1e6);
+		else
+			printf("%9.0f op/s ", r->ops / r->sec);
+		printf("%10.2f %10.2f %8u\n", (double)r->cmds / r->ops, (double)r->sects / r->ops, r->stack);
+	}
+}
+
+
+static
+void usage (void)
+{
+	printf("usage: fs_compare [-i image] [-v volume_MB] [-c cluster_bytes] [-l none|usb|sd]\n"
+		   "                  [-n file_KB] [-b buffer_bytes] [-r random_ops] [-f files] [-d depth] [-t ff|sl]\n");
+	exit(1);
+}
+
+
+int main (int argc, char *argv[])
+{
+	const char *image = "fs_compare.img";
+	UINT vol_mb = 64, au = 0, prof = 0, sel = 3, p, ph, i, csize;
+	int c;
+
+
+	while ((c = getopt(argc, argv, "i:v:c:l:n:b:r:f:d:t:")) != -1) {
+		switch (c) {
+		case 'i': image = optarg; break;
+		case 'v': vol_mb = (UINT)atoi(optarg); break;
+		case 'c': au = (UINT)atoi(optarg); break;
+		case 'n': FileKB = (UINT)atoi(optarg); break;
+		case 'b': BSize = (UINT)atoi(optarg); break;
+		case 'r': NRand = (UINT)atoi(optarg); break;
+		case 'f': NFiles = (UINT)atoi(optarg); break;
+		case 'd': Depth = (UINT)atoi(optarg); break;
+		case 't':
+			if (!strcmp(optarg, "ff")) sel = 1;
+			else if (!strcmp(optarg, "sl")) sel = 2;
+			else usage();
+			break;
+		case 'l':
+			for (prof = 0; prof < sizeof(Profiles) / sizeof(Profiles[0]); prof++) {
+				if (!strcmp(optarg, Profiles[prof].name)) break;
+			}
+			if (prof == sizeof(Profiles) / sizeof(Profiles[0])) usage();
+			break;
+		default: usage();
+		}
+	}
+	if (!BSize || !FileKB || (DWORD)FileKB * 1024 < BSize || !NRand || !NFiles || NFiles > 99999 || Depth > 12) usage();
+	Buff = malloc(BSize > SMALL_SIZE ? BSize : SMALL_SIZE);
+	if (!Buff) return 1;
+	Rand = 1;
+	for (i = 0; i < BSize; i++) Buff[i] = (BYTE)rnd();
+
+	if (imgdisk_open(0, image, (DWORD)vol_mb * 1024 * 1024 / 512, 512)) {
+		printf("imgdisk_open failed\n");
+		return 1;
+	}
+	c = fsport_mkfs(au, &csize);	/* Get the cluster size chosen for the volume */
+	if (c) {
+		printf("mkfs failed (%d)\n", c);
+		return 1;
+	}
+	printf("fs_compare: %u MB volume, %u byte clusters, %s latency\n", vol_mb, csize, Profiles[prof].name);
+	printf("%u KB file, %u byte buffer, %u random ops, %u files, depth %u\n", FileKB, BSize, NRand, NFiles, Depth);
+
+	for (p = 0; p < N_PORTS; p++) {
+		if (!(sel & 1 << p)) continue;
+		run(p, au, &Profiles[prof].lat);
+		report(p);
+	}
+
+	if (sel == 3) {		/* Side by side rate and sector I/O */
+		printf("\n%-12s", "phase");
+		for (p = 0; p < N_PORTS; p++) printf(" %14s %10s", Ports[p]->name, "sects/op");
+		printf("\n");
+		for (ph = 0; ph < N_PHASES; ph++) {
+			printf("%-12s", PhaseName[ph]);
+			for (p = 0; p < N_PORTS; p++) {
+				const RESULT *r = &Result[p][ph];
+				if (r->bytes)
+					printf(" %9.2f MB/s", r->bytes / r->sec / 1e6);
+				else
+					printf(" %9.0f op/s", r->ops / r->sec);
+				printf(" %10.2f", (double)r->sects / r->ops);
+			}
+			printf("\n");
+		}
+	}
+
+	imgdisk_close(0);
+	return 0;
+}
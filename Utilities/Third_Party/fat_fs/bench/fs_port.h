@@ -0,0 +1,38 @@
+/*-----------------------------------------------------------------------*/
+/* File system ports for the cross-filesystem benchmark (fs_compare)     */
+/*-----------------------------------------------------------------------*/
+/* Each file system is wrapped into the same small set of calls so that  */
+/* one workload can drive them all on the same disk image. Only plain C  */
+/* types cross this interface because the ports are built with their own */
+/* type models (see fatsl_host.h). One file is open at a time and the    */
+/* volume is on physical drive 0 of imgdisk.                             */
+/*-----------------------------------------------------------------------*/
+
+#ifndef _FS_PORT
+#define _FS_PORT
+
+#define FSP_READ	0	/* Open an existing file for reading */
+#define FSP_WRITE	1	/* Open an existing file for reading and writing */
+#define FSP_CREATE	2	/* Create a new file or truncate an existing one */
+
+typedef struct {
+	const char *name;						/* Name of the file system */
+	unsigned int (*ram)(void);				/* Bytes of static work area (volume, file, directory and buffers) */
+	int (*mount)(void);						/* Mount the volume on physical drive 0 (0:Successful) */
+	void (*unmount)(void);					/* Unmount the volume */
+	int (*open)(const char *path, int mode);/* Open a file (0:Successful) */
+	int (*close)(void);						/* Close the file (0:Successful) */
+	int (*read)(void *buff, unsigned int btr);			/* Read from the file (bytes read, <0:Error) */
+	int (*write)(const void *buff, unsigned int btw);	/* Write to the file (bytes written, <0:Error) */
+	int (*seek)(unsigned int ofs);			/* Move the file pointer (0:Successful) */
+	int (*mkdir)(const char *path);			/* Create a directory (0:Successful) */
+	int (*unlink)(const char *path);		/* Remove a file (0:Successful) */
+	int (*scan)(const char *path);			/* Count the items in a directory (<0:Error) */
+} FSPORT;
+
+extern const FSPORT FsPortFatFs;	/* fs_port_ff.c */
+extern const FSPORT FsPortFatSL;	/* fs_port_sl.c */
+
+int fsport_mkfs (unsigned int au, unsigned int *csize);	/* Format physical drive 0 with f_mkfs, no partition table (0:Successful) */
+
+#endif
@@ -0,0 +1,166 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs port of the cross-filesystem benchmark                          */
+/*-----------------------------------------------------------------------*/
+
+#include "ff.h"
+#include "fs_port.h"
+
+
+static FATFS Fatfs;
+static FIL File;
+static DIR Dir;
+
+
+
+static
+unsigned int ff_ram (void)
+{
+	return sizeof Fatfs + sizeof File + sizeof Dir;
+}
+
+
+static
+int ff_mount (void)
+{
+	FRESULT res;
+
+
+	res = f_mount(0, &Fatfs);
+	if (res == FR_OK) res = f_opendir(&Dir, "");	/* Mount the volume now rather than in the first measurement */
+	return (int)res;
+}
+
+
+static
+void ff_unmount (void)
+{
+	f_mount(0, 0);
+}
+
+
+static
+int ff_open (
+	const char *path,
+	int mode
+)
+{
+	BYTE fa;
+
+
+	switch (mode) {
+	case FSP_READ :		fa = FA_READ; break;
+	case FSP_WRITE :	fa = FA_READ | FA_WRITE; break;
+	default :			fa = FA_CREATE_ALWAYS | FA_READ | FA_WRITE;
+	}
+	return (int)f_open(&File, path, fa);
+}
+
+
+static
+int ff_close (void)
+{
+	return (int)f_close(&File);
+}
+
+
+static
+int ff_read (
+	void *buff,
+	unsigned int btr
+)
+{
+	UINT br;
+
+
+	if (f_read(&File, buff, btr, &br) != FR_OK) return -1;
+	return (int)br;
+}
+
+
+static
+int ff_write (
+	const void *buff,
+	unsigned int btw
+)
+{
+	UINT bw;
+
+
+	if (f_write(&File, buff, btw, &bw) != FR_OK) return -1;
+	return (int)bw;
+}
+
+
+static
+int ff_seek (
+	unsigned int ofs
+)
+{
+	return (int)f_lseek(&File, ofs);
+}
+
+
+static
+int ff_mkdir (
+	const char *path
+)
+{
+	return (int)f_mkdir(path);
+}
+
+
+static
+int ff_unlink (
+	const char *path
+)
+{
+	return (int)f_unlink(path);
+}
+
+
+static
+int ff_scan (
+	const char *path
+)
+{
+	FILINFO fno;
+	int n;
+
+
+	if (f_opendir(&Dir, path) != FR_OK) return -1;
+	n = 0;
+	while (f_readdir(&Dir, &fno) == FR_OK && fno.fname[0]) {
+		if (fno.fname[0] != '.') n++;	/* Do not count the dot entries */
+	}
+	return n;
+}
+
+
+
+int fsport_mkfs (
+	unsigned int au,		/* Allocation unit in bytes (0:Auto) */
+	unsigned int *csize		/* Pointer to the cluster size in bytes created */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD nclst;
+
+
+	f_mount(0, &Fatfs);
+	res = f_mkfs(0, 1, au);
+	if (res == FR_OK) res = f_getfree("", &nclst, &fs);	/* Mount the new volume */
+#if _MAX_SS != 512
+	if (res == FR_OK) *csize = (unsigned int)fs->csize * fs->ssize;
+#else
+	if (res == FR_OK) *csize = (unsigned int)fs->csize * 512;
+#endif
+	f_mount(0, 0);
+	return (int)res;
+}
+
+
+const FSPORT FsPortFatFs = {
+	"FatFs", ff_ram, ff_mount, ff_unmount, ff_open, ff_close,
+	ff_read, ff_write, ff_seek, ff_mkdir, ff_unlink, ff_scan
+};
@@ -0,0 +1,257 @@
+/*-----------------------------------------------------------------------*/
+/* FreeRTOS-Plus-FAT-SL port of the cross-filesystem benchmark           */
+/*-----------------------------------------------------------------------*/
+/* The FAT-SL media driver is mapped onto the disk_read/disk_write       */
+/* functions of imgdisk, so that both file systems go through the same   */
+/* latency model and access counters.                                    */
+/*-----------------------------------------------------------------------*/
+
+#include "diskio.h"			/* FatFs types with the native long */
+#include "fatsl_host.h"		/* FAT-SL types with a 32-bit long from here */
+#include "fat_sl.h"
+#include "volume.h"
+#include "fs_port.h"
+
+#define SL_BURST	128		/* Maximum sectors per disk_read/disk_write command */
+
+
+static F_DRIVER Driver;
+static F_FILE *File;
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Media driver on imgdisk physical drive 0                              */
+/*-----------------------------------------------------------------------*/
+
+static
+int sl_readmultiplesector (
+	F_DRIVER *driver,
+	void *data,
+	unsigned long sector,
+	int cnt
+)
+{
+	int n;
+
+
+	for ( ; cnt > 0; cnt -= n) {
+		n = cnt < SL_BURST ? cnt : SL_BURST;
+		if (disk_read(0, data, sector, (BYTE)n) != RES_OK) return 1;
+		data = (BYTE*)data + n * F_SECTOR_SIZE;
+		sector += n;
+	}
+	return 0;
+}
+
+
+static
+int sl_writemultiplesector (
+	F_DRIVER *driver,
+	void *data,
+	unsigned long sector,
+	int cnt
+)
+{
+	int n;
+
+
+	for ( ; cnt > 0; cnt -= n) {
+		n = cnt < SL_BURST ? cnt : SL_BURST;
+		if (disk_write(0, data, sector, (BYTE)n) != RES_OK) return 1;
+		data = (BYTE*)data + n * F_SECTOR_SIZE;
+		sector += n;
+	}
+	return 0;
+}
+
+
+static
+int sl_readsector (
+	F_DRIVER *driver,
+	void *data,
+	unsigned long sector
+)
+{
+	return sl_readmultiplesector(driver, data, sector, 1);
+}
+
+
+static
+int sl_writesector (
+	F_DRIVER *driver,
+	void *data,
+	unsigned long sector
+)
+{
+	return sl_writemultiplesector(driver, data, sector, 1);
+}
+
+
+static
+int sl_getphy (
+	F_DRIVER *driver,
+	F_PHY *phy
+)
+{
+	DWORD n;
+
+
+	if (disk_ioctl(0, GET_SECTOR_COUNT, &n) != RES_OK) return 1;
+	phy->number_of_sectors = n;
+	phy->bytes_per_sector = F_SECTOR_SIZE;
+	phy->media_descriptor = F_MEDIADESC_FIX;
+	return 0;
+}
+
+
+static
+F_DRIVER *sl_initfunc (
+	unsigned long driver_param
+)
+{
+	if (disk_initialize(0) & STA_NOINIT) return 0;
+
+	memset(&Driver, 0, sizeof Driver);
+	Driver.readsector = sl_readsector;
+	Driver.writesector = sl_writesector;
+	Driver.readmultiplesector = sl_readmultiplesector;
+	Driver.writemultiplesector = sl_writemultiplesector;
+	Driver.getphy = sl_getphy;
+	return &Driver;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Port functions                                                        */
+/*-----------------------------------------------------------------------*/
+
+static
+unsigned int sl_ram (void)
+{
+	unsigned int n;
+
+
+	n = sizeof gl_volume + sizeof gl_file + F_SECTOR_SIZE + sizeof Driver;
+#if F_SECTOR_CACHE_SIZE
+	n += F_SECTOR_CACHE_SIZE * (F_SECTOR_SIZE + 2 * sizeof(unsigned long)) + sizeof(unsigned long);
+#endif
+	return n;
+}
+
+
+static
+int sl_mount (void)
+{
+	F_FIND find;
+	unsigned char res;
+
+
+	res = f_initvolume(sl_initfunc);
+	if (res == F_NO_ERROR) {	/* Mount the volume now rather than in the first measurement */
+		res = f_findfirst("*.*", &find);
+		if (res == F_ERR_NOTFOUND) res = F_NO_ERROR;
+	}
+	return res;
+}
+
+
+static
+void sl_unmount (void)
+{
+	f_delvolume();
+}
+
+
+static
+int sl_open (
+	const char *path,
+	int mode
+)
+{
+	File = f_open(path, mode == FSP_READ ? "r" : mode == FSP_WRITE ? "r+" : "w+");
+	return File ? 0 : 1;
+}
+
+
+static
+int sl_close (void)
+{
+	return f_close(File);
+}
+
+
+static
+int sl_read (
+	void *buff,
+	unsigned int btr
+)
+{
+	return (int)f_read(buff, 1, (long)btr, File);
+}
+
+
+static
+int sl_write (
+	const void *buff,
+	unsigned int btw
+)
+{
+	return (int)f_write(buff, 1, (long)btw, File);
+}
+
+
+static
+int sl_seek (
+	unsigned int ofs
+)
+{
+	return f_seek(File, (long)ofs, F_SEEK_SET);
+}
+
+
+static
+int sl_mkdir (
+	const char *path
+)
+{
+	return f_mkdir(path);
+}
+
+
+static
+int sl_unlink (
+	const char *path
+)
+{
+	return f_delete(path);
+}
+
+
+static
+int sl_scan (
+	const char *path
+)
+{
+	F_FIND find;
+	char pat[F_MAXPATH];
+	int n;
+
+
+	if (strlen(path) + 5 > sizeof pat) return -1;
+	strcpy(pat, path);
+	strcat(pat, "/*.*");
+	if (f_findfirst(pat, &find) != F_NO_ERROR) return -1;
+	n = 0;
+	do {
+		if (find.filename[0] != '.') n++;
+	} while (f_findnext(&find) == F_NO_ERROR);
+	return n;
+}
+
+
+const FSPORT FsPortFatSL = {
+	"FAT-SL", sl_ram, sl_mount, sl_unmount, sl_open, sl_close,
+	sl_read, sl_write, sl_seek, sl_mkdir, sl_unlink, sl_scan
+};
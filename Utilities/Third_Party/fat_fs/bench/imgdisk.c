@@ -0,0 +1,289 @@
+/*-----------------------------------------------------------------------*/
+/* Disk image file I/O module for the FatFs host benchmarks              */
+/*-----------------------------------------------------------------------*/
+/* Physical drives 0..IMGDISK_DRIVES-1 are emulated on regular files     */
+/* with pread/pwrite. Each command is delayed by the latency model to    */
+/* mimic the real drive (e.g. a USB MSC stick or an SD card). A drive    */
+/* must not be called from two threads at a time, but different drives  */
+/* can be. A power failure can be injected after a number of sectors    */
+/* written, then the drive does not respond until it is opened again.    */
+/*-----------------------------------------------------------------------*/
+
+#define _FILE_OFFSET_BITS 64
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "diskio.h"
+#include "imgdisk.h"
+
+
+IDSTAT ImgDiskStat[IMGDISK_DRIVES];
+
+static struct {
+	int		fd;			/* Image file (-1:Not opened) */
+	DWORD	sectors;	/* Number of sectors on the image */
+	WORD	ssize;		/* Bytes per sector */
+	IDLAT	lat;		/* Latency model */
+	DWORD	cut;		/* Sector count to the power failure (0:No failure) */
+	BYTE	down;		/* Power is down */
+#if _USE_ASYNC
+	BYTE	*rbuff;		/* Read in progress (0:Idle) */
+	DWORD	rsect;
+	BYTE	rcount;
+	double	rdone;		/* Time when the read in progress completes */
+#endif
+} Drv[IMGDISK_DRIVES] = { { -1 }, { -1 }, { -1 } };
+
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+double cost (		/* Latency of a command (sec) */
+	BYTE drv,		/* Physical drive */
+	DWORD ns,		/* Time per sector (ns) */
+	BYTE count		/* Number of sectors */
+)
+{
+	return Drv[drv].lat.cmd_us * 1e-6 + (double)ns * count * 1e-9;
+}
+
+
+static
+void wait_until (	/* Spin until the time (sleeping is too coarse for the latency) */
+	BYTE drv,
+	double t
+)
+{
+	double s = now();
+
+	if (t > s) ImgDiskStat[drv].wait += t - s;
+	while (now() < t) ;
+}
+
+
+static
+int chk_drv (		/* 1:The drive is ready */
+	BYTE drv
+)
+{
+	return drv < IMGDISK_DRIVES && Drv[drv].fd >= 0 && !Drv[drv].down;
+}
+
+
+
+int imgdisk_open (
+	BYTE drv,			/* Physical drive number */
+	const char *path,	/* Image file */
+	DWORD nsect,		/* Number of sectors */
+	WORD ssize			/* Sector size */
+)
+{
+	if (drv >= IMGDISK_DRIVES) return 1;
+	imgdisk_close(drv);
+	Drv[drv].fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (Drv[drv].fd < 0) return 1;
+	if (ftruncate(Drv[drv].fd, (off_t)nsect * ssize)) {
+		imgdisk_close(drv);
+		return 1;
+	}
+	Drv[drv].sectors = nsect;
+	Drv[drv].ssize = ssize;
+	Drv[drv].cut = 0;
+	Drv[drv].down = 0;
+	memset(&ImgDiskStat[drv], 0, sizeof(IDSTAT));
+	return 0;
+}
+
+
+void imgdisk_close (
+	BYTE drv			/* Physical drive number */
+)
+{
+	if (drv >= IMGDISK_DRIVES || Drv[drv].fd < 0) return;
+	fsync(Drv[drv].fd);
+	close(Drv[drv].fd);
+	Drv[drv].fd = -1;
+	Drv[drv].sectors = 0;
+}
+
+
+void imgdisk_latency (
+	BYTE drv,			/* Physical drive number */
+	const IDLAT *lat	/* Latency model (null:No latency) */
+)
+{
+	if (drv >= IMGDISK_DRIVES) return;
+	if (lat)
+		Drv[drv].lat = *lat;
+	else
+		memset(&Drv[drv].lat, 0, sizeof(IDLAT));
+}
+
+
+void imgdisk_powercut (
+	BYTE drv,			/* Physical drive number */
+	DWORD nsect			/* The power fails at the nsect-th sector written from now (0:Never) */
+)
+{
+	if (drv >= IMGDISK_DRIVES) return;
+	Drv[drv].cut = nsect;
+}
+
+
+
+DSTATUS disk_initialize (
+	BYTE drv		/* Physical drive nmuber */
+)
+{
+	return chk_drv(drv) ? 0 : STA_NOINIT;
+}
+
+
+DSTATUS disk_status (
+	BYTE drv		/* Physical drive nmuber */
+)
+{
+	return chk_drv(drv) ? 0 : STA_NOINIT;
+}
+
+
+DRESULT disk_read (
+	BYTE drv,		/* Physical drive nmuber */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..255) */
+)
+{
+	double t;
+	size_t n;
+
+
+	if (!chk_drv(drv)) return RES_NOTRDY;
+	if (!count || sector >= Drv[drv].sectors || count > Drv[drv].sectors - sector) return RES_PARERR;
+#if _USE_ASYNC
+	while (disk_read_poll(drv) == RES_BUSY) ;	/* Complete the read in progress */
+#endif
+
+	t = now() + cost(drv, Drv[drv].lat.rd_ns, count);
+	n = (size_t)count * Drv[drv].ssize;
+	if (pread(Drv[drv].fd, buff, n, (off_t)sector * Drv[drv].ssize) != (ssize_t)n) return RES_ERROR;
+	wait_until(drv, t);
+	ImgDiskStat[drv].reads++;
+	ImgDiskStat[drv].rsects += count;
+	return RES_OK;
+}
+
+
+DRESULT disk_write (
+	BYTE drv,			/* Physical drive nmuber */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address (LBA) */
+	BYTE count			/* Number of sectors to write (1..255) */
+)
+{
+	double t;
+	size_t n;
+
+
+	if (!chk_drv(drv)) return RES_NOTRDY;
+	if (!count || sector >= Drv[drv].sectors || count > Drv[drv].sectors - sector) return RES_PARERR;
+#if _USE_ASYNC
+	while (disk_read_poll(drv) == RES_BUSY) ;	/* Complete the read in progress */
+#endif
+
+	if (Drv[drv].cut && count >= Drv[drv].cut) {	/* Power fails in this command */
+		n = (size_t)(Drv[drv].cut - 1) * Drv[drv].ssize;	/* The sectors prior to the last one are written */
+		if (n) pwrite(Drv[drv].fd, buff, n, (off_t)sector * Drv[drv].ssize);
+		Drv[drv].down = 1;
+		return RES_NOTRDY;
+	}
+	if (Drv[drv].cut) Drv[drv].cut -= count;
+
+	t = now() + cost(drv, Drv[drv].lat.wr_ns, count);
+	n = (size_t)count * Drv[drv].ssize;
+	if (pwrite(Drv[drv].fd, buff, n, (off_t)sector * Drv[drv].ssize) != (ssize_t)n) return RES_ERROR;
+	wait_until(drv, t);
+	ImgDiskStat[drv].writes++;
+	ImgDiskStat[drv].wsects += count;
+	return RES_OK;
+}
+
+
+#if _USE_ASYNC
+DRESULT disk_read_start (
+	BYTE drv,		/* Physical drive nmuber */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..255) */
+)
+{
+	if (!chk_drv(drv)) return RES_NOTRDY;
+	if (!count || sector >= Drv[drv].sectors || count > Drv[drv].sectors - sector) return RES_PARERR;
+	while (disk_read_poll(drv) == RES_BUSY) ;	/* Only one read can be in progress */
+
+	Drv[drv].rbuff = buff;		/* The transfer completes in background for the latency */
+	Drv[drv].rsect = sector;
+	Drv[drv].rcount = count;
+	Drv[drv].rdone = now() + cost(drv, Drv[drv].lat.rd_ns, count);
+	ImgDiskStat[drv].wait += Drv[drv].rdone - now();
+	return RES_OK;
+}
+
+
+DRESULT disk_read_poll (
+	BYTE drv		/* Physical drive nmuber */
+)
+{
+	BYTE *buff;
+	size_t n;
+
+
+	if (!chk_drv(drv)) return RES_NOTRDY;
+	if (!Drv[drv].rbuff) return RES_OK;
+	if (now() < Drv[drv].rdone) return RES_BUSY;
+
+	buff = Drv[drv].rbuff;
+	Drv[drv].rbuff = 0;
+	n = (size_t)Drv[drv].rcount * Drv[drv].ssize;
+	if (pread(Drv[drv].fd, buff, n, (off_t)Drv[drv].rsect * Drv[drv].ssize) != (ssize_t)n) return RES_ERROR;
+	ImgDiskStat[drv].reads++;
+	ImgDiskStat[drv].rsects += Drv[drv].rcount;
+	return RES_OK;
+}
+#endif
+
+
+DRESULT disk_ioctl (
+	BYTE drv,		/* Physical drive nmuber */
+	BYTE ctrl,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+	if (!chk_drv(drv)) return RES_NOTRDY;
+
+	switch (ctrl) {
+	case CTRL_SYNC :		/* The image is synced on close (the latency model stands for the drive) */
+		return RES_OK;
+	case GET_SECTOR_COUNT :
+		*(DWORD*)buff = Drv[drv].sectors;
+		return RES_OK;
+	case GET_SECTOR_SIZE :
+		*(WORD*)buff = Drv[drv].ssize;
+		return RES_OK;
+	case GET_BLOCK_SIZE :
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	}
+	return RES_PARERR;
+}
@@ -0,0 +1,35 @@
+/*-----------------------------------------------------------------------*/
+/* Disk image files for the FatFs host benchmarks                        */
+/*-----------------------------------------------------------------------*/
+
+#ifndef _IMGDISK
+#define _IMGDISK
+
+#include "integer.h"
+
+#define IMGDISK_DRIVES	3	/* Number of physical drives emulated */
+
+/* Latency model of the emulated drive */
+typedef struct {
+	DWORD	cmd_us;			/* Time to process a command (us) */
+	DWORD	rd_ns;			/* Time to read a sector (ns) */
+	DWORD	wr_ns;			/* Time to write a sector (ns) */
+} IDLAT;
+
+/* Access counters of the disk image */
+typedef struct {
+	DWORD	reads;			/* Number of disk_read calls */
+	DWORD	writes;			/* Number of disk_write calls */
+	DWORD	rsects;			/* Number of sectors read */
+	DWORD	wsects;			/* Number of sectors written */
+	double	wait;			/* Injected latency (sec) */
+} IDSTAT;
+
+extern IDSTAT ImgDiskStat[IMGDISK_DRIVES];
+
+int imgdisk_open (BYTE drv, const char *path, DWORD nsect, WORD ssize);	/* Create or resize the image file (0:Successful) */
+void imgdisk_close (BYTE drv);												/* Close the image file */
+void imgdisk_latency (BYTE drv, const IDLAT *lat);							/* Set the latency model (null:No latency) */
+void imgdisk_powercut (BYTE drv, DWORD nsect);								/* Cut the power at the nsect-th sector written from now (0:Never) */
+
+#endif
@@ -0,0 +1,284 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs journaling benchmark and power failure test                     */
+/*-----------------------------------------------------------------------*/
+/* Runs a data logger workload (records appended with f_sync, files      */
+/* created and removed) with and without the metadata journal and        */
+/* compares the write cost. Then the power is cut at points spread over  */
+/* the workload, and the volume is checked after the restart for lost    */
+/* synced data, lost clusters and corrupted files. The journaled volume  */
+/* may lose the last _FS_JOURNAL - 1 records, which are not counted.     */
+/*                                                                       */
+/* Usage: jnl_bench [-i image] [-v volume_MB] [-c cluster_bytes]         */
+/*                  [-l none|usb|sd] [-n records] [-b record_bytes]      */
+/*                  [-j journal_sectors] [-p power_cuts]                 */
+/*-----------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ff.h"
+#include "imgdisk.h"
+
+
+/* Latency models of the drives */
+static const struct {
+	const char *name;
+	IDLAT lat;
+} Profiles[] = {
+	{ "none", {    0,      0,      0 } },
+	{ "usb",  { 1000, 500000, 600000 } },	/* USB FS mass storage: 1 ms per BOT command, 1 MB/s */
+	{ "sd",   {  150,  25000,  80000 } }	/* SD card on 4-bit SDIO */
+};
+
+/* Results of the check after a power failure */
+enum { CHK_OK, CHK_LOST, CHK_LEAK, CHK_CORRUPT, CHK_NUM };
+static const char *const ChkName[] = { "intact", "lost synced data", "lost clusters", "corrupted" };
+
+#define NSLOTS	32		/* Number of small files rotated by the workload */
+#define FSIZE	2000	/* Size of the small files */
+
+static FATFS Fatfs;
+static BYTE Buff[4096];
+static const char *Image = "jnl_bench.img";
+static DWORD VolSect, JnlSect = 64;
+static UINT Au, NRec = 400, RecSize = 100;
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+void die (const char *msg, FRESULT res)
+{
+	printf("%s failed (%d)\n", msg, (int)res);
+	exit(1);
+}
+
+
+/* Contents of a file at an offset (key 0:LOG.DAT, n+1:Fnnn.DAT) */
+static
+void fill (BYTE *buf, DWORD ofs, UINT len, UINT key)
+{
+	while (len--) {
+		*buf++ = (BYTE)(ofs * 31 + key);
+		ofs++;
+	}
+}
+
+
+/* Format the volume and start journaling if needed */
+static
+void format (int jnl)
+{
+	FRESULT res;
+	DIR dir;
+
+
+	if (imgdisk_open(0, Image, VolSect, 512)) die("imgdisk_open", FR_DISK_ERR);
+	f_mount(0, &Fatfs);
+	res = f_mkfs(0, 1, Au);
+	if (res) die("f_mkfs", res);
+	f_mount(0, 0);
+	f_mount(0, &Fatfs);
+	res = f_opendir(&dir, "");		/* Mount the volume */
+	if (res) die("f_opendir", res);
+	if (jnl) {
+		res = f_journal(0, JnlSect);
+		if (res) die("f_journal", res);
+	}
+}
+
+
+/* Data logger workload, returns the log size made durable by f_sync */
+static
+FRESULT workload (DWORD *synced)
+{
+	FRESULT res;
+	FIL log, fil;
+	UINT r, bw;
+	char path[16];
+
+
+	*synced = 0;
+	res = f_open(&log, "LOG.DAT", FA_OPEN_ALWAYS | FA_WRITE);
+	if (res) return res;
+	for (r = 0; r < NRec; r++) {
+		fill(Buff, log.fptr, RecSize, 0);		/* Append a record */
+		res = f_write(&log, Buff, RecSize, &bw);
+		if (res == FR_OK) res = f_sync(&log);
+		if (res) return res;
+		*synced = log.fptr;
+		if (r % 8 == 7) {						/* Rewrite a small file */
+			sprintf(path, "F%03u.DAT", r / 8 % NSLOTS);
+			res = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+			if (res) return res;
+			fill(Buff, 0, FSIZE, r / 8 % NSLOTS + 1);
+			res = f_write(&fil, Buff, FSIZE, &bw);
+			if (res == FR_OK) res = f_close(&fil);
+			if (res) return res;
+		}
+		if (r % 16 == 15) {						/* Remove another one */
+			sprintf(path, "F%03u.DAT", (r / 8 + NSLOTS / 2) % NSLOTS);
+			res = f_unlink(path);
+			if (res && res != FR_NO_FILE) return res;
+		}
+	}
+	return f_close(&log);
+}
+
+
+/* Check the volume after a restart */
+static
+int check (DWORD synced)
+{
+	FRESULT res;
+	DIR dir;
+	FILINFO fno;
+	FIL fil;
+	FATFS *fs;
+	DWORD map[256], ofs, nclst, used, nfree, csz;
+	UINT key, br, n;
+	int rc = CHK_OK;
+
+
+	res = f_opendir(&dir, "");
+	if (res) return CHK_CORRUPT;
+	fs = dir.fs;
+	csz = (DWORD)fs->csize * 512;
+	used = 0;
+	while ((res = f_readdir(&dir, &fno)) == FR_OK && fno.fname[0]) {
+		if (fno.fattrib & AM_DIR) continue;
+		if (!strcmp(fno.fname, "LOG.DAT")) {
+			key = 0;
+			if (fno.fsize < synced && rc == CHK_OK) rc = CHK_LOST;
+		} else if (fno.fname[0] == 'F') {
+			key = (UINT)atoi(fno.fname + 1) + 1;
+		} else {
+			key = 0xFFFF;	/* Journal */
+		}
+		if (f_open(&fil, fno.fname, FA_READ)) return CHK_CORRUPT;
+		map[0] = 256;		/* Count the clusters on the chain */
+		fil.cltbl = map;
+		if (f_lseek(&fil, CREATE_LINKMAP)) return CHK_CORRUPT;
+		for (nclst = 0, n = 1; map[n]; n += 2) nclst += map[n];
+		fil.cltbl = 0;
+		if (nclst < (fil.fsize + csz - 1) / csz) return CHK_CORRUPT;	/* Chain is shorter than the file */
+		if (nclst > (fil.fsize + csz - 1) / csz && rc == CHK_OK) rc = CHK_LEAK;
+		used += nclst;
+		for (ofs = 0; key != 0xFFFF && ofs < fil.fsize; ofs += br) {	/* Verify the contents */
+			if (f_read(&fil, Buff, sizeof Buff, &br) || !br) return CHK_CORRUPT;
+			for (n = 0; n < br && Buff[n] == (BYTE)((ofs + n) * 31 + key); n++) ;
+			if (n < br) return CHK_CORRUPT;
+		}
+		f_close(&fil);
+	}
+	if (res) return CHK_CORRUPT;
+
+	if (fs->fs_type != FS_FAT32) {	/* Allocated clusters must be owned by the files */
+		fs->free_clust = 0xFFFFFFFF;
+		if (f_getfree("", &nfree, &fs)) return CHK_CORRUPT;
+		if (fs->n_fatent - 2 - nfree < used) return CHK_CORRUPT;	/* Cross-linked */
+		if (fs->n_fatent - 2 - nfree > used && rc == CHK_OK) rc = CHK_LEAK;
+	}
+	return rc;
+}
+
+
+static
+void usage (void)
+{
+	printf("usage: jnl_bench [-i image] [-v volume_MB] [-c cluster_bytes] [-l none|usb|sd]\n"
+		   "                 [-n records] [-b record_bytes] [-j journal_sectors] [-p power_cuts]\n");
+	exit(1);
+}
+
+
+int main (int argc, char *argv[])
+{
+	UINT vol_mb = 16, prof = 0, ncut = 100, k, jnl;
+	DWORD wsects[2], synced, result[2][CHK_NUM];
+	FRESULT res;
+	double t;
+	int c;
+
+
+	while ((c = getopt(argc, argv, "i:v:c:l:n:b:j:p:")) != -1) {
+		switch (c) {
+		case 'i': Image = optarg; break;
+		case 'v': vol_mb = (UINT)atoi(optarg); break;
+		case 'c': Au = (UINT)atoi(optarg); break;
+		case 'n': NRec = (UINT)atoi(optarg); break;
+		case 'b': RecSize = (UINT)atoi(optarg); break;
+		case 'j': JnlSect = (DWORD)atol(optarg); break;
+		case 'p': ncut = (UINT)atoi(optarg); break;
+		case 'l':
+			for (prof = 0; prof < sizeof(Profiles) / sizeof(Profiles[0]); prof++) {
+				if (!strcmp(optarg, Profiles[prof].name)) break;
+			}
+			if (prof == sizeof(Profiles) / sizeof(Profiles[0])) usage();
+			break;
+		default: usage();
+		}
+	}
+	if (!vol_mb || !NRec || !RecSize || RecSize > sizeof Buff) usage();
+	VolSect = (DWORD)vol_mb * 1024 * 1024 / 512;
+
+	/* Write cost of the workload */
+	format(0);
+	printf("FatFs journaling benchmark: %u MB FAT%u volume, %u byte clusters, %s latency\n",
+		vol_mb, Fatfs.fs_type == FS_FAT12 ? 12 : Fatfs.fs_type == FS_FAT16 ? 16 : 32,
+		Fatfs.csize * 512, Profiles[prof].name);
+	printf("%u records of %u bytes with f_sync, %lu sector journal, %u syncs per commit\n",
+		NRec, RecSize, (unsigned long)JnlSect, _FS_JOURNAL);
+	for (jnl = 0; jnl < 2; jnl++) {
+		format(jnl);
+		imgdisk_latency(0, &Profiles[prof].lat);
+		memset(&ImgDiskStat[0], 0, sizeof(IDSTAT));
+		t = now();
+		res = workload(&synced);
+		if (res) die("workload", res);
+		t = now() - t;
+		imgdisk_latency(0, 0);
+		wsects[jnl] = ImgDiskStat[0].wsects;
+		printf("%-10s %10.1f ms %9.0f rec/s %8lu writes %8lu sectors written %6.0f ms waited\n",
+			jnl ? "journaled" : "plain", t * 1e3, NRec / t,
+			(unsigned long)ImgDiskStat[0].writes, (unsigned long)ImgDiskStat[0].wsects, ImgDiskStat[0].wait * 1e3);
+		f_mount(0, 0);
+	}
+
+	/* Power failures spread over the workload */
+	if (ncut) {
+		memset(result, 0, sizeof result);
+		for (jnl = 0; jnl < 2; jnl++) {
+			for (k = 1; k <= ncut; k++) {
+				format(jnl);
+				imgdisk_powercut(0, (DWORD)((double)wsects[jnl] * k / (ncut + 1)) + 1);
+				workload(&synced);		/* Runs until the power fails */
+				f_mount(0, 0);
+				if (imgdisk_open(0, Image, VolSect, 512)) die("imgdisk_open", FR_DISK_ERR);	/* Restart */
+				f_mount(0, &Fatfs);
+				if (jnl) synced = synced > (_FS_JOURNAL - 1) * RecSize ? synced - (_FS_JOURNAL - 1) * RecSize : 0;
+				result[jnl][check(synced)]++;
+				f_mount(0, 0);
+			}
+		}
+		printf("%u power failures:\n", ncut);
+		for (k = 0; k < CHK_NUM; k++) {
+			printf("  %-18s plain %4lu   journaled %4lu\n", ChkName[k],
+				(unsigned long)result[0][k], (unsigned long)result[1][k]);
+		}
+	}
+
+	imgdisk_close(0);
+	return 0;
+}
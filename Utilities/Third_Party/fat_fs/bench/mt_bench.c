@@ -0,0 +1,238 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs lock contention benchmark                                       */
+/*-----------------------------------------------------------------------*/
+/* Measures the latency of small metadata operations (f_stat, f_open/    */
+/* f_read/f_close) while another thread writes a large file on the same  */
+/* volume, and the throughput of two threads writing to two drives at    */
+/* once. Build it with _FS_REENTRANT = 1 (volume lock held across the    */
+/* data transfers) and 2 (data transfers run outside the volume lock)    */
+/* to compare them; see Makefile.                                        */
+/*                                                                       */
+/* Usage: mt_bench [-l none|usb|sd] [-n file_KB] [-b buffer_bytes]       */
+/*                 [-m meta_ops]                                         */
+/*-----------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "ff.h"
+#include "imgdisk.h"
+
+#if !_FS_REENTRANT || _VOLUMES < 2
+#error mt_bench needs _FS_REENTRANT >= 1 and _VOLUMES >= 2.
+#endif
+
+
+/* Latency models of the drives */
+static const struct {
+	const char *name;
+	IDLAT lat;
+} Profiles[] = {
+	{ "none", {    0,      0,      0 } },
+	{ "usb",  { 1000, 500000, 600000 } },	/* USB FS mass storage: 1 ms per BOT command, 1 MB/s */
+	{ "sd",   {  150,  25000,  80000 } }	/* SD card on 4-bit SDIO */
+};
+
+#define SMALL_FILES	8		/* Number of small files for the metadata operations */
+
+static FATFS Fatfs[2];
+static UINT FileKB = 4096, BSize = 65536, MetaOps = 200;
+static volatile int Stop;
+
+
+static
+double now (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static
+void die (const char *msg, FRESULT res)
+{
+	printf("%s failed (%d)\n", msg, (int)res);
+	exit(1);
+}
+
+
+
+/* Writer thread: writes a file of FileKB on the drive (arg) until Stop */
+/* is set or once if the loop is not requested */
+typedef struct {
+	BYTE drv;			/* Logical drive to write */
+	BYTE loop;			/* Repeat until Stop */
+	double bytes;		/* Bytes written */
+	double time;		/* Time spent */
+} WRITER;
+
+static
+void *writer (void *arg)
+{
+	WRITER *wr = arg;
+	BYTE *buff;
+	char path[16];
+	FIL fil;
+	UINT n, bw;
+	DWORD ofs;
+	FRESULT res;
+	double t0;
+
+
+	buff = malloc(BSize);
+	if (!buff) die("malloc", FR_NOT_ENOUGH_CORE);
+	memset(buff, 0x5A, BSize);
+	sprintf(path, "%u:BIG.BIN", wr->drv);
+	t0 = now();
+	do {
+		res = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+		if (res) die("f_open", res);
+		for (ofs = 0; ofs < (DWORD)FileKB * 1024 && !Stop; ofs += n) {
+			n = BSize;
+			if (n > (DWORD)FileKB * 1024 - ofs) n = (DWORD)FileKB * 1024 - ofs;
+			res = f_write(&fil, buff, n, &bw);
+			if (res || bw != n) die("f_write", res);
+			wr->bytes += n;
+		}
+		res = f_close(&fil);
+		if (res) die("f_close", res);
+	} while (wr->loop && !Stop);
+	wr->time = now() - t0;
+	free(buff);
+	return 0;
+}
+
+
+
+/* Metadata operations on the drive 0, reports their latency */
+static
+void meta (const char *name)
+{
+	FILINFO fno;
+	FIL fil;
+	BYTE buff[512];
+	char path[16];
+	UINT i, br;
+	FRESULT res;
+	double t, sum = 0, max = 0;
+
+
+	for (i = 0; i < MetaOps; i++) {
+		sprintf(path, "0:SMALL%u.TXT", i % SMALL_FILES);
+		t = now();
+		if (i & 1) {
+			res = f_stat(path, &fno);
+			if (res) die("f_stat", res);
+		} else {
+			res = f_open(&fil, path, FA_READ);
+			if (res) die("f_open", res);
+			res = f_read(&fil, buff, sizeof(buff), &br);
+			if (res) die("f_read", res);
+			f_close(&fil);
+		}
+		t = now() - t;
+		sum += t;
+		if (t > max) max = t;
+	}
+	printf("%-22s %6u ops %9.3f ms avg %9.3f ms max", name, MetaOps, sum / MetaOps * 1e3, max * 1e3);
+}
+
+
+static
+void usage (void)
+{
+	printf("usage: mt_bench [-l none|usb|sd] [-n file_KB] [-b buffer_bytes] [-m meta_ops]\n");
+	exit(1);
+}
+
+
+int main (int argc, char *argv[])
+{
+	UINT prof = 2, i, bw;
+	BYTE drv;
+	FRESULT res;
+	FIL fil;
+	char path[24];
+	pthread_t th[2];
+	WRITER wr[2];
+	double t;
+	int c;
+
+
+	while ((c = getopt(argc, argv, "l:n:b:m:")) != -1) {
+		switch (c) {
+		case 'n': FileKB = (UINT)atoi(optarg); break;
+		case 'b': BSize = (UINT)atoi(optarg); break;
+		case 'm': MetaOps = (UINT)atoi(optarg); break;
+		case 'l':
+			for (prof = 0; prof < sizeof(Profiles) / sizeof(Profiles[0]); prof++) {
+				if (!strcmp(optarg, Profiles[prof].name)) break;
+			}
+			if (prof == sizeof(Profiles) / sizeof(Profiles[0])) usage();
+			break;
+		default: usage();
+		}
+	}
+	if (!FileKB || !BSize || !MetaOps) usage();
+
+	/* Format the volumes without latency */
+	for (drv = 0; drv < 2; drv++) {
+		sprintf(path, "mt_bench%u.img", drv);
+		if (imgdisk_open(drv, path, 32UL * 1024 * 1024 / 512, 512)) die("imgdisk_open", FR_DISK_ERR);
+		f_mount(drv, &Fatfs[drv]);
+		res = f_mkfs(drv, 0, 0);
+		if (res) die("f_mkfs", res);
+	}
+	for (i = 0; i < SMALL_FILES; i++) {
+		sprintf(path, "0:SMALL%u.TXT", i);
+		res = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+		if (res) die("f_open", res);
+		res = f_write(&fil, path, sizeof(path), &bw);
+		if (res) die("f_write", res);
+		f_close(&fil);
+	}
+	for (drv = 0; drv < 2; drv++) imgdisk_latency(drv, &Profiles[prof].lat);
+	printf("_FS_REENTRANT %d, latency %s, %u KB file, %u byte buffer\n",
+		_FS_REENTRANT, Profiles[prof].name, FileKB, BSize);
+
+	/* Metadata operations on an idle volume */
+	meta("meta idle");
+	printf("\n");
+
+	/* Metadata operations during a large write on the same volume */
+	memset(wr, 0, sizeof(wr));
+	wr[0].loop = 1;
+	Stop = 0;
+	pthread_create(&th[0], 0, writer, &wr[0]);
+	nanosleep(&(struct timespec){ 0, 10000000 }, 0);	/* Let the writer start */
+	meta("meta during write");
+	Stop = 1;
+	pthread_join(th[0], 0);
+	printf(" %9.2f MB/s written\n", wr[0].bytes / wr[0].time / 1e6);
+
+	/* A large write on one drive, then on two drives at once */
+	memset(wr, 0, sizeof(wr));
+	Stop = 0;
+	writer(&wr[0]);
+	printf("%-22s %9.2f MB/s\n", "write 1 drive", wr[0].bytes / wr[0].time / 1e6);
+
+	memset(wr, 0, sizeof(wr));
+	wr[1].drv = 1;
+	t = now();
+	for (i = 0; i < 2; i++) pthread_create(&th[i], 0, writer, &wr[i]);
+	for (i = 0; i < 2; i++) pthread_join(th[i], 0);
+	t = now() - t;
+	printf("%-22s %9.2f MB/s\n", "write 2 drives", (wr[0].bytes + wr[1].bytes) / t / 1e6);
+
+	for (drv = 0; drv < 2; drv++) {
+		f_mount(drv, NULL);
+		imgdisk_close(drv);
+	}
+	return 0;
+}
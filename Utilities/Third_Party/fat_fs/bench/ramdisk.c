@@ -0,0 +1,159 @@
+/*-----------------------------------------------------------------------*/
+/* RAM disk I/O module for the FatFs host benchmarks                     */
+/*-----------------------------------------------------------------------*/
+/* A single physical drive (0) is emulated on a heap allocated image and */
+/* every access is counted in RamDiskStat.                               */
+/*-----------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "diskio.h"
+#include "ramdisk.h"
+
+
+RDSTAT RamDiskStat;
+
+static BYTE *Image;		/* Disk image */
+static DWORD Sectors;	/* Number of sectors on the image */
+static WORD SecSize;	/* Bytes per sector */
+
+#if _USE_ASYNC
+static BYTE *ReadBuff;	/* Read in progress (0:Idle) */
+static DWORD ReadSector;
+static BYTE ReadCount;
+#endif
+
+
+
+int ramdisk_create (
+	DWORD nsect,	/* Number of sectors */
+	WORD ssize		/* Sector size */
+)
+{
+	Image = calloc(nsect, ssize);
+	if (!Image) return 1;
+	Sectors = nsect;
+	SecSize = ssize;
+	memset(&RamDiskStat, 0, sizeof(RamDiskStat));
+	return 0;
+}
+
+
+void ramdisk_delete (void)
+{
+	free(Image);
+	Image = 0;
+	Sectors = 0;
+}
+
+
+
+DSTATUS disk_initialize (
+	BYTE drv		/* Physical drive nmuber (0) */
+)
+{
+	return (drv || !Image) ? STA_NOINIT : 0;
+}
+
+
+DSTATUS disk_status (
+	BYTE drv		/* Physical drive nmuber (0) */
+)
+{
+	return (drv || !Image) ? STA_NOINIT : 0;
+}
+
+
+DRESULT disk_read (
+	BYTE drv,		/* Physical drive nmuber (0) */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..255) */
+)
+{
+	if (drv || !Image) return RES_NOTRDY;
+	if (!count || sector >= Sectors || count > Sectors - sector) return RES_PARERR;
+
+	memcpy(buff, Image + (size_t)sector * SecSize, (size_t)count * SecSize);
+	RamDiskStat.reads++;
+	RamDiskStat.rsects += count;
+	return RES_OK;
+}
+
+
+#if _USE_ASYNC
+DRESULT disk_read_start (
+	BYTE drv,		/* Physical drive nmuber (0) */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..255) */
+)
+{
+	if (drv || !Image) return RES_NOTRDY;
+	if (ReadBuff) return RES_ERROR;
+	if (!count || sector >= Sectors || count > Sectors - sector) return RES_PARERR;
+
+	ReadBuff = buff;		/* The transfer completes at the next poll */
+	ReadSector = sector;
+	ReadCount = count;
+	return RES_OK;
+}
+
+
+DRESULT disk_read_poll (
+	BYTE drv		/* Physical drive nmuber (0) */
+)
+{
+	DRESULT res;
+
+
+	if (drv || !Image) return RES_NOTRDY;
+	if (!ReadBuff) return RES_OK;
+
+	res = disk_read(drv, ReadBuff, ReadSector, ReadCount);
+	ReadBuff = 0;
+	return res;
+}
+#endif
+
+
+DRESULT disk_write (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address (LBA) */
+	BYTE count			/* Number of sectors to write (1..255) */
+)
+{
+	if (drv || !Image) return RES_NOTRDY;
+	if (!count || sector >= Sectors || count > Sectors - sector) return RES_PARERR;
+
+	memcpy(Image + (size_t)sector * SecSize, buff, (size_t)count * SecSize);
+	RamDiskStat.writes++;
+	RamDiskStat.wsects += count;
+	return RES_OK;
+}
+
+
+DRESULT disk_ioctl (
+	BYTE drv,		/* Physical drive nmuber (0) */
+	BYTE ctrl,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+	if (drv || !Image) return RES_NOTRDY;
+
+	switch (ctrl) {
+	case CTRL_SYNC :
+		return RES_OK;
+	case GET_SECTOR_COUNT :
+		*(DWORD*)buff = Sectors;
+		return RES_OK;
+	case GET_SECTOR_SIZE :
+		*(WORD*)buff = SecSize;
+		return RES_OK;
+	case GET_BLOCK_SIZE :
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	}
+	return RES_PARERR;
+}
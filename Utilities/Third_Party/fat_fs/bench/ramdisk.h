@@ -0,0 +1,23 @@
+/*-----------------------------------------------------------------------*/
+/* RAM disk for the FatFs host benchmarks                                */
+/*-----------------------------------------------------------------------*/
+
+#ifndef _RAMDISK
+#define _RAMDISK
+
+#include "integer.h"
+
+/* Access counters of the RAM disk */
+typedef struct {
+	DWORD	reads;			/* Number of disk_read calls */
+	DWORD	writes;			/* Number of disk_write calls */
+	DWORD	rsects;			/* Number of sectors read */
+	DWORD	wsects;			/* Number of sectors written */
+} RDSTAT;
+
+extern RDSTAT RamDiskStat;
+
+int ramdisk_create (DWORD nsect, WORD ssize);	/* Allocate the disk image (0:Successful) */
+void ramdisk_delete (void);						/* Release the disk image */
+
+#endif
@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------*/
+/* Synchronization object controls on POSIX threads for the FatFs host    */
+/* benchmarks (see ../src/option/syncobj.c). _SYNC_t must be void*.       */
+/*------------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ff.h"
+
+#if _FS_REENTRANT
+
+int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create due to any error */
+	BYTE vol,			/* Corresponding logical drive being processed */
+	_SYNC_t *sobj		/* Pointer to return the created sync object */
+)
+{
+	pthread_mutex_t *mtx;
+
+
+	(void)vol;
+	mtx = malloc(sizeof(pthread_mutex_t));
+	if (!mtx) return 0;
+	if (pthread_mutex_init(mtx, 0)) {
+		free(mtx);
+		return 0;
+	}
+	*sobj = mtx;
+	return 1;
+}
+
+
+int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to any error */
+	_SYNC_t sobj		/* Sync object tied to the logical drive to be deleted */
+)
+{
+	pthread_mutex_destroy(sobj);
+	free(sobj);
+	return 1;
+}
+
+
+int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a grant */
+	_SYNC_t sobj	/* Sync object to wait */
+)
+{
+	struct timespec ts;
+
+
+	clock_gettime(CLOCK_REALTIME, &ts);	/* _FS_TIMEOUT is taken in unit of ms */
+	ts.tv_sec += _FS_TIMEOUT / 1000;
+	ts.tv_nsec += (_FS_TIMEOUT % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	return pthread_mutex_timedlock(sobj, &ts) == 0;
+}
+
+
+void ff_rel_grant (
+	_SYNC_t sobj	/* Sync object to be signaled */
+)
+{
+	pthread_mutex_unlock(sobj);
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #define _READONLY	0	/* 1: Remove write functions */
 #define _USE_IOCTL	1	/* 1: Use disk_ioctl fucntion */
+#define _USE_ASYNC	1	/* 1: Use disk_read_start and disk_read_poll functions */
 
 #include "integer.h"
 
@@ -19,7 +20,8 @@ typedef enum {
 	RES_ERROR,		/* 1: R/W Error */
 	RES_WRPRT,		/* 2: Write Protected */
 	RES_NOTRDY,		/* 3: Not Ready */
-	RES_PARERR		/* 4: Invalid Parameter */
+	RES_PARERR,		/* 4: Invalid Parameter */
+	RES_BUSY		/* 5: Transfer in progress */
 } DRESULT;
 
 
@@ -34,6 +36,10 @@ DRESULT disk_read (BYTE, BYTE*, DWORD, BYTE);
 DRESULT disk_write (BYTE, const BYTE*, DWORD, BYTE);
 #endif
 DRESULT disk_ioctl (BYTE, BYTE, void*);
+#if _USE_ASYNC
+DRESULT disk_read_start (BYTE, BYTE*, DWORD, BYTE);	/* Start a read without waiting for completion */
+DRESULT disk_read_poll (BYTE);						/* Advance the read started (RES_BUSY:in progress) */
+#endif
 
 
 
@@ -72,6 +72,27 @@ typedef char TCHAR;
 
 
 
+/* Directory index structure (DIRIDX) */
+
+#if _FS_DIRIDX
+#if _USE_LFN
+#define	_DIRIDX_SLOTS	(_FS_DIRIDX * 2)	/* An object with LFN takes two slots */
+#else
+#define	_DIRIDX_SLOTS	_FS_DIRIDX
+#endif
+typedef struct {
+	DWORD	sclust;			/* Start cluster of the directory (0:Root dir) */
+	DWORD	age;			/* Last access stamp */
+	BYTE	stat;			/* Index status (0:Not in use, 1:Partial, 2:Complete) */
+	WORD	ncov;			/* Entries below this index are indexed (Partial) */
+	WORD	nent;			/* Number of slots used or deleted */
+	WORD	free;			/* Entries below this index are in use */
+	DWORD	slot[_DIRIDX_SLOTS];	/* Hash table (0:Blank, 1:Deleted, Else:Tag<<16 | SFN index+1) */
+} DIRIDX;
+#endif
+
+
+
 /* File system object structure (FATFS) */
 
 typedef struct {
@@ -89,11 +110,18 @@ typedef struct {
 #if _FS_REENTRANT
 	_SYNC_t	sobj;			/* Identifier of sync object */
 #endif
+#if _FS_REENTRANT == 2
+	_SYNC_t	dobj;			/* Identifier of sync object for the disk access */
+#endif
 #if !_FS_READONLY
 	DWORD	last_clust;		/* Last allocated cluster */
 	DWORD	free_clust;		/* Number of free clusters */
 	DWORD	fsi_sector;		/* fsinfo sector (FAT32) */
 #endif
+#if _USE_FREEMAP
+	DWORD*	fmap;			/* Pointer to the free cluster bitmap (null:not attached) */
+	BYTE	fmap_stat;		/* Free cluster bitmap status (0:not built, 1:valid) */
+#endif
 #if _FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
 #endif
@@ -104,6 +132,34 @@ typedef struct {
 	DWORD	database;		/* Data start sector */
 	DWORD	winsect;		/* Current sector appearing in the win[] */
 	BYTE	win[_MAX_SS];	/* Disk access window for Directory, FAT (and Data on tiny cfg) */
+#if _FS_CACHE_WAYS
+	DWORD	cache_hit;		/* Number of window loads served by the sector cache */
+	DWORD	cache_miss;		/* Number of window loads read from the disk */
+	DWORD	cstamp;			/* Access stamp of the sector cache (LRU clock) */
+	DWORD	csect[_FS_CACHE_SETS * _FS_CACHE_WAYS];	/* Sector held in each cache line (0:empty) */
+	DWORD	cage[_FS_CACHE_SETS * _FS_CACHE_WAYS];	/* Last access stamp of each cache line */
+	BYTE	cflag[_FS_CACHE_SETS * _FS_CACHE_WAYS];	/* Cache line dirty flag (1:must be written back, 2:committed to the journal) */
+	BYTE	cbuf[_FS_CACHE_SETS * _FS_CACHE_WAYS][_MAX_SS];	/* Cache line buffers */
+#endif
+#if _FS_JOURNAL
+	DWORD	jsect;			/* Journal start sector (0:journaling is off) */
+	DWORD	jsize;			/* Journal size in sectors */
+	DWORD	jpos;			/* Position of the next transaction in the journal */
+	DWORD	jseq;			/* Sequence number of the next transaction */
+	DWORD	jrel[2];		/* Range of the clusters released since the last commit ({low, high}, high 0:None) */
+	BYTE	jsync;			/* Number of f_sync calls not committed yet */
+	BYTE	jbuf[_MAX_SS];	/* Journal descriptor buffer */
+#endif
+#if _FS_AUTOMAP
+	DWORD	amap_pool[_FS_AUTOMAP];	/* Pool of the automatic link maps */
+#endif
+#if _FS_DIRIDX
+	DWORD	didx_stamp;		/* Access stamp of the directory indexes (LRU clock) */
+	DIRIDX	didx[_FS_DIRIDX_DIRS];	/* Directory indexes */
+#endif
+#if _USE_LFN == 4
+	WCHAR	lfnbuf[_MAX_LFN+1];	/* LFN working buffer */
+#endif
 } FATFS;
 
 
@@ -124,8 +180,14 @@ typedef struct {
 	DWORD	dir_sect;		/* Sector containing the directory entry */
 	BYTE*	dir_ptr;		/* Ponter to the directory entry in the window */
 #endif
+#if _USE_EXPAND
+	DWORD	ecl;			/* Last cluster of the contiguous block allocated by f_expand (0:none) */
+#endif
 #if _USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (null on file open) */
+#if _FS_AUTOMAP
+	DWORD*	amap;			/* Pointer to the automatic link map in the pool (null:none) */
+#endif
 #endif
 #if _FS_SHARE
 	UINT	lockid;			/* File lock ID (index of file semaphore table) */
@@ -137,6 +199,25 @@ typedef struct {
 
 
 
+/* Stream read object structure (FSTREAM) */
+
+typedef struct {
+	FIL*	fp;				/* Pointer to the file object being streamed */
+	BYTE*	buf;			/* Pointer to the ring buffer (nslot * ssize bytes) */
+	UINT	ssize;			/* Bytes per slot (sector size * 2^n, up to cluster size) */
+	BYTE	nslot;			/* Number of slots in the ring */
+	BYTE	wr;				/* Slot to be filled next */
+	BYTE	rd;				/* Slot to be handed out next */
+	BYTE	nrdy;			/* Number of filled slots not handed out */
+	BYTE	nheld;			/* Number of slots handed out and not released */
+	BYTE	busy;			/* A read to the slot wr is in progress */
+	DWORD	rclust;			/* Cluster of the read-ahead point (as fp->clust) */
+	DWORD	rofs;			/* File offset of the read-ahead point */
+	DWORD	dofs;			/* File offset of the data to be handed out next */
+} FSTREAM;
+
+
+
 /* Directory object structure (DIR) */
 
 typedef struct {
@@ -212,7 +293,15 @@ FRESULT f_readdir (DIR*, FILINFO*);					/* Read a directory item */
 FRESULT f_stat (const TCHAR*, FILINFO*);			/* Get file status */
 FRESULT f_write (FIL*, const void*, UINT, UINT*);	/* Write data to a file */
 FRESULT f_getfree (const TCHAR*, DWORD*, FATFS**);	/* Get number of free clusters on the drive */
+FRESULT f_freemap (const TCHAR*, DWORD*, UINT);		/* Attach a free cluster bitmap to the drive */
 FRESULT f_truncate (FIL*);							/* Truncate file */
+FRESULT f_expand (FIL*, DWORD);						/* Allocate a contiguous block to the file */
+FRESULT f_journal (BYTE, DWORD);					/* Start or stop metadata journaling on the drive */
+FRESULT f_sopen (FSTREAM*, FIL*, void*, UINT, UINT);	/* Start streaming read of a file */
+FRESULT f_sget (FSTREAM*, const BYTE**, UINT*);		/* Get the next block of the stream */
+FRESULT f_sfree (FSTREAM*);							/* Release the oldest block handed out */
+FRESULT f_spoll (FSTREAM*);							/* Advance read-ahead of the stream */
+FRESULT f_sclose (FSTREAM*);						/* Stop streaming read */
 FRESULT f_sync (FIL*);								/* Flush cached data of a writing file */
 FRESULT f_unlink (const TCHAR*);					/* Delete an existing file or directory */
 FRESULT	f_mkdir (const TCHAR*);						/* Create a new directory */
@@ -1,53 +1,156 @@
 /*---------------------------------------------------------------------------/
-/  FatFs - FAT file system module configuration file  R0.07e  (C)ChaN, 2009
+/  FatFs - FAT file system module configuration file  R0.09  (C)ChaN, 2011
 /----------------------------------------------------------------------------/
 /
 / CAUTION! Do not forget to make clean the project after any changes to
 / the configuration options.
 /
 /----------------------------------------------------------------------------*/
-#ifndef _FFCONFIG
-#define _FFCONFIG 0x007E
+#ifndef _FFCONF
+#define _FFCONF 6502	/* Revision ID */
 
 
 /*---------------------------------------------------------------------------/
 / Function and Buffer Configurations
 /----------------------------------------------------------------------------*/
 
-#define	_FS_TINY	0		/* 0 or 1 */
+#define	_FS_TINY		0	/* 0:Normal or 1:Tiny */
 /* When _FS_TINY is set to 1, FatFs uses the sector buffer in the file system
 /  object instead of the sector buffer in the individual file object for file
 /  data transfer. This reduces memory consumption 512 bytes each file object. */
 
 
-#define _FS_READONLY	0	/* 0 or 1 */
+/* The options below that are enclosed in #ifndef can be set by the project
+/  with a compiler define instead of editing this file, e.g. -D_USE_EXPAND=1.
+/  The optional features are disabled by default. */
+
+#ifndef _FS_CACHE_WAYS
+#define	_FS_CACHE_WAYS	0	/* 0:Disable or 1-8:Lines per cache set */
+#endif
+#ifndef _FS_CACHE_SETS
+#define	_FS_CACHE_SETS	4	/* Number of cache sets (1, 2, 4, 8...) */
+#endif
+/* When _FS_CACHE_WAYS is not zero, a set-associative write-back sector cache
+/  of _FS_CACHE_SETS * _FS_CACHE_WAYS lines is placed behind the sector window
+/  of each file system object. FAT and directory sectors (and file data on the
+/  tiny cfg.) are written back on eviction or f_sync, and the FAT copies are
+/  updated at that time. Each line occupies _MAX_SS bytes in the FATFS. */
+
+
+#ifndef _FS_DIRIDX
+#define	_FS_DIRIDX		0	/* 0:Disable or 16-32768 (power of 2):Slots per directory index */
+#endif
+#ifndef _FS_DIRIDX_DIRS
+#define	_FS_DIRIDX_DIRS	2	/* Number of directories indexed at a time (1-8) */
+#endif
+/* When _FS_DIRIDX is not zero, a hash index of the SFN entries is built in the
+/  FATFS on the first search of a directory, and then the object is found with
+/  a sector read instead of scanning the whole directory. Up to _FS_DIRIDX * 3/4
+/  entries are indexed per directory and the rest is scanned. Each index
+/  occupies _FS_DIRIDX * 4 bytes and the least recently used one is rebuilt for
+/  another directory. On the LFN cfg, an object with LFN takes a second slot
+/  hashed by the case folded LFN, so that a long name is compared in full only
+/  when the hash matched. The index has twice the slots (_FS_DIRIDX * 8 bytes)
+/  to keep the same number of objects. A lookup by LFN still reads about 40%
+/  more sectors than by SFN (30% fewer lookups per second in ff_bench with
+/  28-char names), as the LFN entries make the directory about four times
+/  larger for the sector cache and an LFN that straddles a sector boundary
+/  takes a second read to be verified in full. */
+
+
+#ifndef _FS_JOURNAL
+#define	_FS_JOURNAL		0	/* 0:Disable or 1-255:f_sync calls per commit */
+#endif
+/* When _FS_JOURNAL is not zero, f_journal function creates a contiguous file
+/  JOURNAL.SYS in the root directory and the volume is journaled while it
+/  exists. File data is written in place, but the FAT and directory sectors
+/  changed since the last commit are written to the journal in a transaction,
+/  and they go to their home location (and to the FAT copies) only when the
+/  journal is full. The committed transactions are replayed on mount, so that
+/  the FAT and the directories are never torn by a power failure. f_close and
+/  the directory operations commit at once, and f_sync commits at every
+/  _FS_JOURNAL-th call (or at once after any cluster has been released), so
+/  that up to _FS_JOURNAL - 1 syncs can be lost but the volume is consistent.
+/  The released clusters are not reused until the release has been committed,
+/  and when no other cluster is free, the release is committed at once.
+/  An operation that dirties more sectors than the sector cache has lines is
+/  committed in more than one transaction. Requires the sector cache,
+/  _USE_EXPAND, _FS_MINIMIZE == 0 and adds _MAX_SS bytes to the FATFS. */
+
+
+#define _FS_READONLY	0	/* 0:Read/Write or 1:Read only */
 /* Setting _FS_READONLY to 1 defines read only configuration. This removes
 /  writing functions, f_write, f_sync, f_unlink, f_mkdir, f_chmod, f_rename,
 /  f_truncate and useless f_getfree. */
 
 
-#define _FS_MINIMIZE	0	/* 0, 1, 2 or 3 */
+#define _FS_MINIMIZE	0	/* 0 to 3 */
 /* The _FS_MINIMIZE option defines minimization level to remove some functions.
 /
 /   0: Full function.
 /   1: f_stat, f_getfree, f_unlink, f_mkdir, f_chmod, f_truncate and f_rename
 /      are removed.
-/   2: f_opendir and f_readdir are removed in addition to level 1.
-/   3: f_lseek is removed in addition to level 2. */
+/   2: f_opendir and f_readdir are removed in addition to 1.
+/   3: f_lseek is removed in addition to 2. */
 
 
-#define	_USE_STRFUNC	2	/* 0, 1 or 2 */
+#define	_USE_STRFUNC	2	/* 0:Disable or 1-2:Enable */
 /* To enable string functions, set _USE_STRFUNC to 1 or 2. */
 
 
-#define	_USE_MKFS	1		/* 0 or 1 */
+#define	_USE_MKFS		1	/* 0:Disable or 1:Enable */
 /* To enable f_mkfs function, set _USE_MKFS to 1 and set _FS_READONLY to 0 */
 
 
-#define	_USE_FORWARD	0	/* 0 or 1 */
+#define	_USE_FORWARD	0	/* 0:Disable or 1:Enable */
 /* To enable f_forward function, set _USE_FORWARD to 1 and set _FS_TINY to 1. */
 
 
+#ifndef _USE_FASTSEEK
+#define	_USE_FASTSEEK	0	/* 0:Disable or 1:Enable */
+#endif
+/* To enable fast seek feature, set _USE_FASTSEEK to 1. */
+
+
+#ifndef _FS_AUTOMAP
+#define	_FS_AUTOMAP		0	/* 0:Disable or 16-65535:Items of the link map pool per volume */
+#endif
+/* When _FS_AUTOMAP is not zero, f_open builds the cluster link map of a file
+/  opened without FA_WRITE and larger than a cluster in a pool of the FATFS,
+/  and then f_lseek and f_read find the clusters with a binary search on the
+/  map instead of following the FAT. A map of n fragments takes 2n + 2 items
+/  (4 bytes each) and is returned to the pool by f_close. When the pool is
+/  short, the file is opened in normal seek mode. _USE_FASTSEEK must be 1. */
+
+
+#ifndef _USE_FREEMAP
+#define	_USE_FREEMAP	0	/* 0:Disable or 1:Enable */
+#endif
+/* To enable free cluster bitmap, set _USE_FREEMAP to 1 and set _FS_READONLY to 0.
+/  A bitmap buffer of (number of clusters + 2) bits attached to the volume by
+/  f_freemap function is built from the FAT on the first cluster allocation or
+/  f_getfree, and then they do not need to read the FAT to find free clusters.
+/  f_freemap is available when _FS_MINIMIZE == 0. */
+
+
+#ifndef _USE_EXPAND
+#define	_USE_EXPAND		0	/* 0:Disable or 1:Enable */
+#endif
+/* To enable f_expand function, set _USE_EXPAND to 1 and set _FS_READONLY to 0.
+/  f_expand allocates a contiguous cluster block to an empty file and f_write
+/  writes into the block across the cluster boundaries without FAT access. The
+/  part of the block beyond the file size is released by f_close. */
+
+
+#ifndef _USE_STREAM
+#define	_USE_STREAM		0	/* 0:Disable or 1:Enable */
+#endif
+/* To enable streaming read functions (f_sopen, f_sget, f_sfree, f_spoll and
+/  f_sclose), set _USE_STREAM to 1. They read ahead the file into a ring of
+/  buffers with disk_read_start/disk_read_poll, so that _USE_ASYNC must be
+/  enabled in diskio.h. _FS_MINIMIZE must be 0 to 2. */
+
+
 
 /*---------------------------------------------------------------------------/
 / Locale and Namespace Configurations
@@ -86,29 +189,35 @@
 */
 
 
-#define	_USE_LFN	0	/* 0, 1 or 2 */
+#define	_USE_LFN	0		/* 0 to 4 */
 #define	_MAX_LFN	255		/* Maximum LFN length to handle (12 to 255) */
 /* The _USE_LFN option switches the LFN support.
 /
-/   0: Disable LFN. _MAX_LFN and _LFN_UNICODE have no effect.
-/   1: Enable LFN with static working buffer on the bss. NOT REENTRANT.
+/   0: Disable LFN feature. _MAX_LFN and _LFN_UNICODE have no effect.
+/   1: Enable LFN with static working buffer on the BSS. Always NOT reentrant.
 /   2: Enable LFN with dynamic working buffer on the STACK.
+/   3: Enable LFN with dynamic working buffer on the HEAP.
+/   4: Enable LFN with working buffer in the file system object (FATFS).
 /
-/  The LFN working buffer occupies (_MAX_LFN + 1) * 2 bytes. When enable LFN,
-/  two Unicode handling functions ff_convert() and ff_wtoupper() must be added
-/  to the project. */
+/  The LFN working buffer occupies (_MAX_LFN + 1) * 2 bytes. To enable LFN,
+/  Unicode handling functions ff_convert() and ff_wtoupper() must be added
+/  to the project. When enable to use heap, memory control functions
+/  ff_memalloc() and ff_memfree() must be added to the project. */
 
 
-#define	_LFN_UNICODE	0	/* 0 or 1 */
+#define	_LFN_UNICODE	0	/* 0:ANSI/OEM or 1:Unicode */
 /* To switch the character code set on FatFs API to Unicode,
-/  enable LFN feature and set _LFN_UNICODE to 1.
-*/
+/  enable LFN feature and set _LFN_UNICODE to 1. */
 
 
-#define _FS_RPATH	0	/* 0 or 1 */
-/* When _FS_RPATH is set to 1, relative path feature is enabled and f_chdir,
-/  f_chdrive function are available.
-/  Note that output of the f_readdir function is affected by this option. */
+#define _FS_RPATH		0	/* 0 to 2 */
+/* The _FS_RPATH option configures relative path feature.
+/
+/   0: Disable relative path feature and remove related functions.
+/   1: Enable relative path. f_chdrive() and f_chdir() are available.
+/   2: f_getcwd() is available in addition to 1.
+/
+/  Note that output of the f_readdir fnction is affected by this option. */
 
 
 
@@ -116,22 +225,27 @@
 / Physical Drive Configurations
 /----------------------------------------------------------------------------*/
 
-#define _DRIVES		1
+#define _VOLUMES	1
 /* Number of volumes (logical drives) to be used. */
 
 
-#define	_MAX_SS		1024	/* 512, 1024, 2048 or 4096 */
+#define	_MAX_SS		1024		/* 512, 1024, 2048 or 4096 */
 /* Maximum sector size to be handled.
 /  Always set 512 for memory card and hard disk but a larger value may be
-/  required for floppy disk (512/1024) and optical disk (512/2048).
-/  When _MAX_SS is larger than 512, GET_SECTOR_SIZE command must be implemented
-/  to the disk_ioctl function. */
+/  required for on-board flash memory, floppy disk and optical disk.
+/  When _MAX_SS is larger than 512, it configures FatFs to variable sector size
+/  and GET_SECTOR_SIZE command must be implememted to the disk_ioctl function. */
+
+
+#define	_MULTI_PARTITION	0	/* 0:Single partition, 1/2:Enable multiple partition */
+/* When set to 0, each volume is bound to the same physical drive number and
+/ it can mount only first primaly partition. When it is set to 1, each volume
+/ is tied to the partitions listed in VolToPart[]. */
 
 
-#define	_MULTI_PARTITION	0	/* 0 or 1 */
-/* When _MULTI_PARTITION is set to 0, each volume is bound to the same physical
-/ drive number and can mount only first primary partition. When it is set to 1,
-/ each volume is tied to the partitions listed in Drives[]. */
+#define	_USE_ERASE	0	/* 0:Disable or 1:Enable */
+/* To enable sector erase feature, set _USE_ERASE to 1. CTRL_ERASE_SECTOR command
+/  should be added to the disk_ioctl functio. */
 
 
 
@@ -140,27 +254,43 @@
 /----------------------------------------------------------------------------*/
 
 #define _WORD_ACCESS	0	/* 0 or 1 */
-/* The _WORD_ACCESS option defines which access method is used to the word
-/  data on the FAT volume.
+/* Set 0 first and it is always compatible with all platforms. The _WORD_ACCESS
+/  option defines which access method is used to the word data on the FAT volume.
 /
-/   0: Byte-by-byte access. Always compatible with all platforms.
+/   0: Byte-by-byte access.
 /   1: Word access. Do not choose this unless following condition is met.
 /
-/  When the byte order on the memory is big-endian or address miss-aligned
-/  word access results incorrect behavior, the _WORD_ACCESS must be set to 0.
+/  When the byte order on the memory is big-endian or address miss-aligned word
+/  access results incorrect behavior, the _WORD_ACCESS must be set to 0.
 /  If it is not the case, the value can also be set to 1 to improve the
-/  performance and code size. */
+/  performance and code size.
+*/
+
 
+/* A header file that defines sync object types on the O/S, such as
+/  windows.h, ucos_ii.h and semphr.h, must be included prior to ff.h. */
 
-#define _FS_REENTRANT	0		/* 0 or 1 */
+#define _FS_REENTRANT	0		/* 0:Disable, 1:Enable or 2:Enable with fine-grained locking */
 #define _FS_TIMEOUT		1000	/* Timeout period in unit of time ticks */
-#define	_SYNC_t			HANDLE	/* O/S dependent type of sync object. e.g. HANDLE, OS_EVENT*, ID and etc.. */
-/* The _FS_REENTRANT option switches the reentrancy of the FatFs module.
+#define	_SYNC_t			HANDLE	/* O/S dependent type of sync object. e.g. HANDLE, OS_EVENT*, xSemaphoreHandle, ID and etc.. */
+
+/* The _FS_REENTRANT option switches the reentrancy (thread safe) of the FatFs module.
 /
 /   0: Disable reentrancy. _SYNC_t and _FS_TIMEOUT have no effect.
 /   1: Enable reentrancy. Also user provided synchronization handlers,
 /      ff_req_grant, ff_rel_grant, ff_del_syncobj and ff_cre_syncobj
-/      function must be added to the project. */
+/      function must be added to the project.
+/   2: Enable reentrancy as 1, but the volume is not locked while file data is
+/      transferred by f_read and f_write, so that other tasks can access the
+/      volume meanwhile. A second sync object per volume serializes the calls
+/      to the disk I/O functions instead. Each volume (drive) is locked
+/      independently of the others, so that the tasks on different drives run
+/      in parallel. _FS_TINY and _MULTI_PARTITION must be 0. */
+
+
+#define	_FS_SHARE	0	/* 0:Disable or >=1:Enable */
+/* To enable file shareing feature, set _FS_SHARE to 1 or greater. The value
+   defines how many files can be opened simultaneously. */
 
 
-#endif /* _FFCONFIG */
+#endif /* _FFCONF */
@@ -105,6 +105,32 @@ DRESULT disk_read (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Start Reading Sector(s) / Poll the Read in Progress                   */
+/* (a drive without background transfer can complete it at the start)    */
+
+#if _USE_ASYNC
+DRESULT disk_read_start (
+	BYTE drv,		/* Physical drive nmuber (0..) */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..255) */
+)
+{
+	return disk_read(drv, buff, sector, count);
+}
+
+
+DRESULT disk_read_poll (
+	BYTE drv		/* Physical drive nmuber (0..) */
+)
+{
+	return RES_OK;
+}
+#endif /* _USE_ASYNC */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Write Sector(s)                                                       */
 
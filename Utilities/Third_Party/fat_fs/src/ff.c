@@ -123,6 +123,9 @@
 #if _USE_LFN == 1
 #error Static LFN work area must not be used in re-entrant configuration.
 #endif
+#if _FS_REENTRANT == 2 && (_FS_TINY || _MULTI_PARTITION)
+#error _FS_REENTRANT == 2 requires _FS_TINY == 0 and _MULTI_PARTITION == 0.
+#endif
 #define	ENTER_FF(fs)		{ if (!lock_fs(fs)) return FR_TIMEOUT; }
 #define	LEAVE_FF(fs, res)	{ unlock_fs(fs, res); return res; }
 #else
@@ -147,6 +150,75 @@ typedef struct {
 #endif
 
 
+/* Free cluster bitmap and contiguous allocation */
+#if _USE_FREEMAP && _FS_READONLY
+#error _USE_FREEMAP must be 0 on read-only cfg.
+#endif
+#if _USE_EXPAND && _FS_READONLY
+#error _USE_EXPAND must be 0 on read-only cfg.
+#endif
+
+
+/* Directory index */
+#if _FS_DIRIDX
+#if _FS_DIRIDX < 16 || _FS_DIRIDX > 32768 || (_FS_DIRIDX & (_FS_DIRIDX - 1))
+#error Wrong _FS_DIRIDX setting
+#endif
+#if !_FS_DIRIDX_DIRS || _FS_DIRIDX_DIRS > 8
+#error Wrong _FS_DIRIDX_DIRS setting
+#endif
+#define	DIDX_LIMIT	(_DIRIDX_SLOTS / 4 * 3)	/* Max number of slots used in an index */
+#endif
+
+
+/* Automatic link map */
+#if _FS_AUTOMAP && (!_USE_FASTSEEK || _FS_AUTOMAP < 16 || _FS_AUTOMAP > 65535)
+#error Wrong _FS_AUTOMAP setting
+#endif
+
+
+/* Streaming read */
+#if _USE_STREAM && (!_USE_ASYNC || _FS_MINIMIZE > 2)
+#error _USE_STREAM requires _USE_ASYNC and _FS_MINIMIZE <= 2.
+#endif
+
+
+/* Sector cache */
+#if _FS_CACHE_WAYS
+#if _FS_CACHE_WAYS > 8 || !_FS_CACHE_SETS || (_FS_CACHE_SETS & (_FS_CACHE_SETS - 1))
+#error Wrong sector cache configuration.
+#endif
+#define	CACHE_LINES	(_FS_CACHE_SETS * _FS_CACHE_WAYS)	/* Number of cache lines */
+#endif
+
+
+/* Journaling */
+#if _FS_JOURNAL
+#if !_FS_CACHE_WAYS || _FS_TINY || _FS_READONLY || !_USE_EXPAND || _FS_MINIMIZE
+#error _FS_JOURNAL requires the sector cache, _USE_EXPAND and _FS_MINIMIZE == 0 on non-tiny R/W cfg.
+#endif
+#if _FS_JOURNAL > 255
+#error Wrong _FS_JOURNAL setting
+#endif
+#if CACHE_LINES > (512 - 16) / 8
+#error Too many cache lines for a journal descriptor.
+#endif
+#define	JNL_NAME	"JOURNAL SYS"	/* SFN of the journal file in the root directory */
+#define	JS_Sig		0		/* Superblock signature (4) */
+#define	JS_Seq		4		/* Sequence number of the first transaction in the journal (4) */
+#define	JD_Sig		0		/* Descriptor signature (4) */
+#define	JD_Seq		4		/* Sequence number of the transaction (4) */
+#define	JD_Cnt		8		/* Number of logged sectors that follow the descriptor (4) */
+#define	JD_Sum		12		/* Checksum of the descriptor (4) */
+#define	JD_Ent		16		/* Home sector (4) and checksum (4) of each logged sector */
+#define	JS_SIG		0x4C4E4A46	/* "FJNL" */
+#define	JD_SIG		0x4E585446	/* "FTXN" */
+#define	JNL_HELD(fs, cl)	((fs)->jsect && (fs)->jrel[1] && (cl) >= (fs)->jrel[0] && (cl) <= (fs)->jrel[1])	/* Released but not committed */
+#else
+#define	JNL_HELD(fs, cl)	0
+#endif
+
+
 /* Misc definitions */
 #define LD_CLUST(dir)	(((DWORD)LD_WORD(dir+DIR_FstClusHI)<<16) | LD_WORD(dir+DIR_FstClusLO))
 #define ST_CLUST(dir,cl) {ST_WORD(dir+DIR_FstClusLO, cl); ST_WORD(dir+DIR_FstClusHI, (DWORD)cl>>16);}
@@ -506,6 +578,11 @@ static WCHAR LfnBuf[_MAX_LFN+1];
 							  (dobj).lfn = lfn;	(dobj).fn = sfn; }
 #define	FREE_BUF()			ff_memfree(lfn)
 
+#elif _USE_LFN == 4 		/* LFN feature with working buffer in the file system object */
+#define	DEF_NAMEBUF			BYTE sfn[12]
+#define INIT_BUF(dobj)		{ (dobj).fn = sfn; (dobj).lfn = (dobj).fs->lfnbuf; }
+#define	FREE_BUF()
+
 #else
 #error Wrong LFN configuration.
 #endif
@@ -600,6 +677,120 @@ void unlock_fs (
 
 
 
+#if _FS_REENTRANT == 2
+/*-----------------------------------------------------------------------*/
+/* Serialize the disk access on the drive                                */
+/*-----------------------------------------------------------------------*/
+/* The volume lock does not cover the file data transfer on this cfg, so
+/  that every call to the disk I/O layer is made with the drive locked.
+/  The disk functions called in following code are redirected to these.
+*/
+
+static
+DSTATUS lock_initialize (BYTE drv)
+{
+	DSTATUS stat = STA_NOINIT;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		stat = disk_initialize(drv);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return stat;
+}
+
+
+static
+DSTATUS lock_status (BYTE drv)
+{
+	DSTATUS stat = STA_NOINIT;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		stat = disk_status(drv);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return stat;
+}
+
+
+static
+DRESULT lock_read (BYTE drv, BYTE *buff, DWORD sect, BYTE cnt)
+{
+	DRESULT res = RES_NOTRDY;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		res = disk_read(drv, buff, sect, cnt);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return res;
+}
+
+
+#if !_FS_READONLY
+static
+DRESULT lock_write (BYTE drv, const BYTE *buff, DWORD sect, BYTE cnt)
+{
+	DRESULT res = RES_NOTRDY;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		res = disk_write(drv, buff, sect, cnt);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return res;
+}
+#endif
+
+
+static
+DRESULT lock_ioctl (BYTE drv, BYTE ctrl, void *buff)
+{
+	DRESULT res = RES_NOTRDY;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		res = disk_ioctl(drv, ctrl, buff);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return res;
+}
+
+
+#if _USE_STREAM
+static
+DRESULT lock_read_start (BYTE drv, BYTE *buff, DWORD sect, BYTE cnt)
+{
+	DRESULT res = RES_NOTRDY;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		res = disk_read_start(drv, buff, sect, cnt);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return res;
+}
+
+
+static
+DRESULT lock_read_poll (BYTE drv)
+{
+	DRESULT res = RES_NOTRDY;
+
+	if (ff_req_grant(FatFs[drv]->dobj)) {
+		res = disk_read_poll(drv);
+		ff_rel_grant(FatFs[drv]->dobj);
+	}
+	return res;
+}
+#define	disk_read_start	lock_read_start
+#define	disk_read_poll	lock_read_poll
+#endif
+
+#define	disk_initialize	lock_initialize
+#define	disk_status		lock_status
+#define	disk_read		lock_read
+#define	disk_write		lock_write
+#define	disk_ioctl		lock_ioctl
+#endif /* _FS_REENTRANT == 2 */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* File shareing control functions                                       */
 /*-----------------------------------------------------------------------*/
@@ -711,6 +902,272 @@ void clear_lock (	/* Clear lock entries of the volume */
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Create FSInfo sector                                                  */
+/*-----------------------------------------------------------------------*/
+#if !_FS_READONLY
+static
+void put_fsinfo (
+	FATFS *fs,		/* File system object */
+	BYTE *buf		/* Sector buffer to create the FSInfo structure */
+)
+{
+	mem_set(buf, 0, 512);
+	ST_WORD(buf+BS_55AA, 0xAA55);
+	ST_DWORD(buf+FSI_LeadSig, 0x41615252);
+	ST_DWORD(buf+FSI_StrucSig, 0x61417272);
+	ST_DWORD(buf+FSI_Free_Count, fs->free_clust);
+	ST_DWORD(buf+FSI_Nxt_Free, fs->last_clust);
+}
+#endif
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Sector cache - Find, allocate, write back and drop cache lines        */
+/*-----------------------------------------------------------------------*/
+#if _FS_CACHE_WAYS
+
+static
+UINT cache_find (	/* Index of the line holding the sector (CACHE_LINES:not cached) */
+	FATFS *fs,		/* File system object */
+	DWORD sect		/* Sector number to find */
+)
+{
+	UINT i, n;
+
+
+	i = (UINT)(sect & (_FS_CACHE_SETS - 1)) * _FS_CACHE_WAYS;	/* Top of the set */
+	for (n = _FS_CACHE_WAYS; n; n--, i++) {
+		if (fs->csect[i] == sect) return i;
+	}
+	return CACHE_LINES;
+}
+
+
+#if !_FS_READONLY
+static
+FRESULT cache_wback (	/* FR_OK:Successful, FR_DISK_ERR:Failed */
+	FATFS *fs,		/* File system object */
+	UINT i			/* Cache line to be written back */
+)
+{
+	DWORD wsect;
+
+
+	wsect = fs->csect[i];
+	if (disk_write(fs->drv, fs->cbuf[i], wsect, 1) != RES_OK)
+		return FR_DISK_ERR;
+	fs->cflag[i] = 0;
+	if (wsect < (fs->fatbase + fs->fsize)) {	/* In FAT area */
+		BYTE nf;
+		for (nf = fs->n_fats; nf > 1; nf--) {	/* Reflect the change to all FAT copies */
+			wsect += fs->fsize;
+			disk_write(fs->drv, fs->cbuf[i], wsect, 1);
+		}
+	}
+	return FR_OK;
+}
+
+
+static
+FRESULT cache_flush (	/* FR_OK:Successful, FR_DISK_ERR:Failed */
+	FATFS *fs		/* File system object */
+)
+{
+	UINT i, n, cnt, ord[CACHE_LINES];
+	BYTE nf;
+
+
+	for (cnt = i = 0; i < CACHE_LINES; i++) {	/* Sort dirty lines in order of sector number */
+		if (!fs->cflag[i]) continue;
+		for (n = cnt++; n && fs->csect[ord[n - 1]] > fs->csect[i]; n--)
+			ord[n] = ord[n - 1];
+		ord[n] = i;
+	}
+	for (n = 0; n < cnt; n++) {		/* Write back the dirty lines */
+		i = ord[n];
+		if (disk_write(fs->drv, fs->cbuf[i], fs->csect[i], 1) != RES_OK)
+			return FR_DISK_ERR;
+	}
+	for (nf = 1; nf < fs->n_fats; nf++) {	/* Reflect the FAT changes to each FAT copy in a pass */
+		for (n = 0; n < cnt; n++) {
+			i = ord[n];
+			if (fs->csect[i] < (fs->fatbase + fs->fsize))
+				disk_write(fs->drv, fs->cbuf[i], fs->csect[i] + fs->fsize * nf, 1);
+		}
+	}
+	for (n = 0; n < cnt; n++) fs->cflag[ord[n]] = 0;
+
+	return FR_OK;
+}
+#endif
+
+
+#if _FS_JOURNAL
+static
+DWORD jnl_sum (		/* Checksum of a sector */
+	const BYTE *p,	/* Sector data */
+	UINT n			/* Number of bytes (multiple of 4) */
+)
+{
+	DWORD s = 0;
+
+
+	for ( ; n; n -= 4, p += 4)
+		s = (((s << 1) | ((s >> 31) & 1)) + LD_DWORD(p)) & 0xFFFFFFFF;
+	return s;
+}
+
+
+static
+FRESULT jnl_checkpoint (	/* FR_OK:Successful, FR_DISK_ERR:Failed */
+	FATFS *fs		/* File system object */
+)
+{
+	BYTE *d = fs->jbuf;
+
+
+	if (cache_flush(fs) != FR_OK)	/* Write the committed sectors to their home location */
+		return FR_DISK_ERR;
+	if (fs->fs_type == FS_FAT32 && fs->fsi_flag) {
+		put_fsinfo(fs, d);
+		if (disk_write(fs->drv, d, fs->fsi_sector, 1) != RES_OK)
+			return FR_DISK_ERR;
+		fs->fsi_flag = 0;
+	}
+	if (disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+		return FR_DISK_ERR;
+	mem_set(d, 0, SS(fs));			/* Discard the transactions in the journal */
+	ST_DWORD(d+JS_Sig, JS_SIG);
+	ST_DWORD(d+JS_Seq, fs->jseq);
+	if (disk_write(fs->drv, d, fs->jsect, 1) != RES_OK || disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+		return FR_DISK_ERR;
+	fs->jpos = 1;
+
+	return FR_OK;
+}
+
+
+static
+FRESULT jnl_commit (	/* FR_OK:Successful, FR_DISK_ERR:Failed */
+	FATFS *fs		/* File system object */
+)
+{
+	UINT i, n, cnt;
+	DWORD sect, sum;
+	BYTE *d = fs->jbuf;
+
+
+	if (disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)	/* File data reaches the medium prior to the metadata */
+		return FR_DISK_ERR;
+	mem_set(d, 0, SS(fs));
+	sect = fs->jsect + fs->jpos + 1;
+	for (cnt = i = 0; i < CACHE_LINES; i += n ? n : 1) {	/* Log the dirty lines, adjacent lines in a write */
+		for (n = 0; i + n < CACHE_LINES && fs->cflag[i + n] == 1 && (!n || SS(fs) == _MAX_SS); n++, cnt++) {
+			sum = jnl_sum(fs->cbuf[i + n], SS(fs));
+			ST_DWORD(d + JD_Ent + cnt * 8, fs->csect[i + n]);
+			ST_DWORD(d + JD_Ent + cnt * 8 + 4, sum);
+		}
+		if (n) {
+			if (disk_write(fs->drv, fs->cbuf[i], sect, (BYTE)n) != RES_OK)
+				return FR_DISK_ERR;
+			sect += n;
+		}
+	}
+	if (!cnt) return FR_OK;
+
+	ST_DWORD(d+JD_Sig, JD_SIG);		/* Write the descriptor to complete the transaction */
+	ST_DWORD(d+JD_Seq, fs->jseq);
+	ST_DWORD(d+JD_Cnt, cnt);
+	sum = jnl_sum(d, SS(fs));
+	ST_DWORD(d+JD_Sum, sum);
+	if (disk_write(fs->drv, d, fs->jsect + fs->jpos, 1) != RES_OK || disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+		return FR_DISK_ERR;
+	for (i = 0; i < CACHE_LINES; i++) {	/* The lines can go home at any time from now */
+		if (fs->cflag[i] == 1) fs->cflag[i] = 2;
+	}
+	fs->jpos += 1 + cnt;
+	fs->jseq++;
+	fs->jsync = 0;
+
+	if (fs->jpos + 1 + CACHE_LINES > fs->jsize)	/* Checkpoint if the next transaction may not fit */
+		return jnl_checkpoint(fs);
+	return FR_OK;
+}
+#endif
+
+
+static
+UINT cache_alloc (	/* Index of the line to be refilled (CACHE_LINES:disk error) */
+	FATFS *fs,		/* File system object */
+	DWORD sect		/* Sector number to be cached */
+)
+{
+	UINT i, v, n;
+
+
+	i = v = (UINT)(sect & (_FS_CACHE_SETS - 1)) * _FS_CACHE_WAYS;	/* Top of the set */
+	for (n = _FS_CACHE_WAYS; n; n--, i++) {	/* Find an empty or least recently used line */
+		if (!fs->csect[i]) { v = i; break; }
+		if ((DWORD)(fs->cstamp - fs->cage[i]) > (DWORD)(fs->cstamp - fs->cage[v])) v = i;
+	}
+#if !_FS_READONLY
+#if _FS_JOURNAL
+	if (fs->cflag[v] == 1 && fs->jsect && jnl_commit(fs) != FR_OK)	/* Commit the victim before it goes home */
+		return CACHE_LINES;
+#endif
+	if (fs->cflag[v] && cache_wback(fs, v) != FR_OK)	/* Write back the victim if dirty */
+		return CACHE_LINES;
+#endif
+	fs->csect[v] = sect;
+	fs->cage[v] = ++fs->cstamp;
+	return v;
+}
+
+
+static
+void cache_inval (
+	FATFS *fs,		/* File system object */
+	DWORD sect,		/* Start sector of the range to be dropped */
+	UINT cnt		/* Number of sectors */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < CACHE_LINES; i++) {
+		if (fs->csect[i] - sect < cnt) {
+			fs->csect[i] = 0; fs->cflag[i] = 0;
+		}
+	}
+}
+
+
+#if _FS_TINY && !_FS_READONLY && _FS_MINIMIZE <= 2
+static
+void cache_patch (	/* Replace sectors in a read buffer with the dirty cache lines */
+	FATFS *fs,		/* File system object */
+	BYTE *buff,		/* Data read from the disk */
+	DWORD sect,		/* Start sector of the data */
+	UINT cnt		/* Number of sectors */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < CACHE_LINES; i++) {
+		if (fs->cflag[i] && fs->csect[i] - sect < cnt)
+			mem_cpy(buff + ((fs->csect[i] - sect) * SS(fs)), fs->cbuf[i], SS(fs));
+	}
+}
+#endif
+#endif /* _FS_CACHE_WAYS */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Change window offset                                                  */
 /*-----------------------------------------------------------------------*/
@@ -726,6 +1183,39 @@ FRESULT move_window (
 
 	wsect = fs->winsect;
 	if (wsect != sector) {	/* Changed current window */
+#if _FS_CACHE_WAYS
+		UINT i;
+
+#if !_FS_READONLY
+		if (fs->wflag) {	/* Write back dirty window into the cache */
+			i = cache_find(fs, wsect);
+			if (i == CACHE_LINES) {
+				i = cache_alloc(fs, wsect);
+				if (i == CACHE_LINES) return FR_DISK_ERR;
+			}
+			mem_cpy(fs->cbuf[i], fs->win, SS(fs));
+			fs->cflag[i] = 1;
+			fs->wflag = 0;
+		}
+#endif
+		if (sector) {
+			i = cache_find(fs, sector);
+			if (i < CACHE_LINES) {		/* Cache hit */
+				fs->cage[i] = ++fs->cstamp;
+				fs->cache_hit++;
+			} else {					/* Cache miss, refill a line */
+				i = cache_alloc(fs, sector);
+				if (i == CACHE_LINES) return FR_DISK_ERR;
+				if (disk_read(fs->drv, fs->cbuf[i], sector, 1) != RES_OK) {
+					fs->csect[i] = 0;
+					return FR_DISK_ERR;
+				}
+				fs->cache_miss++;
+			}
+			mem_cpy(fs->win, fs->cbuf[i], SS(fs));
+			fs->winsect = sector;
+		}
+#else
 #if !_FS_READONLY
 		if (fs->wflag) {	/* Write back dirty window if needed */
 			if (disk_write(fs->drv, fs->win, wsect, 1) != RES_OK)
@@ -745,6 +1235,7 @@ FRESULT move_window (
 				return FR_DISK_ERR;
 			fs->winsect = sector;
 		}
+#endif
 	}
 
 	return FR_OK;
@@ -766,17 +1257,22 @@ FRESULT sync (	/* FR_OK: successful, FR_DISK_ERR: failed */
 
 
 	res = move_window(fs, 0);
+#if _FS_JOURNAL
+	if (res == FR_OK && fs->jsect) {	/* Journaled volume: FAT copies and FSInfo are updated at the checkpoint */
+		res = jnl_commit(fs);
+		if (res == FR_OK) fs->jrel[1] = 0;	/* The released clusters can be reused from now */
+		return res;
+	}
+#endif
+#if _FS_CACHE_WAYS
+	if (res == FR_OK)
+		res = cache_flush(fs);
+#endif
 	if (res == FR_OK) {
 		/* Update FSInfo sector if needed */
 		if (fs->fs_type == FS_FAT32 && fs->fsi_flag) {
 			fs->winsect = 0;
-			/* Create FSInfo structure */
-			mem_set(fs->win, 0, 512);
-			ST_WORD(fs->win+BS_55AA, 0xAA55);
-			ST_DWORD(fs->win+FSI_LeadSig, 0x41615252);
-			ST_DWORD(fs->win+FSI_StrucSig, 0x61417272);
-			ST_DWORD(fs->win+FSI_Free_Count, fs->free_clust);
-			ST_DWORD(fs->win+FSI_Nxt_Free, fs->last_clust);
+			put_fsinfo(fs, fs->win);
 			/* Write it into the FSInfo sector */
 			disk_write(fs->drv, fs->win, fs->fsi_sector, 1);
 			fs->fsi_flag = 0;
@@ -908,6 +1404,14 @@ FRESULT put_fat (
 			res = FR_INT_ERR;
 		}
 		fs->wflag = 1;
+#if _USE_FREEMAP
+		if (res == FR_OK && fs->fmap_stat) {	/* Reflect the change to the free cluster bitmap */
+			if (val & 0x0FFFFFFF)
+				fs->fmap[clst / 32] |= (DWORD)1 << (clst % 32);
+			else
+				fs->fmap[clst / 32] &= ~((DWORD)1 << (clst % 32));
+		}
+#endif
 	}
 
 	return res;
@@ -918,9 +1422,103 @@ FRESULT put_fat (
 
 
 /*-----------------------------------------------------------------------*/
-/* FAT handling - Remove a cluster chain                                 */
+/* FAT handling - Build and search the free cluster bitmap               */
 /*-----------------------------------------------------------------------*/
-#if !_FS_READONLY
+#if _USE_FREEMAP
+
+static
+FRESULT build_fmap (	/* FR_OK:Successful, FR_DISK_ERR/FR_INT_ERR:Failed */
+	FATFS *fs		/* File system object */
+)
+{
+	FRESULT res;
+	DWORD n, clst, sect, stat, *map;
+	UINT i;
+	BYTE fat, *p;
+
+
+	map = fs->fmap;
+	mem_set(map, 0, (fs->n_fatent + 31) / 32 * sizeof(DWORD));
+	fat = fs->fs_type;
+	res = FR_OK; n = 0;
+	if (fat == FS_FAT12) {
+		clst = 2;
+		do {
+			stat = get_fat(fs, clst);
+			if (stat == 0xFFFFFFFF) return FR_DISK_ERR;
+			if (stat == 1) return FR_INT_ERR;
+			if (stat) map[clst / 32] |= (DWORD)1 << (clst % 32);
+			else n++;
+		} while (++clst < fs->n_fatent);
+	} else {
+		clst = 0;
+		sect = fs->fatbase;
+		i = 0; p = 0;
+		do {
+			if (!i) {
+				res = move_window(fs, sect++);
+				if (res != FR_OK) return res;
+				p = fs->win;
+				i = SS(fs);
+			}
+			if (fat == FS_FAT16) {
+				stat = LD_WORD(p);
+				p += 2; i -= 2;
+			} else {
+				stat = LD_DWORD(p) & 0x0FFFFFFF;
+				p += 4; i -= 4;
+			}
+			if (stat) map[clst / 32] |= (DWORD)1 << (clst % 32);
+			else if (clst >= 2) n++;
+		} while (++clst < fs->n_fatent);
+	}
+	map[0] |= 3;						/* Cluster 0 and 1 are not available */
+	for (clst = fs->n_fatent; clst % 32; clst++)	/* Nor the bits over the last cluster */
+		map[clst / 32] |= (DWORD)1 << (clst % 32);
+
+	fs->free_clust = n;					/* Free cluster count is exact from now */
+	if (fat == FS_FAT32) fs->fsi_flag = 1;
+	fs->fmap_stat = 1;
+
+	return res;
+}
+
+
+static
+DWORD find_fmap (	/* 0:No free cluster, >=2:Free cluster# */
+	FATFS *fs,		/* File system object */
+	DWORD scl		/* Cluster# to start the search after */
+)
+{
+	DWORD ncl, w, *map;
+	UINT i, n, nw, b;
+
+
+	map = fs->fmap;
+	nw = (UINT)((fs->n_fatent + 31) / 32);
+	ncl = scl + 1;
+	if (ncl >= fs->n_fatent) ncl = 2;
+	i = (UINT)(ncl / 32);
+	w = map[i] | (((DWORD)1 << (ncl % 32)) - 1);	/* Skip clusters prior to the start point */
+	for (n = nw + 1; n; n--) {	/* Search the bitmap in a round */
+		if (w != 0xFFFFFFFF) {
+			for (b = 0; w & 1; b++) w >>= 1;
+			return (DWORD)i * 32 + b;
+		}
+		if (++i == nw) i = 0;
+		w = map[i];
+	}
+	return 0;
+}
+#endif /* _USE_FREEMAP */
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Remove a cluster chain                                 */
+/*-----------------------------------------------------------------------*/
+#if !_FS_READONLY
 static
 FRESULT remove_chain (
 	FATFS *fs,			/* File system object */
@@ -938,6 +1536,9 @@ FRESULT remove_chain (
 
 	} else {
 		res = FR_OK;
+#if _FS_JOURNAL > 1
+		fs->jsync = _FS_JOURNAL;				/* Released clusters can be reused for data only after a commit */
+#endif
 		while (clst < fs->n_fatent) {			/* Not a last link? */
 			nxt = get_fat(fs, clst);			/* Get cluster status */
 			if (nxt == 0) break;				/* Empty cluster? */
@@ -945,6 +1546,12 @@ FRESULT remove_chain (
 			if (nxt == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }	/* Disk error? */
 			res = put_fat(fs, clst, 0);			/* Mark the cluster "empty" */
 			if (res != FR_OK) break;
+#if _FS_JOURNAL
+			if (fs->jsect) {					/* Hold the cluster until the release is committed */
+				if (!fs->jrel[1] || clst < fs->jrel[0]) fs->jrel[0] = clst;
+				if (clst > fs->jrel[1]) fs->jrel[1] = clst;
+			}
+#endif
 			if (fs->free_clust != 0xFFFFFFFF) {	/* Update FSInfo */
 				fs->free_clust++;
 				fs->fsi_flag = 1;
@@ -974,6 +1581,52 @@ FRESULT remove_chain (
 /* FAT handling - Stretch or Create a cluster chain                      */
 /*-----------------------------------------------------------------------*/
 #if !_FS_READONLY
+static
+DWORD find_free (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Free cluster# */
+	FATFS *fs,			/* File system object */
+	DWORD scl			/* Cluster# to search next to */
+)
+{
+	DWORD cs, ncl;
+#if _USE_FREEMAP
+	FRESULT res;
+#endif
+
+
+#if _USE_FREEMAP
+	if (fs->fmap) {			/* Find a free cluster on the bitmap */
+		if (!fs->fmap_stat) {
+			res = build_fmap(fs);
+			if (res != FR_OK) return (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;
+		}
+		ncl = find_fmap(fs, scl);
+#if _FS_JOURNAL
+		if (JNL_HELD(fs, ncl))			/* Skip the clusters held for the journal */
+			ncl = find_fmap(fs, fs->jrel[1]);
+#endif
+		if (!ncl || JNL_HELD(fs, ncl)) return 0;	/* No free cluster */
+	} else
+#endif
+	{
+		ncl = scl;				/* Start cluster */
+		for (;;) {
+			ncl++;							/* Next cluster */
+			if (ncl >= fs->n_fatent) {		/* Wrap around */
+				ncl = 2;
+				if (ncl > scl) return 0;	/* No free cluster */
+			}
+			cs = get_fat(fs, ncl);			/* Get the cluster status */
+			if (cs == 0 && !JNL_HELD(fs, ncl)) break;	/* Found a free cluster */
+			if (cs == 0xFFFFFFFF || cs == 1)/* An error occurred */
+				return cs;
+			if (ncl == scl) return 0;		/* No free cluster */
+		}
+	}
+
+	return ncl;
+}
+
+
 static
 DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:New cluster# */
 	FATFS *fs,			/* File system object */
@@ -995,25 +1648,23 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 		scl = clst;
 	}
 
-	ncl = scl;				/* Start cluster */
-	for (;;) {
-		ncl++;							/* Next cluster */
-		if (ncl >= fs->n_fatent) {		/* Wrap around */
-			ncl = 2;
-			if (ncl > scl) return 0;	/* No free cluster */
-		}
-		cs = get_fat(fs, ncl);			/* Get the cluster status */
-		if (cs == 0) break;				/* Found a free cluster */
-		if (cs == 0xFFFFFFFF || cs == 1)/* An error occurred */
-			return cs;
-		if (ncl == scl) return 0;		/* No free cluster */
+	ncl = find_free(fs, scl);
+#if _FS_JOURNAL
+	if (ncl == 0 && fs->jsect && fs->jrel[1]) {	/* Only the held clusters are left, commit the release and retry */
+		if (sync(fs) != FR_OK) return 0xFFFFFFFF;
+		ncl = find_free(fs, scl);
 	}
+#endif
+	if (ncl < 2 || ncl == 0xFFFFFFFF) return ncl;
 
 	res = put_fat(fs, ncl, 0x0FFFFFFF);	/* Mark the new cluster "last link" */
 	if (res == FR_OK && clst != 0) {
 		res = put_fat(fs, clst, ncl);	/* Link it to the previous one if needed */
 	}
 	if (res == FR_OK) {
+#if _FS_CACHE_WAYS
+		cache_inval(fs, clust2sect(fs, ncl), fs->csize);	/* Drop stale lines of the new cluster */
+#endif
 		fs->last_clust = ncl;			/* Update FSINFO */
 		if (fs->free_clust != 0xFFFFFFFF) {
 			fs->free_clust--;
@@ -1029,6 +1680,41 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 
 
 
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Release unused clusters of a contiguous block          */
+/*-----------------------------------------------------------------------*/
+#if _USE_EXPAND
+
+static
+FRESULT trim_block (
+	FIL *fp			/* File object with a block allocated by f_expand */
+)
+{
+	FRESULT res;
+	DWORD lcl;
+
+
+	if (!fp->fsize) {				/* Nothing has been written, release the whole block */
+		res = remove_chain(fp->fs, fp->sclust);
+		fp->sclust = 0;
+	} else {						/* Release the clusters beyond the file size */
+		lcl = fp->sclust + (fp->fsize - 1) / ((DWORD)fp->fs->csize * SS(fp->fs));
+		res = FR_OK;
+		if (lcl < fp->ecl) {
+			res = put_fat(fp->fs, lcl, 0x0FFFFFFF);
+			if (res == FR_OK) res = remove_chain(fp->fs, lcl + 1);
+		}
+	}
+	fp->ecl = 0;
+	fp->flag |= FA__WRITTEN;
+
+	return res;
+}
+#endif /* _USE_EXPAND */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT handling - Convert offset into cluster with link map table        */
 /*-----------------------------------------------------------------------*/
@@ -1043,8 +1729,22 @@ DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	DWORD cl, ncl, *tbl;
 
 
-	tbl = fp->cltbl + 1;	/* Top of CLMT */
 	cl = ofs / SS(fp->fs) / fp->fs->csize;	/* Cluster order from top of the file */
+#if _FS_AUTOMAP
+	if (fp->cltbl == fp->amap) {	/* Automatic map: {n, {end, top} * n} */
+		UINT lo, hi, mid;
+
+		tbl = fp->amap;
+		lo = 0; hi = tbl[0] - 1;
+		if (cl >= tbl[hi * 2 + 1]) return 0;	/* Out of the map? (error) */
+		while (lo < hi) {		/* Find the fragment with binary search on the fragment ends */
+			mid = (lo + hi) / 2;
+			if (cl < tbl[mid * 2 + 1]) hi = mid; else lo = mid + 1;
+		}
+		return tbl[lo * 2 + 2] + cl - (lo ? tbl[lo * 2 - 1] : 0);
+	}
+#endif
+	tbl = fp->cltbl + 1;	/* Top of CLMT */
 	for (;;) {
 		ncl = *tbl++;			/* Number of cluters in the fragment */
 		if (!ncl) return 0;		/* End of table? (error) */
@@ -1057,6 +1757,76 @@ DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 
 
 
+
+#if _FS_AUTOMAP
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Build the automatic link map of a read-only file       */
+/*-----------------------------------------------------------------------*/
+/* The pool is a row of blocks, each led by a header item of (number of
+/  items << 1 | used). The map is built in the largest free block and the
+/  rest of the block is returned to the pool. */
+
+static
+FRESULT amap_build (	/* FR_OK:Built or pool short, FR_DISK_ERR/FR_INT_ERR:Broken chain */
+	FIL* fp				/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->fs;
+	DWORD *pool = fs->amap_pool, *blk = 0, *tbl, cl, pcl, ncl, need, ord;
+	UINT i, sz, bsz = 0, n;
+
+
+	for (i = 0; i < _FS_AUTOMAP; i += sz) {	/* Merge free blocks and find the largest one */
+		sz = pool[i] >> 1;
+		if (!(pool[i] & 1)) {
+			while (i + sz < _FS_AUTOMAP && !(pool[i + sz] & 1))
+				sz += pool[i + sz] >> 1;
+			pool[i] = (DWORD)sz << 1;
+			if (sz > bsz) { blk = &pool[i]; bsz = sz; }
+		}
+	}
+	if (bsz < 4) return FR_OK;		/* No room for a fragment */
+
+	tbl = blk + 1; n = 0; ord = 0;
+	need = (fp->fsize - 1) / SS(fs) / fs->csize + 1;	/* Number of clusters in the file */
+	cl = fp->sclust;
+	while (ord < need) {			/* Get fragments up to the end of file */
+		if (2 + 2 * (n + 1) > bsz) return FR_OK;	/* Pool short */
+		tbl[2 * n + 2] = cl; ncl = 0;
+		do {
+			pcl = cl; ncl++;
+			if (ord + ncl >= need) break;
+			cl = get_fat(fs, cl);
+			if (cl <= 1 || cl >= fs->n_fatent) return (cl == 0xFFFFFFFF) ? FR_DISK_ERR : FR_INT_ERR;
+		} while (cl == pcl + 1);
+		ord += ncl;
+		tbl[2 * n + 1] = ord;		/* End of the fragment (cluster order) */
+		n++;
+	}
+	tbl[0] = n;
+
+	sz = 2 + 2 * n;					/* Take the used part of the block */
+	if (bsz > sz) blk[sz] = (DWORD)(bsz - sz) << 1;
+	blk[0] = (DWORD)sz << 1 | 1;
+	fp->amap = fp->cltbl = tbl;
+	return FR_OK;
+}
+
+
+static
+void amap_free (
+	FIL* fp				/* Pointer to the file object */
+)
+{
+	if (fp->amap) {
+		fp->amap[-1] &= ~1;			/* Mark the block free */
+		fp->amap = fp->cltbl = 0;
+	}
+}
+#endif	/* _FS_AUTOMAP */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Set directory index                              */
 /*-----------------------------------------------------------------------*/
@@ -1233,114 +2003,441 @@ int pick_lfn (			/* 1:Succeeded, 0:Buffer overflow */
 		} else {
 			if (uc != 0xFFFF) return 0;		/* Check filler */
 		}
-	} while (++s < 13);						/* Read all character in the entry */
+	} while (++s < 13);						/* Read all character in the entry */
+
+	if (dir[LDIR_Ord] & LLE) {				/* Put terminator if it is the last LFN part */
+		if (i >= _MAX_LFN) return 0;		/* Buffer overflow? */
+		lfnbuf[i] = 0;
+	}
+
+	return 1;
+}
+
+
+#if !_FS_READONLY
+static
+void fit_lfn (
+	const WCHAR *lfnbuf,	/* Pointer to the LFN buffer */
+	BYTE *dir,				/* Pointer to the directory entry */
+	BYTE ord,				/* LFN order (1-20) */
+	BYTE sum				/* SFN sum */
+)
+{
+	UINT i, s;
+	WCHAR wc;
+
+
+	dir[LDIR_Chksum] = sum;			/* Set check sum */
+	dir[LDIR_Attr] = AM_LFN;		/* Set attribute. LFN entry */
+	dir[LDIR_Type] = 0;
+	ST_WORD(dir+LDIR_FstClusLO, 0);
+
+	i = (ord - 1) * 13;				/* Get offset in the LFN buffer */
+	s = wc = 0;
+	do {
+		if (wc != 0xFFFF) wc = lfnbuf[i++];	/* Get an effective char */
+		ST_WORD(dir+LfnOfs[s], wc);	/* Put it */
+		if (!wc) wc = 0xFFFF;		/* Padding chars following last char */
+	} while (++s < 13);
+	if (wc == 0xFFFF || !lfnbuf[i]) ord |= LLE;	/* Bottom LFN part is the start of LFN sequence */
+	dir[LDIR_Ord] = ord;			/* Set the LFN order */
+}
+
+#endif
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Create numbered name                                                  */
+/*-----------------------------------------------------------------------*/
+#if _USE_LFN
+void gen_numname (
+	BYTE *dst,			/* Pointer to generated SFN */
+	const BYTE *src,	/* Pointer to source SFN to be modified */
+	const WCHAR *lfn,	/* Pointer to LFN */
+	WORD seq			/* Sequence number */
+)
+{
+	BYTE ns[8], c;
+	UINT i, j;
+
+
+	mem_cpy(dst, src, 11);
+
+	if (seq > 5) {	/* On many collisions, generate a hash number instead of sequential number */
+		do seq = (seq >> 1) + (seq << 15) + (WORD)*lfn++; while (*lfn);
+	}
+
+	/* itoa (hexdecimal) */
+	i = 7;
+	do {
+		c = (seq % 16) + '0';
+		if (c > '9') c += 7;
+		ns[i--] = c;
+		seq /= 16;
+	} while (seq);
+	ns[i] = '~';
+
+	/* Append the number */
+	for (j = 0; j < i && dst[j] != ' '; j++) {
+		if (IsDBCS1(dst[j])) {
+			if (j == i - 1) break;
+			j++;
+		}
+	}
+	do {
+		dst[j++] = (i < 8) ? ns[i++] : ' ';
+	} while (j < 8);
+}
+#endif
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Calculate sum of an SFN                                               */
+/*-----------------------------------------------------------------------*/
+#if _USE_LFN
+static
+BYTE sum_sfn (
+	const BYTE *dir		/* Ptr to directory entry */
+)
+{
+	BYTE sum = 0;
+	UINT n = 11;
+
+	do sum = (sum >> 1) + (sum << 7) + *dir++; while (--n);
+	return sum;
+}
+#endif
+
+
+
+
+#if _FS_DIRIDX
+/*-----------------------------------------------------------------------*/
+/* Directory handling - Hash index of the SFN and LFN entries            */
+/*-----------------------------------------------------------------------*/
+/* An object with LFN has two slots, one hashed by the SFN and one by the
+/  LFN, both pointing the SFN entry. The LFN hash is a sum over the chars,
+/  so that it can be built from the LFN entries in any order.
+*/
+
+static
+DWORD didx_hash (	/* Hash value of the SFN */
+	const BYTE *fn	/* Pointer to the SFN (11 bytes) */
+)
+{
+	DWORD h = 2166136261UL;
+	UINT n = 11;
+
+
+	do h = (h ^ *fn++) * 16777619UL; while (--n);
+	return h;
+}
+
+
+#if _USE_LFN
+static
+DWORD didx_lfnchr (	/* Hash value of an LFN char */
+	UINT i,			/* Position in the LFN */
+	WCHAR wc		/* LFN char */
+)
+{
+	DWORD x;
+
+
+	if (wc < 0x80) {				/* Case is folded same as ff_wtoupper() */
+		if (wc >= 'a' && wc <= 'z') wc -= 0x20;
+	} else {
+		wc = ff_wtoupper(wc);
+	}
+	x = (((DWORD)i << 16 | wc) * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+	x = ((x ^ (x >> 13)) * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+	return x ^ (x >> 16);
+}
+
+
+static
+DWORD didx_lfnhash (	/* Hash value of the LFN */
+	const WCHAR *lfn	/* Pointer to the LFN */
+)
+{
+	DWORD h = 0;
+	UINT i;
+
+
+	for (i = 0; lfn[i]; i++) h += didx_lfnchr(i, lfn[i]);
+	return h;
+}
+
+
+static
+DWORD didx_lfnpart (	/* Part of the LFN hash held in an LFN entry */
+	const BYTE *dir		/* Pointer to the LFN entry */
+)
+{
+	DWORD h = 0;
+	UINT i, s;
+	WCHAR wc;
+
+
+	i = ((dir[LDIR_Ord] & ~LLE) - 1) * 13;	/* Offset in the LFN */
+	for (s = 0; s < 13; s++) {
+		wc = LD_WORD(dir+LfnOfs[s]);
+		if (!wc) break;						/* End of the LFN */
+		h += didx_lfnchr(i + s, wc);
+	}
+	return h;
+}
+#endif
+
+
+static
+DIRIDX* didx_get (	/* Pointer to the index of the directory (null:Not indexed) */
+	FATFS *fs,		/* File system object */
+	DWORD sclust	/* Start cluster of the directory */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < _FS_DIRIDX_DIRS; i++) {
+		if (fs->didx[i].stat && fs->didx[i].sclust == sclust) return &fs->didx[i];
+	}
+	return 0;
+}
+
+
+static
+int didx_put (		/* 0:Registered, 1:Out of slots */
+	DIRIDX *ix,		/* Directory index */
+	DWORD h,		/* Hash value of the name */
+	WORD idx		/* Directory index of the SFN entry */
+)
+{
+	UINT i;
+
+
+	for (i = h & (_DIRIDX_SLOTS - 1); ix->slot[i] > 1; i = (i + 1) & (_DIRIDX_SLOTS - 1)) ;	/* Find a blank or deleted slot */
+	if (!ix->slot[i]) {
+		if (ix->nent >= DIDX_LIMIT) return 1;
+		ix->nent++;
+	}
+	ix->slot[i] = ((h | 0x80000000) & 0xFFFF0000) | (WORD)(idx + 1);
+	return 0;
+}
+
+
+static
+FRESULT didx_find (	/* FR_OK:Found, FR_NO_FILE:Not found in the index (*top:Index to scan from, 0:Not exist) */
+	DIR *dj,		/* Directory object with the name to be found */
+	WORD *top		/* Pointer to the variable to return the index to start linear search */
+)
+{
+	FRESULT res;
+	FATFS *fs = dj->fs;
+	DIRIDX *ix;
+	DWORD h, v;
+	UINT i;
+	BYTE c, *dir;
+#if _USE_LFN
+	BYTE a, ord = 0xFF, sum = 0xFF;
+	WORD is = 0, ne;
+	DWORD lh = 0;
+#endif
+
+
+	ix = didx_get(fs, dj->sclust);
+	if (!ix) {						/* Build the index of the directory in the LRU index */
+		ix = &fs->didx[0];
+		for (i = 1; i < _FS_DIRIDX_DIRS; i++) {
+			if (!ix->stat) break;
+			if (!fs->didx[i].stat || (DWORD)(fs->didx_stamp - fs->didx[i].age) > (DWORD)(fs->didx_stamp - ix->age))
+				ix = &fs->didx[i];
+		}
+		ix->stat = 0; ix->nent = 0; ix->free = 0xFFFF;
+		mem_set(ix->slot, 0, sizeof(ix->slot));
+		res = dir_sdi(dj, 0);
+		while (res == FR_OK) {
+			res = move_window(fs, dj->sect);
+			if (res != FR_OK) return res;
+			dir = dj->dir;
+			c = dir[DIR_Name];
+			if (c == 0) break;			/* End of table */
+			if (c == DDE) {				/* Blank entry */
+				if (ix->free == 0xFFFF) ix->free = dj->index;
+#if _USE_LFN
+			} else if ((dir[DIR_Attr] & AM_MASK) == AM_LFN) {	/* LFN entry */
+				if (c & LLE) {			/* Start of an LFN sequence */
+					sum = dir[LDIR_Chksum];
+					c &= ~LLE; ord = c;
+					is = dj->index; lh = 0;
+				}
+				if (c == ord && sum == dir[LDIR_Chksum]) {	/* Accumulate the LFN hash while the sequence is valid */
+					lh += didx_lfnpart(dir);
+					ord--;
+				} else {
+					ord = 0xFF;
+				}
+			} else if (!(dir[DIR_Attr] & AM_VOL)) {	/* Valid entry */
+				if (ord || sum != sum_sfn(dir)) is = dj->index;	/* The SFN has no LFN */
+				if (didx_put(ix, didx_hash(dir), dj->index) ||
+					(is != dj->index && didx_put(ix, lh, dj->index))) {	/* Out of slots (the rest is not indexed) */
+					ix->stat = 1; ix->ncov = is;
+					break;
+				}
+			}
+			if (c == DDE || (dir[DIR_Attr] & AM_MASK) != AM_LFN) ord = 0xFF;	/* End of LFN sequence */
+#else
+			} else if (!(dir[DIR_Attr] & AM_VOL)) {	/* Valid entry */
+				if (didx_put(ix, didx_hash(dir), dj->index)) {	/* Out of slots (the rest is not indexed) */
+					ix->stat = 1; ix->ncov = dj->index;
+					break;
+				}
+			}
+#endif
+			res = dir_next(dj, 0);
+		}
+		if (res == FR_NO_FILE) res = FR_OK;		/* End of chain */
+		if (res != FR_OK) return res;
+		if (ix->free == 0xFFFF) ix->free = dj->index;
+		if (!ix->stat) ix->stat = 2;
+		ix->sclust = dj->sclust;
+	}
+	ix->age = ++fs->didx_stamp;
 
-	if (dir[LDIR_Ord] & LLE) {				/* Put terminator if it is the last LFN part */
-		if (i >= _MAX_LFN) return 0;		/* Buffer overflow? */
-		lfnbuf[i] = 0;
+#if _USE_LFN
+	if (dj->lfn) {			/* Find the LFN, verify the LFN entries above the SFN entry pointed by the slot */
+		h = didx_lfnhash(dj->lfn);
+		for (ne = 0; dj->lfn[ne]; ne++) ;
+		ne = (ne + 12) / 13;	/* Number of LFN entries */
+		for (i = h & (_DIRIDX_SLOTS - 1); (v = ix->slot[i]) != 0; i = (i + 1) & (_DIRIDX_SLOTS - 1)) {
+			if ((v ^ (h | 0x80000000)) & 0xFFFF0000) continue;	/* Tag mismatched or deleted slot */
+			if ((WORD)(v - 1) < ne) continue;
+			res = dir_sdi(dj, (WORD)(v - 1 - ne));
+			ord = 0xFF;
+			while (res == FR_OK) {
+				res = move_window(fs, dj->sect);
+				if (res != FR_OK) return res;
+				dir = dj->dir;
+				c = dir[DIR_Name];
+				a = dir[DIR_Attr] & AM_MASK;
+				if (c == DDE) break;
+				if (a != AM_LFN) {		/* SFN entry next to the LFN entries */
+					if (!ord && !(a & AM_VOL) && sum == sum_sfn(dir)) return FR_OK;	/* LFN matched */
+					break;
+				}
+				if (c & LLE) {
+					sum = dir[LDIR_Chksum];
+					c &= ~LLE; ord = c;
+					dj->lfn_idx = dj->index;
+				}
+				if (c != ord || sum != dir[LDIR_Chksum] || !cmp_lfn(dj->lfn, dir)) break;
+				ord--;
+				res = dir_next(dj, 0);
+			}
+			if (res != FR_OK && res != FR_NO_FILE) return res;
+		}
+	}
+	dj->lfn_idx = 0xFFFF;
+	if (!(dj->fn[NS] & NS_LOSS)) {	/* Find the SFN */
+#else
+	{
+#endif
+		h = didx_hash(dj->fn);
+		for (i = h & (_DIRIDX_SLOTS - 1); (v = ix->slot[i]) != 0; i = (i + 1) & (_DIRIDX_SLOTS - 1)) {
+			if ((v ^ (h | 0x80000000)) & 0xFFFF0000) continue;	/* Tag mismatched or deleted slot */
+			res = dir_sdi(dj, (WORD)(v - 1));
+			if (res == FR_OK) res = move_window(fs, dj->sect);
+			if (res != FR_OK) return res;
+			dir = dj->dir;
+			if (!(dir[DIR_Attr] & AM_VOL) && !mem_cmp(dir, dj->fn, 11))	/* Name matched? */
+				return FR_OK;
+		}
 	}
+	*top = (ix->stat == 2) ? 0 : ix->ncov;
 
-	return 1;
+	return FR_NO_FILE;
 }
 
 
 #if !_FS_READONLY
 static
-void fit_lfn (
-	const WCHAR *lfnbuf,	/* Pointer to the LFN buffer */
-	BYTE *dir,				/* Pointer to the directory entry */
-	BYTE ord,				/* LFN order (1-20) */
-	BYTE sum				/* SFN sum */
+void didx_add (
+	DIR *dj			/* Directory object pointing the entry registered */
 )
 {
-	UINT i, s;
-	WCHAR wc;
+	DIRIDX *ix = didx_get(dj->fs, dj->sclust);
 
 
-	dir[LDIR_Chksum] = sum;			/* Set check sum */
-	dir[LDIR_Attr] = AM_LFN;		/* Set attribute. LFN entry */
-	dir[LDIR_Type] = 0;
-	ST_WORD(dir+LDIR_FstClusLO, 0);
-
-	i = (ord - 1) * 13;				/* Get offset in the LFN buffer */
-	s = wc = 0;
-	do {
-		if (wc != 0xFFFF) wc = lfnbuf[i++];	/* Get an effective char */
-		ST_WORD(dir+LfnOfs[s], wc);	/* Put it */
-		if (!wc) wc = 0xFFFF;		/* Padding chars following last char */
-	} while (++s < 13);
-	if (wc == 0xFFFF || !lfnbuf[i]) ord |= LLE;	/* Bottom LFN part is the start of LFN sequence */
-	dir[LDIR_Ord] = ord;			/* Set the LFN order */
-}
-
+	if (ix && (ix->stat == 2 || dj->index < ix->ncov)) {
+		if (didx_put(ix, didx_hash(dj->fn), dj->index))
+			ix->stat = 0;				/* Out of slots (rebuilt on next search) */
+#if _USE_LFN
+		if ((dj->fn[NS] & NS_LFN) && didx_put(ix, didx_lfnhash(dj->lfn), dj->index))
+			ix->stat = 0;
 #endif
+	}
+#if !_USE_LFN
+	if (ix && dj->index >= ix->free) ix->free = dj->index;
 #endif
+}
 
 
-
-/*-----------------------------------------------------------------------*/
-/* Create numbered name                                                  */
-/*-----------------------------------------------------------------------*/
-#if _USE_LFN
-void gen_numname (
-	BYTE *dst,			/* Pointer to generated SFN */
-	const BYTE *src,	/* Pointer to source SFN to be modified */
-	const WCHAR *lfn,	/* Pointer to LFN */
-	WORD seq			/* Sequence number */
+#if !_FS_MINIMIZE
+static
+void didx_del (
+	DIRIDX *ix,		/* Directory index */
+	DWORD h,		/* Hash value of the name */
+	WORD idx		/* Directory index of the SFN entry */
 )
 {
-	BYTE ns[8], c;
-	UINT i, j;
-
-
-	mem_cpy(dst, src, 11);
-
-	if (seq > 5) {	/* On many collisions, generate a hash number instead of sequential number */
-		do seq = (seq >> 1) + (seq << 15) + (WORD)*lfn++; while (*lfn);
-	}
+	DWORD v;
+	UINT i;
 
-	/* itoa (hexdecimal) */
-	i = 7;
-	do {
-		c = (seq % 16) + '0';
-		if (c > '9') c += 7;
-		ns[i--] = c;
-		seq /= 16;
-	} while (seq);
-	ns[i] = '~';
 
-	/* Append the number */
-	for (j = 0; j < i && dst[j] != ' '; j++) {
-		if (IsDBCS1(dst[j])) {
-			if (j == i - 1) break;
-			j++;
+	for (i = h & (_DIRIDX_SLOTS - 1); (v = ix->slot[i]) != 0; i = (i + 1) & (_DIRIDX_SLOTS - 1)) {
+		if ((WORD)(v - 1) == idx && v > 1) {	/* Mark the slot deleted */
+			ix->slot[i] = 1;
+			break;
 		}
 	}
-	do {
-		dst[j++] = (i < 8) ? ns[i++] : ' ';
-	} while (j < 8);
 }
-#endif
-
 
 
-
-/*-----------------------------------------------------------------------*/
-/* Calculate sum of an SFN                                               */
-/*-----------------------------------------------------------------------*/
-#if _USE_LFN
 static
-BYTE sum_sfn (
-	const BYTE *dir		/* Ptr to directory entry */
+void didx_remove (
+	DIR *dj,		/* Directory object pointing the SFN entry to be removed */
+	DWORD lh		/* LFN hash of the entry (used when dj->lfn_idx is valid on LFN cfg) */
 )
 {
-	BYTE sum = 0;
-	UINT n = 11;
+	DIRIDX *ix;
+	WORD is = dj->index;
 
-	do sum = (sum >> 1) + (sum << 7) + *dir++; while (--n);
-	return sum;
+
+	ix = didx_get(dj->fs, dj->sclust);
+	if (ix) {
+		didx_del(ix, didx_hash(dj->dir), dj->index);
+#if _USE_LFN
+		if (dj->lfn_idx != 0xFFFF) {	/* Remove the LFN slot too */
+			didx_del(ix, lh, dj->index);
+			is = dj->lfn_idx;
+		}
+#else
+		(void)lh;
+#endif
+		if (is < ix->free) ix->free = is;
+	}
+	if (dj->dir[DIR_Attr] & AM_DIR) {	/* Discard the index of the sub-directory to be removed */
+		ix = didx_get(dj->fs, LD_CLUST(dj->dir));
+		if (ix) ix->stat = 0;
+	}
 }
 #endif
+#endif
+#endif /* _FS_DIRIDX */
 
 
 
@@ -1359,8 +2456,17 @@ FRESULT dir_find (
 #if _USE_LFN
 	BYTE a, ord, sum;
 #endif
+#if _FS_DIRIDX
+	WORD top = 0;
+
+
+	res = didx_find(dj, &top);		/* Look up the directory index */
+	if (res != FR_NO_FILE || !top) return res;
+	res = dir_sdi(dj, top);			/* Search the rest not indexed */
+#else
 
 	res = dir_sdi(dj, 0);			/* Rewind directory object */
+#endif
 	if (res != FR_OK) return res;
 
 #if _USE_LFN
@@ -1478,6 +2584,10 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 	WORD n, ne, is;
 	BYTE sn[12], *fn, sum;
 	WCHAR *lfn;
+#if _FS_DIRIDX
+	DIRIDX *ix;
+	WORD fb = 0xFFFF;
+#endif
 
 
 	fn = dj->fn; lfn = dj->lfn;
@@ -1506,7 +2616,12 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 	}
 
 	/* Reserve contiguous entries */
+#if _FS_DIRIDX
+	ix = didx_get(dj->fs, dj->sclust);
+	res = dir_sdi(dj, ix ? ix->free : 0);	/* Skip the entries known to be in use */
+#else
 	res = dir_sdi(dj, 0);
+#endif
 	if (res != FR_OK) return res;
 	n = is = 0;
 	do {
@@ -1515,12 +2630,18 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 		c = *dj->dir;				/* Check the entry status */
 		if (c == DDE || c == 0) {	/* Is it a blank entry? */
 			if (n == 0) is = dj->index;	/* First index of the contiguous entry */
+#if _FS_DIRIDX
+			if (fb == 0xFFFF) fb = dj->index;	/* First blank entry */
+#endif
 			if (++n == ne) break;	/* A contiguous entry that required count is found */
 		} else {
 			n = 0;					/* Not a blank entry. Restart to search */
 		}
 		res = dir_next(dj, 1);		/* Next entry with table stretch */
 	} while (res == FR_OK);
+#if _FS_DIRIDX
+	if (res == FR_OK && ix) ix->free = (fb == is) ? is + ne - 1 : fb;	/* Entries below it will be in use */
+#endif
 
 	if (res == FR_OK && ne > 1) {	/* Initialize LFN entry if needed */
 		res = dir_sdi(dj, is);
@@ -1538,7 +2659,14 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 	}
 
 #else	/* Non LFN configuration */
+#if _FS_DIRIDX
+	{
+		DIRIDX *ix = didx_get(dj->fs, dj->sclust);
+		res = dir_sdi(dj, ix ? ix->free : 0);	/* Skip the entries known to be in use */
+	}
+#else
 	res = dir_sdi(dj, 0);
+#endif
 	if (res == FR_OK) {
 		do {	/* Find a blank entry for the SFN */
 			res = move_window(dj->fs, dj->sect);
@@ -1560,6 +2688,9 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 			dir[DIR_NTres] = *(dj->fn+NS) & (NS_BODY | NS_EXT);	/* Put NT flag */
 #endif
 			dj->fs->wflag = 1;
+#if _FS_DIRIDX
+			didx_add(dj);			/* Register the SFN to the directory index */
+#endif
 		}
 	}
 
@@ -1583,12 +2714,22 @@ FRESULT dir_remove (	/* FR_OK: Successful, FR_DISK_ERR: A disk error */
 #if _USE_LFN	/* LFN configuration */
 	WORD i;
 
+#if _FS_DIRIDX
+	DWORD lh = 0;
+#endif
+
 	i = dj->index;	/* SFN index */
 	res = dir_sdi(dj, (WORD)((dj->lfn_idx == 0xFFFF) ? i : dj->lfn_idx));	/* Goto the SFN or top of the LFN entries */
 	if (res == FR_OK) {
 		do {
 			res = move_window(dj->fs, dj->sect);
 			if (res != FR_OK) break;
+#if _FS_DIRIDX
+			if (dj->index < i)
+				lh += didx_lfnpart(dj->dir);	/* LFN hash of the object */
+			else
+				didx_remove(dj, lh);		/* Remove the object from the directory index */
+#endif
 			*dj->dir = DDE;			/* Mark the entry "deleted" */
 			dj->fs->wflag = 1;
 			if (dj->index >= i) break;	/* When reached SFN, all entries of the object has been deleted. */
@@ -1602,6 +2743,9 @@ FRESULT dir_remove (	/* FR_OK: Successful, FR_DISK_ERR: A disk error */
 	if (res == FR_OK) {
 		res = move_window(dj->fs, dj->sect);
 		if (res == FR_OK) {
+#if _FS_DIRIDX
+			didx_remove(dj, 0);		/* Remove the SFN from the directory index */
+#endif
 			*dj->dir = DDE;			/* Mark the entry "deleted" */
 			dj->fs->wflag = 1;
 		}
@@ -2001,6 +3145,121 @@ BYTE check_fs (	/* 0:FAT-VBR, 1:Valid BR but not FAT, 2:Not a BR, 3:Disk error *
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Journal - Find the journal file and replay the transactions           */
+/*-----------------------------------------------------------------------*/
+#if _FS_JOURNAL
+static
+FRESULT jnl_mount (	/* FR_OK:Successful (journaling is off if no valid journal), FR_DISK_ERR:Failed */
+	FATFS *fs,		/* File system object */
+	BYTE init		/* 1:Initialize the journal prior to use */
+)
+{
+	DIR dj;
+	FRESULT res;
+	BYTE *dir, *d = fs->jbuf, nf;
+	DWORD scl, cl, ncl, nsect, jsect, pos, seq, sect, sum;
+	UINT i, cnt, n;
+
+
+	fs->jsect = 0;
+	scl = nsect = 0;
+	dj.fs = fs; dj.sclust = 0;
+	res = dir_sdi(&dj, 0);				/* Find the journal file in the root directory */
+	while (res == FR_OK) {
+		res = move_window(fs, dj.sect);
+		if (res != FR_OK) return res;
+		dir = dj.dir;
+		if (!dir[DIR_Name]) break;
+		if (!(dir[DIR_Attr] & (AM_DIR | AM_VOL)) && !mem_cmp(dir, JNL_NAME, 11)) {
+			scl = LD_CLUST(dir);
+			nsect = LD_DWORD(dir+DIR_FileSize) / SS(fs);
+			break;
+		}
+		res = dir_next(&dj, 0);
+	}
+	if (res != FR_OK && res != FR_NO_FILE) return res;
+	if (scl < 2 || nsect < 2 + CACHE_LINES) return FR_OK;	/* No journal */
+	for (cl = scl, n = (nsect - 1) / fs->csize; n; cl++, n--) {	/* It must be a contiguous block */
+		ncl = get_fat(fs, cl);
+		if (ncl == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (ncl != cl + 1) return FR_OK;
+	}
+	jsect = clust2sect(fs, scl);
+
+	if (init) {		/* Start with an empty journal (no stale descriptor must be left) */
+		mem_set(d, 0, SS(fs));
+		for (pos = 1; pos < nsect; pos++) {
+			if (disk_write(fs->drv, d, jsect + pos, 1) != RES_OK)
+				return FR_DISK_ERR;
+		}
+		ST_DWORD(d+JS_Sig, JS_SIG);
+		ST_DWORD(d+JS_Seq, get_fattime());
+		if (disk_write(fs->drv, d, jsect, 1) != RES_OK || disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+			return FR_DISK_ERR;
+	}
+	if (disk_read(fs->drv, d, jsect, 1) != RES_OK)
+		return FR_DISK_ERR;
+	if (LD_DWORD(d+JS_Sig) != JS_SIG) return FR_OK;	/* Not initialized */
+	seq = LD_DWORD(d+JS_Seq);
+
+	/* Replay the complete transactions in order of the sequence number */
+	fs->winsect = 0;				/* The window is used as a sector buffer */
+	for (pos = 1, n = 0; pos + 1 + CACHE_LINES <= nsect; pos += 1 + cnt, seq++, n++) {
+		if (disk_read(fs->drv, d, jsect + pos, 1) != RES_OK)
+			return FR_DISK_ERR;
+		cnt = (UINT)LD_DWORD(d+JD_Cnt);
+		if (LD_DWORD(d+JD_Sig) != JD_SIG || LD_DWORD(d+JD_Seq) != seq || !cnt || cnt > CACHE_LINES)
+			break;
+		sum = LD_DWORD(d+JD_Sum);
+		ST_DWORD(d+JD_Sum, 0);
+		if (jnl_sum(d, SS(fs)) != sum) break;
+		for (i = 0; i < cnt; i++) {	/* Check if all the logged sectors have reached the journal */
+			sect = LD_DWORD(d + JD_Ent + i * 8);
+			if (sect < fs->fatbase || sect >= fs->database + (fs->n_fatent - 2) * fs->csize) break;
+			if (disk_read(fs->drv, fs->win, jsect + pos + 1 + i, 1) != RES_OK)
+				return FR_DISK_ERR;
+			if (jnl_sum(fs->win, SS(fs)) != LD_DWORD(d + JD_Ent + i * 8 + 4)) break;
+		}
+		if (i < cnt) break;			/* Torn transaction */
+		for (i = 0; i < cnt; i++) {	/* Write the logged sectors to their home location */
+			sect = LD_DWORD(d + JD_Ent + i * 8);
+			if (disk_read(fs->drv, fs->win, jsect + pos + 1 + i, 1) != RES_OK || disk_write(fs->drv, fs->win, sect, 1) != RES_OK)
+				return FR_DISK_ERR;
+			if (sect < fs->fatbase + fs->fsize) {	/* Reflect the FAT change to all FAT copies */
+				for (nf = fs->n_fats; nf > 1; nf--) {
+					sect += fs->fsize;
+					disk_write(fs->drv, fs->win, sect, 1);
+				}
+			}
+		}
+	}
+	if (n) {	/* Discard the replayed transactions */
+		mem_set(fs->csect, 0, sizeof(fs->csect));
+		mem_set(fs->cflag, 0, sizeof(fs->cflag));
+		fs->free_clust = 0xFFFFFFFF;	/* FSInfo may be out of date */
+		if (disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+			return FR_DISK_ERR;
+		mem_set(d, 0, SS(fs));
+		ST_DWORD(d+JS_Sig, JS_SIG);
+		ST_DWORD(d+JS_Seq, seq);
+		if (disk_write(fs->drv, d, jsect, 1) != RES_OK || disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK)
+			return FR_DISK_ERR;
+	}
+	fs->jsect = jsect;
+	fs->jsize = nsect;
+	fs->jpos = 1;
+	fs->jseq = seq;
+	fs->jsync = 0;
+	fs->jrel[1] = 0;
+
+	return FR_OK;
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Check if the file system object is valid or not                       */
 /*-----------------------------------------------------------------------*/
@@ -2152,12 +3411,32 @@ FRESULT chk_mounted (	/* FR_OK(0): successful, !=0: any error occurred */
 	fs->id = ++Fsid;		/* File system mount ID */
 	fs->winsect = 0;		/* Invalidate sector cache */
 	fs->wflag = 0;
+#if _USE_FREEMAP
+	fs->fmap_stat = 0;		/* Free cluster bitmap is rebuilt on demand */
+#endif
+#if _FS_CACHE_WAYS
+	mem_set(fs->csect, 0, sizeof(fs->csect));
+	mem_set(fs->cflag, 0, sizeof(fs->cflag));
+	fs->cache_hit = fs->cache_miss = 0;
+#endif
+#if _FS_DIRIDX
+	for (vol = 0; vol < _FS_DIRIDX_DIRS; vol++) fs->didx[vol].stat = 0;	/* Directory indexes are rebuilt on demand */
+#endif
+#if _FS_AUTOMAP
+	fs->amap_pool[0] = (DWORD)_FS_AUTOMAP << 1;	/* The link map pool is a free block */
+#endif
 #if _FS_RPATH
 	fs->cdir = 0;			/* Current directory (root dir) */
 #endif
 #if _FS_SHARE				/* Clear file lock semaphores */
 	clear_lock(fs);
 #endif
+#if _FS_JOURNAL
+	if (jnl_mount(fs, 0) != FR_OK) {	/* Replay the journal if exist */
+		fs->fs_type = 0;
+		return FR_DISK_ERR;
+	}
+#endif
 
 	return FR_OK;
 }
@@ -2219,14 +3498,23 @@ FRESULT f_mount (
 #endif
 #if _FS_REENTRANT				/* Discard sync object of the current volume */
 		if (!ff_del_syncobj(rfs->sobj)) return FR_INT_ERR;
+#endif
+#if _FS_REENTRANT == 2
+		if (!ff_del_syncobj(rfs->dobj)) return FR_INT_ERR;
 #endif
 		rfs->fs_type = 0;		/* Clear old fs object */
 	}
 
 	if (fs) {
 		fs->fs_type = 0;		/* Clear new fs object */
+#if _USE_FREEMAP
+		fs->fmap = 0;			/* No free cluster bitmap is attached */
+#endif
 #if _FS_REENTRANT				/* Create sync object for the new volume */
 		if (!ff_cre_syncobj(vol, &fs->sobj)) return FR_INT_ERR;
+#endif
+#if _FS_REENTRANT == 2
+		if (!ff_cre_syncobj(vol, &fs->dobj)) return FR_INT_ERR;
 #endif
 	}
 	FatFs[vol] = fs;			/* Register new fs object */
@@ -2262,9 +3550,9 @@ FRESULT f_open (
 	mode &= FA_READ;
 	res = chk_mounted(&path, &dj.fs, 0);
 #endif
+	if (res != FR_OK) LEAVE_FF(dj.fs, res);
 	INIT_BUF(dj);
-	if (res == FR_OK)
-		res = follow_path(&dj, path);	/* Follow the file path */
+	res = follow_path(&dj, path);	/* Follow the file path */
 	dir = dj.dir;
 
 #if !_FS_READONLY	/* R/W configuration */
@@ -2276,6 +3564,10 @@ FRESULT f_open (
 			res = chk_lock(&dj, (mode & ~FA_READ) ? 1 : 0);
 #endif
 	}
+#if _FS_JOURNAL
+	if (res == FR_OK && dj.fs->jsect && (mode & (FA_WRITE | FA_CREATE_ALWAYS)) && clust2sect(dj.fs, LD_CLUST(dir)) == dj.fs->jsect)
+		res = FR_DENIED;			/* Cannot write the journal in use */
+#endif
 	/* Create or Open a file */
 	if (mode & (FA_CREATE_ALWAYS | FA_OPEN_ALWAYS | FA_CREATE_NEW)) {
 		DWORD dw, cl;
@@ -2310,6 +3602,9 @@ FRESULT f_open (
 				dw = dj.fs->winsect;
 				res = remove_chain(dj.fs, cl);
 				if (res == FR_OK) {
+#if _FS_JOURNAL
+					if (!dj.fs->jsect)		/* The hole is held until the release is committed on the journaled volume */
+#endif
 					dj.fs->last_clust = cl - 1;	/* Reuse the cluster hole */
 					res = move_window(dj.fs, dw);
 				}
@@ -2357,8 +3652,23 @@ FRESULT f_open (
 		fp->dsect = 0;
 #if _USE_FASTSEEK
 		fp->cltbl = 0;						/* Normal seek mode */
+#endif
+#if _USE_EXPAND
+		fp->ecl = 0;						/* No contiguous block */
 #endif
 		fp->fs = dj.fs; fp->id = dj.fs->id;	/* Validate file object */
+#if _FS_AUTOMAP
+		fp->amap = 0;
+		if (!(mode & FA_WRITE) && fp->fsize > (DWORD)dj.fs->csize * SS(dj.fs)) {	/* Map the read-only file over a cluster */
+			res = amap_build(fp);
+			if (res != FR_OK) {			/* Broken chain: release the share lock and invalidate the file object */
+#if _FS_SHARE
+				dec_lock(fp->lockid);
+#endif
+				fp->fs = 0;
+			}
+		}
+#endif
 	}
 
 	LEAVE_FF(dj.fs, res);
@@ -2367,6 +3677,48 @@ FRESULT f_open (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Transfer File Data                                                    */
+/*-----------------------------------------------------------------------*/
+/* The volume is released during the transfer on the fine-grained
+/  reentrant cfg. The sectors belong to the file and the buffer to the
+/  caller or the file object, so that nothing on the volume is touched.
+/  The file object is validated again when the volume is regained, because
+/  the volume can have been unmounted or remounted meanwhile. */
+
+static
+FRESULT data_io (	/* FR_OK:Successful, FR_DISK_ERR:Disk error, Else:Could not regain the volume (see validate) */
+	FIL *fp,		/* File object */
+	BYTE *buff,		/* Data buffer */
+	DWORD sect,		/* Start sector */
+	BYTE cnt,		/* Number of sectors */
+	BYTE wr			/* 0:Read, 1:Write */
+)
+{
+	DRESULT dr;
+#if _FS_REENTRANT == 2
+	FRESULT res;
+
+
+	unlock_fs(fp->fs, FR_OK);
+#endif
+#if !_FS_READONLY
+	if (wr)
+		dr = disk_write(fp->fs->drv, buff, sect, cnt);
+	else
+#endif
+		dr = disk_read(fp->fs->drv, buff, sect, cnt);
+#if _FS_REENTRANT == 2
+	res = validate(fp->fs, fp->id);		/* Regain the volume and check if the file is still valid */
+	if (res != FR_OK) return res;
+#endif
+
+	return (dr == RES_OK) ? FR_OK : FR_DISK_ERR;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Read File                                                             */
 /*-----------------------------------------------------------------------*/
@@ -2421,10 +3773,13 @@ FRESULT f_read (
 			if (cc) {							/* Read maximum contiguous sectors directly */
 				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
-				if (disk_read(fp->fs->drv, rbuff, sect, (BYTE)cc) != RES_OK)
-					ABORT(fp->fs, FR_DISK_ERR);
+				res = data_io(fp, rbuff, sect, (BYTE)cc, 0);
+				if (res != FR_OK) ABORT(fp->fs, res);
 #if !_FS_READONLY && _FS_MINIMIZE <= 2			/* Replace one of the read sectors with cached data if it contains a dirty sector */
 #if _FS_TINY
+#if _FS_CACHE_WAYS
+				cache_patch(fp->fs, rbuff, sect, cc);
+#endif
 				if (fp->fs->wflag && fp->fs->winsect - sect < cc)
 					mem_cpy(rbuff + ((fp->fs->winsect - sect) * SS(fp->fs)), fp->fs->win, SS(fp->fs));
 #else
@@ -2439,13 +3794,13 @@ FRESULT f_read (
 			if (fp->dsect != sect) {			/* Load data sector if not in cache */
 #if !_FS_READONLY
 				if (fp->flag & FA__DIRTY) {		/* Write-back dirty sector cache */
-					if (disk_write(fp->fs->drv, fp->buf, fp->dsect, 1) != RES_OK)
-						ABORT(fp->fs, FR_DISK_ERR);
+					res = data_io(fp, fp->buf, fp->dsect, 1, 1);
+					if (res != FR_OK) ABORT(fp->fs, res);
 					fp->flag &= ~FA__DIRTY;
 				}
 #endif
-				if (disk_read(fp->fs->drv, fp->buf, sect, 1) != RES_OK)	/* Fill sector cache */
-					ABORT(fp->fs, FR_DISK_ERR);
+				res = data_io(fp, fp->buf, sect, 1, 0);	/* Fill sector cache */
+				if (res != FR_OK) ABORT(fp->fs, res);
 			}
 #endif
 			fp->dsect = sect;
@@ -2510,6 +3865,11 @@ FRESULT f_write (
 					if (fp->cltbl)
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
 					else
+#endif
+#if _USE_EXPAND
+					if (fp->clust < fp->ecl)
+						clst = fp->clust + 1;	/* Next cluster in the contiguous block */
+					else
 #endif
 						clst = create_chain(fp->fs, fp->clust);	/* Follow or stretch cluster chain on the FAT */
 				}
@@ -2523,8 +3883,8 @@ FRESULT f_write (
 				ABORT(fp->fs, FR_DISK_ERR);
 #else
 			if (fp->flag & FA__DIRTY) {		/* Write-back sector cache */
-				if (disk_write(fp->fs->drv, fp->buf, fp->dsect, 1) != RES_OK)
-					ABORT(fp->fs, FR_DISK_ERR);
+				res = data_io(fp, fp->buf, fp->dsect, 1, 1);
+				if (res != FR_OK) ABORT(fp->fs, res);
 				fp->flag &= ~FA__DIRTY;
 			}
 #endif
@@ -2533,11 +3893,25 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fp->fs);			/* When remaining bytes >= sector size, */
 			if (cc) {						/* Write maximum contiguous sectors directly */
-				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
-					cc = fp->fs->csize - csect;
-				if (disk_write(fp->fs->drv, wbuff, sect, (BYTE)cc) != RES_OK)
-					ABORT(fp->fs, FR_DISK_ERR);
+				if (csect + cc > fp->fs->csize) {	/* Clip at cluster boundary */
+#if _USE_EXPAND
+					if (fp->clust < fp->ecl) {	/* Or at the end of contiguous block */
+						clst = (fp->ecl - fp->clust + 1) * fp->fs->csize - csect;
+						if (cc > clst) cc = clst;
+						if (cc > 255) cc = 255;
+					} else
+#endif
+						cc = fp->fs->csize - csect;
+				}
+				res = data_io(fp, (BYTE*)wbuff, sect, (BYTE)cc, 1);
+				if (res != FR_OK) ABORT(fp->fs, res);
+#if _USE_EXPAND
+				fp->clust += (csect + cc - 1) / fp->fs->csize;	/* Cluster of the last sector written */
+#endif
 #if _FS_TINY
+#if _FS_CACHE_WAYS
+				cache_inval(fp->fs, sect, cc);
+#endif
 				if (fp->fs->winsect - sect < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
 					mem_cpy(fp->fs->win, wbuff + ((fp->fs->winsect - sect) * SS(fp->fs)), SS(fp->fs));
 					fp->fs->wflag = 0;
@@ -2557,10 +3931,9 @@ FRESULT f_write (
 				fp->fs->winsect = sect;
 			}
 #else
-			if (fp->dsect != sect) {		/* Fill sector cache with file data */
-				if (fp->fptr < fp->fsize &&
-					disk_read(fp->fs->drv, fp->buf, sect, 1) != RES_OK)
-						ABORT(fp->fs, FR_DISK_ERR);
+			if (fp->dsect != sect && fp->fptr < fp->fsize) {	/* Fill sector cache with file data */
+				res = data_io(fp, fp->buf, sect, 1, 0);
+				if (res != FR_OK) ABORT(fp->fs, res);
 			}
 #endif
 			fp->dsect = sect;
@@ -2621,6 +3994,10 @@ FRESULT f_sync (
 				ST_DWORD(dir+DIR_WrtTime, tim);
 				fp->flag &= ~FA__WRITTEN;
 				fp->fs->wflag = 1;
+#if _FS_JOURNAL > 1
+				if (fp->fs->jsect && ++fp->fs->jsync < _FS_JOURNAL)	/* Defer the commit */
+					LEAVE_FF(fp->fs, FR_OK);
+#endif
 				res = sync(fp->fs);
 			}
 		}
@@ -2647,11 +4024,39 @@ FRESULT f_close (
 #if _FS_READONLY
 	FATFS *fs = fp->fs;
 	res = validate(fs, fp->id);
-	if (res == FR_OK) fp->fs = 0;	/* Discard file object */
+	if (res == FR_OK) {
+#if _FS_AUTOMAP
+		amap_free(fp);				/* Return the link map to the pool */
+#endif
+		fp->fs = 0;					/* Discard file object */
+	}
 	LEAVE_FF(fs, res);
 
 #else
+#if _USE_EXPAND
+	if (fp->ecl) {			/* Release unused part of the contiguous block */
+		res = validate(fp->fs, fp->id);
+		if (res == FR_OK) {
+			res = trim_block(fp);
+#if _FS_REENTRANT
+			unlock_fs(fp->fs, FR_OK);
+#endif
+		}
+		if (res != FR_OK) return res;
+	}
+#endif
 	res = f_sync(fp);		/* Flush cached data */
+#if _FS_JOURNAL > 1
+	if (res == FR_OK && fp->fs->jsect && fp->fs->jsync) {	/* Commit the deferred syncs */
+		res = validate(fp->fs, fp->id);
+		if (res == FR_OK) {
+			if (fp->fs->jsect && fp->fs->jsync) res = sync(fp->fs);
+#if _FS_REENTRANT
+			unlock_fs(fp->fs, FR_OK);
+#endif
+		}
+	}
+#endif
 #if _FS_SHARE
 	if (res == FR_OK) {		/* Decrement open counter */
 #if _FS_REENTRANT
@@ -2664,6 +4069,17 @@ FRESULT f_close (
 		res = dec_lock(fp->lockid);
 #endif
 	}
+#endif
+#if _FS_AUTOMAP
+	if (res == FR_OK && fp->amap) {	/* Return the link map to the pool */
+		res = validate(fp->fs, fp->id);
+		if (res == FR_OK) {
+			amap_free(fp);
+#if _FS_REENTRANT
+			unlock_fs(fp->fs, FR_OK);
+#endif
+		}
+	}
 #endif
 	if (res == FR_OK) fp->fs = 0;	/* Discard file object */
 	return res;
@@ -2820,6 +4236,9 @@ FRESULT f_lseek (
 		DWORD cl, pcl, ncl, tcl, dsc, tlen, ulen, *tbl;
 
 		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
+#if _FS_AUTOMAP
+			if (fp->cltbl == fp->amap) LEAVE_FF(fp->fs, FR_OK);	/* Automatic map is ready */
+#endif
 			tbl = fp->cltbl;
 			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
 			cl = fp->sclust;			/* Top of the chain */
@@ -3090,6 +4509,13 @@ FRESULT f_getfree (
 	/* Get drive number */
 	res = chk_mounted(&path, fatfs, 0);
 	if (res == FR_OK) {
+#if _USE_FREEMAP
+		/* If free cluster bitmap is attached, free_clust is exact after it has been built */
+		if ((*fatfs)->fmap) {
+			if (!(*fatfs)->fmap_stat) res = build_fmap(*fatfs);
+			*nclst = (*fatfs)->free_clust;
+		} else
+#endif
 		/* If free_clust is valid, return it without full cluster scan */
 		if ((*fatfs)->free_clust <= (*fatfs)->n_fatent - 2) {
 			*nclst = (*fatfs)->free_clust;
@@ -3136,6 +4562,37 @@ FRESULT f_getfree (
 
 
 
+#if _USE_FREEMAP
+/*-----------------------------------------------------------------------*/
+/* Attach Free Cluster Bitmap                                            */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_freemap (
+	const TCHAR *path,	/* Pointer to the logical drive number (root dir) */
+	DWORD *buff,		/* Pointer to the bitmap buffer (null:detach the bitmap) */
+	UINT len			/* Size of the buffer in unit of DWORD */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = chk_mounted(&path, &fs, 0);
+	if (res == FR_OK) {
+		if (buff && len < (fs->n_fatent + 31) / 32) {	/* Check if the buffer covers all clusters */
+			res = FR_NOT_ENOUGH_CORE;
+		} else {
+			fs->fmap = buff;	/* The bitmap is built on the first allocation or f_getfree */
+			fs->fmap_stat = 0;
+		}
+	}
+	LEAVE_FF(fs, res);
+}
+#endif /* _USE_FREEMAP */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Truncate File                                                         */
 /*-----------------------------------------------------------------------*/
@@ -3158,7 +4615,10 @@ FRESULT f_truncate (
 		}
 	}
 	if (res == FR_OK) {
-		if (fp->fsize > fp->fptr) {
+#if _USE_EXPAND
+		if (fp->ecl) res = trim_block(fp);	/* Release unused part of the contiguous block */
+#endif
+		if (res == FR_OK && fp->fsize > fp->fptr) {
 			fp->fsize = fp->fptr;	/* Set file size to current R/W point */
 			fp->flag |= FA__WRITTEN;
 			if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
@@ -3196,6 +4656,9 @@ FRESULT f_unlink (
 	DIR dj, sdj;
 	BYTE *dir;
 	DWORD dclst;
+#if _FS_JOURNAL
+	BYTE atr;
+#endif
 	DEF_NAMEBUF;
 
 
@@ -3217,6 +4680,11 @@ FRESULT f_unlink (
 					res = FR_DENIED;		/* Cannot remove R/O object */
 			}
 			dclst = LD_CLUST(dir);
+#if _FS_JOURNAL
+			atr = dir[DIR_Attr];
+			if (res == FR_OK && dj.fs->jsect && clust2sect(dj.fs, dclst) == dj.fs->jsect)
+				res = FR_DENIED;			/* Cannot remove the journal in use */
+#endif
 			if (res == FR_OK && (dir[DIR_Attr] & AM_DIR)) {	/* Is it a sub-dir? */
 				if (dclst < 2) {
 					res = FR_INT_ERR;
@@ -3241,6 +4709,10 @@ FRESULT f_unlink (
 					if (dclst)				/* Remove the cluster chain if exist */
 						res = remove_chain(dj.fs, dclst);
 					if (res == FR_OK) res = sync(dj.fs);
+#if _FS_JOURNAL
+					if (res == FR_OK && dj.fs->jsect && (atr & AM_DIR))	/* The logged sectors of the removed dir must not be replayed */
+						res = jnl_checkpoint(dj.fs);
+#endif
 				}
 			}
 		}
@@ -3307,6 +4779,12 @@ FRESULT f_mkdir (
 			if (res == FR_OK) res = dir_register(&dj);	/* Register the object to the directoy */
 			if (res != FR_OK) {
 				remove_chain(dj.fs, dcl);			/* Could not register, remove cluster chain */
+#if _FS_JOURNAL
+				if (dj.fs->jsect) {					/* The logged sectors of the new dir must not be replayed */
+					if (sync(dj.fs) != FR_OK || jnl_checkpoint(dj.fs) != FR_OK)
+						res = FR_DISK_ERR;
+				}
+#endif
 			} else {
 				dir = dj.dir;
 				dir[DIR_Attr] = AM_DIR;				/* Attribute */
@@ -3437,6 +4915,10 @@ FRESULT f_rename (
 		if (res == FR_OK) {						/* Old object is found */
 			if (!djo.dir) {						/* Is root dir? */
 				res = FR_NO_FILE;
+#if _FS_JOURNAL
+			} else if (djo.fs->jsect && clust2sect(djo.fs, LD_CLUST(djo.dir)) == djo.fs->jsect) {
+				res = FR_DENIED;				/* Cannot rename the journal in use */
+#endif
 			} else {
 				mem_cpy(buf, djo.dir+DIR_Attr, 21);		/* Save the object information except for name */
 				mem_cpy(&djn, &djo, sizeof(DIR));		/* Check new object */
@@ -3486,6 +4968,430 @@ FRESULT f_rename (
 
 
 
+#if _USE_EXPAND
+/*-----------------------------------------------------------------------*/
+/* Allocate a Contiguous Block to the File                               */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_expand (
+	FIL *fp,		/* Pointer to the file object */
+	DWORD fsz		/* Number of bytes to be allocated */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD n, clst, stcl, scl, ncl, tcl, lim;
+
+
+	res = validate(fp->fs, fp->id);		/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)			/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+	if (!(fp->flag & FA_WRITE) || fp->sclust)	/* Check access mode and if the file is empty */
+		LEAVE_FF(fp->fs, FR_DENIED);
+	fs = fp->fs;
+	if (!fsz) LEAVE_FF(fs, FR_OK);
+
+	n = (DWORD)fs->csize * SS(fs);		/* Cluster size */
+	tcl = fsz / n + ((fsz % n) ? 1 : 0);	/* Number of clusters required */
+	if (tcl > fs->n_fatent - 2) LEAVE_FF(fs, FR_DENIED);
+#if _USE_FREEMAP
+	if (fs->fmap && !fs->fmap_stat) {
+		res = build_fmap(fs);
+		if (res != FR_OK) LEAVE_FF(fs, res);
+	}
+#endif
+#if _FS_JOURNAL
+	if (fs->jsect && fs->jrel[1]) {		/* Commit the released clusters so that the block can take them */
+		res = sync(fs);
+		if (res != FR_OK) LEAVE_FF(fs, res);
+	}
+#endif
+
+	/* Find a contiguous free cluster block from the last allocated cluster */
+	stcl = fs->last_clust;
+	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+	scl = clst = stcl; ncl = 0;
+	lim = fs->n_fatent - 2 + tcl;	/* All the clusters, and a block open at stcl that continues past it */
+	for (;;) {
+#if _USE_FREEMAP
+		if (fs->fmap) {
+			n = (fs->fmap[clst / 32] >> (clst % 32)) & 1;	/* Cluster status on the bitmap (1:in use) */
+		} else
+#endif
+		{
+			n = get_fat(fs, clst);
+			if (n == 1) { res = FR_INT_ERR; break; }
+			if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+		}
+		if (n == 0) {				/* Is it a free cluster? */
+			if (++ncl == tcl) break;	/* Break if the block has been found */
+		} else {
+			scl = clst + 1; ncl = 0;	/* Not a free cluster */
+		}
+		if (++clst >= fs->n_fatent) {	/* Wrap around (the block cannot straddle it) */
+			clst = scl = 2; ncl = 0;
+		}
+		if (--lim == 0) { res = FR_DENIED; break; }	/* No contiguous block */
+	}
+
+	if (res == FR_OK) {	/* Link the block in a pass */
+		for (clst = scl, n = tcl; n > 1 && res == FR_OK; clst++, n--)
+			res = put_fat(fs, clst, clst + 1);
+		if (res == FR_OK)
+			res = put_fat(fs, clst, 0x0FFFFFFF);
+		if (res == FR_OK) {
+#if _FS_CACHE_WAYS
+			cache_inval(fs, clust2sect(fs, scl), (UINT)(tcl * fs->csize));	/* Drop stale lines of the block */
+#endif
+			fs->last_clust = clst;
+			if (fs->free_clust != 0xFFFFFFFF) {
+				fs->free_clust -= tcl;
+				fs->fsi_flag = 1;
+			}
+			fp->sclust = scl;			/* Attach the block to the file */
+			fp->ecl = clst;
+			fp->flag |= FA__WRITTEN;
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+#endif /* _USE_EXPAND */
+
+
+
+
+#if _FS_JOURNAL
+/*-----------------------------------------------------------------------*/
+/* Start or Stop Metadata Journaling                                     */
+/*-----------------------------------------------------------------------*/
+
+static
+FRESULT jnl_ctrl (	/* Initialize and start the journal or checkpoint and stop it */
+	const TCHAR *path,	/* Path name of the journal file */
+	BYTE start			/* 1:Start, 0:Stop */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = chk_mounted(&path, &fs, 1);
+	if (res == FR_OK) {
+		if (start) {
+			res = jnl_mount(fs, 1);
+			if (res == FR_OK && !fs->jsect) res = FR_INT_ERR;
+		} else if (fs->jsect) {
+			res = sync(fs);			/* Commit and write all the changes home */
+			if (res == FR_OK) res = jnl_checkpoint(fs);
+			if (res == FR_OK) fs->jsect = 0;
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+
+
+FRESULT f_journal (
+	BYTE vol,		/* Logical drive number */
+	DWORD nsect		/* Size of the journal in sectors (0:Stop journaling and remove the journal) */
+)
+{
+	FRESULT res, res2;
+	FIL fil;
+	TCHAR path[16], *p = path;
+	const char *s = "/JOURNAL.SYS";
+	DWORD n;
+
+
+	if (vol >= _VOLUMES) return FR_INVALID_DRIVE;
+#if _VOLUMES > 1
+	*p++ = (TCHAR)'0' + vol; *p++ = ':';
+#endif
+	do *p++ = (TCHAR)*s; while (*s++);
+
+	if (!nsect) {	/* Write all the changes home and remove the journal */
+		res = jnl_ctrl(path, 0);
+		if (res == FR_OK) res = f_unlink(path);
+		return res;
+	}
+
+	if (nsect < 2 + CACHE_LINES) return FR_INVALID_PARAMETER;
+	res = f_open(&fil, path, FA_CREATE_NEW | FA_WRITE);	/* Create the journal file in a contiguous block */
+	if (res != FR_OK) return res;
+	n = nsect * SS(fil.fs);
+	res = f_expand(&fil, n);
+	if (res == FR_OK) res = f_lseek(&fil, n);
+	if (res == FR_OK && fil.fsize != n) res = FR_DENIED;
+	res2 = f_close(&fil);
+	if (res == FR_OK) res = res2;
+	if (res == FR_OK) res = f_chmod(path, AM_SYS | AM_HID, AM_SYS | AM_HID);
+	if (res == FR_OK) res = jnl_ctrl(path, 1);
+	if (res != FR_OK) f_unlink(path);
+
+	return res;
+}
+#endif /* _FS_JOURNAL */
+
+
+
+
+#if _USE_STREAM
+/*-----------------------------------------------------------------------*/
+/* Streaming Read - Follow the cluster chain at the read-ahead point     */
+/*-----------------------------------------------------------------------*/
+
+static
+DWORD stream_clust (	/* 0xFFFFFFFF:Disk error, 1:Internal error, Else:Next cluster# */
+	FSTREAM *st		/* Pointer to the stream object */
+)
+{
+#if _USE_FASTSEEK
+	if (st->fp->cltbl) return clmt_clust(st->fp, st->rofs);	/* Get cluster# from the CLMT */
+#endif
+	return get_fat(st->fp->fs, st->rclust);	/* Follow cluster chain on the FAT */
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Streaming Read - Complete the read in progress and start the next one */
+/*-----------------------------------------------------------------------*/
+
+static
+FRESULT stream_pump (
+	FSTREAM *st		/* Pointer to the stream object */
+)
+{
+	FIL *fp = st->fp;
+	FATFS *fs = fp->fs;
+	DWORD sect, clst, eofs;
+	UINT cnt;
+	DRESULT dr;
+
+
+	if (st->busy) {				/* Is a read in progress? */
+		dr = disk_read_poll(fs->drv);
+		if (dr == RES_BUSY) return FR_OK;
+		st->busy = 0;
+		if (dr != RES_OK) return FR_DISK_ERR;
+		if (++st->wr == st->nslot) st->wr = 0;
+		st->nrdy++;
+	}
+	if (st->rofs >= fp->fsize || st->nrdy + st->nheld >= st->nslot)	/* End of file or no free slot */
+		return FR_OK;
+
+	sect = clust2sect(fs, st->rclust);	/* Sector at the read-ahead point */
+	if (!sect) return FR_INT_ERR;
+	sect += st->rofs / SS(fs) & (fs->csize - 1);
+	eofs = (st->rofs / st->ssize + 1) * st->ssize;	/* Read up to the slot boundary */
+	if (eofs > fp->fsize) eofs = fp->fsize;
+	cnt = (UINT)((eofs - st->rofs + SS(fs) - 1) / SS(fs));
+	st->rofs = eofs;
+	if (eofs % ((DWORD)fs->csize * SS(fs)) == 0 && eofs < fp->fsize) {	/* Crossing the cluster boundary? */
+		clst = stream_clust(st);		/* Look up the next cluster before the drive gets busy */
+		if (clst < 2) return FR_INT_ERR;
+		if (clst == 0xFFFFFFFF) return FR_DISK_ERR;
+		st->rclust = clst;
+	}
+	if (disk_read_start(fs->drv, st->buf + (UINT)st->wr * st->ssize, sect, (BYTE)cnt) != RES_OK)
+		return FR_DISK_ERR;
+	st->busy = 1;
+
+	return FR_OK;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start Streaming Read of a File                                        */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_sopen (
+	FSTREAM *st,	/* Pointer to the blank stream object */
+	FIL *fp,		/* Pointer to the file object to be streamed from its file pointer */
+	void *buff,		/* Pointer to the ring buffer of nslot * ssize bytes */
+	UINT ssize,		/* Bytes per slot (sector size * 2^n, clipped at the cluster size) */
+	UINT nslot		/* Number of slots (2..255) */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD clst;
+
+
+	st->fp = fp;						/* The stream can be closed even if failed to start */
+	st->busy = 0;
+	st->dofs = fp->fptr;				/* Stream from the file pointer */
+
+	res = validate(fp->fs, fp->id);		/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)			/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+	if (!(fp->flag & FA_READ))			/* Check access mode */
+		LEAVE_FF(fp->fs, FR_DENIED);
+#if !_FS_READONLY
+	if (fp->flag & FA__WRITTEN)			/* The file must have been synced */
+		LEAVE_FF(fp->fs, FR_DENIED);
+#endif
+	fs = fp->fs;
+	if (ssize > (UINT)fs->csize * SS(fs)) ssize = (UINT)fs->csize * SS(fs);
+	if (!ssize || ssize % SS(fs) || (ssize & (ssize - 1)) || nslot < 2 || nslot > 255)
+		LEAVE_FF(fs, FR_INVALID_PARAMETER);
+#if _FS_TINY && !_FS_READONLY
+	if (move_window(fs, 0) != FR_OK)	/* File data in the window must be on the disk */
+		LEAVE_FF(fs, FR_DISK_ERR);
+#if _FS_CACHE_WAYS
+	if (cache_flush(fs) != FR_OK)
+		LEAVE_FF(fs, FR_DISK_ERR);
+#endif
+#endif
+
+	st->buf = (BYTE*)buff;
+	st->ssize = ssize;
+	st->nslot = (BYTE)nslot;
+	st->wr = st->rd = st->nrdy = st->nheld = 0;
+	st->rofs = fp->fptr / SS(fs) * SS(fs);	/* Read-ahead from the top of the sector */
+	st->rclust = fp->clust;
+	if (st->rofs < fp->fsize) {				/* Cluster at the read-ahead point */
+		if (st->rofs == 0) {
+			clst = fp->sclust;
+		} else if (fp->fptr % ((DWORD)fs->csize * SS(fs)) == 0) {	/* fp->clust is the previous cluster */
+			clst = stream_clust(st);
+			if (clst == 0xFFFFFFFF) LEAVE_FF(fs, FR_DISK_ERR);
+		} else {
+			clst = fp->clust;
+		}
+		if (clst < 2) LEAVE_FF(fs, FR_INT_ERR);
+		st->rclust = clst;
+	}
+	res = stream_pump(st);				/* Start read-ahead */
+
+	LEAVE_FF(fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Get the Next Block of the Stream                                      */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_sget (
+	FSTREAM *st,		/* Pointer to the stream object */
+	const BYTE **buff,	/* Pointer to the variable to return the block (in the ring buffer) */
+	UINT *len			/* Pointer to the variable to return length of the block (0:end of file) */
+)
+{
+	FRESULT res;
+	FIL *fp = st->fp;
+	DWORD eofs;
+
+
+	*len = 0;
+	res = validate(fp->fs, fp->id);		/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (st->dofs >= fp->fsize)			/* End of file */
+		LEAVE_FF(fp->fs, FR_OK);
+	if (!st->nrdy && st->nheld == st->nslot)	/* All slots are held by the consumer */
+		LEAVE_FF(fp->fs, FR_DENIED);
+
+	while (!st->nrdy) {					/* Wait for the slot to be filled */
+		res = stream_pump(st);
+		if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	}
+	*buff = st->buf + (UINT)st->rd * st->ssize + st->dofs % SS(fp->fs);	/* Hand out the slot */
+	eofs = (st->dofs / st->ssize + 1) * st->ssize;
+	if (eofs > fp->fsize) eofs = fp->fsize;
+	*len = (UINT)(eofs - st->dofs);
+	st->dofs = eofs;
+	if (++st->rd == st->nslot) st->rd = 0;
+	st->nrdy--; st->nheld++;
+	res = stream_pump(st);
+
+	LEAVE_FF(fp->fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Release the Oldest Block Handed Out                                   */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_sfree (
+	FSTREAM *st		/* Pointer to the stream object */
+)
+{
+	FRESULT res;
+
+
+	res = validate(st->fp->fs, st->fp->id);	/* Check validity of the object */
+	if (res == FR_OK) {
+		if (!st->nheld) {
+			res = FR_INT_ERR;
+		} else {
+			st->nheld--;
+			res = stream_pump(st);		/* Refill the slot */
+		}
+	}
+	LEAVE_FF(st->fp->fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Advance Read-ahead of the Stream (call it while waiting for others)   */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_spoll (
+	FSTREAM *st		/* Pointer to the stream object */
+)
+{
+	FRESULT res;
+
+
+	res = validate(st->fp->fs, st->fp->id);	/* Check validity of the object */
+	if (res == FR_OK) res = stream_pump(st);
+	LEAVE_FF(st->fp->fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Stop Streaming Read                                                   */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_sclose (
+	FSTREAM *st		/* Pointer to the stream object */
+)
+{
+	FRESULT res;
+
+
+	res = validate(st->fp->fs, st->fp->id);	/* Check validity of the object */
+	if (res == FR_OK) {
+		if (st->busy) {			/* Wait for the read in progress */
+			while (disk_read_poll(st->fp->fs->drv) == RES_BUSY) ;
+			st->busy = 0;
+		}
+#if _FS_REENTRANT
+		unlock_fs(st->fp->fs, FR_OK);
+#endif
+		res = f_lseek(st->fp, st->dofs);	/* Move the file pointer to the end of data handed out */
+	}
+	return res;
+}
+#endif /* _USE_STREAM */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Forward data to the stream directly (available on only tiny cfg)      */
 /*-----------------------------------------------------------------------*/
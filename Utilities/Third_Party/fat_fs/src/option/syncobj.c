@@ -5,6 +5,8 @@
 
 #include <windows.h>	// Win32
 //#include <ucos_ii.h>	// uC/OS-II
+//#include "FreeRTOS.h"	// FreeRTOS
+//#include "semphr.h"	//
 
 #include "../ff.h"
 
@@ -16,6 +18,8 @@
 /* This function is called in f_mount function to create a new
 /  synchronization object, such as semaphore and mutex. When a FALSE is
 /  returned, the f_mount function fails with FR_INT_ERR.
+/  With _FS_REENTRANT == 2, it is called twice per volume; one object for
+/  the file system object and one for the physical drive.
 */
 
 BOOL ff_cre_syncobj (	/* TRUE:Function succeeded, FALSE:Could not create due to any error */
@@ -34,6 +38,9 @@ BOOL ff_cre_syncobj (	/* TRUE:Function succeeded, FALSE:Could not create due to
 //	*sobj = OSMutexCreate(0, &err);				// uC/OS-II
 //	ret = (err == OS_NO_ERR) ? TRUE : FALSE;	//
 
+//	*sobj = xSemaphoreCreateMutex();			// FreeRTOS
+//	ret = (*sobj != NULL) ? TRUE : FALSE;		//
+
 	return ret;
 }
 
@@ -60,6 +67,9 @@ BOOL ff_del_syncobj (	/* TRUE:Function succeeded, FALSE:Could not delete due to
 //	OSMutexDel(sobj, OS_DEL_ALWAYS, &err);		// uC/OS-II
 //	ret = (err == OS_NO_ERR) ? TRUE : FALSE;	//
 
+//	vSemaphoreDelete(sobj);		// FreeRTOS
+//	ret = TRUE;					//
+
 	return ret;
 }
 
@@ -85,6 +95,8 @@ BOOL ff_req_grant (	/* TRUE:Got a grant to access the volume, FALSE:Could not ge
 //	OSMutexPend(sobj, _FS_TIMEOUT, &err));				// uC/OS-II
 //	ret = (err == OS_NO_ERR) ? TRUE : FALSE;		//
 
+//	ret = (xSemaphoreTake(sobj, _FS_TIMEOUT) == pdTRUE) ? TRUE : FALSE;	// FreeRTOS
+
 	return ret;
 }
 
@@ -105,6 +117,8 @@ void ff_rel_grant (
 //	sig_sem(sobj);		// uITRON
 
 //	OSMutexPost(sobj);	// uC/OS-II
+
+//	xSemaphoreGive(sobj);	// FreeRTOS
 }
 
 